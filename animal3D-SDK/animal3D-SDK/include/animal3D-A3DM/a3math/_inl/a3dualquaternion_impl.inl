@@ -0,0 +1,522 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3dualquaternion_impl.inl
+	Implementations for dual quaternion functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_DUALQUATERNION_H
+#ifndef __ANIMAL3D_A3DM_DUALQUATERNION_IMPL_INL
+#define __ANIMAL3D_A3DM_DUALQUATERNION_IMPL_INL
+
+
+#include "../a3quaternion.h"
+#include "a3intrin_impl.inl"
+
+
+A3_BEGIN_IMPL
+
+
+// preset constants
+A3DM_GLOBAL const a3dualquat a3dualquat_identity = { { a3real_zero, a3real_zero, a3real_zero, a3real_one, a3real_zero, a3real_zero, a3real_zero, a3real_zero } };
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real4x2r a3dualquatSetIdentity(a3real4x2p Q_out)
+{
+	return a3dualquatCopy(Q_out, a3dualquat_identity.Q);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSet(a3real4x2p Q_out, const a3real4 rotateScaleQuat, const a3real4 dualPartQuat)
+{
+	a3real4SetReal4(Q_out[0], rotateScaleQuat);
+	a3real4SetReal4(Q_out[1], dualPartQuat);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSetAxisAngle(a3real4x2p Q_out, const a3real3p unitAxis, const a3real degrees)
+{
+	a3quatSetAxisAngle(Q_out[0], unitAxis, degrees);
+	a3real4SetReal4(Q_out[1], a3dualquat_identity.d.q);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSetAxisAngleTranslate(a3real4x2p Q_out, const a3real3p unitAxis, const a3real degrees, const a3real3p translate)
+{
+	a3quatSetAxisAngle(Q_out[0], unitAxis, degrees);
+	a3dualquatCalculateDualPart(Q_out[1], Q_out[0], translate);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSetEuler(a3real4x2p Q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3boolean eulerIsXYZ)
+{
+	if (eulerIsXYZ)
+		a3quatSetEulerXYZ(Q_out[0], degrees_x, degrees_y, degrees_z);
+	else
+		a3quatSetEulerZYX(Q_out[0], degrees_x, degrees_y, degrees_z);
+	a3real4SetReal4(Q_out[1], a3dualquat_identity.d.q);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSetEulerTranslate(a3real4x2p Q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3boolean eulerIsXYZ, const a3real3p translate)
+{
+	a3dualquatSetEuler(Q_out, degrees_x, degrees_y, degrees_z, eulerIsXYZ);
+	a3dualquatCalculateDualPart(Q_out[1], Q_out[0], translate);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSetTranslate(a3real4x2p Q_out, const a3real3p translate)
+{
+	// real part is identity, so the dual part is just half the translation
+	a3real4SetReal4(Q_out[0], a3dualquat_identity.r.q);
+	a3real4Set(Q_out[1], a3real_half * translate[0], a3real_half * translate[1], a3real_half * translate[2], a3real_zero);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatCopy(a3real4x2p Q_out, const a3real4x2p Q)
+{
+	a3real4SetReal4(Q_out[0], Q[0]);
+	a3real4SetReal4(Q_out[1], Q[1]);
+	return Q_out;
+}
+
+
+A3DM_INLINE a3real4x2r a3dualquatGetConjugated(a3real4x2p Q_out, const a3real4x2p Q)
+{
+	a3quatGetConjugated(Q_out[0], Q[0]);
+	a3quatGetConjugated(Q_out[1], Q[1]);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatGetInverseIgnoreScale(a3real4x2p Q_out, const a3real4x2p Q)
+{
+	return a3dualquatGetConjugated(Q_out, Q);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatConjugate(a3real4x2p Q_inout)
+{
+	return a3dualquatGetConjugated(Q_inout, Q_inout);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatInvertIgnoreScale(a3real4x2p Q_inout)
+{
+	return a3dualquatGetConjugated(Q_inout, Q_inout);
+}
+
+
+A3DM_INLINE a3real4x2rk a3dualquatGetAxisAngleIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real *degrees_out)
+{
+	a3quatGetAxisAngleIgnoreScale(Q[0], unitAxis_out, degrees_out);
+	return Q;
+}
+
+A3DM_INLINE a3real4x2rk a3dualquatGetAxisAngleTranslateIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real *degrees_out, a3real3p translate_out)
+{
+	a3quatGetAxisAngleIgnoreScale(Q[0], unitAxis_out, degrees_out);
+	if (translate_out)
+		a3dualquatCalculateTranslateIgnoreScale(translate_out, Q[0], Q[1]);
+	return Q;
+}
+
+
+// the norm of a dual quaternion is dual-valued; its real part is the length 
+//	of the real quaternion, which is what these report
+A3DM_INLINE a3real a3dualquatLengthSquared(const a3real4x2p Q)
+{
+	return a3real4LengthSquared(Q[0]);
+}
+
+A3DM_INLINE a3real a3dualquatLengthSquaredInverse(const a3real4x2p Q)
+{
+	return a3real4LengthSquaredInverse(Q[0]);
+}
+
+A3DM_INLINE a3real a3dualquatLength(const a3real4x2p Q)
+{
+	return a3real4Length(Q[0]);
+}
+
+A3DM_INLINE a3real a3dualquatLengthInverse(const a3real4x2p Q)
+{
+	return a3real4LengthInverse(Q[0]);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatGetUnit(a3real4x2p Q_out, const a3real4x2p Q)
+{
+	return a3dualquatGetUnitInvLength(Q_out, Q, 0);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatGetUnitInvLength(a3real4x2p Q_out, const a3real4x2p Q, a3real *invLength_out)
+{
+	const a3real invLength = a3real4LengthInverse(Q[0]);
+	if (invLength_out)
+		*invLength_out = invLength;
+	a3real4ProductS(Q_out[0], Q[0], invLength);
+	a3real4ProductS(Q_out[1], Q[1], invLength);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatNormalize(a3real4x2p Q_inout)
+{
+	return a3dualquatGetUnitInvLength(Q_inout, Q_inout, 0);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatNormalizeGetInvLength(a3real4x2p Q_inout, a3real *invLength_out)
+{
+	return a3dualquatGetUnitInvLength(Q_inout, Q_inout, invLength_out);
+}
+
+
+A3DM_INLINE a3real4x4r a3dualquatConvertToMat4IgnoreScale(a3real4x4p m_out, const a3real4x2 Q)
+{
+	a3quatConvertToMat4(m_out, Q[0]);
+	a3dualquatCalculateTranslateIgnoreScale(m_out[3], Q[0], Q[1]);
+	return m_out;
+}
+
+
+A3DM_INLINE a3real4x2r a3dualquatSum(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2p QR)
+{
+	a3real4Sum(Q_out[0], QL[0], QR[0]);
+	a3real4Sum(Q_out[1], QL[1], QR[1]);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatDiff(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2p QR)
+{
+	a3real4Diff(Q_out[0], QL[0], QR[0]);
+	a3real4Diff(Q_out[1], QL[1], QR[1]);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatProductS(a3real4x2p Q_out, const a3real4x2p Q, const a3real s)
+{
+	a3real4ProductS(Q_out[0], Q[0], s);
+	a3real4ProductS(Q_out[1], Q[1], s);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatQuotientS(a3real4x2p Q_out, const a3real4x2p Q, const a3real s)
+{
+	return a3dualquatProductS(Q_out, Q, a3recip(s));
+}
+
+A3DM_INLINE a3real4x2r a3dualquatAdd(a3real4x2p QL_inout, const a3real4x2p QR)
+{
+	return a3dualquatSum(QL_inout, QL_inout, QR);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSub(a3real4x2p QL_inout, const a3real4x2p QR)
+{
+	return a3dualquatDiff(QL_inout, QL_inout, QR);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatMulS(a3real4x2p Q_inout, const a3real s)
+{
+	return a3dualquatProductS(Q_inout, Q_inout, s);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatDivS(a3real4x2p Q_inout, const a3real s)
+{
+	return a3dualquatProductS(Q_inout, Q_inout, a3recip(s));
+}
+
+
+A3DM_INLINE a3real4x2r a3dualquatProduct(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2 QR)
+{
+	// (rL + e dL)(rR + e dR) = rL rR + e (rL dR + dL rR); temporaries allow 
+	//	the output to alias either input
+	a3real4 r, d, tmp;
+	a3quatProduct(r, QL[0], QR[0]);
+	a3quatProduct(d, QL[0], QR[1]);
+	a3quatProduct(tmp, QL[1], QR[0]);
+	a3real4SetReal4(Q_out[0], r);
+	a3real4Sum(Q_out[1], d, tmp);
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatConcatL(a3real4x2p QL_inout, const a3real4x2 QR)
+{
+	return a3dualquatProduct(QL_inout, QL_inout, QR);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatConcatR(const a3real4x2p QL, a3real4x2 QR_inout)
+{
+	return a3dualquatProduct(QR_inout, QL, QR_inout);
+}
+
+
+A3DM_INLINE a3real3r a3dualquatVec3GetTransformedIgnoreScale(a3real3p v_out, const a3real3p v, const a3real4x2p Q)
+{
+	// rotate, then add decoded translation
+	a3real3 t;
+	a3dualquatCalculateTranslateIgnoreScale(t, Q[0], Q[1]);
+	a3quatVec3GetRotatedIgnoreScale(v_out, v, Q[0]);
+	return a3real3Add(v_out, t);
+}
+
+A3DM_INLINE a3real3r a3dualquatVec3TransformIgnoreScale(a3real3p v_inout, const a3real4x2p Q)
+{
+	return a3dualquatVec3GetTransformedIgnoreScale(v_inout, v_inout, Q);
+}
+
+
+A3DM_INLINE a3real4x2r a3dualquatSclerpUnit(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1, const a3real param)
+{
+	// Q0 (Q0* Q1)^t: raise the delta to a power by scaling its screw angle 
+	//	and distance, taking the short way around
+	a3dualquat delta, step;
+	a3real3 axis, moment, translate;
+	a3real degrees, distance, halfAngle, s, c;
+	a3dualquatGetConjugated(delta.Q, Q0);
+	a3dualquatConcatL(delta.Q, Q1);
+	if (delta.rw < a3real_zero)
+		a3dualquatMulS(delta.Q, -a3real_one);
+
+	a3dualquatCalculateScrewParamsIgnoreScale(delta.Q, axis, moment, translate, &degrees, &distance);
+	if (a3real3LengthSquared(delta.r.q) > a3real_zero)
+	{
+		halfAngle = a3real_half * degrees * param;
+		distance *= param;
+		s = a3sind(halfAngle);
+		c = a3cosd(halfAngle);
+		a3real4Set(step.r.q, s * axis[0], s * axis[1], s * axis[2], c);
+		a3real4Set(step.d.q,
+			a3real_half * distance * c * axis[0] + s * moment[0],
+			a3real_half * distance * c * axis[1] + s * moment[1],
+			a3real_half * distance * c * axis[2] + s * moment[2],
+			-a3real_half * distance * s);
+	}
+	else
+	{
+		a3real4SetReal4(step.r.q, a3dualquat_identity.r.q);
+		a3real4ProductS(step.d.q, delta.d.q, param);
+	}
+	return a3dualquatProduct(Q_out, Q0, step.Q);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSclerpUnitIdentityQ0(a3real4x2p Q_out, const a3real4x2p Q1, const a3real param)
+{
+	return a3dualquatSclerpUnit(Q_out, a3dualquat_identity.Q, Q1, param);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatSclerpUnitIdentityQ1(a3real4x2p Q_out, const a3real4x2p Q0, const a3real param)
+{
+	return a3dualquatSclerpUnit(Q_out, Q0, a3dualquat_identity.Q, param);
+}
+
+
+A3DM_INLINE a3real4x2r a3dualquatDLB2(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1)
+{
+	a3dualquatSum(Q_out, Q0, Q1);
+	return a3dualquatNormalize(Q_out);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatDLB4(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1, const a3real4x2p Q2, const a3real4x2p Q3)
+{
+	a3dualquat tmp;
+	a3dualquatSum(tmp.Q, Q2, Q3);
+	a3dualquatSum(Q_out, Q0, Q1);
+	a3dualquatAdd(Q_out, tmp.Q);
+	return a3dualquatNormalize(Q_out);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatDLB(a3real4x2p Q_out, const a3real4x2 Q[], const a3count count)
+{
+	a3index i;
+	a3dualquatCopy(Q_out, a3dualquat_identity.Q);
+	if (count)
+	{
+		a3dualquatCopy(Q_out, Q[0]);
+		for (i = 1; i < count; ++i)
+			a3dualquatAdd(Q_out, Q[i]);
+		a3dualquatNormalize(Q_out);
+	}
+	return Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatDLBParam(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1, const a3real param)
+{
+	const a3real w0 = a3real_one - param, w1 = a3real4Dot(Q0[0], Q1[0]) < a3real_zero ? -param : param;
+	a3real4x2 tmp;
+	a3real4ProductS(tmp[0], Q1[0], w1);
+	a3real4ProductS(tmp[1], Q1[1], w1);
+	a3real4Add(a3real4ProductS(Q_out[0], Q0[0], w0), tmp[0]);
+	a3real4Add(a3real4ProductS(Q_out[1], Q0[1], w0), tmp[1]);
+	return a3dualquatNormalize(Q_out);
+}
+
+
+A3DM_INLINE a3real4r a3dualquatCalculateDualPart(a3real4p d_out, const a3real4p r, const a3real3p translate)
+{
+	// d = 1/2 t r, with t pure
+	a3quatProductPureL(d_out, translate, r);
+	return a3real4MulS(d_out, a3real_half);
+}
+
+A3DM_INLINE a3real3r a3dualquatCalculateTranslateIgnoreScale(a3real3p translate_out, const a3real4p r, const a3real4p d)
+{
+	// t = 2 d r*, vector part only
+	a3real4 rc, t;
+	a3quatGetConjugated(rc, r);
+	a3quatProduct(t, d, rc);
+	return a3real3ProductS(translate_out, t, a3real_two);
+}
+
+A3DM_INLINE a3real4x2rk a3dualquatCalculateScrewParamsIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real3p moment_out, a3real3p translate_out, a3real *degrees_out, a3real *distance_out)
+{
+	// r = (sin(a/2) l, cos(a/2)), d = (d/2 cos(a/2) l + sin(a/2) m, -d/2 sin(a/2))
+	// pure translation has no rotation axis; slide along the translation
+	const a3real s = a3real3Length(Q[0]);
+	a3real3 l, m, t;
+	a3real degrees, distance;
+	a3dualquatCalculateTranslateIgnoreScale(t, Q[0], Q[1]);
+	if (s > a3real_epsilon)
+	{
+		const a3real sInv = a3recip(s);
+		a3real3ProductS(l, Q[0], sInv);
+		degrees = a3real_two * a3atan2d(s, Q[0][3]);
+		distance = -a3real_two * Q[1][3] * sInv;
+		a3real3ProductS(m, l, a3real_half * distance * Q[0][3]);
+		a3real3Diff(m, Q[1], m);
+		a3real3MulS(m, sInv);
+	}
+	else
+	{
+		distance = a3real3Length(t);
+		if (distance > a3real_zero)
+			a3real3ProductS(l, t, a3recip(distance));
+		else
+			a3real3SetReal3(l, a3vec3_x.v);
+		degrees = a3real_zero;
+		a3real3Set(m, a3real_zero, a3real_zero, a3real_zero);
+	}
+	if (unitAxis_out)
+		a3real3SetReal3(unitAxis_out, l);
+	if (moment_out)
+		a3real3SetReal3(moment_out, m);
+	if (translate_out)
+		a3real3SetReal3(translate_out, t);
+	if (degrees_out)
+		*degrees_out = degrees;
+	if (distance_out)
+		*distance_out = distance;
+	return Q;
+}
+
+
+//-----------------------------------------------------------------------------
+
+#ifdef A3_USING_INTRIN
+// internal: transpose one lane group of dual quaternions to or from lanes, 
+//	r[j] and d[j] holding component j of each real and dual part
+A3DM_INLINE void a3dualquatInternalLoadLanes(a3intrinLanes r_out[4], a3intrinLanes d_out[4], const a3real4x2 Q[])
+{
+#ifdef A3_INTRIN_AVX
+	a3intrinGather8(r_out, Q[0][0], Q[1][0], Q[2][0], Q[3][0], Q[4][0], Q[5][0], Q[6][0], Q[7][0]);
+	a3intrinGather8(d_out, Q[0][1], Q[1][1], Q[2][1], Q[3][1], Q[4][1], Q[5][1], Q[6][1], Q[7][1]);
+#else	// !A3_INTRIN_AVX
+	a3intrinGather4(r_out, Q[0][0], Q[1][0], Q[2][0], Q[3][0]);
+	a3intrinGather4(d_out, Q[0][1], Q[1][1], Q[2][1], Q[3][1]);
+#endif	// A3_INTRIN_AVX
+}
+
+A3DM_INLINE void a3dualquatInternalStoreLanes(a3real4x2 Q_out[], const a3intrinLanes r[4], const a3intrinLanes d[4])
+{
+#ifdef A3_INTRIN_AVX
+	a3intrinScatter8(Q_out[0][0], Q_out[1][0], Q_out[2][0], Q_out[3][0], Q_out[4][0], Q_out[5][0], Q_out[6][0], Q_out[7][0], r);
+	a3intrinScatter8(Q_out[0][1], Q_out[1][1], Q_out[2][1], Q_out[3][1], Q_out[4][1], Q_out[5][1], Q_out[6][1], Q_out[7][1], d);
+#else	// !A3_INTRIN_AVX
+	a3intrinScatter4(Q_out[0][0], Q_out[1][0], Q_out[2][0], Q_out[3][0], r);
+	a3intrinScatter4(Q_out[0][1], Q_out[1][1], Q_out[2][1], Q_out[3][1], d);
+#endif	// A3_INTRIN_AVX
+}
+
+// internal: weighted DLB of one lane group; same steps as a3dualquatDLBParam
+A3DM_INLINE void a3dualquatInternalDLBLanes(a3intrinLanes r_inout[4], a3intrinLanes d_inout[4], const a3intrinLanes r1[4], const a3intrinLanes d1[4], const a3intrinLanes t)
+{
+	const a3intrinLanes w0 = a3intrinLanesSub(a3intrinLanesSet1(1.0f), t);
+	a3intrinLanes w1, lenInv;
+	a3index j;
+	w1 = a3intrinLanesMul(r_inout[0], r1[0]);
+	w1 = a3intrinLanesMulAdd(r_inout[1], r1[1], w1);
+	w1 = a3intrinLanesMulAdd(r_inout[2], r1[2], w1);
+	w1 = a3intrinLanesMulAdd(r_inout[3], r1[3], w1);
+	w1 = a3intrinLanesXor(t, a3intrinLanesAnd(w1, a3intrinLanesSet1(-0.0f)));
+	for (j = 0; j < 4; ++j)
+	{
+		r_inout[j] = a3intrinLanesMulAdd(r_inout[j], w0, a3intrinLanesMul(r1[j], w1));
+		d_inout[j] = a3intrinLanesMulAdd(d_inout[j], w0, a3intrinLanesMul(d1[j], w1));
+	}
+	lenInv = a3intrinLanesMul(r_inout[0], r_inout[0]);
+	lenInv = a3intrinLanesMulAdd(r_inout[1], r_inout[1], lenInv);
+	lenInv = a3intrinLanesMulAdd(r_inout[2], r_inout[2], lenInv);
+	lenInv = a3intrinLanesRsqrt(a3intrinLanesMulAdd(r_inout[3], r_inout[3], lenInv));
+	for (j = 0; j < 4; ++j)
+	{
+		r_inout[j] = a3intrinLanesMul(r_inout[j], lenInv);
+		d_inout[j] = a3intrinLanesMul(d_inout[j], lenInv);
+	}
+}
+#endif	// A3_USING_INTRIN
+
+// internal: array driver; uses the parameter array if provided, otherwise 
+//	the single parameter
+A3DM_INLINE a3real4x2r a3dualquatInternalDLBArray(a3real4x2 Q_out[], const a3real4x2 Q0[], const a3real4x2 Q1[], const a3real param, const a3real param_array[], const a3count count)
+{
+	a3index i = 0;
+#ifdef A3_USING_INTRIN
+	a3intrinLanes r0[4], d0[4], r1[4], d1[4], t = a3intrinLanesSet1(param);
+	for (; i + a3intrinLaneCount <= count; i += a3intrinLaneCount)
+	{
+		if (param_array)
+			t = a3intrinLanesLoad(param_array + i);
+		a3dualquatInternalLoadLanes(r0, d0, Q0 + i);
+		a3dualquatInternalLoadLanes(r1, d1, Q1 + i);
+		a3dualquatInternalDLBLanes(r0, d0, r1, d1, t);
+		a3dualquatInternalStoreLanes(Q_out + i, r0, d0);
+	}
+#endif	// A3_USING_INTRIN
+	for (; i < count; ++i)
+		a3dualquatDLBParam(Q_out[i], Q0[i], Q1[i], param_array ? param_array[i] : param);
+	return *Q_out;
+}
+
+A3DM_INLINE a3real4x2r a3dualquatDLBArray(a3real4x2 Q_out[], const a3real4x2 Q0[], const a3real4x2 Q1[], const a3real param, const a3count count)
+{
+	return a3dualquatInternalDLBArray(Q_out, Q0, Q1, param, 0, count);
+}
+
+A3DM_INLINE a3real4x2r a3dualquatDLBArrayParams(a3real4x2 Q_out[], const a3real4x2 Q0[], const a3real4x2 Q1[], const a3real param[], const a3count count)
+{
+	return a3dualquatInternalDLBArray(Q_out, Q0, Q1, a3real_zero, param, count);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_DUALQUATERNION_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_DUALQUATERNION_H
\ No newline at end of file
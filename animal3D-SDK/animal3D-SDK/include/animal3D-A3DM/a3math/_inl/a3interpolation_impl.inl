@@ -0,0 +1,389 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3interpolation_impl.inl
+	Implementations for basic interpolation algorithms.
+*/
+
+#ifdef __ANIMAL3D_A3DM_INTERPOLATION_H
+#ifndef __ANIMAL3D_A3DM_INTERPOLATION_IMPL_INL
+#define __ANIMAL3D_A3DM_INTERPOLATION_IMPL_INL
+
+
+#include "../a3sqrt.h"
+
+
+A3_BEGIN_IMPL
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real a3lerpFunc(const a3real n0, const a3real n1, const a3real param)
+{
+	return (n0 + (n1 - n0) * param);
+}
+
+A3DM_INLINE a3real a3lerpInverse(const a3real n0, const a3real n1, const a3real value)
+{
+	return ((value - n0) / (n1 - n0));
+}
+
+A3DM_INLINE a3real a3lerpSafeInverse(const a3real n0, const a3real n1, const a3real value)
+{
+	return a3divide(value - n0, n1 - n0);
+}
+
+A3DM_INLINE a3real a3remapFunc(const a3real n0_new, const a3real n1_new, const a3real n0, const a3real n1, const a3real value)
+{
+	return a3lerpFunc(n0_new, n1_new, a3lerpInverse(n0, n1, value));
+}
+
+A3DM_INLINE a3real a3remapSafe(const a3real n0_new, const a3real n1_new, const a3real n0, const a3real n1, const a3real value)
+{
+	return a3lerpFunc(n0_new, n1_new, a3lerpSafeInverse(n0, n1, value));
+}
+
+
+A3DM_INLINE a3real a3bilerp(const a3real n00, const a3real n01, const a3real n10, const a3real n11, const a3real param0, const a3real param1)
+{
+	return a3lerpFunc(a3lerpFunc(n00, n01, param0), a3lerpFunc(n10, n11, param0), param1);
+}
+
+A3DM_INLINE a3real a3trilerp(const a3real n000, const a3real n001, const a3real n010, const a3real n011, const a3real n100, const a3real n101, const a3real n110, const a3real n111, const a3real param0, const a3real param1, const a3real param2)
+{
+	return a3lerpFunc(a3bilerp(n000, n001, n010, n011, param0, param1), a3bilerp(n100, n101, n110, n111, param0, param1), param2);
+}
+
+
+A3DM_INLINE a3real a3CatmullRom(const a3real nPrev, const a3real n0, const a3real n1, const a3real nNext, const a3real param)
+{
+	// polynomial form of the uniform Catmull-Rom matrix, Horner in t
+	const a3real c1 = n1 - nPrev;
+	const a3real c2 = nPrev + nPrev - n0 * a3real_five + n1 * a3real_four - nNext;
+	const a3real c3 = (n0 - n1) * a3real_three - nPrev + nNext;
+	return (n0 + a3real_half * param * (c1 + param * (c2 + param * c3)));
+}
+
+A3DM_INLINE a3real a3HermiteControl(const a3real n0, const a3real n1, const a3real nControl0, const a3real nControl1, const a3real param)
+{
+	// handles are values; tangents are the offsets from their points
+	return a3HermiteTangent(n0, n1, nControl0 - n0, nControl1 - n1, param);
+}
+
+A3DM_INLINE a3real a3HermiteTangent(const a3real n0, const a3real n1, const a3real nTangent0, const a3real nTangent1, const a3real param)
+{
+	// polynomial form of the cubic Hermite basis, Horner in t
+	const a3real d = n1 - n0;
+	const a3real c2 = d * a3real_three - nTangent0 - nTangent0 - nTangent1;
+	const a3real c3 = nTangent0 + nTangent1 - d - d;
+	return (n0 + param * (nTangent0 + param * (c2 + param * c3)));
+}
+
+A3DM_INLINE a3real a3Bezier0(const a3real n0, const a3real param)
+{
+	// constant curve: parameter unused
+	(void)param;
+	return n0;
+}
+
+A3DM_INLINE a3real a3Bezier1(const a3real n0, const a3real n1, const a3real param)
+{
+	return a3lerpFunc(n0, n1, param);
+}
+
+A3DM_INLINE a3real a3Bezier2(const a3real n0, const a3real n1, const a3real n2, const a3real param)
+{
+	// Bernstein form of the recursive lerp
+	const a3real t = param, s = a3real_one - t;
+	return (n0 * s * s + n1 * a3real_two * s * t + n2 * t * t);
+}
+
+A3DM_INLINE a3real a3Bezier3(const a3real n0, const a3real n1, const a3real n2, const a3real n3, const a3real param)
+{
+	const a3real t = param, s = a3real_one - t;
+	return (n0 * s * s * s + (n1 * s + n2 * t) * a3real_three * s * t + n3 * t * t * t);
+}
+
+A3DM_INLINE a3real a3BezierN(a3count order_N, const a3real n[], const a3real param)
+{
+	// Horner evaluation of the Bernstein form in O(N): the sum is factored 
+	//	by the larger of (1-t) and t so the running ratio stays in [0, 1] 
+	//	for interpolation; binomial coefficients are built incrementally
+	const a3real t = param, s = a3real_one - t;
+	const a3boolean fromEnd = (t <= a3real_half);
+	const a3real u = fromEnd ? a3divide(t, s) : a3divide(s, t);
+	a3real c = a3real_one, scale = a3real_one, result;
+	a3index i;
+	if (order_N == 0)
+		return n[0];
+	result = fromEnd ? n[order_N] : n[0];
+	for (i = 1; i <= order_N; ++i)
+	{
+		c = c * (a3real)(order_N - i + 1) / (a3real)i;
+		result = result * u + c * (fromEnd ? n[order_N - i] : n[i]);
+		scale *= fromEnd ? s : t;
+	}
+	return (result * scale);
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal: fill parameters and accumulated lengths for existing samples
+A3DM_INLINE a3real a3calculateArcLengthInternal(const a3real sampleTable[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions)
+{
+	const a3real dt = a3real_one / (a3real)numDivisions;
+	a3real total = a3real_zero, totalInv;
+	a3index i;
+	arclenTable_out[0] = a3real_zero;
+	for (i = 1; i <= numDivisions; ++i)
+		arclenTable_out[i] = total += a3absolute(sampleTable[i] - sampleTable[i - 1]);
+	if (paramTable_out)
+		for (i = 0; i <= numDivisions; ++i)
+			paramTable_out[i] = (a3real)i * dt;
+	if (autoNormalize && total > a3real_zero)
+		for (i = 1, totalInv = a3recip(total); i <= numDivisions; ++i)
+			arclenTable_out[i] *= totalInv;
+	return total;
+}
+
+A3DM_INLINE a3real a3calculateArcLengthCatmullRom(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real nPrev, const a3real n0, const a3real n1, const a3real nNext)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			sampleTable_out[i] = a3CatmullRom(nPrev, n0, n1, nNext, (a3real)i / (a3real)numDivisions);
+		return a3calculateArcLengthInternal(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3calculateArcLengthHermiteControl(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real nControl0, const a3real nControl1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			sampleTable_out[i] = a3HermiteControl(n0, n1, nControl0, nControl1, (a3real)i / (a3real)numDivisions);
+		return a3calculateArcLengthInternal(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3calculateArcLengthHermiteTangent(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real nTangent0, const a3real nTangent1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			sampleTable_out[i] = a3HermiteTangent(n0, n1, nTangent0, nTangent1, (a3real)i / (a3real)numDivisions);
+		return a3calculateArcLengthInternal(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3calculateArcLengthBezier0(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			sampleTable_out[i] = n0;
+		return a3calculateArcLengthInternal(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3calculateArcLengthBezier1(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			sampleTable_out[i] = a3Bezier1(n0, n1, (a3real)i / (a3real)numDivisions);
+		return a3calculateArcLengthInternal(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3calculateArcLengthBezier2(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real n2)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			sampleTable_out[i] = a3Bezier2(n0, n1, n2, (a3real)i / (a3real)numDivisions);
+		return a3calculateArcLengthInternal(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3calculateArcLengthBezier3(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real n2, const a3real n3)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			sampleTable_out[i] = a3Bezier3(n0, n1, n2, n3, (a3real)i / (a3real)numDivisions);
+		return a3calculateArcLengthInternal(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3calculateArcLengthBezierN(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real n[])
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			sampleTable_out[i] = a3BezierN(order_N, n, (a3real)i / (a3real)numDivisions);
+		return a3calculateArcLengthInternal(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real a3sampleTableLerpIncrement(const a3real valueTable[], const a3real paramTable[], const a3real param, a3index i)
+{
+	a3real t;
+	i = a3sampleTableLerpIncrementIndex(paramTable, param, i, &t);
+	return (i ? a3lerpFunc(valueTable[i - 1], valueTable[i], t) : valueTable[0]);
+}
+
+A3DM_INLINE a3real a3sampleTableLerpDecrement(const a3real valueTable[], const a3real paramTable[], const a3real param, a3index i)
+{
+	a3real t;
+	i = a3sampleTableLerpDecrementIndex(paramTable, param, i, &t);
+	return (i ? a3lerpFunc(valueTable[i - 1], valueTable[i], t) : valueTable[0]);
+}
+
+A3DM_INLINE a3real a3sampleTableLerpIncrementStep(const a3real valueTable[], const a3real paramTable[], const a3real param, const a3count step, a3index i)
+{
+	a3real t;
+	i = a3sampleTableLerpIncrementStepIndex(paramTable, param, step, i, &t);
+	return (i >= step ? a3lerpFunc(valueTable[i - step], valueTable[i], t) : valueTable[i]);
+}
+
+A3DM_INLINE a3real a3sampleTableLerpDecrementStep(const a3real valueTable[], const a3real paramTable[], const a3real param, const a3count step, a3index i)
+{
+	a3real t;
+	i = a3sampleTableLerpDecrementStepIndex(paramTable, param, step, i, &t);
+	return (i >= step ? a3lerpFunc(valueTable[i - step], valueTable[i], t) : valueTable[i]);
+}
+
+
+// the search stops at the first entry past the reference; tables must 
+//	bracket the reference (the caller owns the table length)
+A3DM_INLINE a3index a3sampleTableLerpIncrementIndex(const a3real paramTable[], const a3real param, a3index i, a3real *param_out)
+{
+	while (paramTable[i] < param)
+		++i;
+	if (param_out)
+		*param_out = i ? a3lerpSafeInverse(paramTable[i - 1], paramTable[i], param) : a3real_zero;
+	return i;
+}
+
+A3DM_INLINE a3index a3sampleTableLerpDecrementIndex(const a3real paramTable[], const a3real param, a3index i, a3real *param_out)
+{
+	while (paramTable[i] > param)
+		++i;
+	if (param_out)
+		*param_out = i ? a3lerpSafeInverse(paramTable[i - 1], paramTable[i], param) : a3real_zero;
+	return i;
+}
+
+A3DM_INLINE a3index a3sampleTableLerpIncrementStepIndex(const a3real paramTable[], const a3real param, const a3count step, a3index i, a3real *param_out)
+{
+	while (paramTable[i] < param)
+		i += step;
+	if (param_out)
+		*param_out = i >= step ? a3lerpSafeInverse(paramTable[i - step], paramTable[i], param) : a3real_zero;
+	return i;
+}
+
+A3DM_INLINE a3index a3sampleTableLerpDecrementStepIndex(const a3real paramTable[], const a3real param, const a3count step, a3index i, a3real *param_out)
+{
+	while (paramTable[i] > param)
+		i += step;
+	if (param_out)
+		*param_out = i >= step ? a3lerpSafeInverse(paramTable[i - step], paramTable[i], param) : a3real_zero;
+	return i;
+}
+
+
+A3DM_INLINE a3index a3sampleTableGenerate(a3real sampleTable_out[], a3real paramTable_out[], const a3count numDivisions, const a3count numSubdivisions, const a3real paramMin, const a3real paramMax, const a3realfunc func)
+{
+	const a3index count = a3sampleTableGenerateNumSamplesRequired(numDivisions, numSubdivisions);
+	a3real dt, t;
+	a3index i;
+	if (sampleTable_out && paramTable_out && func && numDivisions && numSubdivisions)
+	{
+		dt = (paramMax - paramMin) / (a3real)(count - 1);
+		for (i = 0; i < count; ++i)
+		{
+			t = paramMin + dt * (a3real)i;
+			paramTable_out[i] = t;
+			sampleTable_out[i] = func(t);
+		}
+		return count;
+	}
+	return 0;
+}
+
+A3DM_INLINE a3index a3sampleTableGenerateArcLength(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count numSubdivisions, const a3real paramMin, const a3real paramMax, const a3realfunc func)
+{
+	// arc length of the function's graph
+	const a3index count = a3sampleTableGenerate(sampleTable_out, paramTable_out, numDivisions, numSubdivisions, paramMin, paramMax, func);
+	a3real dx, dy, total = a3real_zero, totalInv;
+	a3index i;
+	if (count && arclenTable_out)
+	{
+		arclenTable_out[0] = a3real_zero;
+		for (i = 1; i < count; ++i)
+		{
+			dx = paramTable_out[i] - paramTable_out[i - 1];
+			dy = sampleTable_out[i] - sampleTable_out[i - 1];
+			arclenTable_out[i] = total += a3sqrt(dx * dx + dy * dy);
+		}
+		if (autoNormalize && total > a3real_zero)
+			for (i = 1, totalInv = a3recip(total); i < count; ++i)
+				arclenTable_out[i] *= totalInv;
+	}
+	return count;
+}
+
+A3DM_INLINE a3index a3sampleTableGenerateNumSamplesRequired(const a3index numDivisions, const a3count numSubdivisions)
+{
+	return (numDivisions * numSubdivisions + 1);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_INTERPOLATION_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_INTERPOLATION_H
\ No newline at end of file
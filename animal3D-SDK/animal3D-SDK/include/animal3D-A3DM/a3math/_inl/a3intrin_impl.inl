@@ -0,0 +1,383 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3intrin_impl.inl
+	Shared SIMD building blocks for the A3DM implementation.
+*/
+
+#ifndef __ANIMAL3D_A3DM_INTRIN_IMPL_INL
+#define __ANIMAL3D_A3DM_INTRIN_IMPL_INL
+
+
+#ifdef A3_USING_INTRIN
+
+// instruction set tiers available to the current compile target
+//	MSVC only reports AVX and up, so SSE4.1 is assumed on x64 builds there
+#if (defined __SSE4_1__ || defined __AVX__ || defined _MSC_VER)
+#define A3_INTRIN_SSE4	1
+#endif	// (defined __SSE4_1__ || defined __AVX__ || defined _MSC_VER)
+#if (defined __AVX__)
+#define A3_INTRIN_AVX	1
+#endif	// (defined __AVX__)
+#if (defined __AVX2__)
+#define A3_INTRIN_AVX2	1
+#endif	// (defined __AVX2__)
+#if (defined __FMA__ || defined __AVX2__)
+#define A3_INTRIN_FMA	1
+#endif	// (defined __FMA__ || defined __AVX2__)
+
+
+// broadcast one lane to all lanes
+#define a3intrinSplat(v, i)			_mm_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i))
+
+// flip signs of selected lanes
+#define a3intrinFlip(v, x, y, z, w)	_mm_xor_ps(v, _mm_setr_ps(x, y, z, w))
+
+
+// lanes: one register holding the same element of several objects (SoA), 
+//	for kernels that process a group of matrices or quaternions per iteration
+#ifdef A3_INTRIN_AVX
+typedef __m256 a3intrinLanes;
+#define a3intrinLaneCount			8
+#define a3intrinLanesSet1			_mm256_set1_ps
+#define a3intrinLanesLoad			_mm256_loadu_ps
+#define a3intrinLanesStore			_mm256_storeu_ps
+#define a3intrinLanesAdd			_mm256_add_ps
+#define a3intrinLanesSub			_mm256_sub_ps
+#define a3intrinLanesMul			_mm256_mul_ps
+#define a3intrinLanesDiv			_mm256_div_ps
+#define a3intrinLanesMin			_mm256_min_ps
+#define a3intrinLanesMax			_mm256_max_ps
+#define a3intrinLanesFloor			_mm256_floor_ps
+#define a3intrinLanesAnd			_mm256_and_ps
+#define a3intrinLanesAndNot			_mm256_andnot_ps
+#define a3intrinLanesOr				_mm256_or_ps
+#define a3intrinLanesXor			_mm256_xor_ps
+#define a3intrinLanesSqrt			_mm256_sqrt_ps
+#define a3intrinLanesRsqrtEst		_mm256_rsqrt_ps
+#define a3intrinLanesNotEqual(a, b)	_mm256_cmp_ps(a, b, _CMP_NEQ_UQ)
+#define a3intrinLanesLess(a, b)		_mm256_cmp_ps(a, b, _CMP_LT_OQ)
+#ifdef A3_INTRIN_FMA
+#define a3intrinLanesMulAdd			_mm256_fmadd_ps
+#else	// !A3_INTRIN_FMA
+#define a3intrinLanesMulAdd(a, b, c)	_mm256_add_ps(_mm256_mul_ps(a, b), c)
+#endif	// A3_INTRIN_FMA
+#else	// !A3_INTRIN_AVX
+typedef __m128 a3intrinLanes;
+#define a3intrinLaneCount			4
+#define a3intrinLanesSet1			_mm_set1_ps
+#define a3intrinLanesLoad			_mm_loadu_ps
+#define a3intrinLanesStore			_mm_storeu_ps
+#define a3intrinLanesAdd			_mm_add_ps
+#define a3intrinLanesSub			_mm_sub_ps
+#define a3intrinLanesMul			_mm_mul_ps
+#define a3intrinLanesDiv			_mm_div_ps
+#define a3intrinLanesMin			_mm_min_ps
+#define a3intrinLanesMax			_mm_max_ps
+#ifdef A3_INTRIN_SSE4
+#define a3intrinLanesFloor			_mm_floor_ps
+#else	// !A3_INTRIN_SSE4
+#define a3intrinLanesFloor			a3intrinFloor
+#endif	// A3_INTRIN_SSE4
+#define a3intrinLanesAnd			_mm_and_ps
+#define a3intrinLanesAndNot			_mm_andnot_ps
+#define a3intrinLanesOr				_mm_or_ps
+#define a3intrinLanesXor			_mm_xor_ps
+#define a3intrinLanesSqrt			_mm_sqrt_ps
+#define a3intrinLanesRsqrtEst		_mm_rsqrt_ps
+#define a3intrinLanesNotEqual		_mm_cmpneq_ps
+#define a3intrinLanesLess			_mm_cmplt_ps
+#define a3intrinLanesMulAdd			a3intrinMulAdd
+#endif	// A3_INTRIN_AVX
+
+// per-lane select: mask ? a : b, where mask is the result of a comparison
+#define a3intrinLanesSelect(mask, a, b)	a3intrinLanesOr(a3intrinLanesAnd(mask, a), a3intrinLanesAndNot(mask, b))
+
+
+A3_BEGIN_IMPL
+
+
+//-----------------------------------------------------------------------------
+
+// multiply-add: a*b + c
+A3DM_INLINE __m128 a3intrinMulAdd(const __m128 a, const __m128 b, const __m128 c)
+{
+#ifdef A3_INTRIN_FMA
+	return _mm_fmadd_ps(a, b, c);
+#else	// !A3_INTRIN_FMA
+	return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif	// A3_INTRIN_FMA
+}
+
+#ifndef A3_INTRIN_SSE4
+// floor without SSE4.1: truncate, then step down where that rounded up
+A3DM_INLINE __m128 a3intrinFloor(const __m128 x)
+{
+	const __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+	return _mm_sub_ps(t, _mm_and_ps(_mm_cmplt_ps(x, t), _mm_set1_ps(1.0f)));
+}
+#endif	// !A3_INTRIN_SSE4
+
+// dot product of all four lanes, result in every lane
+A3DM_INLINE __m128 a3intrinDot4(const __m128 a, const __m128 b)
+{
+#ifdef A3_INTRIN_SSE4
+	return _mm_dp_ps(a, b, 0xff);
+#else	// !A3_INTRIN_SSE4
+	__m128 p = _mm_mul_ps(a, b);
+	p = _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 0, 3, 2)));
+#endif	// A3_INTRIN_SSE4
+}
+
+// reciprocal square root refined with one Newton step (~22 bits)
+A3DM_INLINE __m128 a3intrinRsqrt(const __m128 x)
+{
+	const __m128 r = _mm_rsqrt_ps(x);
+	const __m128 rrx = _mm_mul_ps(_mm_mul_ps(r, r), x);
+	return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), r), _mm_sub_ps(_mm_set1_ps(3.0f), rrx));
+}
+
+// column-major 4x4 matrix times column vector
+A3DM_INLINE __m128 a3intrinMat4Vec4(const a3real4x4p m, const __m128 v)
+{
+	__m128 r = _mm_mul_ps(_mm_loadu_ps(m[0]), a3intrinSplat(v, 0));
+	r = a3intrinMulAdd(_mm_loadu_ps(m[1]), a3intrinSplat(v, 1), r);
+	r = a3intrinMulAdd(_mm_loadu_ps(m[2]), a3intrinSplat(v, 2), r);
+	return a3intrinMulAdd(_mm_loadu_ps(m[3]), a3intrinSplat(v, 3), r);
+}
+
+// column-major 4x4 matrix product, m_out = mL * mR; all loads happen before 
+//	stores so the output may alias either input
+A3DM_INLINE void a3intrinMat4Product(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR)
+{
+#ifdef A3_INTRIN_AVX
+	// two result columns per register
+	const __m256 l0 = _mm256_broadcast_ps((__m128 const *)mL[0]);
+	const __m256 l1 = _mm256_broadcast_ps((__m128 const *)mL[1]);
+	const __m256 l2 = _mm256_broadcast_ps((__m128 const *)mL[2]);
+	const __m256 l3 = _mm256_broadcast_ps((__m128 const *)mL[3]);
+	const __m256 r01 = _mm256_loadu_ps(mR[0]), r23 = _mm256_loadu_ps(mR[2]);
+	__m256 o01 = _mm256_mul_ps(l0, _mm256_shuffle_ps(r01, r01, 0x00));
+	__m256 o23 = _mm256_mul_ps(l0, _mm256_shuffle_ps(r23, r23, 0x00));
+#ifdef A3_INTRIN_FMA
+	o01 = _mm256_fmadd_ps(l1, _mm256_shuffle_ps(r01, r01, 0x55), o01);
+	o23 = _mm256_fmadd_ps(l1, _mm256_shuffle_ps(r23, r23, 0x55), o23);
+	o01 = _mm256_fmadd_ps(l2, _mm256_shuffle_ps(r01, r01, 0xaa), o01);
+	o23 = _mm256_fmadd_ps(l2, _mm256_shuffle_ps(r23, r23, 0xaa), o23);
+	o01 = _mm256_fmadd_ps(l3, _mm256_shuffle_ps(r01, r01, 0xff), o01);
+	o23 = _mm256_fmadd_ps(l3, _mm256_shuffle_ps(r23, r23, 0xff), o23);
+#else	// !A3_INTRIN_FMA
+	o01 = _mm256_add_ps(_mm256_mul_ps(l1, _mm256_shuffle_ps(r01, r01, 0x55)), o01);
+	o23 = _mm256_add_ps(_mm256_mul_ps(l1, _mm256_shuffle_ps(r23, r23, 0x55)), o23);
+	o01 = _mm256_add_ps(_mm256_mul_ps(l2, _mm256_shuffle_ps(r01, r01, 0xaa)), o01);
+	o23 = _mm256_add_ps(_mm256_mul_ps(l2, _mm256_shuffle_ps(r23, r23, 0xaa)), o23);
+	o01 = _mm256_add_ps(_mm256_mul_ps(l3, _mm256_shuffle_ps(r01, r01, 0xff)), o01);
+	o23 = _mm256_add_ps(_mm256_mul_ps(l3, _mm256_shuffle_ps(r23, r23, 0xff)), o23);
+#endif	// A3_INTRIN_FMA
+	_mm256_storeu_ps(m_out[0], o01);
+	_mm256_storeu_ps(m_out[2], o23);
+#else	// !A3_INTRIN_AVX
+	const __m128 r0 = _mm_loadu_ps(mR[0]), r1 = _mm_loadu_ps(mR[1]), r2 = _mm_loadu_ps(mR[2]), r3 = _mm_loadu_ps(mR[3]);
+	const __m128 o0 = a3intrinMat4Vec4(mL, r0), o1 = a3intrinMat4Vec4(mL, r1), o2 = a3intrinMat4Vec4(mL, r2), o3 = a3intrinMat4Vec4(mL, r3);
+	_mm_storeu_ps(m_out[0], o0);
+	_mm_storeu_ps(m_out[1], o1);
+	_mm_storeu_ps(m_out[2], o2);
+	_mm_storeu_ps(m_out[3], o3);
+#endif	// A3_INTRIN_AVX
+}
+
+// Hamilton product of quaternions stored {x, y, z, w}
+A3DM_INLINE __m128 a3intrinQuatProduct(const __m128 qL, const __m128 qR)
+{
+	__m128 r = _mm_mul_ps(a3intrinSplat(qL, 3), qR);
+	r = a3intrinMulAdd(a3intrinSplat(qL, 0), a3intrinFlip(_mm_shuffle_ps(qR, qR, _MM_SHUFFLE(0, 1, 2, 3)), +0.0f, -0.0f, +0.0f, -0.0f), r);
+	r = a3intrinMulAdd(a3intrinSplat(qL, 1), a3intrinFlip(_mm_shuffle_ps(qR, qR, _MM_SHUFFLE(1, 0, 3, 2)), +0.0f, +0.0f, -0.0f, -0.0f), r);
+	return a3intrinMulAdd(a3intrinSplat(qL, 2), a3intrinFlip(_mm_shuffle_ps(qR, qR, _MM_SHUFFLE(2, 3, 0, 1)), -0.0f, +0.0f, +0.0f, -0.0f), r);
+}
+
+
+// gather four 4D vectors into lanes: lane i of v_out[j] is component j of 
+//	vector i (a transpose)
+A3DM_INLINE void a3intrinGather4(__m128 v_out[4], const a3real *v0, const a3real *v1, const a3real *v2, const a3real *v3)
+{
+	__m128 r0 = _mm_loadu_ps(v0), r1 = _mm_loadu_ps(v1), r2 = _mm_loadu_ps(v2), r3 = _mm_loadu_ps(v3);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	v_out[0] = r0;
+	v_out[1] = r1;
+	v_out[2] = r2;
+	v_out[3] = r3;
+}
+
+// scatter lanes back to four 4D vectors; inverse of gather
+A3DM_INLINE void a3intrinScatter4(a3real *v0_out, a3real *v1_out, a3real *v2_out, a3real *v3_out, const __m128 v[4])
+{
+	__m128 r0 = v[0], r1 = v[1], r2 = v[2], r3 = v[3];
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	_mm_storeu_ps(v0_out, r0);
+	_mm_storeu_ps(v1_out, r1);
+	_mm_storeu_ps(v2_out, r2);
+	_mm_storeu_ps(v3_out, r3);
+}
+
+#ifdef A3_INTRIN_AVX
+// gather eight 4D vectors into lanes: vectors 0-3 fill the low halves and 
+//	4-7 the high halves, so the transpose stays within each half
+A3DM_INLINE void a3intrinGather8(__m256 v_out[4], const a3real *v0, const a3real *v1, const a3real *v2, const a3real *v3, const a3real *v4, const a3real *v5, const a3real *v6, const a3real *v7)
+{
+	const __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(v0)), _mm_loadu_ps(v4), 1);
+	const __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(v1)), _mm_loadu_ps(v5), 1);
+	const __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(v2)), _mm_loadu_ps(v6), 1);
+	const __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(v3)), _mm_loadu_ps(v7), 1);
+	const __m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1);
+	const __m256 t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+	v_out[0] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	v_out[1] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	v_out[2] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	v_out[3] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// scatter lanes back to eight 4D vectors; inverse of gather
+A3DM_INLINE void a3intrinScatter8(a3real *v0_out, a3real *v1_out, a3real *v2_out, a3real *v3_out, a3real *v4_out, a3real *v5_out, a3real *v6_out, a3real *v7_out, const __m256 v[4])
+{
+	const __m256 t0 = _mm256_unpacklo_ps(v[0], v[1]), t1 = _mm256_unpackhi_ps(v[0], v[1]);
+	const __m256 t2 = _mm256_unpacklo_ps(v[2], v[3]), t3 = _mm256_unpackhi_ps(v[2], v[3]);
+	const __m256 r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m256 r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	const __m256 r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m256 r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	_mm_storeu_ps(v0_out, _mm256_castps256_ps128(r0));
+	_mm_storeu_ps(v1_out, _mm256_castps256_ps128(r1));
+	_mm_storeu_ps(v2_out, _mm256_castps256_ps128(r2));
+	_mm_storeu_ps(v3_out, _mm256_castps256_ps128(r3));
+	_mm_storeu_ps(v4_out, _mm256_extractf128_ps(r0, 1));
+	_mm_storeu_ps(v5_out, _mm256_extractf128_ps(r1, 1));
+	_mm_storeu_ps(v6_out, _mm256_extractf128_ps(r2, 1));
+	_mm_storeu_ps(v7_out, _mm256_extractf128_ps(r3, 1));
+}
+#endif	// A3_INTRIN_AVX
+
+// reciprocal square root of each lane refined with one Newton step
+A3DM_INLINE a3intrinLanes a3intrinLanesRsqrt(const a3intrinLanes x)
+{
+	const a3intrinLanes r = a3intrinLanesRsqrtEst(x);
+	const a3intrinLanes rrx = a3intrinLanesMul(a3intrinLanesMul(r, r), x);
+	return a3intrinLanesMul(a3intrinLanesMul(a3intrinLanesSet1(0.5f), r), a3intrinLanesSub(a3intrinLanesSet1(3.0f), rrx));
+}
+
+// sum of all lanes
+A3DM_INLINE a3real a3intrinLanesSum(const a3intrinLanes x)
+{
+#ifdef A3_INTRIN_AVX
+	__m128 v = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+#else	// !A3_INTRIN_AVX
+	__m128 v = x;
+#endif	// A3_INTRIN_AVX
+	v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+	v = _mm_add_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_cvtss_f32(v);
+}
+
+// sine of each lane for |x| <= pi/2; odd polynomial through x^11, 
+//	truncation error below 6e-8 at the ends of the range
+A3DM_INLINE a3intrinLanes a3intrinLanesSinQuadrant(const a3intrinLanes x)
+{
+	const a3intrinLanes x2 = a3intrinLanesMul(x, x);
+	a3intrinLanes p = a3intrinLanesSet1(-2.5052108e-8f);
+	p = a3intrinLanesMulAdd(p, x2, a3intrinLanesSet1(+2.7557319e-6f));
+	p = a3intrinLanesMulAdd(p, x2, a3intrinLanesSet1(-1.9841270e-4f));
+	p = a3intrinLanesMulAdd(p, x2, a3intrinLanesSet1(+8.3333333e-3f));
+	p = a3intrinLanesMulAdd(p, x2, a3intrinLanesSet1(-1.6666667e-1f));
+	return a3intrinLanesMulAdd(a3intrinLanesMul(p, x2), x, x);
+}
+
+// arccosine of each lane for 0 <= x <= 1 as sqrt(1 - x) times a polynomial 
+//	(Abramowitz & Stegun 4.4.46), absolute error below 2e-8 before rounding
+A3DM_INLINE a3intrinLanes a3intrinLanesAcosUnit(const a3intrinLanes x)
+{
+	a3intrinLanes p = a3intrinLanesSet1(-0.0012624911f);
+	p = a3intrinLanesMulAdd(p, x, a3intrinLanesSet1(+0.0066700901f));
+	p = a3intrinLanesMulAdd(p, x, a3intrinLanesSet1(-0.0170881256f));
+	p = a3intrinLanesMulAdd(p, x, a3intrinLanesSet1(+0.0308918810f));
+	p = a3intrinLanesMulAdd(p, x, a3intrinLanesSet1(-0.0501743046f));
+	p = a3intrinLanesMulAdd(p, x, a3intrinLanesSet1(+0.0889789874f));
+	p = a3intrinLanesMulAdd(p, x, a3intrinLanesSet1(-0.2145988016f));
+	p = a3intrinLanesMulAdd(p, x, a3intrinLanesSet1(+1.5707963050f));
+	return a3intrinLanesMul(p, a3intrinLanesSqrt(a3intrinLanesSub(a3intrinLanesSet1(1.0f), x)));
+}
+
+
+// gather one lane group of 4D vectors from an array: v_out[j] holds 
+//	component j of each vector
+A3DM_INLINE void a3intrinLanesLoadVec4(a3intrinLanes v_out[4], const a3real4 v[])
+{
+#ifdef A3_INTRIN_AVX
+	a3intrinGather8(v_out, v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7]);
+#else	// !A3_INTRIN_AVX
+	a3intrinGather4(v_out, v[0], v[1], v[2], v[3]);
+#endif	// A3_INTRIN_AVX
+}
+
+// scatter one lane group of 4D vectors to an array; inverse of load
+A3DM_INLINE void a3intrinLanesStoreVec4(a3real4 v_out[], const a3intrinLanes v[4])
+{
+#ifdef A3_INTRIN_AVX
+	a3intrinScatter8(v_out[0], v_out[1], v_out[2], v_out[3], v_out[4], v_out[5], v_out[6], v_out[7], v);
+#else	// !A3_INTRIN_AVX
+	a3intrinScatter4(v_out[0], v_out[1], v_out[2], v_out[3], v);
+#endif	// A3_INTRIN_AVX
+}
+
+// load one lane group of 4x4 matrices: e_out[c*4+r] holds element [c][r] of 
+//	each matrix
+A3DM_INLINE void a3intrinLanesLoadMat4(a3intrinLanes e_out[16], const a3real4x4 m[])
+{
+	a3index c;
+	for (c = 0; c < 4; ++c)
+#ifdef A3_INTRIN_AVX
+		a3intrinGather8(e_out + c * 4, m[0][c], m[1][c], m[2][c], m[3][c], m[4][c], m[5][c], m[6][c], m[7][c]);
+#else	// !A3_INTRIN_AVX
+		a3intrinGather4(e_out + c * 4, m[0][c], m[1][c], m[2][c], m[3][c]);
+#endif	// A3_INTRIN_AVX
+}
+
+// store one lane group of 4x4 matrices; inverse of load
+A3DM_INLINE void a3intrinLanesStoreMat4(a3real4x4 m_out[], const a3intrinLanes e[16])
+{
+	a3index c;
+	for (c = 0; c < 4; ++c)
+#ifdef A3_INTRIN_AVX
+		a3intrinScatter8(m_out[0][c], m_out[1][c], m_out[2][c], m_out[3][c], m_out[4][c], m_out[5][c], m_out[6][c], m_out[7][c], e + c * 4);
+#else	// !A3_INTRIN_AVX
+		a3intrinScatter4(m_out[0][c], m_out[1][c], m_out[2][c], m_out[3][c], e + c * 4);
+#endif	// A3_INTRIN_AVX
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+#endif	// A3_USING_INTRIN
+
+
+#endif	// !__ANIMAL3D_A3DM_INTRIN_IMPL_INL
\ No newline at end of file
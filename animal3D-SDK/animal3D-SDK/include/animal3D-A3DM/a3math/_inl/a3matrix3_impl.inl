@@ -0,0 +1,370 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3matrix3_impl.inl
+	Implementations for 3D matrix functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_MATRIX_H
+#ifndef __ANIMAL3D_A3DM_MATRIX3_IMPL_INL
+#define __ANIMAL3D_A3DM_MATRIX3_IMPL_INL
+
+
+#include "../a3trig.h"
+
+
+A3_BEGIN_IMPL
+
+
+// preset constants
+A3DM_GLOBAL const a3mat3 a3mat3_identity = { { a3real_one, a3real_zero, a3real_zero, a3real_zero, a3real_one, a3real_zero, a3real_zero, a3real_zero, a3real_one } };
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real3x3r a3real3x3SetIdentity(a3real3x3p m_out)
+{
+	m_out[0][0] = m_out[1][1] = m_out[2][2] = a3real_one;
+	m_out[0][1] = m_out[0][2] = m_out[1][0] = m_out[1][2] = m_out[2][0] = m_out[2][1] = a3real_zero;
+	return m_out;
+}
+
+A3DM_INLINE a3real3x3r a3real3x3Set(a3real3x3p m_out, const a3real x0, const a3real y0, const a3real z0, const a3real x1, const a3real y1, const a3real z1, const a3real x2, const a3real y2, const a3real z2)
+{
+	m_out[0][0] = x0;
+	m_out[0][1] = y0;
+	m_out[0][2] = z0;
+	m_out[1][0] = x1;
+	m_out[1][1] = y1;
+	m_out[1][2] = z1;
+	m_out[2][0] = x2;
+	m_out[2][1] = y2;
+	m_out[2][2] = z2;
+	return m_out;
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetMajors(a3real3x3p m_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	a3real3SetReal3(m_out[0], v0);
+	a3real3SetReal3(m_out[1], v1);
+	a3real3SetReal3(m_out[2], v2);
+	return m_out;
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetMinors(a3real3x3p m_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	return a3real3x3Set(m_out, v0[0], v1[0], v2[0], v0[1], v1[1], v2[1], v0[2], v1[2], v2[2]);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetReal2x2(a3real3x3p m_out, const a3real2x2p m)
+{
+	return a3real3x3Set(m_out, m[0][0], m[0][1], a3real_zero, m[1][0], m[1][1], a3real_zero, a3real_zero, a3real_zero, a3real_one);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetReal3x3(a3real3x3p m_out, const a3real3x3p m)
+{
+	return a3real3x3SetMajors(m_out, m[0], m[1], m[2]);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetReal4x4(a3real3x3p m_out, const a3real4x4p m)
+{
+	a3real3SetReal4(m_out[0], m[0]);
+	a3real3SetReal4(m_out[1], m[1]);
+	a3real3SetReal4(m_out[2], m[2]);
+	return m_out;
+}
+
+
+A3DM_INLINE a3real a3real3x3Determinant(const a3real3x3p m)
+{
+	// triple product of the majors
+	return (m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2])
+		+ m[1][0] * (m[2][1] * m[0][2] - m[0][1] * m[2][2])
+		+ m[2][0] * (m[0][1] * m[1][2] - m[1][1] * m[0][2]));
+}
+
+A3DM_INLINE a3real a3real3x3DeterminantInverse(const a3real3x3p m)
+{
+	const a3real det = a3real3x3Determinant(m);
+	return a3recipsafe(det);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3GetNegative(a3real3x3p m_out, const a3real3x3p m)
+{
+	a3real3GetNegative(m_out[0], m[0]);
+	a3real3GetNegative(m_out[1], m[1]);
+	a3real3GetNegative(m_out[2], m[2]);
+	return m_out;
+}
+
+A3DM_INLINE a3real3x3r a3real3x3GetTransposed(a3real3x3p m_out, const a3real3x3p m)
+{
+	return a3real3x3Set(m_out, m[0][0], m[1][0], m[2][0], m[0][1], m[1][1], m[2][1], m[0][2], m[1][2], m[2][2]);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3GetInverse(a3real3x3p m_out, const a3real3x3p m)
+{
+	// minors of the inverse are cross products of the input's majors, 
+	//	scaled by the inverse determinant; singular input yields zero
+	a3mat3 adj;
+	a3real detInv;
+	a3real3Cross(adj.m[0], m[1], m[2]);
+	a3real3Cross(adj.m[1], m[2], m[0]);
+	a3real3Cross(adj.m[2], m[0], m[1]);
+	detInv = a3recipsafe(a3real3Dot(m[0], adj.m[0]));
+	a3real3x3GetTransposed(m_out, adj.m);
+	return a3real3x3MulS(m_out, detInv);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3Negate(a3real3x3p m_inout)
+{
+	return a3real3x3GetNegative(m_inout, m_inout);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3Transpose(a3real3x3p m_inout)
+{
+	return a3real3x3GetTransposed(m_inout, m_inout);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3Invert(a3real3x3p m_inout)
+{
+	return a3real3x3GetInverse(m_inout, m_inout);
+}
+
+
+A3DM_INLINE a3real3x3r a3real3x3Sum(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR)
+{
+	a3real3Sum(m_out[0], mL[0], mR[0]);
+	a3real3Sum(m_out[1], mL[1], mR[1]);
+	a3real3Sum(m_out[2], mL[2], mR[2]);
+	return m_out;
+}
+
+A3DM_INLINE a3real3x3r a3real3x3Diff(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR)
+{
+	a3real3Diff(m_out[0], mL[0], mR[0]);
+	a3real3Diff(m_out[1], mL[1], mR[1]);
+	a3real3Diff(m_out[2], mL[2], mR[2]);
+	return m_out;
+}
+
+A3DM_INLINE a3real3x3r a3real3x3ProductS(a3real3x3p m_out, const a3real3x3p m, const a3real s)
+{
+	a3real3ProductS(m_out[0], m[0], s);
+	a3real3ProductS(m_out[1], m[1], s);
+	a3real3ProductS(m_out[2], m[2], s);
+	return m_out;
+}
+
+A3DM_INLINE a3real3x3r a3real3x3QuotientS(a3real3x3p m_out, const a3real3x3p m, const a3real s)
+{
+	return a3real3x3ProductS(m_out, m, a3recip(s));
+}
+
+A3DM_INLINE a3real3x3r a3real3x3Add(a3real3x3p mL_inout, const a3real3x3p mR)
+{
+	return a3real3x3Sum(mL_inout, mL_inout, mR);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3Sub(a3real3x3p mL_inout, const a3real3x3p mR)
+{
+	return a3real3x3Diff(mL_inout, mL_inout, mR);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3MulS(a3real3x3p m_inout, const a3real s)
+{
+	return a3real3x3ProductS(m_inout, m_inout, s);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3DivS(a3real3x3p m_inout, const a3real s)
+{
+	return a3real3x3ProductS(m_inout, m_inout, a3recip(s));
+}
+
+
+A3DM_INLINE a3real3r a3real3Real3x3ProductL(a3real3p v_out, const a3real3p v, const a3real3x3p m)
+{
+	const a3real x = a3real3Dot(v, m[0]);
+	const a3real y = a3real3Dot(v, m[1]);
+	const a3real z = a3real3Dot(v, m[2]);
+	return a3real3Set(v_out, x, y, z);
+}
+
+A3DM_INLINE a3real3r a3real3Real3x3ProductR(a3real3p v_out, const a3real3x3p m, const a3real3p v)
+{
+	const a3real x = m[0][0] * v[0] + m[1][0] * v[1] + m[2][0] * v[2];
+	const a3real y = m[0][1] * v[0] + m[1][1] * v[1] + m[2][1] * v[2];
+	const a3real z = m[0][2] * v[0] + m[1][2] * v[1] + m[2][2] * v[2];
+	return a3real3Set(v_out, x, y, z);
+}
+
+A3DM_INLINE a3real3r a3real3Real3x3MulL(a3real3p v_inout, const a3real3x3p m)
+{
+	return a3real3Real3x3ProductL(v_inout, v_inout, m);
+}
+
+A3DM_INLINE a3real3r a3real3Real3x3MulR(const a3real3x3p m, a3real3p v_inout)
+{
+	return a3real3Real3x3ProductR(v_inout, m, v_inout);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3Product(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR)
+{
+	// output may alias either input
+	a3mat3 tmp;
+	a3real3Real3x3ProductR(tmp.m[0], mL, mR[0]);
+	a3real3Real3x3ProductR(tmp.m[1], mL, mR[1]);
+	a3real3Real3x3ProductR(tmp.m[2], mL, mR[2]);
+	return a3real3x3SetReal3x3(m_out, tmp.m);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3ConcatL(a3real3x3p mL_inout, const a3real3x3p mR)
+{
+	return a3real3x3Product(mL_inout, mL_inout, mR);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3ConcatR(const a3real3x3p mL, a3real3x3p mR_inout)
+{
+	return a3real3x3Product(mR_inout, mL, mR_inout);
+}
+
+
+A3DM_INLINE a3real3x3r a3real3x3SetScale(a3real3x3p m_out, const a3real s)
+{
+	return a3real3x3SetNonUnif(m_out, s, s, s);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetNonUnif(a3real3x3p m_out, const a3real sx, const a3real sy, const a3real sz)
+{
+	return a3real3x3Set(m_out, sx, a3real_zero, a3real_zero, a3real_zero, sy, a3real_zero, a3real_zero, a3real_zero, sz);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetRotateX(a3real3x3p m_out, const a3real degrees)
+{
+	const a3real c = a3cosd(degrees), s = a3sind(degrees);
+	return a3real3x3Set(m_out, a3real_one, a3real_zero, a3real_zero, a3real_zero, c, s, a3real_zero, -s, c);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetRotateY(a3real3x3p m_out, const a3real degrees)
+{
+	const a3real c = a3cosd(degrees), s = a3sind(degrees);
+	return a3real3x3Set(m_out, c, a3real_zero, -s, a3real_zero, a3real_one, a3real_zero, s, a3real_zero, c);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetRotateZ(a3real3x3p m_out, const a3real degrees)
+{
+	const a3real c = a3cosd(degrees), s = a3sind(degrees);
+	return a3real3x3Set(m_out, c, s, a3real_zero, -s, c, a3real_zero, a3real_zero, a3real_zero, a3real_one);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetRotateXYZ(a3real3x3p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z)
+{
+	// R = Rz * Ry * Rx, expanded
+	const a3real cx = a3cosd(degrees_x), sx = a3sind(degrees_x);
+	const a3real cy = a3cosd(degrees_y), sy = a3sind(degrees_y);
+	const a3real cz = a3cosd(degrees_z), sz = a3sind(degrees_z);
+	const a3real sxsy = sx * sy, cxsy = cx * sy;
+	return a3real3x3Set(m_out,
+		cy * cz, cy * sz, -sy,
+		sxsy * cz - cx * sz, sxsy * sz + cx * cz, sx * cy,
+		cxsy * cz + sx * sz, cxsy * sz - sx * cz, cx * cy);
+}
+
+A3DM_INLINE a3real3x3r a3real3x3SetRotateZYX(a3real3x3p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z)
+{
+	// R = Rx * Ry * Rz, expanded
+	const a3real cx = a3cosd(degrees_x), sx = a3sind(degrees_x);
+	const a3real cy = a3cosd(degrees_y), sy = a3sind(degrees_y);
+	const a3real cz = a3cosd(degrees_z), sz = a3sind(degrees_z);
+	const a3real sxsy = sx * sy, cxsy = cx * sy;
+	return a3real3x3Set(m_out,
+		cy * cz, cx * sz + sxsy * cz, sx * sz - cxsy * cz,
+		-cy * sz, cx * cz - sxsy * sz, sx * cz + cxsy * sz,
+		sy, -sx * cy, cx * cy);
+}
+
+A3DM_INLINE a3real3x3rk a3real3x3GetEulerXYZIgnoreScale(const a3real3x3p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out)
+{
+	// inverse of the XYZ expansion; at gimbal lock X is zero and Z absorbs it
+	const a3real sy = -m[0][2];
+	if (degrees_x_out && degrees_y_out && degrees_z_out)
+	{
+		*degrees_y_out = a3asind(a3clamp(-a3real_one, a3real_one, sy));
+		if (a3absolute(sy) < a3real_one - a3real_epsilon)
+		{
+			*degrees_x_out = a3atan2d(m[1][2], m[2][2]);
+			*degrees_z_out = a3atan2d(m[0][1], m[0][0]);
+		}
+		else
+		{
+			*degrees_x_out = a3real_zero;
+			*degrees_z_out = a3atan2d(-m[1][0], m[1][1]);
+		}
+	}
+	return m;
+}
+
+A3DM_INLINE a3real3x3rk a3real3x3GetEulerZYXIgnoreScale(const a3real3x3p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out)
+{
+	// inverse of the ZYX expansion; at gimbal lock X is zero and Z absorbs it
+	const a3real sy = m[2][0];
+	if (degrees_x_out && degrees_y_out && degrees_z_out)
+	{
+		*degrees_y_out = a3asind(a3clamp(-a3real_one, a3real_one, sy));
+		if (a3absolute(sy) < a3real_one - a3real_epsilon)
+		{
+			*degrees_x_out = a3atan2d(-m[2][1], m[2][2]);
+			*degrees_z_out = a3atan2d(-m[1][0], m[0][0]);
+		}
+		else
+		{
+			*degrees_x_out = a3real_zero;
+			*degrees_z_out = a3atan2d(m[0][1], m[1][1]);
+		}
+	}
+	return m;
+}
+
+
+A3DM_INLINE a3real3x3r a3real3x3MakeLookAt(a3real3x3p m_out, a3real3x3p mInv_out_opt, const a3real3p eyePos, const a3real3p targetPos, const a3real3p worldUpVec)
+{
+	// camera looks down its own -Z axis, so the forward major points away 
+	//	from the target; the inverse of the orthonormal basis is its transpose
+	a3real3 side, up, forward;
+	a3real3Diff(forward, eyePos, targetPos);
+	a3real3Normalize(forward);
+	a3real3CrossUnit(side, worldUpVec, forward);
+	a3real3Cross(up, forward, side);
+	a3real3x3SetMajors(m_out, side, up, forward);
+	if (mInv_out_opt)
+		a3real3x3GetTransposed(mInv_out_opt, m_out);
+	return m_out;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_MATRIX3_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_MATRIX_H
\ No newline at end of file
@@ -0,0 +1,870 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3matrix4_impl.inl
+	Implementations for 4D matrix functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_MATRIX_H
+#ifndef __ANIMAL3D_A3DM_MATRIX4_IMPL_INL
+#define __ANIMAL3D_A3DM_MATRIX4_IMPL_INL
+
+
+#include "../a3trig.h"
+#include "a3intrin_impl.inl"
+
+
+A3_BEGIN_IMPL
+
+
+// preset constants
+A3DM_GLOBAL const a3mat4 a3mat4_identity = { { a3real_one, a3real_zero, a3real_zero, a3real_zero, a3real_zero, a3real_one, a3real_zero, a3real_zero, a3real_zero, a3real_zero, a3real_one, a3real_zero, a3real_zero, a3real_zero, a3real_zero, a3real_one } };
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real4x4r a3real4x4SetIdentity(a3real4x4p m_out)
+{
+	return a3real4x4SetReal4x4(m_out, a3mat4_identity.m);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4Set(a3real4x4p m_out, const a3real x0, const a3real y0, const a3real z0, const a3real w0, const a3real x1, const a3real y1, const a3real z1, const a3real w1, const a3real x2, const a3real y2, const a3real z2, const a3real w2, const a3real x3, const a3real y3, const a3real z3, const a3real w3)
+{
+	a3real4Set(m_out[0], x0, y0, z0, w0);
+	a3real4Set(m_out[1], x1, y1, z1, w1);
+	a3real4Set(m_out[2], x2, y2, z2, w2);
+	a3real4Set(m_out[3], x3, y3, z3, w3);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetMajors(a3real4x4p m_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3)
+{
+	a3real4SetReal4(m_out[0], v0);
+	a3real4SetReal4(m_out[1], v1);
+	a3real4SetReal4(m_out[2], v2);
+	a3real4SetReal4(m_out[3], v3);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetMinors(a3real4x4p m_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3)
+{
+	a3real4x4SetMajors(m_out, v0, v1, v2, v3);
+	return a3real4x4Transpose(m_out);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetReal2x2(a3real4x4p m_out, const a3real2x2p m)
+{
+	a3real4x4SetReal4x4(m_out, a3mat4_identity.m);
+	a3real2SetReal2(m_out[0], m[0]);
+	a3real2SetReal2(m_out[1], m[1]);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetReal3x3(a3real4x4p m_out, const a3real3x3p m)
+{
+	a3real4SetReal3(m_out[0], m[0]);
+	a3real4SetReal3(m_out[1], m[1]);
+	a3real4SetReal3(m_out[2], m[2]);
+	a3real4SetReal4(m_out[3], a3vec4_w.v);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetReal4x4(a3real4x4p m_out, const a3real4x4p m)
+{
+	return a3real4x4SetMajors(m_out, m[0], m[1], m[2], m[3]);
+}
+
+
+// internal: cofactor expansion by pairs of 2x2 minors from the first two and 
+//	last two majors; shared by determinant and inverse
+A3DM_INLINE a3real a3real4x4InternalMinors(const a3real4x4p m, a3real s_out[6], a3real c_out[6])
+{
+	s_out[0] = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+	s_out[1] = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+	s_out[2] = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+	s_out[3] = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+	s_out[4] = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+	s_out[5] = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+	c_out[0] = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+	c_out[1] = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+	c_out[2] = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+	c_out[3] = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+	c_out[4] = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+	c_out[5] = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	return (s_out[0] * c_out[5] - s_out[1] * c_out[4] + s_out[2] * c_out[3] + s_out[3] * c_out[2] - s_out[4] * c_out[1] + s_out[5] * c_out[0]);
+}
+
+A3DM_INLINE a3real a3real4x4Determinant(const a3real4x4p m)
+{
+	a3real s[6], c[6];
+	return a3real4x4InternalMinors(m, s, c);
+}
+
+A3DM_INLINE a3real a3real4x4DeterminantInverse(const a3real4x4p m)
+{
+	const a3real det = a3real4x4Determinant(m);
+	return a3recipsafe(det);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4GetNegative(a3real4x4p m_out, const a3real4x4p m)
+{
+	a3real4GetNegative(m_out[0], m[0]);
+	a3real4GetNegative(m_out[1], m[1]);
+	a3real4GetNegative(m_out[2], m[2]);
+	a3real4GetNegative(m_out[3], m[3]);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4GetTransposed(a3real4x4p m_out, const a3real4x4p m)
+{
+#ifdef A3_USING_INTRIN
+	__m128 c0 = _mm_loadu_ps(m[0]), c1 = _mm_loadu_ps(m[1]), c2 = _mm_loadu_ps(m[2]), c3 = _mm_loadu_ps(m[3]);
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+	_mm_storeu_ps(m_out[0], c0);
+	_mm_storeu_ps(m_out[1], c1);
+	_mm_storeu_ps(m_out[2], c2);
+	_mm_storeu_ps(m_out[3], c3);
+	return m_out;
+#else	// !A3_USING_INTRIN
+	return a3real4x4Set(m_out,
+		m[0][0], m[1][0], m[2][0], m[3][0],
+		m[0][1], m[1][1], m[2][1], m[3][1],
+		m[0][2], m[1][2], m[2][2], m[3][2],
+		m[0][3], m[1][3], m[2][3], m[3][3]);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real4x4r a3real4x4GetInverse(a3real4x4p m_out, const a3real4x4p m)
+{
+	// adjugate from the shared 2x2 minors; singular input yields zero
+	a3real s[6], c[6], detInv;
+	detInv = a3real4x4InternalMinors(m, s, c);
+	detInv = a3recipsafe(detInv);
+	return a3real4x4Set(m_out,
+		(+m[1][1] * c[5] - m[1][2] * c[4] + m[1][3] * c[3]) * detInv,
+		(-m[0][1] * c[5] + m[0][2] * c[4] - m[0][3] * c[3]) * detInv,
+		(+m[3][1] * s[5] - m[3][2] * s[4] + m[3][3] * s[3]) * detInv,
+		(-m[2][1] * s[5] + m[2][2] * s[4] - m[2][3] * s[3]) * detInv,
+		(-m[1][0] * c[5] + m[1][2] * c[2] - m[1][3] * c[1]) * detInv,
+		(+m[0][0] * c[5] - m[0][2] * c[2] + m[0][3] * c[1]) * detInv,
+		(-m[3][0] * s[5] + m[3][2] * s[2] - m[3][3] * s[1]) * detInv,
+		(+m[2][0] * s[5] - m[2][2] * s[2] + m[2][3] * s[1]) * detInv,
+		(+m[1][0] * c[4] - m[1][1] * c[2] + m[1][3] * c[0]) * detInv,
+		(-m[0][0] * c[4] + m[0][1] * c[2] - m[0][3] * c[0]) * detInv,
+		(+m[3][0] * s[4] - m[3][1] * s[2] + m[3][3] * s[0]) * detInv,
+		(-m[2][0] * s[4] + m[2][1] * s[2] - m[2][3] * s[0]) * detInv,
+		(-m[1][0] * c[3] + m[1][1] * c[1] - m[1][2] * c[0]) * detInv,
+		(+m[0][0] * c[3] - m[0][1] * c[1] + m[0][2] * c[0]) * detInv,
+		(-m[3][0] * s[3] + m[3][1] * s[1] - m[3][2] * s[0]) * detInv,
+		(+m[2][0] * s[3] - m[2][1] * s[1] + m[2][2] * s[0]) * detInv);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4Negate(a3real4x4p m_inout)
+{
+	return a3real4x4GetNegative(m_inout, m_inout);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4Transpose(a3real4x4p m_inout)
+{
+	return a3real4x4GetTransposed(m_inout, m_inout);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4Invert(a3real4x4p m_inout)
+{
+	return a3real4x4GetInverse(m_inout, m_inout);
+}
+
+
+A3DM_INLINE a3real4x4r a3real4x4Sum(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR)
+{
+	a3real4Sum(m_out[0], mL[0], mR[0]);
+	a3real4Sum(m_out[1], mL[1], mR[1]);
+	a3real4Sum(m_out[2], mL[2], mR[2]);
+	a3real4Sum(m_out[3], mL[3], mR[3]);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4Diff(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR)
+{
+	a3real4Diff(m_out[0], mL[0], mR[0]);
+	a3real4Diff(m_out[1], mL[1], mR[1]);
+	a3real4Diff(m_out[2], mL[2], mR[2]);
+	a3real4Diff(m_out[3], mL[3], mR[3]);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4ProductS(a3real4x4p m_out, const a3real4x4p m, const a3real s)
+{
+	a3real4ProductS(m_out[0], m[0], s);
+	a3real4ProductS(m_out[1], m[1], s);
+	a3real4ProductS(m_out[2], m[2], s);
+	a3real4ProductS(m_out[3], m[3], s);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4QuotientS(a3real4x4p m_out, const a3real4x4p m, const a3real s)
+{
+	return a3real4x4ProductS(m_out, m, a3recip(s));
+}
+
+A3DM_INLINE a3real4x4r a3real4x4Add(a3real4x4p mL_inout, const a3real4x4p mR)
+{
+	return a3real4x4Sum(mL_inout, mL_inout, mR);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4Sub(a3real4x4p mL_inout, const a3real4x4p mR)
+{
+	return a3real4x4Diff(mL_inout, mL_inout, mR);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4MulS(a3real4x4p m_inout, const a3real s)
+{
+	return a3real4x4ProductS(m_inout, m_inout, s);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4DivS(a3real4x4p m_inout, const a3real s)
+{
+	return a3real4x4ProductS(m_inout, m_inout, a3recip(s));
+}
+
+
+A3DM_INLINE a3real4r a3real4Real4x4ProductL(a3real4p v_out, const a3real4p v, const a3real4x4p m)
+{
+#ifdef A3_USING_INTRIN
+	// row vector: combine the rows of the transpose
+	const __m128 x = _mm_loadu_ps(v);
+	__m128 c0 = _mm_loadu_ps(m[0]), c1 = _mm_loadu_ps(m[1]), c2 = _mm_loadu_ps(m[2]), c3 = _mm_loadu_ps(m[3]);
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+	c0 = _mm_mul_ps(c0, a3intrinSplat(x, 0));
+	c0 = a3intrinMulAdd(c1, a3intrinSplat(x, 1), c0);
+	c0 = a3intrinMulAdd(c2, a3intrinSplat(x, 2), c0);
+	_mm_storeu_ps(v_out, a3intrinMulAdd(c3, a3intrinSplat(x, 3), c0));
+	return v_out;
+#else	// !A3_USING_INTRIN
+	const a3real x = a3real4Dot(v, m[0]);
+	const a3real y = a3real4Dot(v, m[1]);
+	const a3real z = a3real4Dot(v, m[2]);
+	const a3real w = a3real4Dot(v, m[3]);
+	return a3real4Set(v_out, x, y, z, w);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real4r a3real4Real4x4ProductR(a3real4p v_out, const a3real4x4p m, const a3real4p v)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(v_out, a3intrinMat4Vec4(m, _mm_loadu_ps(v)));
+	return v_out;
+#else	// !A3_USING_INTRIN
+	const a3real x = m[0][0] * v[0] + m[1][0] * v[1] + m[2][0] * v[2] + m[3][0] * v[3];
+	const a3real y = m[0][1] * v[0] + m[1][1] * v[1] + m[2][1] * v[2] + m[3][1] * v[3];
+	const a3real z = m[0][2] * v[0] + m[1][2] * v[1] + m[2][2] * v[2] + m[3][2] * v[3];
+	const a3real w = m[0][3] * v[0] + m[1][3] * v[1] + m[2][3] * v[2] + m[3][3] * v[3];
+	return a3real4Set(v_out, x, y, z, w);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real4r a3real4Real4x4MulL(a3real4p v_inout, const a3real4x4p m)
+{
+	return a3real4Real4x4ProductL(v_inout, v_inout, m);
+}
+
+A3DM_INLINE a3real4r a3real4Real4x4MulR(const a3real4x4p m, a3real4p v_inout)
+{
+	return a3real4Real4x4ProductR(v_inout, m, v_inout);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4Product(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR)
+{
+	// output may alias either input
+#ifdef A3_USING_INTRIN
+	a3intrinMat4Product(m_out, mL, mR);
+	return m_out;
+#else	// !A3_USING_INTRIN
+	a3mat4 tmp;
+	a3real4Real4x4ProductR(tmp.m[0], mL, mR[0]);
+	a3real4Real4x4ProductR(tmp.m[1], mL, mR[1]);
+	a3real4Real4x4ProductR(tmp.m[2], mL, mR[2]);
+	a3real4Real4x4ProductR(tmp.m[3], mL, mR[3]);
+	return a3real4x4SetReal4x4(m_out, tmp.m);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real4x4r a3real4x4ConcatL(a3real4x4p mL_inout, const a3real4x4p mR)
+{
+	return a3real4x4Product(mL_inout, mL_inout, mR);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4ConcatR(const a3real4x4p mL, a3real4x4p mR_inout)
+{
+	return a3real4x4Product(mR_inout, mL, mR_inout);
+}
+
+
+A3DM_INLINE a3real4x4r a3real4x4SetScale(a3real4x4p m_out, const a3real s)
+{
+	return a3real4x4SetNonUnif(m_out, s, s, s);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetNonUnif(a3real4x4p m_out, const a3real sx, const a3real sy, const a3real sz)
+{
+	a3real4x4SetReal4x4(m_out, a3mat4_identity.m);
+	m_out[0][0] = sx;
+	m_out[1][1] = sy;
+	m_out[2][2] = sz;
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetRotateX(a3real4x4p m_out, const a3real degrees)
+{
+	a3mat3 r;
+	a3real3x3SetRotateX(r.m, degrees);
+	return a3real4x4SetReal3x3(m_out, r.m);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetRotateY(a3real4x4p m_out, const a3real degrees)
+{
+	a3mat3 r;
+	a3real3x3SetRotateY(r.m, degrees);
+	return a3real4x4SetReal3x3(m_out, r.m);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetRotateZ(a3real4x4p m_out, const a3real degrees)
+{
+	a3mat3 r;
+	a3real3x3SetRotateZ(r.m, degrees);
+	return a3real4x4SetReal3x3(m_out, r.m);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetRotateXYZ(a3real4x4p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z)
+{
+	a3mat3 r;
+	a3real3x3SetRotateXYZ(r.m, degrees_x, degrees_y, degrees_z);
+	return a3real4x4SetReal3x3(m_out, r.m);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4SetRotateZYX(a3real4x4p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z)
+{
+	a3mat3 r;
+	a3real3x3SetRotateZYX(r.m, degrees_x, degrees_y, degrees_z);
+	return a3real4x4SetReal3x3(m_out, r.m);
+}
+
+A3DM_INLINE a3real4x4rk a3real4x4GetEulerXYZIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out)
+{
+	a3mat3 r;
+	a3real3x3SetReal4x4(r.m, m);
+	a3real3x3GetEulerXYZIgnoreScale(r.m, degrees_x_out, degrees_y_out, degrees_z_out);
+	return m;
+}
+
+A3DM_INLINE a3real4x4rk a3real4x4GetEulerZYXIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out)
+{
+	a3mat3 r;
+	a3real3x3SetReal4x4(r.m, m);
+	a3real3x3GetEulerZYXIgnoreScale(r.m, degrees_x_out, degrees_y_out, degrees_z_out);
+	return m;
+}
+
+A3DM_INLINE a3real4x4rk a3real4x4GetEulerXYZTranslateIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out, a3real3p translate_out)
+{
+	if (translate_out)
+		a3real3SetReal4(translate_out, m[3]);
+	return a3real4x4GetEulerXYZIgnoreScale(m, degrees_x_out, degrees_y_out, degrees_z_out);
+}
+
+A3DM_INLINE a3real4x4rk a3real4x4GetEulerZYXTranslateIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out, a3real3p translate_out)
+{
+	if (translate_out)
+		a3real3SetReal4(translate_out, m[3]);
+	return a3real4x4GetEulerZYXIgnoreScale(m, degrees_x_out, degrees_y_out, degrees_z_out);
+}
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real4r a3real4ProductTransform(a3real4p v_out, const a3real4p v, const a3real4x4p m)
+{
+	// row vector; the majors' last elements hold translation
+	const a3real x = a3real4Dot(v, m[0]);
+	const a3real y = a3real4Dot(v, m[1]);
+	const a3real z = a3real4Dot(v, m[2]);
+	return a3real4Set(v_out, x, y, z, v[3]);
+}
+
+A3DM_INLINE a3real4r a3real4TransformProduct(a3real4p v_out, const a3real4x4p m, const a3real4p v)
+{
+	// column vector; the last major holds translation
+	const a3real x = m[0][0] * v[0] + m[1][0] * v[1] + m[2][0] * v[2] + m[3][0] * v[3];
+	const a3real y = m[0][1] * v[0] + m[1][1] * v[1] + m[2][1] * v[2] + m[3][1] * v[3];
+	const a3real z = m[0][2] * v[0] + m[1][2] * v[1] + m[2][2] * v[2] + m[3][2] * v[3];
+	return a3real4Set(v_out, x, y, z, v[3]);
+}
+
+A3DM_INLINE a3real4r a3real4MulTransform(a3real4p v_inout, const a3real4x4p m)
+{
+	return a3real4ProductTransform(v_inout, v_inout, m);
+}
+
+A3DM_INLINE a3real4r a3real4TransformMul(const a3real4x4p m, a3real4p v_inout)
+{
+	return a3real4TransformProduct(v_inout, m, v_inout);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4ProductTransform(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR)
+{
+	// affine product: bottom elements are assumed to be (0, 0, 0, 1) and 
+	//	are written as such; output may alias either input
+#ifdef A3_USING_INTRIN
+	const __m128 l0 = _mm_loadu_ps(mL[0]), l1 = _mm_loadu_ps(mL[1]), l2 = _mm_loadu_ps(mL[2]), l3 = _mm_loadu_ps(mL[3]);
+	const __m128 r0 = _mm_loadu_ps(mR[0]), r1 = _mm_loadu_ps(mR[1]), r2 = _mm_loadu_ps(mR[2]), r3 = _mm_loadu_ps(mR[3]);
+	const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)), w = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+	__m128 o0 = _mm_mul_ps(l0, a3intrinSplat(r0, 0)), o1 = _mm_mul_ps(l0, a3intrinSplat(r1, 0));
+	__m128 o2 = _mm_mul_ps(l0, a3intrinSplat(r2, 0)), o3 = a3intrinMulAdd(l0, a3intrinSplat(r3, 0), l3);
+	o0 = a3intrinMulAdd(l1, a3intrinSplat(r0, 1), o0);
+	o1 = a3intrinMulAdd(l1, a3intrinSplat(r1, 1), o1);
+	o2 = a3intrinMulAdd(l1, a3intrinSplat(r2, 1), o2);
+	o3 = a3intrinMulAdd(l1, a3intrinSplat(r3, 1), o3);
+	o0 = a3intrinMulAdd(l2, a3intrinSplat(r0, 2), o0);
+	o1 = a3intrinMulAdd(l2, a3intrinSplat(r1, 2), o1);
+	o2 = a3intrinMulAdd(l2, a3intrinSplat(r2, 2), o2);
+	o3 = a3intrinMulAdd(l2, a3intrinSplat(r3, 2), o3);
+	_mm_storeu_ps(m_out[0], _mm_and_ps(o0, mask));
+	_mm_storeu_ps(m_out[1], _mm_and_ps(o1, mask));
+	_mm_storeu_ps(m_out[2], _mm_and_ps(o2, mask));
+	_mm_storeu_ps(m_out[3], _mm_or_ps(_mm_and_ps(o3, mask), w));
+	return m_out;
+#else	// !A3_USING_INTRIN
+	a3mat3 l;
+	a3mat4 tmp;
+	a3real3x3SetReal4x4(l.m, mL);
+	a3real3Real3x3ProductR(tmp.m[0], l.m, mR[0]);
+	a3real3Real3x3ProductR(tmp.m[1], l.m, mR[1]);
+	a3real3Real3x3ProductR(tmp.m[2], l.m, mR[2]);
+	a3real3Real3x3ProductR(tmp.m[3], l.m, mR[3]);
+	a3real3Add(tmp.m[3], mL[3]);
+	a3real4Set(m_out[0], tmp.m[0][0], tmp.m[0][1], tmp.m[0][2], a3real_zero);
+	a3real4Set(m_out[1], tmp.m[1][0], tmp.m[1][1], tmp.m[1][2], a3real_zero);
+	a3real4Set(m_out[2], tmp.m[2][0], tmp.m[2][1], tmp.m[2][2], a3real_zero);
+	a3real4Set(m_out[3], tmp.m[3][0], tmp.m[3][1], tmp.m[3][2], a3real_one);
+	return m_out;
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real4x4r a3real4x4MulTransform(a3real4x4p mL_inout, const a3real4x4p mR)
+{
+	return a3real4x4ProductTransform(mL_inout, mL_inout, mR);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformMul(const a3real4x4p mL, a3real4x4p mR_inout)
+{
+	return a3real4x4ProductTransform(mR_inout, mL, mR_inout);
+}
+
+
+// internal: finish affine inverse given the inverse of the upper 3x3
+A3DM_INLINE a3real4x4r a3real4x4InternalTransformInverse(a3real4x4p m_out, const a3real3x3p rInv, const a3real4p t)
+{
+	a3real3 tInv;
+	a3real3Real3x3ProductR(tInv, rInv, t);
+	a3real4Set(m_out[0], rInv[0][0], rInv[0][1], rInv[0][2], a3real_zero);
+	a3real4Set(m_out[1], rInv[1][0], rInv[1][1], rInv[1][2], a3real_zero);
+	a3real4Set(m_out[2], rInv[2][0], rInv[2][1], rInv[2][2], a3real_zero);
+	a3real4Set(m_out[3], -tInv[0], -tInv[1], -tInv[2], a3real_one);
+	return m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformInverse(a3real4x4p m_out, const a3real4x4p m)
+{
+	a3mat3 r;
+	a3real4 t;
+	a3real3x3SetReal4x4(r.m, m);
+	a3real3x3Invert(r.m);
+	a3real4SetReal4(t, m[3]);
+	return a3real4x4InternalTransformInverse(m_out, r.m, t);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformInverseIgnoreScale(a3real4x4p m_out, const a3real4x4p m)
+{
+	a3mat3 r;
+	a3real4 t;
+	a3real3x3SetReal4x4(r.m, m);
+	a3real3x3Transpose(r.m);
+	a3real4SetReal4(t, m[3]);
+	return a3real4x4InternalTransformInverse(m_out, r.m, t);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformInverseUniformScale(a3real4x4p m_out, const a3real4x4p m)
+{
+	// transpose over squared scale, measured on the first major
+	a3mat3 r;
+	a3real4 t;
+	a3real3x3SetReal4x4(r.m, m);
+	a3real3x3Transpose(r.m);
+	a3real3x3MulS(r.m, a3real3LengthSquaredInverse(r.m[0]));
+	a3real4SetReal4(t, m[3]);
+	return a3real4x4InternalTransformInverse(m_out, r.m, t);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformInvert(a3real4x4p m_inout)
+{
+	return a3real4x4TransformInverse(m_inout, m_inout);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformInvertIgnoreScale(a3real4x4p m_inout)
+{
+	return a3real4x4TransformInverseIgnoreScale(m_inout, m_inout);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformInvertUniformScale(a3real4x4p m_inout)
+{
+	return a3real4x4TransformInverseUniformScale(m_inout, m_inout);
+}
+
+
+A3DM_INLINE a3real4x4r a3real4x4MakeLookAt(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real3p eyePos, const a3real3p targetPos, const a3real3p worldUpVec)
+{
+	a3mat3 r;
+	a3real3x3MakeLookAt(r.m, 0, eyePos, targetPos, worldUpVec);
+	a3real4x4SetReal3x3(m_out, r.m);
+	a3real4SetReal3W(m_out[3], eyePos, a3real_one);
+	if (mInv_out_opt)
+		a3real4x4TransformInverseIgnoreScale(mInv_out_opt, m_out);
+	return m_out;
+}
+
+
+A3DM_INLINE a3real4x4r a3real4x4MakePerspectiveProjection(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real fovyDegrees, const a3real aspect, const a3real nearDist, const a3real farDist)
+{
+	// symmetric frustum
+	const a3real topDist = nearDist * a3tand(a3real_half * fovyDegrees), rightDist = topDist * aspect;
+	return a3real4x4MakePerspectiveProjectionPlanes(m_out, mInv_out_opt, rightDist, -rightDist, topDist, -topDist, nearDist, farDist);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4MakePerspectiveProjectionPlanes(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real rightDist, const a3real leftDist, const a3real topDist, const a3real bottomDist, const a3real nearDist, const a3real farDist)
+{
+	// OpenGL-style frustum; the inverse is written directly from its 
+	//	sparse form; invalid planes yield identity
+	if (rightDist != leftDist && topDist != bottomDist && nearDist > a3real_zero && farDist > nearDist)
+	{
+		const a3real rl = a3recip(rightDist - leftDist), tb = a3recip(topDist - bottomDist), fn = a3recip(farDist - nearDist);
+		const a3real near2 = nearDist + nearDist;
+		const a3real sx = near2 * rl, sy = near2 * tb;
+		const a3real ox = (rightDist + leftDist) * rl, oy = (topDist + bottomDist) * tb;
+		const a3real sz = -(farDist + nearDist) * fn, oz = -near2 * farDist * fn;
+		a3real4x4Set(m_out,
+			sx, a3real_zero, a3real_zero, a3real_zero,
+			a3real_zero, sy, a3real_zero, a3real_zero,
+			ox, oy, sz, -a3real_one,
+			a3real_zero, a3real_zero, oz, a3real_zero);
+		if (mInv_out_opt)
+		{
+			const a3real sxInv = a3recip(sx), syInv = a3recip(sy), ozInv = a3recip(oz);
+			a3real4x4Set(mInv_out_opt,
+				sxInv, a3real_zero, a3real_zero, a3real_zero,
+				a3real_zero, syInv, a3real_zero, a3real_zero,
+				a3real_zero, a3real_zero, a3real_zero, ozInv,
+				ox * sxInv, oy * syInv, -a3real_one, sz * ozInv);
+		}
+		return m_out;
+	}
+	if (mInv_out_opt)
+		a3real4x4SetReal4x4(mInv_out_opt, a3mat4_identity.m);
+	return a3real4x4SetReal4x4(m_out, a3mat4_identity.m);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4MakeOrthographicProjection(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real width, const a3real height, const a3real nearDist, const a3real farDist)
+{
+	const a3real rightDist = a3real_half * width, topDist = a3real_half * height;
+	return a3real4x4MakeOrthographicProjectionPlanes(m_out, mInv_out_opt, rightDist, -rightDist, topDist, -topDist, nearDist, farDist);
+}
+
+A3DM_INLINE a3real4x4r a3real4x4MakeOrthographicProjectionPlanes(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real rightDist, const a3real leftDist, const a3real topDist, const a3real bottomDist, const a3real nearDist, const a3real farDist)
+{
+	// invalid planes yield identity
+	if (rightDist != leftDist && topDist != bottomDist && farDist != nearDist)
+	{
+		const a3real rl = a3recip(rightDist - leftDist), tb = a3recip(topDist - bottomDist), fn = a3recip(farDist - nearDist);
+		const a3real sx = a3real_two * rl, sy = a3real_two * tb, sz = -a3real_two * fn;
+		const a3real ox = -(rightDist + leftDist) * rl, oy = -(topDist + bottomDist) * tb, oz = -(farDist + nearDist) * fn;
+		a3real4x4Set(m_out,
+			sx, a3real_zero, a3real_zero, a3real_zero,
+			a3real_zero, sy, a3real_zero, a3real_zero,
+			a3real_zero, a3real_zero, sz, a3real_zero,
+			ox, oy, oz, a3real_one);
+		if (mInv_out_opt)
+		{
+			const a3real sxInv = a3recip(sx), syInv = a3recip(sy), szInv = a3recip(sz);
+			a3real4x4Set(mInv_out_opt,
+				sxInv, a3real_zero, a3real_zero, a3real_zero,
+				a3real_zero, syInv, a3real_zero, a3real_zero,
+				a3real_zero, a3real_zero, szInv, a3real_zero,
+				-ox * sxInv, -oy * syInv, -oz * szInv, a3real_one);
+		}
+		return m_out;
+	}
+	if (mInv_out_opt)
+		a3real4x4SetReal4x4(mInv_out_opt, a3mat4_identity.m);
+	return a3real4x4SetReal4x4(m_out, a3mat4_identity.m);
+}
+
+
+A3DM_INLINE a3real4x4r a3real4x4ConvertProjectionToStereo(a3real4x4p mL_out, a3real4x4p mR_out, a3real4x4p mInvL_out_opt, a3real4x4p mInvR_out_opt, const a3real4x4p mono, const a3real4x4p monoInv_opt, const a3real interocularDist, const a3real convergenceDist)
+{
+	// each eye is offset along view X and sheared so that the convergence 
+	//	plane has zero parallax: P_eye = P_mono * H, where H moves X by 
+	//	-eye * (1 + z / convergence); H is inverted by negating the offset
+	const a3real eyeR = a3real_half * interocularDist;
+	const a3real shearR = convergenceDist > a3real_zero ? a3recip(convergenceDist) * eyeR : a3real_zero;
+	a3mat4 h = a3mat4_identity, monoInv;
+	if (mInvL_out_opt || mInvR_out_opt)
+	{
+		if (monoInv_opt)
+			a3real4x4SetReal4x4(monoInv.m, monoInv_opt);
+		else
+			a3real4x4GetInverse(monoInv.m, mono);
+	}
+
+	h.m20 = +shearR;
+	h.m30 = +eyeR;
+	a3real4x4Product(mL_out, mono, h.m);
+	if (mInvL_out_opt)
+	{
+		h.m20 = -shearR;
+		h.m30 = -eyeR;
+		a3real4x4Product(mInvL_out_opt, h.m, monoInv.m);
+	}
+
+	h.m20 = -shearR;
+	h.m30 = -eyeR;
+	a3real4x4Product(mR_out, mono, h.m);
+	if (mInvR_out_opt)
+	{
+		h.m20 = +shearR;
+		h.m30 = +eyeR;
+		a3real4x4Product(mInvR_out_opt, h.m, monoInv.m);
+	}
+	return mR_out;
+}
+
+
+A3DM_INLINE a3boolean a3real4x4CheckPerspective(const a3real4x4p m)
+{
+	// last minor is (0, 0, -1, 0)
+	return (m[0][3] == a3real_zero && m[1][3] == a3real_zero && m[2][3] == -a3real_one && m[3][3] == a3real_zero);
+}
+
+A3DM_INLINE a3boolean a3real4x4CheckOrthographic(const a3real4x4p m)
+{
+	// last minor is (0, 0, 0, 1)
+	return (m[0][3] == a3real_zero && m[1][3] == a3real_zero && m[2][3] == a3real_zero && m[3][3] == a3real_one);
+}
+
+A3DM_INLINE a3boolean a3real4x4CheckStereo(const a3real4x4p m)
+{
+	// horizontal shear by depth is introduced by the stereo conversion
+	return (m[2][0] != a3real_zero);
+}
+
+A3DM_INLINE a3integer a3real4x4CheckPerspectiveStereo(const a3real4x4p m)
+{
+	return (a3real4x4CheckPerspective(m) ? a3real4x4CheckStereo(m) ? 1 : -1 : 0);
+}
+
+A3DM_INLINE a3integer a3real4x4CheckOrthographicStereo(const a3real4x4p m)
+{
+	return (a3real4x4CheckOrthographic(m) ? a3real4x4CheckStereo(m) ? 1 : -1 : 0);
+}
+
+
+//-----------------------------------------------------------------------------
+
+#ifdef A3_USING_INTRIN
+// internal: cross product of lane columns
+A3DM_INLINE void a3real4x4InternalCrossLanes(a3intrinLanes v_out[3], const a3intrinLanes a[3], const a3intrinLanes b[3])
+{
+	v_out[0] = a3intrinLanesSub(a3intrinLanesMul(a[1], b[2]), a3intrinLanesMul(a[2], b[1]));
+	v_out[1] = a3intrinLanesSub(a3intrinLanesMul(a[2], b[0]), a3intrinLanesMul(a[0], b[2]));
+	v_out[2] = a3intrinLanesSub(a3intrinLanesMul(a[0], b[1]), a3intrinLanesMul(a[1], b[0]));
+}
+
+// internal: affine inverse of lane group, optionally transposed; all inputs 
+//	are read before the first write, so output may alias input
+A3DM_INLINE void a3real4x4InternalTransformInverseLanes(a3intrinLanes e_out[16], const a3intrinLanes e[16], const a3boolean transpose)
+{
+	// rows of the 3x3 inverse are cross products of the other two columns, 
+	//	over the determinant (zero if singular, like the scalar path)
+	const a3intrinLanes zero = a3intrinLanesSet1(a3real_zero), one = a3intrinLanesSet1(a3real_one);
+	a3intrinLanes x[9], t[3], det, detInv;
+	a3real4x4InternalCrossLanes(x + 0, e + 4, e + 8);
+	a3real4x4InternalCrossLanes(x + 3, e + 8, e + 0);
+	a3real4x4InternalCrossLanes(x + 6, e + 0, e + 4);
+	det = a3intrinLanesMul(e[0], x[0]);
+	det = a3intrinLanesMulAdd(e[1], x[1], det);
+	det = a3intrinLanesMulAdd(e[2], x[2], det);
+	detInv = a3intrinLanesAnd(a3intrinLanesDiv(one, det), a3intrinLanesNotEqual(det, zero));
+	x[0] = a3intrinLanesMul(x[0], detInv);
+	x[1] = a3intrinLanesMul(x[1], detInv);
+	x[2] = a3intrinLanesMul(x[2], detInv);
+	x[3] = a3intrinLanesMul(x[3], detInv);
+	x[4] = a3intrinLanesMul(x[4], detInv);
+	x[5] = a3intrinLanesMul(x[5], detInv);
+	x[6] = a3intrinLanesMul(x[6], detInv);
+	x[7] = a3intrinLanesMul(x[7], detInv);
+	x[8] = a3intrinLanesMul(x[8], detInv);
+
+	// inverse translation: -(A^-1 t)
+	t[0] = a3intrinLanesSub(zero, a3intrinLanesMulAdd(x[2], e[14], a3intrinLanesMulAdd(x[1], e[13], a3intrinLanesMul(x[0], e[12]))));
+	t[1] = a3intrinLanesSub(zero, a3intrinLanesMulAdd(x[5], e[14], a3intrinLanesMulAdd(x[4], e[13], a3intrinLanesMul(x[3], e[12]))));
+	t[2] = a3intrinLanesSub(zero, a3intrinLanesMulAdd(x[8], e[14], a3intrinLanesMulAdd(x[7], e[13], a3intrinLanesMul(x[6], e[12]))));
+
+	// element [c][r] of the inverse is row r of x, component c
+	if (transpose)
+	{
+		e_out[0] = x[0];	e_out[1] = x[1];	e_out[2] = x[2];	e_out[3] = t[0];
+		e_out[4] = x[3];	e_out[5] = x[4];	e_out[6] = x[5];	e_out[7] = t[1];
+		e_out[8] = x[6];	e_out[9] = x[7];	e_out[10] = x[8];	e_out[11] = t[2];
+		e_out[12] = zero;	e_out[13] = zero;	e_out[14] = zero;
+	}
+	else
+	{
+		e_out[0] = x[0];	e_out[1] = x[3];	e_out[2] = x[6];	e_out[3] = zero;
+		e_out[4] = x[1];	e_out[5] = x[4];	e_out[6] = x[7];	e_out[7] = zero;
+		e_out[8] = x[2];	e_out[9] = x[5];	e_out[10] = x[8];	e_out[11] = zero;
+		e_out[12] = t[0];	e_out[13] = t[1];	e_out[14] = t[2];
+	}
+	e_out[15] = one;
+}
+#endif	// A3_USING_INTRIN
+
+
+// products stay one matrix per register group: broadcasting the right-hand 
+//	elements costs the same as transposing to lanes and needs no transposes 
+//	back, so only the shared operands are hoisted out of the loop
+A3DM_INLINE a3real4x4r a3real4x4ProductArray(a3real4x4 m_out[], const a3real4x4 mL[], const a3real4x4 mR[], const a3count count)
+{
+	a3index i;
+	for (i = 0; i < count; ++i)
+		a3real4x4Product(m_out[i], mL[i], mR[i]);
+	return *m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4ProductArrayUniformL(a3real4x4 m_out[], const a3real4x4p mL, const a3real4x4 mR[], const a3count count)
+{
+	a3index i;
+#ifdef A3_USING_INTRIN
+	// left columns live in registers for the whole loop
+	const __m128 l0 = _mm_loadu_ps(mL[0]), l1 = _mm_loadu_ps(mL[1]), l2 = _mm_loadu_ps(mL[2]), l3 = _mm_loadu_ps(mL[3]);
+	__m128 r, o0, o1, o2, o3;
+	for (i = 0; i < count; ++i)
+	{
+		r = _mm_loadu_ps(mR[i][0]);
+		o0 = a3intrinMulAdd(l3, a3intrinSplat(r, 3), a3intrinMulAdd(l2, a3intrinSplat(r, 2), a3intrinMulAdd(l1, a3intrinSplat(r, 1), _mm_mul_ps(l0, a3intrinSplat(r, 0)))));
+		r = _mm_loadu_ps(mR[i][1]);
+		o1 = a3intrinMulAdd(l3, a3intrinSplat(r, 3), a3intrinMulAdd(l2, a3intrinSplat(r, 2), a3intrinMulAdd(l1, a3intrinSplat(r, 1), _mm_mul_ps(l0, a3intrinSplat(r, 0)))));
+		r = _mm_loadu_ps(mR[i][2]);
+		o2 = a3intrinMulAdd(l3, a3intrinSplat(r, 3), a3intrinMulAdd(l2, a3intrinSplat(r, 2), a3intrinMulAdd(l1, a3intrinSplat(r, 1), _mm_mul_ps(l0, a3intrinSplat(r, 0)))));
+		r = _mm_loadu_ps(mR[i][3]);
+		o3 = a3intrinMulAdd(l3, a3intrinSplat(r, 3), a3intrinMulAdd(l2, a3intrinSplat(r, 2), a3intrinMulAdd(l1, a3intrinSplat(r, 1), _mm_mul_ps(l0, a3intrinSplat(r, 0)))));
+		_mm_storeu_ps(m_out[i][0], o0);
+		_mm_storeu_ps(m_out[i][1], o1);
+		_mm_storeu_ps(m_out[i][2], o2);
+		_mm_storeu_ps(m_out[i][3], o3);
+	}
+#else	// !A3_USING_INTRIN
+	for (i = 0; i < count; ++i)
+		a3real4x4Product(m_out[i], mL, mR[i]);
+#endif	// A3_USING_INTRIN
+	return *m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4ProductArrayUniformR(a3real4x4 m_out[], const a3real4x4 mL[], const a3real4x4p mR, const a3count count)
+{
+	a3index i;
+#ifdef A3_USING_INTRIN
+	// right elements are broadcast once, so the loop is pure multiply-add
+	__m128 r[16], l0, l1, l2, l3;
+	for (i = 0; i < 16; ++i)
+		r[i] = _mm_set1_ps(mR[i >> 2][i & 3]);
+	for (i = 0; i < count; ++i)
+	{
+		l0 = _mm_loadu_ps(mL[i][0]);
+		l1 = _mm_loadu_ps(mL[i][1]);
+		l2 = _mm_loadu_ps(mL[i][2]);
+		l3 = _mm_loadu_ps(mL[i][3]);
+		_mm_storeu_ps(m_out[i][0], a3intrinMulAdd(l3, r[3], a3intrinMulAdd(l2, r[2], a3intrinMulAdd(l1, r[1], _mm_mul_ps(l0, r[0])))));
+		_mm_storeu_ps(m_out[i][1], a3intrinMulAdd(l3, r[7], a3intrinMulAdd(l2, r[6], a3intrinMulAdd(l1, r[5], _mm_mul_ps(l0, r[4])))));
+		_mm_storeu_ps(m_out[i][2], a3intrinMulAdd(l3, r[11], a3intrinMulAdd(l2, r[10], a3intrinMulAdd(l1, r[9], _mm_mul_ps(l0, r[8])))));
+		_mm_storeu_ps(m_out[i][3], a3intrinMulAdd(l3, r[15], a3intrinMulAdd(l2, r[14], a3intrinMulAdd(l1, r[13], _mm_mul_ps(l0, r[12])))));
+	}
+#else	// !A3_USING_INTRIN
+	for (i = 0; i < count; ++i)
+		a3real4x4Product(m_out[i], mL[i], mR);
+#endif	// A3_USING_INTRIN
+	return *m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformInverseArray(a3real4x4 m_out[], const a3real4x4 m[], const a3count count)
+{
+	a3index i = 0;
+#ifdef A3_USING_INTRIN
+	a3intrinLanes e[16];
+	for (; i + a3intrinLaneCount <= count; i += a3intrinLaneCount)
+	{
+		a3intrinLanesLoadMat4(e, m + i);
+		a3real4x4InternalTransformInverseLanes(e, e, a3false);
+		a3intrinLanesStoreMat4(m_out + i, e);
+	}
+#endif	// A3_USING_INTRIN
+	for (; i < count; ++i)
+		a3real4x4TransformInverse(m_out[i], m[i]);
+	return *m_out;
+}
+
+A3DM_INLINE a3real4x4r a3real4x4TransformInverseTransposeArray(a3real4x4 m_out[], const a3real4x4 m[], const a3count count)
+{
+	a3mat4 tmp;
+	a3index i = 0;
+#ifdef A3_USING_INTRIN
+	a3intrinLanes e[16];
+	for (; i + a3intrinLaneCount <= count; i += a3intrinLaneCount)
+	{
+		a3intrinLanesLoadMat4(e, m + i);
+		a3real4x4InternalTransformInverseLanes(e, e, a3true);
+		a3intrinLanesStoreMat4(m_out + i, e);
+	}
+#endif	// A3_USING_INTRIN
+	for (; i < count; ++i)
+	{
+		a3real4x4TransformInverse(tmp.m, m[i]);
+		a3real4x4GetTransposed(m_out[i], tmp.m);
+	}
+	return *m_out;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_MATRIX4_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_MATRIX_H
\ No newline at end of file
@@ -0,0 +1,750 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3quaternion_impl.inl
+	Implementations for quaternion functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_QUATERNION_H
+#ifndef __ANIMAL3D_A3DM_QUATERNION_IMPL_INL
+#define __ANIMAL3D_A3DM_QUATERNION_IMPL_INL
+
+
+#include "../a3trig.h"
+#include "a3intrin_impl.inl"
+
+
+A3_BEGIN_IMPL
+
+
+// preset constants
+A3DM_GLOBAL const a3quat a3quat_identity = { { a3real_zero, a3real_zero, a3real_zero, a3real_one } };
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real4r a3quatSetIdentity(a3real4p q_out)
+{
+	return a3real4SetReal4(q_out, a3quat_identity.q);
+}
+
+A3DM_INLINE a3real4r a3quatSet(a3real4p q_out, const a3real x, const a3real y, const a3real z, const a3real w)
+{
+	return a3real4Set(q_out, x, y, z, w);
+}
+
+A3DM_INLINE a3real4r a3quatSetReal4(a3real4p q_out, const a3real4p v)
+{
+	return a3real4SetReal4(q_out, v);
+}
+
+
+A3DM_INLINE a3real4r a3quatSetAxisAngle(a3real4p q_out, const a3real3p unitAxis, const a3real degrees)
+{
+	// half angle: vector part is the sine-scaled axis
+	const a3real halfDegrees = a3real_half * degrees, s = a3sind(halfDegrees);
+	return a3real4Set(q_out, unitAxis[0] * s, unitAxis[1] * s, unitAxis[2] * s, a3cosd(halfDegrees));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerX(a3real4p q_out, const a3real degrees_x)
+{
+	const a3real halfDegrees = a3real_half * degrees_x;
+	return a3real4Set(q_out, a3sind(halfDegrees), a3real_zero, a3real_zero, a3cosd(halfDegrees));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerY(a3real4p q_out, const a3real degrees_y)
+{
+	const a3real halfDegrees = a3real_half * degrees_y;
+	return a3real4Set(q_out, a3real_zero, a3sind(halfDegrees), a3real_zero, a3cosd(halfDegrees));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerZ(a3real4p q_out, const a3real degrees_z)
+{
+	const a3real halfDegrees = a3real_half * degrees_z;
+	return a3real4Set(q_out, a3real_zero, a3real_zero, a3sind(halfDegrees), a3cosd(halfDegrees));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerXYZ(a3real4p q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z)
+{
+	// q = qz * qy * qx, expanded; matches the matrix convention
+	const a3real hx = a3real_half * degrees_x, hy = a3real_half * degrees_y, hz = a3real_half * degrees_z;
+	const a3real cx = a3cosd(hx), sx = a3sind(hx), cy = a3cosd(hy), sy = a3sind(hy), cz = a3cosd(hz), sz = a3sind(hz);
+	return a3real4Set(q_out,
+		sx * cy * cz - cx * sy * sz,
+		cx * sy * cz + sx * cy * sz,
+		cx * cy * sz - sx * sy * cz,
+		cx * cy * cz + sx * sy * sz);
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerZYX(a3real4p q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z)
+{
+	// q = qx * qy * qz, expanded
+	const a3real hx = a3real_half * degrees_x, hy = a3real_half * degrees_y, hz = a3real_half * degrees_z;
+	const a3real cx = a3cosd(hx), sx = a3sind(hx), cy = a3cosd(hy), sy = a3sind(hy), cz = a3cosd(hz), sz = a3sind(hz);
+	return a3real4Set(q_out,
+		sx * cy * cz + cx * sy * sz,
+		cx * sy * cz - sx * cy * sz,
+		cx * cy * sz + sx * sy * cz,
+		cx * cy * cz - sx * sy * sz);
+}
+
+A3DM_INLINE a3real4r a3quatSetVectorDelta(a3real4p q_out, const a3real3p unitV0, const a3real3p unitV1)
+{
+	// half-way construction: (v0 x v1, 1 + v0 . v1) normalized; opposite 
+	//	vectors rotate half a turn about any perpendicular axis
+	const a3real w = a3real_one + a3real3Dot(unitV0, unitV1);
+	a3real3 axis;
+	if (w > a3real_epsilon)
+	{
+		a3real3Cross(axis, unitV0, unitV1);
+		a3real4Set(q_out, axis[0], axis[1], axis[2], w);
+		return a3real4Normalize(q_out);
+	}
+	if (a3absolute(unitV0[0]) < a3real_half)
+		a3real3CrossUnit(axis, a3vec3_x.v, unitV0);
+	else
+		a3real3CrossUnit(axis, a3vec3_y.v, unitV0);
+	return a3real4Set(q_out, axis[0], axis[1], axis[2], a3real_zero);
+}
+
+
+// scale is encoded as squared length, so components scale by its root
+A3DM_INLINE a3real4r a3quatSetAxisAngleScale(a3real4p q_out, const a3real3p unitAxis, const a3real degrees, const a3real s)
+{
+	a3quatSetAxisAngle(q_out, unitAxis, degrees);
+	return a3real4MulS(q_out, a3sqrt(s));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerXScale(a3real4p q_out, const a3real degrees_x, const a3real s)
+{
+	a3quatSetEulerX(q_out, degrees_x);
+	return a3real4MulS(q_out, a3sqrt(s));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerYScale(a3real4p q_out, const a3real degrees_y, const a3real s)
+{
+	a3quatSetEulerY(q_out, degrees_y);
+	return a3real4MulS(q_out, a3sqrt(s));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerZScale(a3real4p q_out, const a3real degrees_z, const a3real s)
+{
+	a3quatSetEulerZ(q_out, degrees_z);
+	return a3real4MulS(q_out, a3sqrt(s));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerXYZScale(a3real4p q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3real s)
+{
+	a3quatSetEulerXYZ(q_out, degrees_x, degrees_y, degrees_z);
+	return a3real4MulS(q_out, a3sqrt(s));
+}
+
+A3DM_INLINE a3real4r a3quatSetEulerZYXScale(a3real4p q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3real s)
+{
+	a3quatSetEulerZYX(q_out, degrees_x, degrees_y, degrees_z);
+	return a3real4MulS(q_out, a3sqrt(s));
+}
+
+A3DM_INLINE a3real4r a3quatSetVectorDeltaScale(a3real4p q_out, const a3real3p unitV0, const a3real3p unitV1, const a3real s)
+{
+	a3quatSetVectorDelta(q_out, unitV0, unitV1);
+	return a3real4MulS(q_out, a3sqrt(s));
+}
+
+A3DM_INLINE a3real4r a3quatSetScale(a3real4p q_out, const a3real s)
+{
+	return a3real4Set(q_out, a3real_zero, a3real_zero, a3real_zero, a3sqrt(s));
+}
+
+
+A3DM_INLINE a3real4r a3quatGetConjugated(a3real4p q_out, const a3real4p q)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(q_out, a3intrinFlip(_mm_loadu_ps(q), -0.0f, -0.0f, -0.0f, +0.0f));
+	return q_out;
+#else	// !A3_USING_INTRIN
+	return a3real4Set(q_out, -q[0], -q[1], -q[2], q[3]);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real4r a3quatGetInverse(a3real4p q_out, const a3real4p q)
+{
+	return a3quatGetInverseGetScale(q_out, 0, q);
+}
+
+A3DM_INLINE a3real4r a3quatGetInverseGetScale(a3real4p q_out, a3real *s_out, const a3real4p q)
+{
+	// conjugate over squared length; the squared length is the scale
+	const a3real s = a3real4LengthSquared(q);
+	if (s_out)
+		*s_out = s;
+	a3quatGetConjugated(q_out, q);
+	return a3real4MulS(q_out, a3recipsafe(s));
+}
+
+A3DM_INLINE a3real4r a3quatGetInverseIgnoreScale(a3real4p q_out, const a3real4p q)
+{
+	return a3quatGetConjugated(q_out, q);
+}
+
+A3DM_INLINE a3real4r a3quatConjugate(a3real4p q_inout)
+{
+	return a3quatGetConjugated(q_inout, q_inout);
+}
+
+A3DM_INLINE a3real4r a3quatInvert(a3real4p q_inout)
+{
+	return a3quatGetInverseGetScale(q_inout, 0, q_inout);
+}
+
+A3DM_INLINE a3real4r a3quatInvertGetScale(a3real4p q_inout, a3real *s_out)
+{
+	return a3quatGetInverseGetScale(q_inout, s_out, q_inout);
+}
+
+A3DM_INLINE a3real4r a3quatInvertIgnoreScale(a3real4p q_inout)
+{
+	return a3quatGetConjugated(q_inout, q_inout);
+}
+
+
+A3DM_INLINE a3real4rk a3quatGetAxisAngle(const a3real4p q, a3real3p unitAxis_out, a3real *degrees_out)
+{
+	return a3quatGetAxisAngleScale(q, unitAxis_out, degrees_out, 0);
+}
+
+A3DM_INLINE a3real4rk a3quatGetAxisAngleScale(const a3real4p q, a3real3p unitAxis_out, a3real *degrees_out, a3real *s_out)
+{
+	// angle from both parts, so scale cancels out of the ratio; identity 
+	//	reports the X axis
+	const a3real lenSqV = a3real3LengthSquared(q), lenV = a3sqrt(lenSqV);
+	if (unitAxis_out)
+	{
+		if (lenV > a3real_zero)
+			a3real3ProductS(unitAxis_out, q, a3recip(lenV));
+		else
+			a3real3SetReal3(unitAxis_out, a3vec3_x.v);
+	}
+	if (degrees_out)
+		*degrees_out = a3real_two * a3atan2d(lenV, q[3]);
+	if (s_out)
+		*s_out = lenSqV + q[3] * q[3];
+	return q;
+}
+
+A3DM_INLINE a3real4rk a3quatGetAxisAngleIgnoreScale(const a3real4p q, a3real3p unitAxis_out, a3real *degrees_out)
+{
+	// unit: sine of the half angle is the vector length
+	const a3real w = a3clamp(-a3real_one, a3real_one, q[3]);
+	if (unitAxis_out)
+	{
+		a3real3SetReal3(unitAxis_out, q);
+		if (a3real3LengthSquared(unitAxis_out) > a3real_zero)
+			a3real3Normalize(unitAxis_out);
+		else
+			a3real3SetReal3(unitAxis_out, a3vec3_x.v);
+	}
+	if (degrees_out)
+		*degrees_out = a3real_two * a3acosd(w);
+	return q;
+}
+
+
+A3DM_INLINE a3real4rk a3quatGetEulerXYZ(const a3real4p q, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out)
+{
+	return a3quatGetEulerXYZScale(q, degrees_x_out, degrees_y_out, degrees_z_out, 0);
+}
+
+A3DM_INLINE a3real4rk a3quatGetEulerZYX(const a3real4p q, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out)
+{
+	return a3quatGetEulerZYXScale(q, degrees_x_out, degrees_y_out, degrees_z_out, 0);
+}
+
+A3DM_INLINE a3real4rk a3quatGetEulerXYZScale(const a3real4p q, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out, a3real *s_out)
+{
+	a3real4 u;
+	a3real invLength;
+	a3real4GetUnitInvLength(u, q, &invLength);
+	if (s_out)
+		*s_out = a3recipsafe(invLength * invLength);
+	a3quatGetEulerXYZIgnoreScale(u, degrees_x_out, degrees_y_out, degrees_z_out);
+	return q;
+}
+
+A3DM_INLINE a3real4rk a3quatGetEulerZYXScale(const a3real4p q, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out, a3real *s_out)
+{
+	a3real4 u;
+	a3real invLength;
+	a3real4GetUnitInvLength(u, q, &invLength);
+	if (s_out)
+		*s_out = a3recipsafe(invLength * invLength);
+	a3quatGetEulerZYXIgnoreScale(u, degrees_x_out, degrees_y_out, degrees_z_out);
+	return q;
+}
+
+A3DM_INLINE a3real4rk a3quatGetEulerXYZIgnoreScale(const a3real4p q, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out)
+{
+	// via the rotation matrix, which handles gimbal lock
+	a3mat3 m;
+	a3quatConvertToMat3(m.m, q);
+	a3real3x3GetEulerXYZIgnoreScale(m.m, degrees_x_out, degrees_y_out, degrees_z_out);
+	return q;
+}
+
+A3DM_INLINE a3real4rk a3quatGetEulerZYXIgnoreScale(const a3real4p q, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out)
+{
+	a3mat3 m;
+	a3quatConvertToMat3(m.m, q);
+	a3real3x3GetEulerZYXIgnoreScale(m.m, degrees_x_out, degrees_y_out, degrees_z_out);
+	return q;
+}
+
+A3DM_INLINE a3real4rk a3quatGetScale(const a3real4p q, a3real *s_out)
+{
+	if (s_out)
+		*s_out = a3real4LengthSquared(q);
+	return q;
+}
+
+
+A3DM_INLINE a3real3x3r a3quatConvertToMat3(a3real3x3p m_out, const a3real4p q)
+{
+	// homogeneous form: non-unit input yields rotation times squared length
+	const a3real xx = q[0] * q[0], yy = q[1] * q[1], zz = q[2] * q[2], ww = q[3] * q[3];
+	const a3real xy = q[0] * q[1], xz = q[0] * q[2], yz = q[1] * q[2];
+	const a3real wx = q[3] * q[0], wy = q[3] * q[1], wz = q[3] * q[2];
+	return a3real3x3Set(m_out,
+		ww + xx - yy - zz, a3real_two * (xy + wz), a3real_two * (xz - wy),
+		a3real_two * (xy - wz), ww - xx + yy - zz, a3real_two * (yz + wx),
+		a3real_two * (xz + wy), a3real_two * (yz - wx), ww - xx - yy + zz);
+}
+
+A3DM_INLINE a3real4x4r a3quatConvertToMat4(a3real4x4p m_out, const a3real4p q)
+{
+	a3mat3 m;
+	a3quatConvertToMat3(m.m, q);
+	return a3real4x4SetReal3x3(m_out, m.m);
+}
+
+A3DM_INLINE a3real4x4r a3quatConvertToMat4Translate(a3real4x4p m_out, const a3real4p q, const a3real3p translate)
+{
+	a3quatConvertToMat4(m_out, q);
+	a3real3SetReal3(m_out[3], translate);
+	return m_out;
+}
+
+
+// internal: squared length encoded in a uniformly scaled rotation matrix
+#define a3quatInternalMatrixScale(m)	a3sqrt(m[0][0] * m[0][0] + m[0][1] * m[0][1] + m[0][2] * m[0][2])
+
+A3DM_INLINE a3real4r a3quatConvertFromMat3(a3real4p q_out, const a3real3x3p m)
+{
+	// trace only; fast but degrades as the rotation approaches half a turn
+	const a3real s = a3quatInternalMatrixScale(m);
+	const a3real w2 = a3sqrt(s + m[0][0] + m[1][1] + m[2][2]), r = a3recipsafe(w2 + w2);
+	return a3real4Set(q_out, (m[1][2] - m[2][1]) * r, (m[2][0] - m[0][2]) * r, (m[0][1] - m[1][0]) * r, a3real_half * w2);
+}
+
+A3DM_INLINE a3real4r a3quatConvertFromMat4(a3real4p q_out, const a3real4x4p m)
+{
+	a3mat3 r;
+	a3real3x3SetReal4x4(r.m, m);
+	return a3quatConvertFromMat3(q_out, r.m);
+}
+
+A3DM_INLINE a3real4r a3quatConvertFromMat4Translate(a3real4p q_out, a3real3p translate_out, const a3real4x4p m)
+{
+	if (translate_out)
+		a3real3SetReal4(translate_out, m[3]);
+	return a3quatConvertFromMat4(q_out, m);
+}
+
+A3DM_INLINE a3real4r a3quatConvertFromMat3Safe(a3real4p q_out, const a3real3x3p m)
+{
+	// branch on the largest component so its root is well-conditioned
+	const a3real s = a3quatInternalMatrixScale(m), t = m[0][0] + m[1][1] + m[2][2];
+	a3real c2, r;
+	if (t >= m[0][0] && t >= m[1][1] && t >= m[2][2])
+	{
+		c2 = a3sqrt(s + t);
+		r = a3recipsafe(c2 + c2);
+		return a3real4Set(q_out, (m[1][2] - m[2][1]) * r, (m[2][0] - m[0][2]) * r, (m[0][1] - m[1][0]) * r, a3real_half * c2);
+	}
+	else if (m[0][0] >= m[1][1] && m[0][0] >= m[2][2])
+	{
+		c2 = a3sqrt(s + m[0][0] - m[1][1] - m[2][2]);
+		r = a3recipsafe(c2 + c2);
+		return a3real4Set(q_out, a3real_half * c2, (m[0][1] + m[1][0]) * r, (m[0][2] + m[2][0]) * r, (m[1][2] - m[2][1]) * r);
+	}
+	else if (m[1][1] >= m[2][2])
+	{
+		c2 = a3sqrt(s - m[0][0] + m[1][1] - m[2][2]);
+		r = a3recipsafe(c2 + c2);
+		return a3real4Set(q_out, (m[0][1] + m[1][0]) * r, a3real_half * c2, (m[1][2] + m[2][1]) * r, (m[2][0] - m[0][2]) * r);
+	}
+	c2 = a3sqrt(s - m[0][0] - m[1][1] + m[2][2]);
+	r = a3recipsafe(c2 + c2);
+	return a3real4Set(q_out, (m[0][2] + m[2][0]) * r, (m[1][2] + m[2][1]) * r, a3real_half * c2, (m[0][1] - m[1][0]) * r);
+}
+
+A3DM_INLINE a3real4r a3quatConvertFromMat4Safe(a3real4p q_out, const a3real4x4p m)
+{
+	a3mat3 r;
+	a3real3x3SetReal4x4(r.m, m);
+	return a3quatConvertFromMat3Safe(q_out, r.m);
+}
+
+A3DM_INLINE a3real4r a3quatConvertFromMat4SafeTranslate(a3real4p q_out, a3real3p translate_out, const a3real4x4p m)
+{
+	if (translate_out)
+		a3real3SetReal4(translate_out, m[3]);
+	return a3quatConvertFromMat4Safe(q_out, m);
+}
+
+
+A3DM_INLINE a3real4r a3quatProduct(a3real4p q_out, const a3real4p qL, const a3real4p qR)
+{
+	// output may alias either input
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(q_out, a3intrinQuatProduct(_mm_loadu_ps(qL), _mm_loadu_ps(qR)));
+	return q_out;
+#else	// !A3_USING_INTRIN
+	const a3real x = qL[3] * qR[0] + qL[0] * qR[3] + qL[1] * qR[2] - qL[2] * qR[1];
+	const a3real y = qL[3] * qR[1] - qL[0] * qR[2] + qL[1] * qR[3] + qL[2] * qR[0];
+	const a3real z = qL[3] * qR[2] + qL[0] * qR[1] - qL[1] * qR[0] + qL[2] * qR[3];
+	const a3real w = qL[3] * qR[3] - qL[0] * qR[0] - qL[1] * qR[1] - qL[2] * qR[2];
+	return a3real4Set(q_out, x, y, z, w);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real4r a3quatConcatL(a3real4p qL_inout, const a3real4p qR)
+{
+	return a3quatProduct(qL_inout, qL_inout, qR);
+}
+
+A3DM_INLINE a3real4r a3quatConcatR(const a3real4p qL, a3real4p qR_inout)
+{
+	return a3quatProduct(qR_inout, qL, qR_inout);
+}
+
+
+A3DM_INLINE a3real3r a3quatVec3GetRotatedIgnoreScale(a3real3p v_out, const a3real3p v, const a3real4p q)
+{
+	// v' = v + w t + u x t, with t = 2 (u x v)
+	a3real3 t, ut;
+	a3real3Cross(t, q, v);
+	a3real3MulS(t, a3real_two);
+	a3real3Cross(ut, q, t);
+	a3real3ProductS(v_out, t, q[3]);
+	a3real3Add(v_out, v);
+	return a3real3Add(v_out, ut);
+}
+
+A3DM_INLINE a3real3r a3quatVec3GetRotatedScaled(a3real3p v_out, const a3real3p v, const a3real4p q)
+{
+	// q v q* = (w^2 - u.u) v + 2 (u.v) u + 2 w (u x v); any length
+	const a3real wSq = q[3] * q[3], uu = a3real3LengthSquared(q), uv = a3real3Dot(q, v);
+	a3real3 uxv;
+	a3real3Cross(uxv, q, v);
+	a3real3ProductS(v_out, v, wSq - uu);
+	a3real3Set(v_out,
+		v_out[0] + a3real_two * (uv * q[0] + q[3] * uxv[0]),
+		v_out[1] + a3real_two * (uv * q[1] + q[3] * uxv[1]),
+		v_out[2] + a3real_two * (uv * q[2] + q[3] * uxv[2]));
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3quatVec3GetRotated(a3real3p v_out, const a3real3p v, const a3real4p q)
+{
+	// q v q^-1: remove the encoded scale
+	a3quatVec3GetRotatedScaled(v_out, v, q);
+	return a3real3MulS(v_out, a3real4LengthSquaredInverse(q));
+}
+
+A3DM_INLINE a3real3r a3quatVec3RotateIgnoreScale(a3real3p v_inout, const a3real4p q)
+{
+	return a3quatVec3GetRotatedIgnoreScale(v_inout, v_inout, q);
+}
+
+A3DM_INLINE a3real3r a3quatVec3RotateScale(a3real3p v_inout, const a3real4p q)
+{
+	return a3quatVec3GetRotatedScaled(v_inout, v_inout, q);
+}
+
+A3DM_INLINE a3real3r a3quatVec3Rotate(a3real3p v_inout, const a3real4p q)
+{
+	return a3quatVec3GetRotated(v_inout, v_inout, q);
+}
+
+
+// pure quaternions have no real part, which removes a quarter of the terms
+A3DM_INLINE a3real4r a3quatProductPureL(a3real4p q_out, const a3real4p qPureL, const a3real4p qR)
+{
+	const a3real x = qPureL[0] * qR[3] + qPureL[1] * qR[2] - qPureL[2] * qR[1];
+	const a3real y = -qPureL[0] * qR[2] + qPureL[1] * qR[3] + qPureL[2] * qR[0];
+	const a3real z = qPureL[0] * qR[1] - qPureL[1] * qR[0] + qPureL[2] * qR[3];
+	const a3real w = -qPureL[0] * qR[0] - qPureL[1] * qR[1] - qPureL[2] * qR[2];
+	return a3real4Set(q_out, x, y, z, w);
+}
+
+A3DM_INLINE a3real4r a3quatProductPureR(a3real4p q_out, const a3real4p qL, const a3real4p qPureR)
+{
+	const a3real x = qL[3] * qPureR[0] + qL[1] * qPureR[2] - qL[2] * qPureR[1];
+	const a3real y = qL[3] * qPureR[1] - qL[0] * qPureR[2] + qL[2] * qPureR[0];
+	const a3real z = qL[3] * qPureR[2] + qL[0] * qPureR[1] - qL[1] * qPureR[0];
+	const a3real w = -qL[0] * qPureR[0] - qL[1] * qPureR[1] - qL[2] * qPureR[2];
+	return a3real4Set(q_out, x, y, z, w);
+}
+
+A3DM_INLINE a3real4r a3quatConcatLPureL(a3real4p qPureL_inout, const a3real4p qR)
+{
+	return a3quatProductPureL(qPureL_inout, qPureL_inout, qR);
+}
+
+A3DM_INLINE a3real4r a3quatConcatRPureL(const a3real4p qPureL, a3real4p qR_inout)
+{
+	return a3quatProductPureL(qR_inout, qPureL, qR_inout);
+}
+
+A3DM_INLINE a3real4r a3quatConcatLPureR(a3real4p qL_inout, const a3real4p qPureR)
+{
+	return a3quatProductPureR(qL_inout, qL_inout, qPureR);
+}
+
+A3DM_INLINE a3real4r a3quatConcatRPureR(const a3real4p qL, a3real4p qPureR_inout)
+{
+	return a3quatProductPureR(qPureR_inout, qL, qPureR_inout);
+}
+
+
+// internal: slerp given the cosine of the angle between inputs and their 
+//	length product; takes the short way around and falls back to lerp when 
+//	the inputs are nearly parallel
+A3DM_INLINE a3real4r a3quatInternalSlerp(a3real4p q_out, const a3real4p q0, const a3real4p q1, const a3real param, a3real cosAngle)
+{
+	const a3real sign = cosAngle < a3real_zero ? -a3real_one : a3real_one;
+	a3real angle, sinAngleInv, w0, w1;
+	cosAngle *= sign;
+	if (cosAngle < a3real_one - a3real_epsilon)
+	{
+		angle = a3acosr(cosAngle);
+		sinAngleInv = a3recip(a3sinr(angle));
+		w0 = a3sinr((a3real_one - param) * angle) * sinAngleInv;
+		w1 = a3sinr(param * angle) * sinAngleInv;
+	}
+	else
+	{
+		w0 = a3real_one - param;
+		w1 = param;
+	}
+	w1 *= sign;
+	return a3real4Set(q_out,
+		q0[0] * w0 + q1[0] * w1,
+		q0[1] * w0 + q1[1] * w1,
+		q0[2] * w0 + q1[2] * w1,
+		q0[3] * w0 + q1[3] * w1);
+}
+
+A3DM_INLINE a3real4r a3quatSlerp(a3real4p q_out, const a3real4p q0, const a3real4p q1, const a3real param)
+{
+	const a3real lenProd = a3sqrt(a3real4LengthSquared(q0) * a3real4LengthSquared(q1));
+	return a3quatInternalSlerp(q_out, q0, q1, param, a3divide(a3real4Dot(q0, q1), lenProd));
+}
+
+A3DM_INLINE a3real4r a3quatSlerpUnit(a3real4p q_out, const a3real4p q0, const a3real4p q1, const a3real param)
+{
+	return a3quatInternalSlerp(q_out, q0, q1, param, a3real4Dot(q0, q1));
+}
+
+A3DM_INLINE a3real4r a3quatSlerpIdentityQ0(a3real4p q_out, const a3real4p q1, const a3real param)
+{
+	return a3quatSlerp(q_out, a3quat_identity.q, q1, param);
+}
+
+A3DM_INLINE a3real4r a3quatSlerpIdentityQ1(a3real4p q_out, const a3real4p q0, const a3real param)
+{
+	return a3quatSlerp(q_out, q0, a3quat_identity.q, param);
+}
+
+A3DM_INLINE a3real4r a3quatSlerpUnitIdentityQ0(a3real4p q_out, const a3real4p q1, const a3real param)
+{
+	return a3quatSlerpUnit(q_out, a3quat_identity.q, q1, param);
+}
+
+A3DM_INLINE a3real4r a3quatSlerpUnitIdentityQ1(a3real4p q_out, const a3real4p q0, const a3real param)
+{
+	return a3quatSlerpUnit(q_out, q0, a3quat_identity.q, param);
+}
+
+A3DM_INLINE a3real4r a3quatSlerpUnitFast(a3real4p q_out, const a3real4p q0, const a3real4p q1, const a3real param)
+{
+	// bend the parameter with a cubic whose shape is fit to the angle cosine 
+	//	(Kapoulkine, "Approximating slerp"), then nlerp the short way around
+	const a3real cosAngle = a3real4Dot(q0, q1), d = a3absolute(cosAngle);
+	const a3real a = (a3real)1.0904 + d * ((a3real)-3.2452 + d * ((a3real)3.55645 - d * (a3real)1.43519));
+	const a3real b = (a3real)0.848013 + d * ((a3real)-1.06021 + d * (a3real)0.215638);
+	const a3real h = param - a3real_half;
+	const a3real t = param + param * h * (param - a3real_one) * (a * h * h + b);
+	const a3real w0 = a3real_one - t, w1 = cosAngle < a3real_zero ? -t : t;
+	a3real4Set(q_out,
+		q0[0] * w0 + q1[0] * w1,
+		q0[1] * w0 + q1[1] * w1,
+		q0[2] * w0 + q1[2] * w1,
+		q0[3] * w0 + q1[3] * w1);
+	return a3real4Normalize(q_out);
+}
+
+
+A3DM_INLINE a3real4r a3quatGramSchmidtOrtho4(a3real4p q0_out, a3real4p q1_out, a3real4p q2_out, a3real4p q3_out, const a3real4p q0, const a3real4p q1, const a3real4p q2, const a3real4p q3, const a3real4p qBase)
+{
+	a3real4 tmp;
+	a3real4GramSchmidtOrtho3(q0_out, q1_out, q2_out, q0, q1, q2, qBase);
+	a3real4GramSchmidtOrtho(tmp, q3, qBase);
+	a3real4GramSchmidt(tmp, q0_out);
+	a3real4GramSchmidt(tmp, q1_out);
+	return a3real4GramSchmidtOrtho(q3_out, tmp, q2_out);
+}
+
+A3DM_INLINE a3real4r a3quatGramSchmidt4(a3real4p q0_inout, a3real4p q1_inout, a3real4p q2_inout, a3real4p q3_inout, const a3real4p qBase)
+{
+	return a3quatGramSchmidtOrtho4(q0_inout, q1_inout, q2_inout, q3_inout, q0_inout, q1_inout, q2_inout, q3_inout, qBase);
+}
+
+
+//-----------------------------------------------------------------------------
+
+#ifdef A3_USING_INTRIN
+// internal: interpolate one lane group of unit quaternions, q[j] holding 
+//	component j of each; the exact path evaluates arccosine and sine with 
+//	polynomials and falls back to lerp where the inputs are nearly parallel, 
+//	the fast path applies the same correction as a3quatSlerpUnitFast
+A3DM_INLINE void a3quatInternalSlerpLanes(a3intrinLanes q_out[4], const a3intrinLanes q0[4], const a3intrinLanes q1[4], const a3intrinLanes t, const a3boolean exact)
+{
+	const a3intrinLanes one = a3intrinLanesSet1(1.0f);
+	a3intrinLanes cosAngle, sign, w0, w1, r0, r1, r2, r3;
+	cosAngle = a3intrinLanesMul(q0[0], q1[0]);
+	cosAngle = a3intrinLanesMulAdd(q0[1], q1[1], cosAngle);
+	cosAngle = a3intrinLanesMulAdd(q0[2], q1[2], cosAngle);
+	cosAngle = a3intrinLanesMulAdd(q0[3], q1[3], cosAngle);
+	sign = a3intrinLanesAnd(cosAngle, a3intrinLanesSet1(-0.0f));
+	cosAngle = a3intrinLanesXor(cosAngle, sign);
+	if (exact)
+	{
+		const a3intrinLanes angle = a3intrinLanesAcosUnit(cosAngle);
+		const a3intrinLanes sinAngleInv = a3intrinLanesDiv(one, a3intrinLanesSinQuadrant(angle));
+		const a3intrinLanes apart = a3intrinLanesLess(cosAngle, a3intrinLanesSet1(a3real_one - a3real_epsilon));
+		w0 = a3intrinLanesMul(a3intrinLanesSinQuadrant(a3intrinLanesMul(a3intrinLanesSub(one, t), angle)), sinAngleInv);
+		w1 = a3intrinLanesMul(a3intrinLanesSinQuadrant(a3intrinLanesMul(t, angle)), sinAngleInv);
+		w0 = a3intrinLanesSelect(apart, w0, a3intrinLanesSub(one, t));
+		w1 = a3intrinLanesSelect(apart, w1, t);
+	}
+	else
+	{
+		const a3intrinLanes h = a3intrinLanesSub(t, a3intrinLanesSet1(0.5f));
+		a3intrinLanes a = a3intrinLanesSet1(-1.43519f), b = a3intrinLanesSet1(0.215638f);
+		a = a3intrinLanesMulAdd(a, cosAngle, a3intrinLanesSet1(3.55645f));
+		a = a3intrinLanesMulAdd(a, cosAngle, a3intrinLanesSet1(-3.2452f));
+		a = a3intrinLanesMulAdd(a, cosAngle, a3intrinLanesSet1(1.0904f));
+		b = a3intrinLanesMulAdd(b, cosAngle, a3intrinLanesSet1(-1.06021f));
+		b = a3intrinLanesMulAdd(b, cosAngle, a3intrinLanesSet1(0.848013f));
+		b = a3intrinLanesMulAdd(a3intrinLanesMul(a, h), h, b);
+		w1 = a3intrinLanesMulAdd(a3intrinLanesMul(a3intrinLanesMul(t, h), a3intrinLanesSub(t, one)), b, t);
+		w0 = a3intrinLanesSub(one, w1);
+	}
+	w1 = a3intrinLanesXor(w1, sign);
+	r0 = a3intrinLanesMulAdd(q0[0], w0, a3intrinLanesMul(q1[0], w1));
+	r1 = a3intrinLanesMulAdd(q0[1], w0, a3intrinLanesMul(q1[1], w1));
+	r2 = a3intrinLanesMulAdd(q0[2], w0, a3intrinLanesMul(q1[2], w1));
+	r3 = a3intrinLanesMulAdd(q0[3], w0, a3intrinLanesMul(q1[3], w1));
+	if (!exact)
+	{
+		a3intrinLanes lenInv = a3intrinLanesMul(r0, r0);
+		lenInv = a3intrinLanesMulAdd(r1, r1, lenInv);
+		lenInv = a3intrinLanesMulAdd(r2, r2, lenInv);
+		lenInv = a3intrinLanesRsqrt(a3intrinLanesMulAdd(r3, r3, lenInv));
+		r0 = a3intrinLanesMul(r0, lenInv);
+		r1 = a3intrinLanesMul(r1, lenInv);
+		r2 = a3intrinLanesMul(r2, lenInv);
+		r3 = a3intrinLanesMul(r3, lenInv);
+	}
+	q_out[0] = r0;
+	q_out[1] = r1;
+	q_out[2] = r2;
+	q_out[3] = r3;
+}
+#endif	// A3_USING_INTRIN
+
+// internal: array driver shared by the exact and fast modes; uses the 
+//	parameter array if provided, otherwise the single parameter
+A3DM_INLINE a3real4r a3quatInternalSlerpArray(a3real4 q_out[], const a3real4 q0[], const a3real4 q1[], const a3real param, const a3real param_array[], const a3count count, const a3boolean exact)
+{
+	a3index i = 0;
+#ifdef A3_USING_INTRIN
+	a3intrinLanes l0[4], l1[4], t = a3intrinLanesSet1(param);
+	for (; i + a3intrinLaneCount <= count; i += a3intrinLaneCount)
+	{
+		if (param_array)
+			t = a3intrinLanesLoad(param_array + i);
+		a3intrinLanesLoadVec4(l0, q0 + i);
+		a3intrinLanesLoadVec4(l1, q1 + i);
+		a3quatInternalSlerpLanes(l0, l0, l1, t, exact);
+		a3intrinLanesStoreVec4(q_out + i, l0);
+	}
+#endif	// A3_USING_INTRIN
+	for (; i < count; ++i)
+	{
+		if (exact)
+			a3quatSlerpUnit(q_out[i], q0[i], q1[i], param_array ? param_array[i] : param);
+		else
+			a3quatSlerpUnitFast(q_out[i], q0[i], q1[i], param_array ? param_array[i] : param);
+	}
+	return *q_out;
+}
+
+A3DM_INLINE a3real4r a3quatSlerpUnitArray(a3real4 q_out[], const a3real4 q0[], const a3real4 q1[], const a3real param, const a3count count)
+{
+	return a3quatInternalSlerpArray(q_out, q0, q1, param, 0, count, a3true);
+}
+
+A3DM_INLINE a3real4r a3quatSlerpUnitArrayParams(a3real4 q_out[], const a3real4 q0[], const a3real4 q1[], const a3real param[], const a3count count)
+{
+	return a3quatInternalSlerpArray(q_out, q0, q1, a3real_zero, param, count, a3true);
+}
+
+A3DM_INLINE a3real4r a3quatSlerpUnitFastArray(a3real4 q_out[], const a3real4 q0[], const a3real4 q1[], const a3real param, const a3count count)
+{
+	return a3quatInternalSlerpArray(q_out, q0, q1, param, 0, count, a3false);
+}
+
+A3DM_INLINE a3real4r a3quatSlerpUnitFastArrayParams(a3real4 q_out[], const a3real4 q0[], const a3real4 q1[], const a3real param[], const a3count count)
+{
+	return a3quatInternalSlerpArray(q_out, q0, q1, a3real_zero, param, count, a3false);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_QUATERNION_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_QUATERNION_H
\ No newline at end of file
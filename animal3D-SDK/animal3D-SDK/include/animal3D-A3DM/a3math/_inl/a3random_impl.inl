@@ -0,0 +1,422 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3random_impl.inl
+	Implementations for random number functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_RANDOM_H
+#ifndef __ANIMAL3D_A3DM_RANDOM_IMPL_INL
+#define __ANIMAL3D_A3DM_RANDOM_IMPL_INL
+
+
+#include "a3intrin_impl.inl"
+
+
+A3_BEGIN_IMPL
+
+
+//-----------------------------------------------------------------------------
+
+// Lehmer generator (Lewis, Goodman & Miller, 1969): the state is also the 
+//	last number returned, in [1, max); a zero seed is promoted to one
+// built from source, the sequence is shared by all units (see A3DM_STATE)
+#define a3randomInternalMax			2147483647
+#define a3randomInternalMultiplier	16807
+
+A3DM_STATE a3integer a3randomInternalSeed A3DM_STATE_INIT(1);
+
+
+A3DM_INLINE a3integer a3randomGetMax()
+{
+	return a3randomInternalMax;
+}
+
+A3DM_INLINE a3integer a3randomGetSeed()
+{
+	return a3randomInternalSeed;
+}
+
+A3DM_INLINE a3integer a3randomSetSeed(const a3integer seed)
+{
+	const a3integer ret = a3randomInternalSeed;
+	a3randomInternalSeed = seed;
+	return ret;
+}
+
+A3DM_INLINE a3integer a3randomInt()
+{
+	const a3biginteger seed = ((a3biginteger)a3randomInternalSeed % a3randomInternalMax + a3randomInternalMax) % a3randomInternalMax;
+	a3randomInternalSeed = (a3integer)((seed ? seed : 1) * a3randomInternalMultiplier % a3randomInternalMax);
+	return a3randomInternalSeed;
+}
+
+A3DM_INLINE a3real a3random()
+{
+	return (a3real)a3randomInt();
+}
+
+A3DM_INLINE a3real a3randomNormalized()
+{
+	return (a3real)((a3f64)a3randomInt() / (a3f64)a3randomInternalMax);
+}
+
+A3DM_INLINE a3real a3randomSymmetric()
+{
+	return a3deserialize(a3randomNormalized());
+}
+
+A3DM_INLINE a3real a3randomMax(const a3real nMax)
+{
+	return (a3randomNormalized() * nMax);
+}
+
+A3DM_INLINE a3integer a3randomMaxInt(const a3integer nMax)
+{
+	return (nMax > 0 ? a3randomInt() % nMax : 0);
+}
+
+A3DM_INLINE a3real a3randomRange(const a3real nMin, const a3real nMax)
+{
+	return (nMin + a3randomNormalized() * (nMax - nMin));
+}
+
+A3DM_INLINE a3integer a3randomRangeInt(const a3integer nMin, const a3integer nMax)
+{
+	return (nMin + a3randomMaxInt(nMax - nMin));
+}
+
+
+//-----------------------------------------------------------------------------
+
+// stream internals: xoshiro128** (Blackman & Vigna, 2018) stepped eight 
+//	generators at a time; reals take the top 24 bits so every value is exact
+#define a3randomInternalStreamWidth	8
+#define a3randomInternalRealScale	(1.0f / 16777216.0f)
+
+#ifdef A3_USING_INTRIN
+// one group of generators per register: eight with AVX2, four with SSE2
+#ifdef A3_INTRIN_AVX2
+typedef __m256i a3randomInternalGroup;
+typedef __m256 a3randomInternalGroupReal;
+#define a3randomInternalGroupWidth			8
+#define a3randomInternalGroupLoad(p)		_mm256_loadu_si256((__m256i const *)(p))
+#define a3randomInternalGroupStore(p, x)	_mm256_storeu_si256((__m256i *)(p), x)
+#define a3randomInternalGroupAdd			_mm256_add_epi32
+#define a3randomInternalGroupOr				_mm256_or_si256
+#define a3randomInternalGroupXor			_mm256_xor_si256
+#define a3randomInternalGroupShl			_mm256_slli_epi32
+#define a3randomInternalGroupShr			_mm256_srli_epi32
+#define a3randomInternalGroupRealSet1		_mm256_set1_ps
+#define a3randomInternalGroupRealStore(p, x, scale, offset)	_mm256_storeu_ps(p, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(x, 8)), scale), offset))
+#else	// !A3_INTRIN_AVX2
+typedef __m128i a3randomInternalGroup;
+typedef __m128 a3randomInternalGroupReal;
+#define a3randomInternalGroupWidth			4
+#define a3randomInternalGroupLoad(p)		_mm_loadu_si128((__m128i const *)(p))
+#define a3randomInternalGroupStore(p, x)	_mm_storeu_si128((__m128i *)(p), x)
+#define a3randomInternalGroupAdd			_mm_add_epi32
+#define a3randomInternalGroupOr				_mm_or_si128
+#define a3randomInternalGroupXor			_mm_xor_si128
+#define a3randomInternalGroupShl			_mm_slli_epi32
+#define a3randomInternalGroupShr			_mm_srli_epi32
+#define a3randomInternalGroupRealSet1		_mm_set1_ps
+#define a3randomInternalGroupRealStore(p, x, scale, offset)	_mm_storeu_ps(p, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 8)), scale), offset))
+#endif	// A3_INTRIN_AVX2
+#define a3randomInternalGroupRotl(x, k)		a3randomInternalGroupOr(a3randomInternalGroupShl(x, k), a3randomInternalGroupShr(x, 32 - k))
+#endif	// A3_USING_INTRIN
+
+
+// internal: rotate bits left
+A3DM_INLINE a3ui32 a3randomInternalRotl(const a3ui32 x, const a3ui32 k)
+{
+	return ((x << k) | (x >> (32 - k)));
+}
+
+// internal: step one generator, state gathered
+A3DM_INLINE a3ui32 a3randomInternalNext(a3ui32 s[4])
+{
+	const a3ui32 r = a3randomInternalRotl(s[1] * 5, 7) * 9, t = s[1] << 9;
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = a3randomInternalRotl(s[3], 11);
+	return r;
+}
+
+// internal: advance generator g by 2^64 (or 2^96 for long) steps; the 
+//	constants are x^(2^64) and x^(2^96) modulo the characteristic polynomial
+A3DM_INLINE void a3randomInternalJump(a3ui32 state[4][8], const a3index g, const a3boolean longJump)
+{
+	const a3ui32 jump[2][4] = {
+		{ 0x8764000bu, 0xf542d2d3u, 0x6fa035c3u, 0x77f2db5bu },
+		{ 0xb523952eu, 0x0b6f099fu, 0xccf5a0efu, 0x1c580662u }
+	};
+	a3ui32 s[4] = { state[0][g], state[1][g], state[2][g], state[3][g] }, j[4] = { 0 };
+	a3index i, b;
+	for (i = 0; i < 4; ++i)
+		for (b = 0; b < 32; ++b)
+		{
+			if (jump[longJump != 0][i] & (1u << b))
+			{
+				j[0] ^= s[0];
+				j[1] ^= s[1];
+				j[2] ^= s[2];
+				j[3] ^= s[3];
+			}
+			a3randomInternalNext(s);
+		}
+	for (i = 0; i < 4; ++i)
+		state[i][g] = j[i];
+}
+
+// internal: SplitMix64 (Steele, Lea & Flood), expands a seed into state
+A3DM_INLINE a3bigindex a3randomInternalSplitMix(a3bigindex *z)
+{
+	a3bigindex x = (*z += 0x9e3779b97f4a7c15ull);
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+	return (x ^ (x >> 31));
+}
+
+// internal: real from the top 24 bits of an output
+A3DM_INLINE a3real a3randomInternalReal(const a3ui32 r, const a3real scale, const a3real offset)
+{
+	return ((a3real)(r >> 8) * scale + offset);
+}
+
+// internal: step all generators, storing raw outputs and/or reals
+A3DM_INLINE void a3randomInternalStep(a3ui32 state[4][8], a3ui32 raw_out[8], a3real real_out[8], const a3real scale, const a3real offset)
+{
+	a3index g;
+#ifdef A3_USING_INTRIN
+	const a3randomInternalGroupReal scaleGroup = a3randomInternalGroupRealSet1(scale), offsetGroup = a3randomInternalGroupRealSet1(offset);
+	a3randomInternalGroup s0, s1, s2, s3, r, t;
+	for (g = 0; g < a3randomInternalStreamWidth; g += a3randomInternalGroupWidth)
+	{
+		s0 = a3randomInternalGroupLoad(state[0] + g);
+		s1 = a3randomInternalGroupLoad(state[1] + g);
+		s2 = a3randomInternalGroupLoad(state[2] + g);
+		s3 = a3randomInternalGroupLoad(state[3] + g);
+
+		// r = rotl(s1 * 5, 7) * 9, multiplies as shift-adds
+		r = a3randomInternalGroupAdd(a3randomInternalGroupShl(s1, 2), s1);
+		r = a3randomInternalGroupRotl(r, 7);
+		r = a3randomInternalGroupAdd(a3randomInternalGroupShl(r, 3), r);
+		t = a3randomInternalGroupShl(s1, 9);
+		s2 = a3randomInternalGroupXor(s2, s0);
+		s3 = a3randomInternalGroupXor(s3, s1);
+		s1 = a3randomInternalGroupXor(s1, s2);
+		s0 = a3randomInternalGroupXor(s0, s3);
+		s2 = a3randomInternalGroupXor(s2, t);
+		s3 = a3randomInternalGroupRotl(s3, 11);
+
+		a3randomInternalGroupStore(state[0] + g, s0);
+		a3randomInternalGroupStore(state[1] + g, s1);
+		a3randomInternalGroupStore(state[2] + g, s2);
+		a3randomInternalGroupStore(state[3] + g, s3);
+		if (raw_out)
+			a3randomInternalGroupStore(raw_out + g, r);
+		if (real_out)
+			a3randomInternalGroupRealStore(real_out + g, r, scaleGroup, offsetGroup);
+	}
+#else	// !A3_USING_INTRIN
+	a3ui32 r, t;
+	for (g = 0; g < a3randomInternalStreamWidth; ++g)
+	{
+		r = a3randomInternalRotl(state[1][g] * 5, 7) * 9;
+		t = state[1][g] << 9;
+		state[2][g] ^= state[0][g];
+		state[3][g] ^= state[1][g];
+		state[1][g] ^= state[2][g];
+		state[0][g] ^= state[3][g];
+		state[2][g] ^= t;
+		state[3][g] = a3randomInternalRotl(state[3][g], 11);
+		if (raw_out)
+			raw_out[g] = r;
+		if (real_out)
+			real_out[g] = a3randomInternalReal(r, scale, offset);
+	}
+#endif	// A3_USING_INTRIN
+}
+
+// internal: next output of stream
+A3DM_INLINE a3ui32 a3randomInternalStreamNext(a3randomStream *stream)
+{
+	if (stream->index >= a3randomInternalStreamWidth)
+	{
+		a3randomInternalStep(stream->state, stream->block, 0, a3real_zero, a3real_zero);
+		stream->index = 0;
+	}
+	return stream->block[stream->index++];
+}
+
+// internal: fill raw outputs or reals; the rest of the current block is 
+//	used first and whole steps are written straight to the output, so the 
+//	values are those of single draws whatever the call sizes
+A3DM_INLINE a3count a3randomInternalStreamFill(a3ui32 raw_out[], a3real real_out[], a3randomStream *stream, const a3count count, const a3real scale, const a3real offset)
+{
+	a3index i = 0;
+	while (i < count)
+	{
+		if (stream->index < a3randomInternalStreamWidth)
+		{
+			if (raw_out)
+				raw_out[i] = stream->block[stream->index];
+			else
+				real_out[i] = a3randomInternalReal(stream->block[stream->index], scale, offset);
+			++stream->index;
+			++i;
+		}
+		else if (count - i >= a3randomInternalStreamWidth)
+		{
+			a3randomInternalStep(stream->state, raw_out ? raw_out + i : 0, real_out ? real_out + i : 0, scale, offset);
+			i += a3randomInternalStreamWidth;
+		}
+		else
+		{
+			a3randomInternalStep(stream->state, stream->block, 0, a3real_zero, a3real_zero);
+			stream->index = 0;
+		}
+	}
+	return count;
+}
+
+
+A3DM_INLINE a3randomStream *a3randomStreamInit(a3randomStream *stream, const a3bigindex seed)
+{
+	return a3randomStreamInitSequence(stream, seed, 0);
+}
+
+A3DM_INLINE a3randomStream *a3randomStreamInitSequence(a3randomStream *stream, const a3bigindex seed, const a3bigindex sequence)
+{
+	// the key hash is a bijection that keeps zero, so sequence zero is the 
+	//	plain seed and distinct keys give distinct seeds
+	a3bigindex z = sequence * 0x9e3779b97f4a7c15ull, w;
+	a3index g, i;
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+	z = seed ^ z ^ (z >> 31);
+
+	// first generator from the seed; the all-zero state is the one fixed 
+	//	point and must be avoided
+	w = a3randomInternalSplitMix(&z);
+	stream->state[0][0] = (a3ui32)w;
+	stream->state[1][0] = (a3ui32)(w >> 32);
+	w = a3randomInternalSplitMix(&z);
+	stream->state[2][0] = (a3ui32)w;
+	stream->state[3][0] = (a3ui32)(w >> 32);
+	if (!(stream->state[0][0] | stream->state[1][0] | stream->state[2][0] | stream->state[3][0]))
+		stream->state[0][0] = 1;
+
+	// each next generator starts one short jump after the previous
+	for (g = 1; g < a3randomInternalStreamWidth; ++g)
+	{
+		for (i = 0; i < 4; ++i)
+			stream->state[i][g] = stream->state[i][g - 1];
+		a3randomInternalJump(stream->state, g, a3false);
+	}
+	stream->index = a3randomInternalStreamWidth;
+	return stream;
+}
+
+A3DM_INLINE a3randomStream *a3randomStreamJump(a3randomStream *stream)
+{
+	a3index g;
+	for (g = 0; g < a3randomInternalStreamWidth; ++g)
+		a3randomInternalJump(stream->state, g, a3true);
+	stream->index = a3randomInternalStreamWidth;
+	return stream;
+}
+
+A3DM_INLINE a3randomStream *a3randomStreamSplit(a3randomStream *stream_out, a3randomStream *stream)
+{
+	*stream_out = *stream;
+	a3randomStreamJump(stream);
+	return stream_out;
+}
+
+A3DM_INLINE a3ui32 a3randomStreamInt(a3randomStream *stream)
+{
+	return a3randomInternalStreamNext(stream);
+}
+
+A3DM_INLINE a3real a3randomStreamNormalized(a3randomStream *stream)
+{
+	return a3randomInternalReal(a3randomInternalStreamNext(stream), (a3real)a3randomInternalRealScale, a3real_zero);
+}
+
+A3DM_INLINE a3real a3randomStreamSymmetric(a3randomStream *stream)
+{
+	return a3randomInternalReal(a3randomInternalStreamNext(stream), (a3real)(a3randomInternalRealScale * 2.0f), -a3real_one);
+}
+
+A3DM_INLINE a3real a3randomStreamRange(a3randomStream *stream, const a3real nMin, const a3real nMax)
+{
+	return a3randomInternalReal(a3randomInternalStreamNext(stream), (nMax - nMin) * (a3real)a3randomInternalRealScale, nMin);
+}
+
+A3DM_INLINE a3integer a3randomStreamRangeInt(a3randomStream *stream, const a3integer nMin, const a3integer nMax)
+{
+	// multiply-shift maps the output onto the range without division
+	const a3bigindex range = (a3ui32)nMax - (a3ui32)nMin;
+	return (nMax > nMin ? (a3integer)((a3ui32)nMin + (a3ui32)(((a3bigindex)a3randomInternalStreamNext(stream) * range) >> 32)) : nMin);
+}
+
+A3DM_INLINE a3count a3randomStreamFillInt(a3ui32 values_out[], a3randomStream *stream, const a3count count)
+{
+	if (values_out && stream)
+		return a3randomInternalStreamFill(values_out, 0, stream, count, a3real_zero, a3real_zero);
+	return 0;
+}
+
+A3DM_INLINE a3count a3randomStreamFillNormalized(a3real values_out[], a3randomStream *stream, const a3count count)
+{
+	if (values_out && stream)
+		return a3randomInternalStreamFill(0, values_out, stream, count, (a3real)a3randomInternalRealScale, a3real_zero);
+	return 0;
+}
+
+A3DM_INLINE a3count a3randomStreamFillSymmetric(a3real values_out[], a3randomStream *stream, const a3count count)
+{
+	if (values_out && stream)
+		return a3randomInternalStreamFill(0, values_out, stream, count, (a3real)(a3randomInternalRealScale * 2.0f), -a3real_one);
+	return 0;
+}
+
+A3DM_INLINE a3count a3randomStreamFillRange(a3real values_out[], a3randomStream *stream, const a3count count, const a3real nMin, const a3real nMax)
+{
+	if (values_out && stream)
+		return a3randomInternalStreamFill(0, values_out, stream, count, (nMax - nMin) * (a3real)a3randomInternalRealScale, nMin);
+	return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_RANDOM_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_RANDOM_H
\ No newline at end of file
@@ -0,0 +1,95 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3sqrt_impl.inl
+	Implementations for fast square root functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_SQRT_H
+#ifndef __ANIMAL3D_A3DM_SQRT_IMPL_INL
+#define __ANIMAL3D_A3DM_SQRT_IMPL_INL
+
+
+#include <math.h>
+
+#include "a3intrin_impl.inl"
+
+
+A3_BEGIN_IMPL
+
+
+//-----------------------------------------------------------------------------
+
+// Quake's fast inverse square root with one Newton step
+A3DM_INLINE a3f32 a3sqrtf0xInverse(const a3f32 x)
+{
+	union { a3f32 f; a3ui32 i; } u;
+	const a3f32 xh = x * 0.5f;
+	u.f = x;
+	u.i = 0x5f3759df - (u.i >> 1);
+	return (u.f * (1.5f - xh * u.f * u.f));
+}
+
+A3DM_INLINE a3f32 a3sqrtf0x(const a3f32 x)
+{
+	return (x * a3sqrtf0xInverse(x));
+}
+
+
+// precise square roots; single precision uses the scalar SSE instructions 
+//	directly when intrinsics are enabled
+A3DM_INLINE a3f32 a3sqrtf(const a3f32 x)
+{
+#ifdef A3_USING_INTRIN
+	return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x)));
+#else	// !A3_USING_INTRIN
+	return sqrtf(x);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3f64 a3sqrtd(const a3f64 x)
+{
+	return sqrt(x);
+}
+
+A3DM_INLINE a3f32 a3sqrtfInverse(const a3f32 x)
+{
+#ifdef A3_USING_INTRIN
+	return _mm_cvtss_f32(_mm_div_ss(_mm_set_ss(1.0f), _mm_sqrt_ss(_mm_set_ss(x))));
+#else	// !A3_USING_INTRIN
+	return (1.0f / sqrtf(x));
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3f64 a3sqrtdInverse(const a3f64 x)
+{
+	return (1.0 / sqrt(x));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_SQRT_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_SQRT_H
\ No newline at end of file
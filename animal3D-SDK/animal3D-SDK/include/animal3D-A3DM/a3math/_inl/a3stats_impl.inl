@@ -0,0 +1,692 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3stats_impl.inl
+	Implementations for statistics functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_STATS_H
+#ifndef __ANIMAL3D_A3DM_STATS_IMPL_INL
+#define __ANIMAL3D_A3DM_STATS_IMPL_INL
+
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "../a3sqrt.h"
+#include "a3intrin_impl.inl"
+
+
+A3_BEGIN_IMPL
+
+
+//-----------------------------------------------------------------------------
+
+// internal: SIMD reductions shared by the real array forms below; lanes 
+//	accumulate separately, so sums round differently from a serial loop
+A3DM_INLINE a3real a3statsInternalSum(const a3real data[], const a3count n)
+{
+	a3real sum = a3real_zero;
+	a3count i = 0;
+#ifdef A3_USING_INTRIN
+	// two accumulators hide the latency of the adds
+	a3intrinLanes s0 = a3intrinLanesSet1(0.0f), s1 = s0;
+	for (; i + a3intrinLaneCount * 2 <= n; i += a3intrinLaneCount * 2)
+	{
+		s0 = a3intrinLanesAdd(s0, a3intrinLanesLoad(data + i));
+		s1 = a3intrinLanesAdd(s1, a3intrinLanesLoad(data + i + a3intrinLaneCount));
+	}
+	sum = a3intrinLanesSum(a3intrinLanesAdd(s0, s1));
+#endif	// A3_USING_INTRIN
+	for (; i < n; ++i)
+		sum += data[i];
+	return sum;
+}
+
+// internal: sum of squared differences from mean
+A3DM_INLINE a3real a3statsInternalSumSquares(const a3real data[], const a3count n, const a3real mean)
+{
+	a3real sum = a3real_zero, d;
+	a3count i = 0;
+#ifdef A3_USING_INTRIN
+	const a3intrinLanes m = a3intrinLanesSet1(mean);
+	a3intrinLanes s0 = a3intrinLanesSet1(0.0f), s1 = s0, d0, d1;
+	for (; i + a3intrinLaneCount * 2 <= n; i += a3intrinLaneCount * 2)
+	{
+		d0 = a3intrinLanesSub(a3intrinLanesLoad(data + i), m);
+		d1 = a3intrinLanesSub(a3intrinLanesLoad(data + i + a3intrinLaneCount), m);
+		s0 = a3intrinLanesMulAdd(d0, d0, s0);
+		s1 = a3intrinLanesMulAdd(d1, d1, s1);
+	}
+	sum = a3intrinLanesSum(a3intrinLanesAdd(s0, s1));
+#endif	// A3_USING_INTRIN
+	for (; i < n; ++i)
+	{
+		d = data[i] - mean;
+		sum += d * d;
+	}
+	return sum;
+}
+
+// internal: extremes of a non-empty array
+A3DM_INLINE void a3statsInternalMinMax(const a3real data[], const a3count n, a3real *min_out, a3real *max_out)
+{
+	a3real lo = data[0], hi = data[0];
+	a3count i = 0;
+#ifdef A3_USING_INTRIN
+	if (n >= a3intrinLaneCount)
+	{
+		a3real tmpLo[a3intrinLaneCount], tmpHi[a3intrinLaneCount];
+		a3intrinLanes l = a3intrinLanesLoad(data), h = l, v;
+		a3count j;
+		for (i = a3intrinLaneCount; i + a3intrinLaneCount <= n; i += a3intrinLaneCount)
+		{
+			v = a3intrinLanesLoad(data + i);
+			l = a3intrinLanesMin(l, v);
+			h = a3intrinLanesMax(h, v);
+		}
+		a3intrinLanesStore(tmpLo, l);
+		a3intrinLanesStore(tmpHi, h);
+		for (j = 0; j < a3intrinLaneCount; ++j)
+		{
+			lo = tmpLo[j] < lo ? tmpLo[j] : lo;
+			hi = tmpHi[j] > hi ? tmpHi[j] : hi;
+		}
+	}
+#endif	// A3_USING_INTRIN
+	for (; i < n; ++i)
+	{
+		lo = data[i] < lo ? data[i] : lo;
+		hi = data[i] > hi ? data[i] : hi;
+	}
+	*min_out = lo;
+	*max_out = hi;
+}
+
+// internal: count values less than and greater than x
+A3DM_INLINE void a3statsInternalRank(const a3real data[], const a3count n, const a3real x, a3count *less_out, a3count *greater_out)
+{
+	a3count i = 0, less = 0, greater = 0;
+#ifdef A3_USING_INTRIN
+	// counts per lane stay exact as reals for any set this is used on
+	const a3intrinLanes one = a3intrinLanesSet1(1.0f), xx = a3intrinLanesSet1(x);
+	a3intrinLanes l = a3intrinLanesSet1(0.0f), g = l, v;
+	for (; i + a3intrinLaneCount <= n; i += a3intrinLaneCount)
+	{
+		v = a3intrinLanesLoad(data + i);
+		l = a3intrinLanesAdd(l, a3intrinLanesAnd(a3intrinLanesLess(v, xx), one));
+		g = a3intrinLanesAdd(g, a3intrinLanesAnd(a3intrinLanesLess(xx, v), one));
+	}
+	less = (a3count)a3intrinLanesSum(l);
+	greater = (a3count)a3intrinLanesSum(g);
+#endif	// A3_USING_INTRIN
+	for (; i < n; ++i)
+	{
+		less += (data[i] < x);
+		greater += (x < data[i]);
+	}
+	*less_out = less;
+	*greater_out = greater;
+}
+
+
+// internal: values copied to the stack for selection; larger sets allocate
+#define a3statsInternalMedianStackCount	256
+
+// internal: median by rank, used when no copy can be made: each candidate 
+//	is ranked against the whole set (quadratic); even counts average the 
+//	two middle ranks
+A3DM_INLINE a3real a3statsInternalMedianRank(const a3real data[], const a3count n)
+{
+	a3real lo = a3real_zero, hi = a3real_zero;
+	a3count i, less, greater, equal;
+	a3boolean foundLo = a3false, foundHi = a3false;
+	for (i = 0; i < n && !(foundLo && foundHi); ++i)
+	{
+		a3statsInternalRank(data, n, data[i], &less, &greater);
+		equal = n - less - greater;
+		if (!foundLo && less <= (n - 1) / 2 && (n - 1) / 2 < less + equal)
+		{
+			lo = (a3real)data[i];
+			foundLo = a3true;
+		}
+		if (!foundHi && less <= n / 2 && n / 2 < less + equal)
+		{
+			hi = (a3real)data[i];
+			foundHi = a3true;
+		}
+	}
+	return ((lo + hi) * a3real_half);
+}
+
+A3DM_INLINE a3real a3statsInternalMedianRankInt(const a3integer data[], const a3count n)
+{
+	a3real lo = a3real_zero, hi = a3real_zero;
+	a3count i, j, less, equal;
+	a3boolean foundLo = a3false, foundHi = a3false;
+	for (i = 0; i < n && !(foundLo && foundHi); ++i)
+	{
+		for (j = less = equal = 0; j < n; ++j)
+		{
+			less += (data[j] < data[i]);
+			equal += (data[j] == data[i]);
+		}
+		if (!foundLo && less <= (n - 1) / 2 && (n - 1) / 2 < less + equal)
+		{
+			lo = (a3real)data[i];
+			foundLo = a3true;
+		}
+		if (!foundHi && less <= n / 2 && n / 2 < less + equal)
+		{
+			hi = (a3real)data[i];
+			foundHi = a3true;
+		}
+	}
+	return ((lo + hi) * a3real_half);
+}
+
+// internal: median of a scratch copy by selection (Wirth's quickselect, 
+//	linear on average); the copy is reordered so that the lower middle 
+//	value is in place and everything after it is no less, so for even 
+//	counts the upper middle value is the least of those
+A3DM_INLINE a3real a3statsInternalMedianSelect(a3real copy[], const a3count n)
+{
+	const a3i32 k = (a3i32)(n - 1) / 2;
+	a3i32 l = 0, m = (a3i32)n - 1, i, j;
+	a3real x, tmp, hi;
+	while (l < m)
+	{
+		x = copy[k];
+		i = l;
+		j = m;
+		do
+		{
+			while (copy[i] < x)
+				++i;
+			while (x < copy[j])
+				--j;
+			if (i <= j)
+			{
+				tmp = copy[i];
+				copy[i++] = copy[j];
+				copy[j--] = tmp;
+			}
+		} while (i <= j);
+		if (j < k)
+			l = i;
+		if (k < i)
+			m = j;
+	}
+	if (n & 1)
+		return copy[k];
+	for (hi = copy[k + 1], i = k + 2; i < (a3i32)n; ++i)
+		hi = copy[i] < hi ? copy[i] : hi;
+	return ((copy[k] + hi) * a3real_half);
+}
+
+A3DM_INLINE a3real a3statsInternalMedianSelectInt(a3integer copy[], const a3count n)
+{
+	const a3i32 k = (a3i32)(n - 1) / 2;
+	a3i32 l = 0, m = (a3i32)n - 1, i, j;
+	a3integer x, tmp, hi;
+	while (l < m)
+	{
+		x = copy[k];
+		i = l;
+		j = m;
+		do
+		{
+			while (copy[i] < x)
+				++i;
+			while (x < copy[j])
+				--j;
+			if (i <= j)
+			{
+				tmp = copy[i];
+				copy[i++] = copy[j];
+				copy[j--] = tmp;
+			}
+		} while (i <= j);
+		if (j < k)
+			l = i;
+		if (k < i)
+			m = j;
+	}
+	if (n & 1)
+		return (a3real)copy[k];
+	for (hi = copy[k + 1], i = k + 2; i < (a3i32)n; ++i)
+		hi = copy[i] < hi ? copy[i] : hi;
+	return (((a3real)copy[k] + (a3real)hi) * a3real_half);
+}
+
+
+// median by selection on a copy (the input is read-only): small sets are 
+//	copied to the stack, larger ones to the heap; ranking is the fallback 
+//	if allocation fails
+A3DM_INLINE a3real a3median(const a3real data[], const a3count n)
+{
+	a3real buffer[a3statsInternalMedianStackCount], *copy, median;
+	a3count i;
+	if (data && n)
+	{
+		copy = n <= a3statsInternalMedianStackCount ? buffer : (a3real *)malloc(sizeof(a3real) * n);
+		if (!copy)
+			return a3statsInternalMedianRank(data, n);
+		for (i = 0; i < n; ++i)
+			copy[i] = data[i];
+		median = a3statsInternalMedianSelect(copy, n);
+		if (copy != buffer)
+			free(copy);
+		return median;
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3medianInt(const a3integer data[], const a3count n)
+{
+	a3integer buffer[a3statsInternalMedianStackCount], *copy;
+	a3real median;
+	a3count i;
+	if (data && n)
+	{
+		copy = n <= a3statsInternalMedianStackCount ? buffer : (a3integer *)malloc(sizeof(a3integer) * n);
+		if (!copy)
+			return a3statsInternalMedianRankInt(data, n);
+		for (i = 0; i < n; ++i)
+			copy[i] = data[i];
+		median = a3statsInternalMedianSelectInt(copy, n);
+		if (copy != buffer)
+			free(copy);
+		return median;
+	}
+	return a3real_zero;
+}
+
+
+A3DM_INLINE a3real a3mean(const a3real data[], const a3count n)
+{
+	if (data && n)
+		return (a3statsInternalSum(data, n) / (a3real)n);
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3meanInt(const a3integer data[], const a3count n)
+{
+	a3biginteger sum = 0;
+	a3count i;
+	if (data && n)
+	{
+		for (i = 0; i < n; ++i)
+			sum += data[i];
+		return ((a3real)sum / (a3real)n);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3variance(const a3real data[], const a3count n, a3real *mean_out)
+{
+	const a3real mean = a3mean(data, n);
+	a3real sum = a3real_zero;
+	if (data && n)
+		sum = a3statsInternalSumSquares(data, n, mean) / (a3real)n;
+	if (mean_out)
+		*mean_out = mean;
+	return sum;
+}
+
+A3DM_INLINE a3real a3varianceInt(const a3integer data[], const a3count n, a3real *mean_out)
+{
+	const a3real mean = a3meanInt(data, n);
+	a3real sum = a3real_zero, d;
+	a3count i;
+	if (data && n)
+	{
+		for (i = 0; i < n; ++i)
+		{
+			d = (a3real)data[i] - mean;
+			sum += d * d;
+		}
+		sum /= (a3real)n;
+	}
+	if (mean_out)
+		*mean_out = mean;
+	return sum;
+}
+
+A3DM_INLINE a3real a3standardDeviation(const a3real data[], const a3count n, a3real *mean_out)
+{
+	return a3sqrt(a3variance(data, n, mean_out));
+}
+
+A3DM_INLINE a3real a3standardDeviationInt(const a3integer data[], const a3count n, a3real *mean_out)
+{
+	return a3sqrt(a3varianceInt(data, n, mean_out));
+}
+
+
+//-----------------------------------------------------------------------------
+
+// values per block reduced in single precision before merging into the 
+//	double-precision totals
+#define a3statsInternalBlockSize	1024
+
+// internal: merge count, mean, squared differences and extremes of a group 
+//	of values into accumulator (Chan, Golub & LeVeque)
+A3DM_INLINE void a3statsInternalAccumulatorMerge(a3statsAccumulator *acc, const a3bigcount count, const a3f64 mean, const a3f64 m2, const a3f64 minimum, const a3f64 maximum)
+{
+	const a3bigcount total = acc->count + count;
+	const a3f64 d = mean - acc->mean;
+	if (!count)
+		return;
+	if (!acc->count)
+	{
+		acc->minimum = minimum;
+		acc->maximum = maximum;
+	}
+	else
+	{
+		acc->minimum = minimum < acc->minimum ? minimum : acc->minimum;
+		acc->maximum = maximum > acc->maximum ? maximum : acc->maximum;
+	}
+	acc->mean += d * (a3f64)count / (a3f64)total;
+	acc->m2 += m2 + d * d * (a3f64)acc->count * (a3f64)count / (a3f64)total;
+	acc->count = total;
+}
+
+A3DM_INLINE a3statsAccumulator *a3statsAccumulatorReset(a3statsAccumulator *acc)
+{
+	acc->count = 0;
+	acc->mean = acc->m2 = 0.0;
+	acc->minimum = acc->maximum = 0.0;
+	return acc;
+}
+
+A3DM_INLINE a3statsAccumulator *a3statsAccumulatorAdd(a3statsAccumulator *acc, const a3real x)
+{
+	const a3f64 d = (a3f64)x - acc->mean;
+	if (!acc->count++)
+		acc->minimum = acc->maximum = (a3f64)x;
+	else if ((a3f64)x < acc->minimum)
+		acc->minimum = (a3f64)x;
+	else if ((a3f64)x > acc->maximum)
+		acc->maximum = (a3f64)x;
+	acc->mean += d / (a3f64)acc->count;
+	acc->m2 += d * ((a3f64)x - acc->mean);
+	return acc;
+}
+
+A3DM_INLINE a3statsAccumulator *a3statsAccumulatorAddArray(a3statsAccumulator *acc, const a3real data[], const a3count n)
+{
+	a3real mean, lo, hi;
+	a3count i, block;
+	if (data)
+		for (i = 0; i < n; i += block)
+		{
+			// two passes per block: mean, then squared differences from it
+			block = n - i < a3statsInternalBlockSize ? n - i : a3statsInternalBlockSize;
+			mean = a3statsInternalSum(data + i, block) / (a3real)block;
+			a3statsInternalMinMax(data + i, block, &lo, &hi);
+			a3statsInternalAccumulatorMerge(acc, block, (a3f64)mean, (a3f64)a3statsInternalSumSquares(data + i, block, mean), (a3f64)lo, (a3f64)hi);
+		}
+	return acc;
+}
+
+A3DM_INLINE a3statsAccumulator *a3statsAccumulatorMerge(a3statsAccumulator *acc, const a3statsAccumulator *other)
+{
+	a3statsInternalAccumulatorMerge(acc, other->count, other->mean, other->m2, other->minimum, other->maximum);
+	return acc;
+}
+
+A3DM_INLINE a3real a3statsAccumulatorGetMean(const a3statsAccumulator *acc)
+{
+	return (a3real)acc->mean;
+}
+
+A3DM_INLINE a3real a3statsAccumulatorGetVariance(const a3statsAccumulator *acc)
+{
+	return (acc->count ? (a3real)(acc->m2 / (a3f64)acc->count) : a3real_zero);
+}
+
+A3DM_INLINE a3real a3statsAccumulatorGetStandardDeviation(const a3statsAccumulator *acc)
+{
+	return a3sqrt(a3statsAccumulatorGetVariance(acc));
+}
+
+
+A3DM_INLINE a3statsQuantileEstimator *a3statsQuantileEstimatorReset(a3statsQuantileEstimator *est, const a3real quantile)
+{
+	const a3f64 p = quantile < a3real_zero ? 0.0 : quantile > a3real_one ? 1.0 : (a3f64)quantile;
+	a3index i;
+	est->quantile = (a3real)p;
+	est->count = 0;
+
+	// markers at the minimum, p/2, p, (1+p)/2 and the maximum; positions 
+	//	count from zero
+	est->step[0] = 0.0;
+	est->step[1] = p * 0.5;
+	est->step[2] = p;
+	est->step[3] = (1.0 + p) * 0.5;
+	est->step[4] = 1.0;
+	for (i = 0; i < 5; ++i)
+	{
+		est->height[i] = 0.0;
+		est->position[i] = (a3f64)i;
+		est->desired[i] = est->step[i] * 4.0;
+	}
+	return est;
+}
+
+A3DM_INLINE a3statsQuantileEstimator *a3statsQuantileEstimatorAdd(a3statsQuantileEstimator *est, const a3real x)
+{
+	const a3f64 v = (a3f64)x;
+	a3f64 *q = est->height, *n = est->position, d, s, qp;
+	a3index i, k;
+
+	// first five values kept sorted
+	if (est->count < 5)
+	{
+		for (i = (a3index)est->count++; i > 0 && q[i - 1] > v; --i)
+			q[i] = q[i - 1];
+		q[i] = v;
+		return est;
+	}
+	++est->count;
+
+	// find cell containing value, extending the ends if needed
+	if (v < q[0])
+	{
+		q[0] = v;
+		k = 0;
+	}
+	else if (v >= q[4])
+	{
+		q[4] = v;
+		k = 3;
+	}
+	else
+		for (k = 0; v >= q[k + 1]; ++k);
+	for (i = k + 1; i < 5; ++i)
+		n[i] += 1.0;
+	for (i = 0; i < 5; ++i)
+		est->desired[i] += est->step[i];
+
+	// move inner markers toward their desired positions, one step at a 
+	//	time, with the piecewise-parabolic prediction if it keeps the order
+	for (i = 1; i < 4; ++i)
+	{
+		d = est->desired[i] - n[i];
+		if ((d >= 1.0 && n[i + 1] - n[i] > 1.0) || (d <= -1.0 && n[i - 1] - n[i] < -1.0))
+		{
+			s = d > 0.0 ? 1.0 : -1.0;
+			qp = q[i] + s / (n[i + 1] - n[i - 1]) * ((n[i] - n[i - 1] + s) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) + (n[i + 1] - n[i] - s) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+			if (q[i - 1] < qp && qp < q[i + 1])
+				q[i] = qp;
+			else if (s > 0.0)
+				q[i] += (q[i + 1] - q[i]) / (n[i + 1] - n[i]);
+			else
+				q[i] -= (q[i - 1] - q[i]) / (n[i - 1] - n[i]);
+			n[i] += s;
+		}
+	}
+	return est;
+}
+
+A3DM_INLINE a3real a3statsQuantileEstimatorGet(const a3statsQuantileEstimator *est)
+{
+	if (est->count >= 5)
+		return (a3real)est->height[2];
+	if (est->count)
+		return (a3real)est->height[(a3index)((a3f64)est->quantile * (a3f64)(est->count - 1) + 0.5)];
+	return a3real_zero;
+}
+
+
+A3DM_INLINE a3statsQuantileSketch *a3statsQuantileSketchReset(a3statsQuantileSketch *sketch, const a3real relativeAccuracy, const a3real minValue)
+{
+	a3index i;
+	if (relativeAccuracy > a3real_zero && relativeAccuracy < a3real_one && minValue > a3real_zero)
+	{
+		// bucket i holds (min * gamma^(i-1), min * gamma^i]
+		for (i = 0; i < a3statsQuantileSketchBuckets; ++i)
+			sketch->bucket[i] = 0;
+		sketch->count = 0;
+		sketch->minimum = sketch->maximum = 0.0;
+		sketch->minValue = (a3f64)minValue;
+		sketch->logGamma = log((1.0 + (a3f64)relativeAccuracy) / (1.0 - (a3f64)relativeAccuracy));
+		return sketch;
+	}
+	return 0;
+}
+
+A3DM_INLINE a3statsQuantileSketch *a3statsQuantileSketchAdd(a3statsQuantileSketch *sketch, const a3real x)
+{
+	const a3f64 v = (a3f64)x;
+	a3f64 k = 0.0;
+	if (v > sketch->minValue)
+	{
+		k = ceil(log(v / sketch->minValue) / sketch->logGamma);
+		k = k < (a3f64)(a3statsQuantileSketchBuckets - 1) ? k : (a3f64)(a3statsQuantileSketchBuckets - 1);
+	}
+	++sketch->bucket[(a3index)k];
+	if (!sketch->count++)
+		sketch->minimum = sketch->maximum = v;
+	else if (v < sketch->minimum)
+		sketch->minimum = v;
+	else if (v > sketch->maximum)
+		sketch->maximum = v;
+	return sketch;
+}
+
+A3DM_INLINE a3statsQuantileSketch *a3statsQuantileSketchMerge(a3statsQuantileSketch *sketch, const a3statsQuantileSketch *other)
+{
+	a3index i;
+	if (sketch->minValue == other->minValue && sketch->logGamma == other->logGamma)
+	{
+		if (other->count)
+		{
+			for (i = 0; i < a3statsQuantileSketchBuckets; ++i)
+				sketch->bucket[i] += other->bucket[i];
+			if (!sketch->count)
+			{
+				sketch->minimum = other->minimum;
+				sketch->maximum = other->maximum;
+			}
+			else
+			{
+				sketch->minimum = other->minimum < sketch->minimum ? other->minimum : sketch->minimum;
+				sketch->maximum = other->maximum > sketch->maximum ? other->maximum : sketch->maximum;
+			}
+			sketch->count += other->count;
+		}
+		return sketch;
+	}
+	return 0;
+}
+
+A3DM_INLINE a3real a3statsQuantileSketchGet(const a3statsQuantileSketch *sketch, const a3real quantile)
+{
+	a3bigcount rank, sum = 0;
+	a3f64 gamma, v;
+	a3index i;
+	if (!sketch->count)
+		return a3real_zero;
+	if (quantile <= a3real_zero)
+		return (a3real)sketch->minimum;
+	if (quantile >= a3real_one)
+		return (a3real)sketch->maximum;
+
+	// find bucket holding the value of the given rank, then return the 
+	//	point of the bucket with equal relative distance to both ends
+	rank = (a3bigcount)((a3f64)quantile * (a3f64)(sketch->count - 1));
+	for (i = 0; i < a3statsQuantileSketchBuckets - 1; ++i)
+		if ((sum += sketch->bucket[i]) > rank)
+			break;
+	gamma = exp(sketch->logGamma);
+	v = i ? sketch->minValue * exp((a3f64)i * sketch->logGamma) * 2.0 / (1.0 + gamma) : sketch->minValue;
+	v = v > sketch->minimum ? v : sketch->minimum;
+	v = v < sketch->maximum ? v : sketch->maximum;
+	return (a3real)v;
+}
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3biginteger a3factorial(a3bigcount n)
+{
+	a3biginteger ret = 1;
+	while (n > 1)
+		ret *= n--;
+	return ret;
+}
+
+A3DM_INLINE a3biginteger a3permutations(const a3bigcount n, const a3bigindex k)
+{
+	a3biginteger ret = 1;
+	a3bigcount i;
+	if (k > n)
+		return 0;
+	for (i = n - k + 1; i <= n; ++i)
+		ret *= i;
+	return ret;
+}
+
+A3DM_INLINE a3biginteger a3combinations(const a3bigcount n, const a3bigindex k)
+{
+	// multiplicative form keeps intermediates exact: C(n, i) = C(n, i-1) * (n-i+1) / i
+	const a3bigindex kk = (k > n - k) ? n - k : k;
+	a3biginteger ret = 1;
+	a3bigindex i;
+	if (k > n)
+		return 0;
+	for (i = 1; i <= kk; ++i)
+		ret = ret * (n - kk + i) / i;
+	return ret;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_STATS_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_STATS_H
\ No newline at end of file
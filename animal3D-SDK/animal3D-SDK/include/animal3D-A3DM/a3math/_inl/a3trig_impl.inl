@@ -0,0 +1,700 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3trig_impl.inl
+	Implementations for trigonometry functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_TRIG_H
+#ifndef __ANIMAL3D_A3DM_TRIG_IMPL_INL
+#define __ANIMAL3D_A3DM_TRIG_IMPL_INL
+
+
+#include <math.h>
+
+#include "a3intrin_impl.inl"
+
+
+// standard library functions matching the active real type
+#if (defined A3_REAL_F64 || defined A3_REAL_F128)
+#define a3trigInternalSin		sin
+#define a3trigInternalCos		cos
+#define a3trigInternalAsin		asin
+#define a3trigInternalAcos		acos
+#define a3trigInternalAtan		atan
+#define a3trigInternalMod		fmod
+#define a3trigInternalFloor		floor
+#else	// !(defined A3_REAL_F64 || defined A3_REAL_F128)
+#define a3trigInternalSin		sinf
+#define a3trigInternalCos		cosf
+#define a3trigInternalAsin		asinf
+#define a3trigInternalAcos		acosf
+#define a3trigInternalAtan		atanf
+#define a3trigInternalMod		fmodf
+#define a3trigInternalFloor		floorf
+#endif	// (defined A3_REAL_F64 || defined A3_REAL_F128)
+
+
+// polynomial coefficients: minimax fits of sine and cosine on [-pi/4, +pi/4] 
+//	and of arctangent on [0, tan(pi/8)], odd or even powers after the first
+#define a3trigInternalSinFull1		-0.16666650669294233
+#define a3trigInternalSinFull2		+0.0083319786631572360
+#define a3trigInternalSinFull3		-0.00019495636237551076
+#define a3trigInternalCosFull2		+0.041666646866445400
+#define a3trigInternalCosFull3		-0.0013887367515867167
+#define a3trigInternalCosFull4		+0.000024438451607468536
+#define a3trigInternalSinFast1		-0.16664799334238100
+#define a3trigInternalSinFast2		+0.0081817130634729150
+#define a3trigInternalCosFast1		-0.49977630707616877
+#define a3trigInternalCosFast2		+0.040488935843593530
+#define a3trigInternalAtanFull1		-0.33332756669434355
+#define a3trigInternalAtanFull2		+0.19971879314801827
+#define a3trigInternalAtanFull3		-0.13824453830611760
+#define a3trigInternalAtanFull4		+0.079025983747978630
+#define a3trigInternalAtanFast1		-0.33243482452191725
+#define a3trigInternalAtanFast2		+0.17312240044840965
+#define a3trigInternalTanEighthPi	0.41421356237309503
+
+// quarter turn split so that multiples of the first part are exact 
+//	(Cody-Waite reduction)
+#define a3trigInternalHalfPi1		1.5703125
+#define a3trigInternalHalfPi2		4.837512969970703125e-4
+#define a3trigInternalHalfPi3		7.54978995489188216e-8
+
+
+A3_BEGIN_IMPL
+
+
+//-----------------------------------------------------------------------------
+
+// table state; the table holds [params | sin | cos], each with 
+//	(samplesPerDegree x 720 + 1) samples over [-360, +360] degrees
+// built from source, the state is shared by all units (see A3DM_STATE); 
+//	until a table is initialized the polynomials are used, 
+//	which agree with the table to within interpolation error
+A3DM_STATE const a3real *a3trigInternalTable A3DM_STATE_INIT(0);
+A3DM_STATE a3index a3trigInternalSamplesPerDegree A3DM_STATE_INIT(0);
+A3DM_STATE a3index a3trigInternalSampleCount A3DM_STATE_INIT(0);
+A3DM_STATE a3index a3trigInternalTaylorIterations A3DM_STATE_INIT(8);
+
+
+// internal: interpolate sampled function at degrees in [-360, +360]
+A3DM_INLINE a3real a3trigInternalSample(const a3real table[], const a3real x)
+{
+	const a3real f = (x + a3real_threesixty) * (a3real)a3trigInternalSamplesPerDegree;
+	a3index i = (a3index)a3clamp(a3real_zero, (a3real)(a3trigInternalSampleCount - 2), a3trigInternalFloor(f));
+	const a3real t = f - (a3real)i;
+	return (table[i] + (table[i + 1] - table[i]) * t);
+}
+
+
+A3DM_INLINE a3index a3trigInit(const a3index samplesPerDegree, a3real table_out[])
+{
+	if (samplesPerDegree && table_out)
+	{
+		const a3index count = samplesPerDegree * 720 + 1;
+		const a3real step = a3real_one / (a3real)samplesPerDegree;
+		a3real *const param = table_out, *const sinTable = param + count, *const cosTable = sinTable + count;
+		a3real x;
+		a3index i;
+		for (i = 0; i < count; ++i)
+		{
+			x = (a3real)i * step - a3real_threesixty;
+			param[i] = x;
+			sinTable[i] = a3trigInternalSin(a3deg2rad(x));
+			cosTable[i] = a3trigInternalCos(a3deg2rad(x));
+		}
+		return a3trigInitSetTables(samplesPerDegree, table_out);
+	}
+	return 0;
+}
+
+A3DM_INLINE a3index a3trigInitSetTables(const a3index samplesPerDegree, const a3real table[])
+{
+	if (samplesPerDegree && table)
+	{
+		a3trigInternalTable = table;
+		a3trigInternalSamplesPerDegree = samplesPerDegree;
+		a3trigInternalSampleCount = samplesPerDegree * 720 + 1;
+		return (a3trigInternalSampleCount * 3);
+	}
+	return 0;
+}
+
+A3DM_INLINE a3index a3trigInitSamplesRequired(const a3index samplesPerDegree)
+{
+	return ((samplesPerDegree * 720 + 1) * 3);
+}
+
+A3DM_INLINE a3index a3trigFree()
+{
+	if (a3trigInternalTable)
+	{
+		a3trigInternalTable = 0;
+		a3trigInternalSamplesPerDegree = a3trigInternalSampleCount = 0;
+		return 1;
+	}
+	return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real a3trigValid_sind(a3real x)
+{
+	return (x >= -a3real_threesixty && x <= a3real_threesixty) ? x : a3trigInternalMod(x, a3real_threesixty);
+}
+
+A3DM_INLINE a3real a3trigValid_sinr(a3real x)
+{
+	return (x >= -a3real_twopi && x <= a3real_twopi) ? x : a3trigInternalMod(x, a3real_twopi);
+}
+
+A3DM_INLINE a3real a3trigValid_asin(a3real x)
+{
+	return a3clamp(-a3real_one, a3real_one, x);
+}
+
+A3DM_INLINE a3real a3trigValid_atan(a3real x)
+{
+	return a3clamp(-a3real_halfpi, a3real_halfpi, x);
+}
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3real a3sind(const a3real x)
+{
+	a3real s;
+	if (a3trigInternalTable)
+		return a3trigInternalSample(a3trigInternalTable + a3trigInternalSampleCount, x);
+	a3trigPoly_sind_cosd(x, a3trigAccuracy_full, &s, 0);
+	return s;
+}
+
+A3DM_INLINE a3real a3cosd(const a3real x)
+{
+	a3real c;
+	if (a3trigInternalTable)
+		return a3trigInternalSample(a3trigInternalTable + a3trigInternalSampleCount * 2, x);
+	a3trigPoly_sind_cosd(x, a3trigAccuracy_full, 0, &c);
+	return c;
+}
+
+A3DM_INLINE a3real a3tand(const a3real x)
+{
+	a3real s, c;
+	if (a3trigInternalTable)
+		return a3divide(a3sind(x), a3cosd(x));
+	a3trigPoly_sind_cosd(x, a3trigAccuracy_full, &s, &c);
+	return a3divide(s, c);
+}
+
+A3DM_INLINE a3real a3sinr(const a3real x)
+{
+	a3real s;
+	if (a3trigInternalTable)
+		return a3sind(a3rad2deg(x));
+	a3trigPoly_sinr_cosr(x, a3trigAccuracy_full, &s, 0);
+	return s;
+}
+
+A3DM_INLINE a3real a3cosr(const a3real x)
+{
+	a3real c;
+	if (a3trigInternalTable)
+		return a3cosd(a3rad2deg(x));
+	a3trigPoly_sinr_cosr(x, a3trigAccuracy_full, 0, &c);
+	return c;
+}
+
+A3DM_INLINE a3real a3tanr(const a3real x)
+{
+	a3real s, c;
+	if (a3trigInternalTable)
+		return a3tand(a3rad2deg(x));
+	a3trigPoly_sinr_cosr(x, a3trigAccuracy_full, &s, &c);
+	return a3divide(s, c);
+}
+
+A3DM_INLINE a3real a3asind(const a3real x)
+{
+	return a3rad2deg(a3trigInternalAsin(x));
+}
+
+A3DM_INLINE a3real a3acosd(const a3real x)
+{
+	return a3rad2deg(a3trigInternalAcos(x));
+}
+
+A3DM_INLINE a3real a3atand(const a3real x)
+{
+	return a3rad2deg(a3trigInternalAtan(x));
+}
+
+A3DM_INLINE a3real a3asinr(const a3real x)
+{
+	return a3trigInternalAsin(x);
+}
+
+A3DM_INLINE a3real a3acosr(const a3real x)
+{
+	return a3trigInternalAcos(x);
+}
+
+A3DM_INLINE a3real a3atanr(const a3real x)
+{
+	return a3trigInternalAtan(x);
+}
+
+A3DM_INLINE a3real a3cscd(const a3real x)
+{
+	return a3recipsafe(a3sind(x));
+}
+
+A3DM_INLINE a3real a3secd(const a3real x)
+{
+	return a3recipsafe(a3cosd(x));
+}
+
+A3DM_INLINE a3real a3cotd(const a3real x)
+{
+	return a3divide(a3cosd(x), a3sind(x));
+}
+
+A3DM_INLINE a3real a3cscr(const a3real x)
+{
+	return a3recipsafe(a3sinr(x));
+}
+
+A3DM_INLINE a3real a3secr(const a3real x)
+{
+	return a3recipsafe(a3cosr(x));
+}
+
+A3DM_INLINE a3real a3cotr(const a3real x)
+{
+	return a3divide(a3cosr(x), a3sinr(x));
+}
+
+A3DM_INLINE a3real a3acscd(const a3real x)
+{
+	return a3asind(a3recipsafe(x));
+}
+
+A3DM_INLINE a3real a3asecd(const a3real x)
+{
+	return a3acosd(a3recipsafe(x));
+}
+
+A3DM_INLINE a3real a3acotd(const a3real x)
+{
+	return (x != a3real_zero) ? a3atand(a3recip(x)) : a3real_ninety;
+}
+
+A3DM_INLINE a3real a3acscr(const a3real x)
+{
+	return a3asinr(a3recipsafe(x));
+}
+
+A3DM_INLINE a3real a3asecr(const a3real x)
+{
+	return a3acosr(a3recipsafe(x));
+}
+
+A3DM_INLINE a3real a3acotr(const a3real x)
+{
+	return (x != a3real_zero) ? a3atanr(a3recip(x)) : a3real_halfpi;
+}
+
+A3DM_INLINE a3real a3atan2d(const a3real y, const a3real x)
+{
+	return a3trigPoly_atan2d(y, x, a3trigAccuracy_full);
+}
+
+A3DM_INLINE a3real a3atan2r(const a3real y, const a3real x)
+{
+	return a3trigPoly_atan2r(y, x, a3trigAccuracy_full);
+}
+
+
+//-----------------------------------------------------------------------------
+
+A3DM_INLINE a3index a3trigSetTaylorIterations(const a3index n)
+{
+	const a3index ret = a3trigInternalTaylorIterations;
+	if (n)
+		a3trigInternalTaylorIterations = n;
+	return ret;
+}
+
+A3DM_INLINE a3index a3trigGetTaylorIterations()
+{
+	return a3trigInternalTaylorIterations;
+}
+
+A3DM_INLINE a3real a3trigTaylor_sinr_cosr(const a3real x, a3real *sin_out, a3real *cos_out)
+{
+	// reduce to [-pi, +pi], then accumulate both series term by term
+	a3real r = a3trigValid_sinr(x), r2, termS, termC, sumS, sumC;
+	a3index i, k;
+	if (r > a3real_pi)
+		r -= a3real_twopi;
+	else if (r < -a3real_pi)
+		r += a3real_twopi;
+	r2 = r * r;
+	termS = sumS = r;
+	termC = sumC = a3real_one;
+	for (i = 1, k = 2; i < a3trigInternalTaylorIterations; ++i, k += 2)
+	{
+		termC *= -r2 / (a3real)((k - 1) * k);
+		termS *= -r2 / (a3real)(k * (k + 1));
+		sumC += termC;
+		sumS += termS;
+	}
+	if (sin_out)
+		*sin_out = sumS;
+	if (cos_out)
+		*cos_out = sumC;
+	return x;
+}
+
+A3DM_INLINE a3real a3trigTaylor_sind_cosd(const a3real x, a3real *sin_out, a3real *cos_out)
+{
+	a3trigTaylor_sinr_cosr(a3deg2rad(x), sin_out, cos_out);
+	return x;
+}
+
+A3DM_INLINE a3real a3sinrTaylor(const a3real x)
+{
+	a3real s;
+	a3trigTaylor_sinr_cosr(x, &s, 0);
+	return s;
+}
+
+A3DM_INLINE a3real a3cosrTaylor(const a3real x)
+{
+	a3real c;
+	a3trigTaylor_sinr_cosr(x, 0, &c);
+	return c;
+}
+
+A3DM_INLINE a3real a3tanrTaylor(const a3real x)
+{
+	a3real s, c;
+	a3trigTaylor_sinr_cosr(x, &s, &c);
+	return a3divide(s, c);
+}
+
+A3DM_INLINE a3real a3sindTaylor(const a3real x)
+{
+	return a3sinrTaylor(a3deg2rad(x));
+}
+
+A3DM_INLINE a3real a3cosdTaylor(const a3real x)
+{
+	return a3cosrTaylor(a3deg2rad(x));
+}
+
+A3DM_INLINE a3real a3tandTaylor(const a3real x)
+{
+	return a3tanrTaylor(a3deg2rad(x));
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal: sine and cosine of r in [-pi/4, +pi/4] (slightly beyond is fine), 
+//	rotated by q quarter turns
+A3DM_INLINE void a3trigInternalPolySinCos(const a3real r, const a3real q, const a3trigAccuracy accuracy, a3real *sin_out, a3real *cos_out)
+{
+	const a3real z = r * r;
+	const a3i32 quadrant = (a3i32)q & 3;
+	a3real s, c, sc[3], sign;
+	if (accuracy == a3trigAccuracy_fast)
+	{
+		s = r + r * z * ((a3real)a3trigInternalSinFast1 + z * (a3real)a3trigInternalSinFast2);
+		c = a3real_one + z * ((a3real)a3trigInternalCosFast1 + z * (a3real)a3trigInternalCosFast2);
+	}
+	else
+	{
+		s = r + r * z * ((a3real)a3trigInternalSinFull1 + z * ((a3real)a3trigInternalSinFull2 + z * (a3real)a3trigInternalSinFull3));
+		c = a3real_one - a3real_half * z + z * z * ((a3real)a3trigInternalCosFull2 + z * ((a3real)a3trigInternalCosFull3 + z * (a3real)a3trigInternalCosFull4));
+	}
+	// index rather than branch, the quadrant being unpredictable: odd 
+	//	quadrants rotate (s, c) to (c, -s), the upper two negate both
+	sc[0] = s;
+	sc[1] = c;
+	sc[2] = -s;
+	sign = (quadrant & 2) ? -a3real_one : a3real_one;
+	if (sin_out)
+		*sin_out = sc[quadrant & 1] * sign;
+	if (cos_out)
+		*cos_out = sc[(quadrant & 1) + 1] * sign;
+}
+
+// internal: arctangent of a in [0, 1]
+A3DM_INLINE a3real a3trigInternalPolyAtanUnit(a3real a, const a3trigAccuracy accuracy)
+{
+	a3real r = a3real_zero, z;
+	if (a > (a3real)a3trigInternalTanEighthPi)
+	{
+		// atan(a) = pi/4 + atan((a - 1) / (a + 1))
+		a = (a - a3real_one) / (a + a3real_one);
+		r = a3real_quarterpi;
+	}
+	z = a * a;
+	if (accuracy == a3trigAccuracy_fast)
+		return (r + a + a * z * ((a3real)a3trigInternalAtanFast1 + z * (a3real)a3trigInternalAtanFast2));
+	return (r + a + a * z * ((a3real)a3trigInternalAtanFull1 + z * ((a3real)a3trigInternalAtanFull2 + z * ((a3real)a3trigInternalAtanFull3 + z * (a3real)a3trigInternalAtanFull4))));
+}
+
+#ifdef A3_USING_INTRIN
+// internal: lane version of the reduction and evaluation below; inputs in 
+//	degrees if requested
+A3DM_INLINE void a3trigInternalPolySinCosLanes(a3intrinLanes *sin_out, a3intrinLanes *cos_out, const a3intrinLanes x, const a3boolean degrees, const a3trigAccuracy accuracy)
+{
+	const a3intrinLanes one = a3intrinLanesSet1(1.0f), signBit = a3intrinLanesSet1(-0.0f);
+	a3intrinLanes q, r, z, s, c, tmp, quadrant, swap, negate;
+	if (degrees)
+	{
+		q = a3intrinLanesFloor(a3intrinLanesMulAdd(x, a3intrinLanesSet1(1.0f / 90.0f), a3intrinLanesSet1(0.5f)));
+		r = a3intrinLanesMul(a3intrinLanesMulAdd(q, a3intrinLanesSet1(-90.0f), x), a3intrinLanesSet1(a3real_deg2rad));
+	}
+	else
+	{
+		q = a3intrinLanesFloor(a3intrinLanesMulAdd(x, a3intrinLanesSet1((a3f32)(1.0 / a3real_halfpi)), a3intrinLanesSet1(0.5f)));
+		r = a3intrinLanesMulAdd(q, a3intrinLanesSet1((a3f32)-a3trigInternalHalfPi1), x);
+		r = a3intrinLanesMulAdd(q, a3intrinLanesSet1((a3f32)-a3trigInternalHalfPi2), r);
+		r = a3intrinLanesMulAdd(q, a3intrinLanesSet1((a3f32)-a3trigInternalHalfPi3), r);
+	}
+	z = a3intrinLanesMul(r, r);
+	if (accuracy == a3trigAccuracy_fast)
+	{
+		s = a3intrinLanesMulAdd(a3intrinLanesSet1((a3f32)a3trigInternalSinFast2), z, a3intrinLanesSet1((a3f32)a3trigInternalSinFast1));
+		c = a3intrinLanesMulAdd(a3intrinLanesSet1((a3f32)a3trigInternalCosFast2), z, a3intrinLanesSet1((a3f32)a3trigInternalCosFast1));
+		s = a3intrinLanesMulAdd(a3intrinLanesMul(s, z), r, r);
+		c = a3intrinLanesMulAdd(c, z, one);
+	}
+	else
+	{
+		s = a3intrinLanesMulAdd(a3intrinLanesSet1((a3f32)a3trigInternalSinFull3), z, a3intrinLanesSet1((a3f32)a3trigInternalSinFull2));
+		c = a3intrinLanesMulAdd(a3intrinLanesSet1((a3f32)a3trigInternalCosFull4), z, a3intrinLanesSet1((a3f32)a3trigInternalCosFull3));
+		s = a3intrinLanesMulAdd(s, z, a3intrinLanesSet1((a3f32)a3trigInternalSinFull1));
+		c = a3intrinLanesMulAdd(c, z, a3intrinLanesSet1((a3f32)a3trigInternalCosFull2));
+		s = a3intrinLanesMulAdd(a3intrinLanesMul(s, z), r, r);
+		c = a3intrinLanesMulAdd(a3intrinLanesMul(c, z), z, a3intrinLanesMulAdd(a3intrinLanesSet1(-0.5f), z, one));
+	}
+
+	// quarter turns modulo 4 and modulo 2 as reals, then masks
+	quadrant = a3intrinLanesMulAdd(a3intrinLanesFloor(a3intrinLanesMul(q, a3intrinLanesSet1(0.25f))), a3intrinLanesSet1(-4.0f), q);
+	swap = a3intrinLanesMulAdd(a3intrinLanesFloor(a3intrinLanesMul(quadrant, a3intrinLanesSet1(0.5f))), a3intrinLanesSet1(-2.0f), quadrant);
+	swap = a3intrinLanesLess(a3intrinLanesSet1(0.5f), swap);
+	negate = a3intrinLanesAnd(a3intrinLanesLess(a3intrinLanesSet1(1.5f), quadrant), signBit);
+	tmp = s;
+	s = a3intrinLanesSelect(swap, c, s);
+	c = a3intrinLanesSelect(swap, a3intrinLanesXor(tmp, signBit), c);
+	if (sin_out)
+		*sin_out = a3intrinLanesXor(s, negate);
+	if (cos_out)
+		*cos_out = a3intrinLanesXor(c, negate);
+}
+
+// internal: lane version of two-parameter arctangent, radian output
+A3DM_INLINE a3intrinLanes a3trigInternalPolyAtan2Lanes(const a3intrinLanes y, const a3intrinLanes x, const a3trigAccuracy accuracy)
+{
+	const a3intrinLanes zero = a3intrinLanesSet1(0.0f), one = a3intrinLanesSet1(1.0f), signBit = a3intrinLanesSet1(-0.0f);
+	const a3intrinLanes ax = a3intrinLanesAndNot(signBit, x), ay = a3intrinLanesAndNot(signBit, y);
+	const a3intrinLanes mx = a3intrinLanesMax(ax, ay);
+	a3intrinLanes a = a3intrinLanesAnd(a3intrinLanesDiv(a3intrinLanesMin(ax, ay), mx), a3intrinLanesLess(zero, mx));
+	const a3intrinLanes big = a3intrinLanesLess(a3intrinLanesSet1((a3f32)a3trigInternalTanEighthPi), a);
+	a3intrinLanes z, p, r;
+	a = a3intrinLanesSelect(big, a3intrinLanesDiv(a3intrinLanesSub(a, one), a3intrinLanesAdd(a, one)), a);
+	r = a3intrinLanesAnd(big, a3intrinLanesSet1(a3real_quarterpi));
+	z = a3intrinLanesMul(a, a);
+	if (accuracy == a3trigAccuracy_fast)
+		p = a3intrinLanesMulAdd(a3intrinLanesSet1((a3f32)a3trigInternalAtanFast2), z, a3intrinLanesSet1((a3f32)a3trigInternalAtanFast1));
+	else
+	{
+		p = a3intrinLanesMulAdd(a3intrinLanesSet1((a3f32)a3trigInternalAtanFull4), z, a3intrinLanesSet1((a3f32)a3trigInternalAtanFull3));
+		p = a3intrinLanesMulAdd(p, z, a3intrinLanesSet1((a3f32)a3trigInternalAtanFull2));
+		p = a3intrinLanesMulAdd(p, z, a3intrinLanesSet1((a3f32)a3trigInternalAtanFull1));
+	}
+	r = a3intrinLanesAdd(r, a3intrinLanesMulAdd(a3intrinLanesMul(p, z), a, a));
+
+	// unfold octants: swap about pi/4, reflect about pi/2, then take the 
+	//	sign of y
+	r = a3intrinLanesSelect(a3intrinLanesLess(ax, ay), a3intrinLanesSub(a3intrinLanesSet1(a3real_halfpi), r), r);
+	r = a3intrinLanesSelect(a3intrinLanesLess(x, zero), a3intrinLanesSub(a3intrinLanesSet1(a3real_pi), r), r);
+	return a3intrinLanesOr(r, a3intrinLanesAnd(y, signBit));
+}
+#endif	// A3_USING_INTRIN
+
+
+A3DM_INLINE a3real a3trigPoly_sinr_cosr(const a3real x, const a3trigAccuracy accuracy, a3real *sin_out, a3real *cos_out)
+{
+	// remove whole quarter turns in three steps to keep the remainder exact
+	const a3real q = a3trigInternalFloor(x * (a3real_one / a3real_halfpi) + a3real_half);
+	a3real r = x - q * (a3real)a3trigInternalHalfPi1;
+	r -= q * (a3real)a3trigInternalHalfPi2;
+	r -= q * (a3real)a3trigInternalHalfPi3;
+	a3trigInternalPolySinCos(r, q, accuracy, sin_out, cos_out);
+	return x;
+}
+
+A3DM_INLINE a3real a3trigPoly_sind_cosd(const a3real x, const a3trigAccuracy accuracy, a3real *sin_out, a3real *cos_out)
+{
+	// whole quarter turns are exact in degrees
+	const a3real q = a3trigInternalFloor(x * (a3real_one / a3real_ninety) + a3real_half);
+	a3trigInternalPolySinCos(a3deg2rad(x - q * a3real_ninety), q, accuracy, sin_out, cos_out);
+	return x;
+}
+
+A3DM_INLINE a3real a3trigPoly_atan2r(const a3real y, const a3real x, const a3trigAccuracy accuracy)
+{
+	// fold into the first octant, evaluate, then unfold
+	const a3real ax = a3absolute(x), ay = a3absolute(y);
+	const a3real mx = a3maximum(ax, ay), mn = a3minimum(ax, ay);
+	a3real r = a3trigInternalPolyAtanUnit(mx > a3real_zero ? mn / mx : a3real_zero, accuracy);
+	if (ay > ax)
+		r = a3real_halfpi - r;
+	if (x < a3real_zero)
+		r = a3real_pi - r;
+	return (y < a3real_zero ? -r : r);
+}
+
+A3DM_INLINE a3real a3trigPoly_atan2d(const a3real y, const a3real x, const a3trigAccuracy accuracy)
+{
+	return a3rad2deg(a3trigPoly_atan2r(y, x, accuracy));
+}
+
+A3DM_INLINE a3index a3trigPolyArray_sinr_cosr(a3real sin_out[], a3real cos_out[], const a3real x[], const a3count count, const a3trigAccuracy accuracy)
+{
+	if ((sin_out || cos_out) && x)
+	{
+		a3index i = 0;
+#ifdef A3_USING_INTRIN
+		a3intrinLanes s, c;
+		for (; i + a3intrinLaneCount <= count; i += a3intrinLaneCount)
+		{
+			a3trigInternalPolySinCosLanes(&s, &c, a3intrinLanesLoad(x + i), a3false, accuracy);
+			if (sin_out)
+				a3intrinLanesStore(sin_out + i, s);
+			if (cos_out)
+				a3intrinLanesStore(cos_out + i, c);
+		}
+#endif	// A3_USING_INTRIN
+		for (; i < count; ++i)
+			a3trigPoly_sinr_cosr(x[i], accuracy, sin_out ? sin_out + i : 0, cos_out ? cos_out + i : 0);
+		return count;
+	}
+	return 0;
+}
+
+A3DM_INLINE a3index a3trigPolyArray_sind_cosd(a3real sin_out[], a3real cos_out[], const a3real x[], const a3count count, const a3trigAccuracy accuracy)
+{
+	if ((sin_out || cos_out) && x)
+	{
+		a3index i = 0;
+#ifdef A3_USING_INTRIN
+		a3intrinLanes s, c;
+		for (; i + a3intrinLaneCount <= count; i += a3intrinLaneCount)
+		{
+			a3trigInternalPolySinCosLanes(&s, &c, a3intrinLanesLoad(x + i), a3true, accuracy);
+			if (sin_out)
+				a3intrinLanesStore(sin_out + i, s);
+			if (cos_out)
+				a3intrinLanesStore(cos_out + i, c);
+		}
+#endif	// A3_USING_INTRIN
+		for (; i < count; ++i)
+			a3trigPoly_sind_cosd(x[i], accuracy, sin_out ? sin_out + i : 0, cos_out ? cos_out + i : 0);
+		return count;
+	}
+	return 0;
+}
+
+A3DM_INLINE a3index a3trigPolyArray_atan2r(a3real atan2_out[], const a3real y[], const a3real x[], const a3count count, const a3trigAccuracy accuracy)
+{
+	if (atan2_out && y && x)
+	{
+		a3index i = 0;
+#ifdef A3_USING_INTRIN
+		for (; i + a3intrinLaneCount <= count; i += a3intrinLaneCount)
+			a3intrinLanesStore(atan2_out + i, a3trigInternalPolyAtan2Lanes(a3intrinLanesLoad(y + i), a3intrinLanesLoad(x + i), accuracy));
+#endif	// A3_USING_INTRIN
+		for (; i < count; ++i)
+			atan2_out[i] = a3trigPoly_atan2r(y[i], x[i], accuracy);
+		return count;
+	}
+	return 0;
+}
+
+A3DM_INLINE a3index a3trigPolyArray_atan2d(a3real atan2_out[], const a3real y[], const a3real x[], const a3count count, const a3trigAccuracy accuracy)
+{
+	if (atan2_out && y && x)
+	{
+		a3index i = 0;
+#ifdef A3_USING_INTRIN
+		for (; i + a3intrinLaneCount <= count; i += a3intrinLaneCount)
+			a3intrinLanesStore(atan2_out + i, a3intrinLanesMul(a3trigInternalPolyAtan2Lanes(a3intrinLanesLoad(y + i), a3intrinLanesLoad(x + i), accuracy), a3intrinLanesSet1(a3real_rad2deg)));
+#endif	// A3_USING_INTRIN
+		for (; i < count; ++i)
+			atan2_out[i] = a3trigPoly_atan2d(y[i], x[i], accuracy);
+		return count;
+	}
+	return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// a discrete circle's edge midpoints sit at cos(half slice angle) of the 
+//	vertex radius; spheres multiply the azimuth and elevation factors
+A3DM_INLINE a3real a3trigEdgeToPointRatio(const a3real totalAzimuth, const a3count numSlices)
+{
+	return numSlices ? a3cosd(a3real_half * totalAzimuth / (a3real)numSlices) : a3real_zero;
+}
+
+A3DM_INLINE a3real a3trigPointToEdgeRatio(const a3real totalAzimuth, const a3count numSlices)
+{
+	return a3recipsafe(a3trigEdgeToPointRatio(totalAzimuth, numSlices));
+}
+
+A3DM_INLINE a3real a3trigFaceToPointRatio(const a3real totalAzimuth, const a3real totalElevation, const a3count numSlices, const a3count numStacks)
+{
+	return (a3trigEdgeToPointRatio(totalAzimuth, numSlices) * a3trigEdgeToPointRatio(totalElevation, numStacks));
+}
+
+A3DM_INLINE a3real a3trigPointToFaceRatio(const a3real totalAzimuth, const a3real totalElevation, const a3count numSlices, const a3count numStacks)
+{
+	return a3recipsafe(a3trigFaceToPointRatio(totalAzimuth, totalElevation, numSlices, numStacks));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_TRIG_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_TRIG_H
\ No newline at end of file
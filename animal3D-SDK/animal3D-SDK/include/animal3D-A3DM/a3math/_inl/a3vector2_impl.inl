@@ -0,0 +1,647 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3vector2_impl.inl
+	Implementations for 2D vector functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_VECTOR_H
+#ifndef __ANIMAL3D_A3DM_VECTOR2_IMPL_INL
+#define __ANIMAL3D_A3DM_VECTOR2_IMPL_INL
+
+
+#include "../a3sqrt.h"
+#include "../a3trig.h"
+
+
+A3_BEGIN_IMPL
+
+
+// preset constants
+A3DM_GLOBAL const a3vec2 a3vec2_zero = { { a3real_zero, a3real_zero } };
+A3DM_GLOBAL const a3vec2 a3vec2_one = { { a3real_one, a3real_one } };
+A3DM_GLOBAL const a3vec2 a3vec2_x = { { a3real_one, a3real_zero } };
+A3DM_GLOBAL const a3vec2 a3vec2_y = { { a3real_zero, a3real_one } };
+
+
+//-----------------------------------------------------------------------------
+// setters
+
+A3DM_INLINE a3real2r a3real2Set(a3real2p v_out, const a3real x, const a3real y)
+{
+	v_out[0] = x;
+	v_out[1] = y;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2SetReal2(a3real2p v_out, const a3real2p v)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2SetReal3(a3real2p v_out, const a3real3p v)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2SetReal4(a3real2p v_out, const a3real4p v)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	return v_out;
+}
+
+//-----------------------------------------------------------------------------
+// length and products
+
+A3DM_INLINE a3real a3real2Dot(const a3real2p vL, const a3real2p vR)
+{
+	return (vL[0] * vR[0] + vL[1] * vR[1]);
+}
+
+A3DM_INLINE a3real a3real2LengthSquared(const a3real2p v)
+{
+	return a3real2Dot(v, v);
+}
+
+A3DM_INLINE a3real a3real2LengthSquaredInverse(const a3real2p v)
+{
+	const a3real lenSq = a3real2Dot(v, v);
+	return a3recipsafe(lenSq);
+}
+
+A3DM_INLINE a3real a3real2Length(const a3real2p v)
+{
+	return a3sqrt(a3real2Dot(v, v));
+}
+
+A3DM_INLINE a3real a3real2LengthInverse(const a3real2p v)
+{
+	const a3real lenSq = a3real2Dot(v, v);
+	return a3sqrtSafeInverse(lenSq);
+}
+
+A3DM_INLINE a3real a3real2DistanceSquared(const a3real2p v0, const a3real2p v1)
+{
+	const a3real d0 = v1[0] - v0[0], d1 = v1[1] - v0[1];
+	return (d0 * d0 + d1 * d1);
+}
+
+A3DM_INLINE a3real a3real2Distance(const a3real2p v0, const a3real2p v1)
+{
+	return a3sqrt(a3real2DistanceSquared(v0, v1));
+}
+
+A3DM_INLINE a3real a3real2ProjRatio(const a3real2p v, const a3real2p vBase)
+{
+	const a3real lenSq = a3real2Dot(vBase, vBase);
+	return a3divide(a3real2Dot(v, vBase), lenSq);
+}
+
+//-----------------------------------------------------------------------------
+// arithmetic
+
+A3DM_INLINE a3real2r a3real2Sum(a3real2p v_out, const a3real2p vL, const a3real2p vR)
+{
+	v_out[0] = vL[0] + vR[0];
+	v_out[1] = vL[1] + vR[1];
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2Diff(a3real2p v_out, const a3real2p vL, const a3real2p vR)
+{
+	v_out[0] = vL[0] - vR[0];
+	v_out[1] = vL[1] - vR[1];
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2ProductS(a3real2p v_out, const a3real2p v, const a3real s)
+{
+	v_out[0] = v[0] * s;
+	v_out[1] = v[1] * s;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2QuotientS(a3real2p v_out, const a3real2p v, const a3real s)
+{
+	return a3real2ProductS(v_out, v, a3recip(s));
+}
+
+A3DM_INLINE a3real2r a3real2ProductComp(a3real2p v_out, const a3real2p vL, const a3real2p vR)
+{
+	v_out[0] = vL[0] * vR[0];
+	v_out[1] = vL[1] * vR[1];
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2QuotientComp(a3real2p v_out, const a3real2p vL, const a3real2p vR)
+{
+	v_out[0] = vL[0] / vR[0];
+	v_out[1] = vL[1] / vR[1];
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2GetNegative(a3real2p v_out, const a3real2p v)
+{
+	v_out[0] = -v[0];
+	v_out[1] = -v[1];
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2Negate(a3real2p v_inout)
+{
+	return a3real2GetNegative(v_inout, v_inout);
+}
+
+A3DM_INLINE a3real2r a3real2Add(a3real2p vL_inout, const a3real2p vR)
+{
+	return a3real2Sum(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real2r a3real2Sub(a3real2p vL_inout, const a3real2p vR)
+{
+	return a3real2Diff(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real2r a3real2MulS(a3real2p v_inout, const a3real s)
+{
+	return a3real2ProductS(v_inout, v_inout, s);
+}
+
+A3DM_INLINE a3real2r a3real2DivS(a3real2p v_inout, const a3real s)
+{
+	return a3real2ProductS(v_inout, v_inout, a3recip(s));
+}
+
+A3DM_INLINE a3real2r a3real2MulComp(a3real2p vL_inout, const a3real2p vR)
+{
+	return a3real2ProductComp(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real2r a3real2DivComp(a3real2p vL_inout, const a3real2p vR)
+{
+	return a3real2QuotientComp(vL_inout, vL_inout, vR);
+}
+
+//-----------------------------------------------------------------------------
+// normalization and projection
+
+A3DM_INLINE a3real2r a3real2GetUnit(a3real2p v_out, const a3real2p v)
+{
+	return a3real2ProductS(v_out, v, a3real2LengthInverse(v));
+}
+
+A3DM_INLINE a3real2r a3real2Normalize(a3real2p v_inout)
+{
+	return a3real2GetUnit(v_inout, v_inout);
+}
+
+A3DM_INLINE a3real2r a3real2GetUnitInvLength(a3real2p v_out, const a3real2p v, a3real *invLength_out)
+{
+	const a3real invLength = a3real2LengthInverse(v);
+	if (invLength_out)
+		*invLength_out = invLength;
+	return a3real2ProductS(v_out, v, invLength);
+}
+
+A3DM_INLINE a3real2r a3real2NormalizeGetInvLength(a3real2p v_inout, a3real *invLength_out)
+{
+	return a3real2GetUnitInvLength(v_inout, v_inout, invLength_out);
+}
+
+A3DM_INLINE a3real2r a3real2Projected(a3real2p v_out, const a3real2p v, const a3real2p vBase)
+{
+	return a3real2ProductS(v_out, vBase, a3real2ProjRatio(v, vBase));
+}
+
+A3DM_INLINE a3real2r a3real2Proj(a3real2p v_inout, const a3real2p vBase)
+{
+	return a3real2Projected(v_inout, v_inout, vBase);
+}
+
+A3DM_INLINE a3real2r a3real2ProjectedGetRatio(a3real2p v_out, const a3real2p v, const a3real2p vBase, a3real *ratio_out)
+{
+	const a3real ratio = a3real2ProjRatio(v, vBase);
+	if (ratio_out)
+		*ratio_out = ratio;
+	return a3real2ProductS(v_out, vBase, ratio);
+}
+
+A3DM_INLINE a3real2r a3real2ProjGetRatio(a3real2p v_inout, const a3real2p vBase, a3real *ratio_out)
+{
+	return a3real2ProjectedGetRatio(v_inout, v_inout, vBase, ratio_out);
+}
+
+//-----------------------------------------------------------------------------
+// interpolation
+
+A3DM_INLINE a3real2r a3real2Lerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param)
+{
+	v_out[0] = v0[0] + (v1[0] - v0[0]) * param;
+	v_out[1] = v0[1] + (v1[1] - v0[1]) * param;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2NLerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param)
+{
+	a3real2Lerp(v_out, v0, v1, param);
+	return a3real2GetUnit(v_out, v_out);
+}
+
+A3DM_INLINE a3real2r a3real2Bilerp(a3real2p v_out, const a3real2p v00, const a3real2p v01, const a3real2p v10, const a3real2p v11, const a3real param0, const a3real param1)
+{
+	a3real2 v0, v1;
+	a3real2Lerp(v0, v00, v01, param0);
+	a3real2Lerp(v1, v10, v11, param0);
+	return a3real2Lerp(v_out, v0, v1, param1);
+}
+
+A3DM_INLINE a3real2r a3real2Trilerp(a3real2p v_out, const a3real2p v000, const a3real2p v001, const a3real2p v010, const a3real2p v011, const a3real2p v100, const a3real2p v101, const a3real2p v110, const a3real2p v111, const a3real param0, const a3real param1, const a3real param2)
+{
+	a3real2 v0, v1;
+	a3real2Bilerp(v0, v000, v001, v010, v011, param0, param1);
+	a3real2Bilerp(v1, v100, v101, v110, v111, param0, param1);
+	return a3real2Lerp(v_out, v0, v1, param2);
+}
+
+A3DM_INLINE a3real2r a3real2CatmullRom(a3real2p v_out, const a3real2p vPrev, const a3real2p v0, const a3real2p v1, const a3real2p vNext, const a3real param)
+{
+	// basis weights of the uniform Catmull-Rom matrix
+	const a3real t = param, t2 = t * t, t3 = t2 * t;
+	const a3real wPrev = a3real_half * (-t3 + t2 + t2 - t);
+	const a3real w0 = a3real_half * (t3 + t3 + t3 - t2 * a3real_five + a3real_two);
+	const a3real w1 = a3real_half * (-t3 - t3 - t3 + t2 * a3real_four + t);
+	const a3real wNext = a3real_half * (t3 - t2);
+	v_out[0] = vPrev[0] * wPrev + v0[0] * w0 + v1[0] * w1 + vNext[0] * wNext;
+	v_out[1] = vPrev[1] * wPrev + v0[1] * w0 + v1[1] * w1 + vNext[1] * wNext;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2HermiteTangent(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p vTangent0, const a3real2p vTangent1, const a3real param)
+{
+	// cubic Hermite basis
+	const a3real t = param, t2 = t * t, t3 = t2 * t;
+	const a3real w1 = t2 + t2 + t2 - t3 - t3;
+	const a3real w0 = a3real_one - w1;
+	const a3real wTangent0 = t3 - t2 - t2 + t;
+	const a3real wTangent1 = t3 - t2;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + vTangent0[0] * wTangent0 + vTangent1[0] * wTangent1;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + vTangent0[1] * wTangent0 + vTangent1[1] * wTangent1;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2HermiteControl(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p vControl0, const a3real2p vControl1, const a3real param)
+{
+	// handles are positions; tangents are the offsets from their points
+	a3real2 tangent0, tangent1;
+	a3real2Diff(tangent0, vControl0, v0);
+	a3real2Diff(tangent1, vControl1, v1);
+	return a3real2HermiteTangent(v_out, v0, v1, tangent0, tangent1, param);
+}
+
+A3DM_INLINE a3real2r a3real2Bezier0(a3real2p v_out, const a3real2p v0, const a3real param)
+{
+	// constant curve: parameter unused
+	(void)param;
+	return a3real2SetReal2(v_out, v0);
+}
+
+A3DM_INLINE a3real2r a3real2Bezier1(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param)
+{
+	return a3real2Lerp(v_out, v0, v1, param);
+}
+
+A3DM_INLINE a3real2r a3real2Bezier2(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real param)
+{
+	// Bernstein form of the recursive lerp
+	const a3real t = param, s = a3real_one - t;
+	const a3real w0 = s * s, w1 = a3real_two * s * t, w2 = t * t;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + v2[0] * w2;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + v2[1] * w2;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2Bezier3(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real2p v3, const a3real param)
+{
+	// Bernstein form of the recursive lerp
+	const a3real t = param, s = a3real_one - t;
+	const a3real w0 = s * s * s, w1 = a3real_three * s * s * t, w2 = a3real_three * s * t * t, w3 = t * t * t;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + v2[0] * w2 + v3[0] * w3;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + v2[1] * w2 + v3[1] * w3;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2BezierN(a3real2p v_out, a3count order_N, const a3real2 v[], const a3real param)
+{
+	// Horner evaluation of the Bernstein form in O(N): the sum is factored 
+	//	by the larger of (1-t) and t so the running ratio stays in [0, 1] 
+	//	for interpolation; binomial coefficients are built incrementally
+	const a3real t = param, s = a3real_one - t;
+	const a3boolean fromEnd = (t <= a3real_half);
+	const a3real u = fromEnd ? a3divide(t, s) : a3divide(s, t);
+	a3real c = a3real_one, scale = a3real_one;
+	a3index i, k;
+	if (order_N == 0)
+		return a3real2SetReal2(v_out, v[0]);
+	k = fromEnd ? order_N : 0;
+	v_out[0] = v[k][0];
+	v_out[1] = v[k][1];
+	for (i = 1; i <= order_N; ++i)
+	{
+		c = c * (a3real)(order_N - i + 1) / (a3real)i;
+		k = fromEnd ? order_N - i : i;
+		v_out[0] = v_out[0] * u + v[k][0] * c;
+		v_out[1] = v_out[1] * u + v[k][1] * c;
+		scale *= fromEnd ? s : t;
+	}
+	v_out[0] *= scale;
+	v_out[1] *= scale;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2Slerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param)
+{
+	// angle from normalized dot; magnitudes blend with the same weights
+	const a3real lenProd = a3sqrt(a3real2Dot(v0, v0) * a3real2Dot(v1, v1));
+	const a3real cosAngle = a3divide(a3real2Dot(v0, v1), lenProd);
+	a3real angle, sinAngleInv, w0, w1;
+	if (cosAngle < a3real_one - a3real_epsilon && cosAngle > a3real_epsilon - a3real_one)
+	{
+		angle = a3acosr(cosAngle);
+		sinAngleInv = a3recip(a3sinr(angle));
+		w0 = a3sinr((a3real_one - param) * angle) * sinAngleInv;
+		w1 = a3sinr(param * angle) * sinAngleInv;
+		v_out[0] = v0[0] * w0 + v1[0] * w1;
+		v_out[1] = v0[1] * w0 + v1[1] * w1;
+		return v_out;
+	}
+	return a3real2Lerp(v_out, v0, v1, param);
+}
+
+A3DM_INLINE a3real2r a3real2SlerpUnit(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param)
+{
+	const a3real cosAngle = a3real2Dot(v0, v1);
+	a3real angle, sinAngleInv, w0, w1;
+	if (cosAngle < a3real_one - a3real_epsilon && cosAngle > a3real_epsilon - a3real_one)
+	{
+		angle = a3acosr(cosAngle);
+		sinAngleInv = a3recip(a3sinr(angle));
+		w0 = a3sinr((a3real_one - param) * angle) * sinAngleInv;
+		w1 = a3sinr(param * angle) * sinAngleInv;
+		v_out[0] = v0[0] * w0 + v1[0] * w1;
+		v_out[1] = v0[1] * w0 + v1[1] * w1;
+		return v_out;
+	}
+	return a3real2Lerp(v_out, v0, v1, param);
+}
+
+//-----------------------------------------------------------------------------
+// arc length
+
+A3DM_INLINE a3real a3real2InternalArcLength(const a3real2 sampleTable[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions)
+{
+	// internal: fill parameters and accumulated lengths for existing samples
+	const a3real dt = a3real_one / (a3real)numDivisions;
+	a3real total = a3real_zero, totalInv;
+	a3index i;
+	arclenTable_out[0] = a3real_zero;
+	for (i = 1; i <= numDivisions; ++i)
+		arclenTable_out[i] = total += a3real2Distance(sampleTable[i - 1], sampleTable[i]);
+	if (paramTable_out)
+		for (i = 0; i <= numDivisions; ++i)
+			paramTable_out[i] = (a3real)i * dt;
+	if (autoNormalize && total > a3real_zero)
+		for (i = 1, totalInv = a3recip(total); i <= numDivisions; ++i)
+			arclenTable_out[i] *= totalInv;
+	return total;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthCatmullRom(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p vPrev, const a3real2p v0, const a3real2p v1, const a3real2p vNext)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2CatmullRom(sampleTable_out[i], vPrev, v0, v1, vNext, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthHermiteControl(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p vControl0, const a3real2p vControl1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2HermiteControl(sampleTable_out[i], v0, v1, vControl0, vControl1, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthHermiteTangent(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p vTangent0, const a3real2p vTangent1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2HermiteTangent(sampleTable_out[i], v0, v1, vTangent0, vTangent1, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthBezier0(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2SetReal2(sampleTable_out[i], v0);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthBezier1(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2Lerp(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthBezier2(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p v2)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2Bezier2(sampleTable_out[i], v0, v1, v2, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthBezier3(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real2p v3)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2Bezier3(sampleTable_out[i], v0, v1, v2, v3, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthBezierN(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real2 v[])
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2BezierN(sampleTable_out[i], order_N, v, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthSlerp(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2Slerp(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real2CalculateArcLengthSlerpUnit(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real2SlerpUnit(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real2InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+//-----------------------------------------------------------------------------
+// orthogonalization
+
+A3DM_INLINE a3real2r a3real2GramSchmidtOrtho(a3real2p v_out, const a3real2p v, const a3real2p vBase)
+{
+	const a3real ratio = a3real2ProjRatio(v, vBase);
+	v_out[0] = v[0] - vBase[0] * ratio;
+	v_out[1] = v[1] - vBase[1] * ratio;
+	return v_out;
+}
+
+A3DM_INLINE a3real2r a3real2GramSchmidt(a3real2p v_inout, const a3real2p vBase)
+{
+	return a3real2GramSchmidtOrtho(v_inout, v_inout, vBase);
+}
+
+//-----------------------------------------------------------------------------
+// cross product and triangles
+
+A3DM_INLINE a3real a3real2CrossZ(const a3real2p vL, const a3real2p vR)
+{
+	return (vL[0] * vR[1] - vL[1] * vR[0]);
+}
+
+A3DM_INLINE a3real a3real2TriangleAreaDoubled(const a3real2p v0, const a3real2p v1, const a3real2p v2)
+{
+	const a3real area2 = (v1[0] - v0[0]) * (v2[1] - v0[1]) - (v1[1] - v0[1]) * (v2[0] - v0[0]);
+	return a3absolute(area2);
+}
+
+A3DM_INLINE a3real a3real2TriangleAreaSquared(const a3real2p v0, const a3real2p v1, const a3real2p v2)
+{
+	const a3real area = a3real_half * a3real2TriangleAreaDoubled(v0, v1, v2);
+	return (area * area);
+}
+
+A3DM_INLINE a3real a3real2TriangleArea(const a3real2p v0, const a3real2p v1, const a3real2p v2)
+{
+	return (a3real_half * a3real2TriangleAreaDoubled(v0, v1, v2));
+}
+
+A3DM_INLINE a3boolean a3real2PointIsInTriangleBarycentric(const a3real2p p, const a3real2p v0, const a3real2p v1, const a3real2p v2, a3real *param0, a3real *param1, a3real *param2)
+{
+	// barycentric coordinates from edge dot products (point is projected 
+	//	onto the triangle's plane in 3D); degenerate triangles contain nothing
+	a3real2 e0, e1, ep;
+	a3real d00, d01, d11, dp0, dp1, denom, b0 = a3real_zero, b1 = a3real_zero, b2 = a3real_zero;
+	a3boolean ret = a3false;
+	a3real2Diff(e0, v1, v0);
+	a3real2Diff(e1, v2, v0);
+	a3real2Diff(ep, p, v0);
+	d00 = a3real2Dot(e0, e0);
+	d01 = a3real2Dot(e0, e1);
+	d11 = a3real2Dot(e1, e1);
+	dp0 = a3real2Dot(ep, e0);
+	dp1 = a3real2Dot(ep, e1);
+	denom = d00 * d11 - d01 * d01;
+	if (denom != a3real_zero)
+	{
+		denom = a3recip(denom);
+		b1 = (d11 * dp0 - d01 * dp1) * denom;
+		b2 = (d00 * dp1 - d01 * dp0) * denom;
+		b0 = a3real_one - b1 - b2;
+		ret = (b0 >= a3real_zero && b1 >= a3real_zero && b2 >= a3real_zero);
+	}
+	if (param0)
+		*param0 = b0;
+	if (param1)
+		*param1 = b1;
+	if (param2)
+		*param2 = b2;
+	return ret;
+}
+
+A3DM_INLINE a3boolean a3real2PointIsInTriangle(const a3real2p p, const a3real2p v0, const a3real2p v1, const a3real2p v2)
+{
+	return a3real2PointIsInTriangleBarycentric(p, v0, v1, v2, 0, 0, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_VECTOR2_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_VECTOR_H
\ No newline at end of file
@@ -0,0 +1,751 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3vector3_impl.inl
+	Implementations for 3D vector functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_VECTOR_H
+#ifndef __ANIMAL3D_A3DM_VECTOR3_IMPL_INL
+#define __ANIMAL3D_A3DM_VECTOR3_IMPL_INL
+
+
+#include "../a3sqrt.h"
+#include "../a3trig.h"
+
+
+A3_BEGIN_IMPL
+
+
+// preset constants
+A3DM_GLOBAL const a3vec3 a3vec3_zero = { { a3real_zero, a3real_zero, a3real_zero } };
+A3DM_GLOBAL const a3vec3 a3vec3_one = { { a3real_one, a3real_one, a3real_one } };
+A3DM_GLOBAL const a3vec3 a3vec3_x = { { a3real_one, a3real_zero, a3real_zero } };
+A3DM_GLOBAL const a3vec3 a3vec3_y = { { a3real_zero, a3real_one, a3real_zero } };
+A3DM_GLOBAL const a3vec3 a3vec3_z = { { a3real_zero, a3real_zero, a3real_one } };
+
+
+//-----------------------------------------------------------------------------
+// setters
+
+A3DM_INLINE a3real3r a3real3Set(a3real3p v_out, const a3real x, const a3real y, const a3real z)
+{
+	v_out[0] = x;
+	v_out[1] = y;
+	v_out[2] = z;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3SetReal2(a3real3p v_out, const a3real2p v)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = a3real_zero;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3SetReal2Z(a3real3p v_out, const a3real2p v, const a3real z)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = z;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3SetReal3(a3real3p v_out, const a3real3p v)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = v[2];
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3SetReal4(a3real3p v_out, const a3real4p v)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = v[2];
+	return v_out;
+}
+
+//-----------------------------------------------------------------------------
+// length and products
+
+A3DM_INLINE a3real a3real3Dot(const a3real3p vL, const a3real3p vR)
+{
+	return (vL[0] * vR[0] + vL[1] * vR[1] + vL[2] * vR[2]);
+}
+
+A3DM_INLINE a3real a3real3LengthSquared(const a3real3p v)
+{
+	return a3real3Dot(v, v);
+}
+
+A3DM_INLINE a3real a3real3LengthSquaredInverse(const a3real3p v)
+{
+	const a3real lenSq = a3real3Dot(v, v);
+	return a3recipsafe(lenSq);
+}
+
+A3DM_INLINE a3real a3real3Length(const a3real3p v)
+{
+	return a3sqrt(a3real3Dot(v, v));
+}
+
+A3DM_INLINE a3real a3real3LengthInverse(const a3real3p v)
+{
+	const a3real lenSq = a3real3Dot(v, v);
+	return a3sqrtSafeInverse(lenSq);
+}
+
+A3DM_INLINE a3real a3real3DistanceSquared(const a3real3p v0, const a3real3p v1)
+{
+	const a3real d0 = v1[0] - v0[0], d1 = v1[1] - v0[1], d2 = v1[2] - v0[2];
+	return (d0 * d0 + d1 * d1 + d2 * d2);
+}
+
+A3DM_INLINE a3real a3real3Distance(const a3real3p v0, const a3real3p v1)
+{
+	return a3sqrt(a3real3DistanceSquared(v0, v1));
+}
+
+A3DM_INLINE a3real a3real3ProjRatio(const a3real3p v, const a3real3p vBase)
+{
+	const a3real lenSq = a3real3Dot(vBase, vBase);
+	return a3divide(a3real3Dot(v, vBase), lenSq);
+}
+
+//-----------------------------------------------------------------------------
+// arithmetic
+
+A3DM_INLINE a3real3r a3real3Sum(a3real3p v_out, const a3real3p vL, const a3real3p vR)
+{
+	v_out[0] = vL[0] + vR[0];
+	v_out[1] = vL[1] + vR[1];
+	v_out[2] = vL[2] + vR[2];
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3Diff(a3real3p v_out, const a3real3p vL, const a3real3p vR)
+{
+	v_out[0] = vL[0] - vR[0];
+	v_out[1] = vL[1] - vR[1];
+	v_out[2] = vL[2] - vR[2];
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3ProductS(a3real3p v_out, const a3real3p v, const a3real s)
+{
+	v_out[0] = v[0] * s;
+	v_out[1] = v[1] * s;
+	v_out[2] = v[2] * s;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3QuotientS(a3real3p v_out, const a3real3p v, const a3real s)
+{
+	return a3real3ProductS(v_out, v, a3recip(s));
+}
+
+A3DM_INLINE a3real3r a3real3ProductComp(a3real3p v_out, const a3real3p vL, const a3real3p vR)
+{
+	v_out[0] = vL[0] * vR[0];
+	v_out[1] = vL[1] * vR[1];
+	v_out[2] = vL[2] * vR[2];
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3QuotientComp(a3real3p v_out, const a3real3p vL, const a3real3p vR)
+{
+	v_out[0] = vL[0] / vR[0];
+	v_out[1] = vL[1] / vR[1];
+	v_out[2] = vL[2] / vR[2];
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3GetNegative(a3real3p v_out, const a3real3p v)
+{
+	v_out[0] = -v[0];
+	v_out[1] = -v[1];
+	v_out[2] = -v[2];
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3Negate(a3real3p v_inout)
+{
+	return a3real3GetNegative(v_inout, v_inout);
+}
+
+A3DM_INLINE a3real3r a3real3Add(a3real3p vL_inout, const a3real3p vR)
+{
+	return a3real3Sum(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real3r a3real3Sub(a3real3p vL_inout, const a3real3p vR)
+{
+	return a3real3Diff(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real3r a3real3MulS(a3real3p v_inout, const a3real s)
+{
+	return a3real3ProductS(v_inout, v_inout, s);
+}
+
+A3DM_INLINE a3real3r a3real3DivS(a3real3p v_inout, const a3real s)
+{
+	return a3real3ProductS(v_inout, v_inout, a3recip(s));
+}
+
+A3DM_INLINE a3real3r a3real3MulComp(a3real3p vL_inout, const a3real3p vR)
+{
+	return a3real3ProductComp(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real3r a3real3DivComp(a3real3p vL_inout, const a3real3p vR)
+{
+	return a3real3QuotientComp(vL_inout, vL_inout, vR);
+}
+
+//-----------------------------------------------------------------------------
+// normalization and projection
+
+A3DM_INLINE a3real3r a3real3GetUnit(a3real3p v_out, const a3real3p v)
+{
+	return a3real3ProductS(v_out, v, a3real3LengthInverse(v));
+}
+
+A3DM_INLINE a3real3r a3real3Normalize(a3real3p v_inout)
+{
+	return a3real3GetUnit(v_inout, v_inout);
+}
+
+A3DM_INLINE a3real3r a3real3GetUnitInvLength(a3real3p v_out, const a3real3p v, a3real *invLength_out)
+{
+	const a3real invLength = a3real3LengthInverse(v);
+	if (invLength_out)
+		*invLength_out = invLength;
+	return a3real3ProductS(v_out, v, invLength);
+}
+
+A3DM_INLINE a3real3r a3real3NormalizeGetInvLength(a3real3p v_inout, a3real *invLength_out)
+{
+	return a3real3GetUnitInvLength(v_inout, v_inout, invLength_out);
+}
+
+A3DM_INLINE a3real3r a3real3Projected(a3real3p v_out, const a3real3p v, const a3real3p vBase)
+{
+	return a3real3ProductS(v_out, vBase, a3real3ProjRatio(v, vBase));
+}
+
+A3DM_INLINE a3real3r a3real3Proj(a3real3p v_inout, const a3real3p vBase)
+{
+	return a3real3Projected(v_inout, v_inout, vBase);
+}
+
+A3DM_INLINE a3real3r a3real3ProjectedGetRatio(a3real3p v_out, const a3real3p v, const a3real3p vBase, a3real *ratio_out)
+{
+	const a3real ratio = a3real3ProjRatio(v, vBase);
+	if (ratio_out)
+		*ratio_out = ratio;
+	return a3real3ProductS(v_out, vBase, ratio);
+}
+
+A3DM_INLINE a3real3r a3real3ProjGetRatio(a3real3p v_inout, const a3real3p vBase, a3real *ratio_out)
+{
+	return a3real3ProjectedGetRatio(v_inout, v_inout, vBase, ratio_out);
+}
+
+//-----------------------------------------------------------------------------
+// interpolation
+
+A3DM_INLINE a3real3r a3real3Lerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param)
+{
+	v_out[0] = v0[0] + (v1[0] - v0[0]) * param;
+	v_out[1] = v0[1] + (v1[1] - v0[1]) * param;
+	v_out[2] = v0[2] + (v1[2] - v0[2]) * param;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3NLerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param)
+{
+	a3real3Lerp(v_out, v0, v1, param);
+	return a3real3GetUnit(v_out, v_out);
+}
+
+A3DM_INLINE a3real3r a3real3Bilerp(a3real3p v_out, const a3real3p v00, const a3real3p v01, const a3real3p v10, const a3real3p v11, const a3real param0, const a3real param1)
+{
+	a3real3 v0, v1;
+	a3real3Lerp(v0, v00, v01, param0);
+	a3real3Lerp(v1, v10, v11, param0);
+	return a3real3Lerp(v_out, v0, v1, param1);
+}
+
+A3DM_INLINE a3real3r a3real3Trilerp(a3real3p v_out, const a3real3p v000, const a3real3p v001, const a3real3p v010, const a3real3p v011, const a3real3p v100, const a3real3p v101, const a3real3p v110, const a3real3p v111, const a3real param0, const a3real param1, const a3real param2)
+{
+	a3real3 v0, v1;
+	a3real3Bilerp(v0, v000, v001, v010, v011, param0, param1);
+	a3real3Bilerp(v1, v100, v101, v110, v111, param0, param1);
+	return a3real3Lerp(v_out, v0, v1, param2);
+}
+
+A3DM_INLINE a3real3r a3real3CatmullRom(a3real3p v_out, const a3real3p vPrev, const a3real3p v0, const a3real3p v1, const a3real3p vNext, const a3real param)
+{
+	// basis weights of the uniform Catmull-Rom matrix
+	const a3real t = param, t2 = t * t, t3 = t2 * t;
+	const a3real wPrev = a3real_half * (-t3 + t2 + t2 - t);
+	const a3real w0 = a3real_half * (t3 + t3 + t3 - t2 * a3real_five + a3real_two);
+	const a3real w1 = a3real_half * (-t3 - t3 - t3 + t2 * a3real_four + t);
+	const a3real wNext = a3real_half * (t3 - t2);
+	v_out[0] = vPrev[0] * wPrev + v0[0] * w0 + v1[0] * w1 + vNext[0] * wNext;
+	v_out[1] = vPrev[1] * wPrev + v0[1] * w0 + v1[1] * w1 + vNext[1] * wNext;
+	v_out[2] = vPrev[2] * wPrev + v0[2] * w0 + v1[2] * w1 + vNext[2] * wNext;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3HermiteTangent(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p vTangent0, const a3real3p vTangent1, const a3real param)
+{
+	// cubic Hermite basis
+	const a3real t = param, t2 = t * t, t3 = t2 * t;
+	const a3real w1 = t2 + t2 + t2 - t3 - t3;
+	const a3real w0 = a3real_one - w1;
+	const a3real wTangent0 = t3 - t2 - t2 + t;
+	const a3real wTangent1 = t3 - t2;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + vTangent0[0] * wTangent0 + vTangent1[0] * wTangent1;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + vTangent0[1] * wTangent0 + vTangent1[1] * wTangent1;
+	v_out[2] = v0[2] * w0 + v1[2] * w1 + vTangent0[2] * wTangent0 + vTangent1[2] * wTangent1;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3HermiteControl(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p vControl0, const a3real3p vControl1, const a3real param)
+{
+	// handles are positions; tangents are the offsets from their points
+	a3real3 tangent0, tangent1;
+	a3real3Diff(tangent0, vControl0, v0);
+	a3real3Diff(tangent1, vControl1, v1);
+	return a3real3HermiteTangent(v_out, v0, v1, tangent0, tangent1, param);
+}
+
+A3DM_INLINE a3real3r a3real3Bezier0(a3real3p v_out, const a3real3p v0, const a3real param)
+{
+	// constant curve: parameter unused
+	(void)param;
+	return a3real3SetReal3(v_out, v0);
+}
+
+A3DM_INLINE a3real3r a3real3Bezier1(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param)
+{
+	return a3real3Lerp(v_out, v0, v1, param);
+}
+
+A3DM_INLINE a3real3r a3real3Bezier2(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real param)
+{
+	// Bernstein form of the recursive lerp
+	const a3real t = param, s = a3real_one - t;
+	const a3real w0 = s * s, w1 = a3real_two * s * t, w2 = t * t;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + v2[0] * w2;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + v2[1] * w2;
+	v_out[2] = v0[2] * w0 + v1[2] * w1 + v2[2] * w2;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3Bezier3(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real3p v3, const a3real param)
+{
+	// Bernstein form of the recursive lerp
+	const a3real t = param, s = a3real_one - t;
+	const a3real w0 = s * s * s, w1 = a3real_three * s * s * t, w2 = a3real_three * s * t * t, w3 = t * t * t;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + v2[0] * w2 + v3[0] * w3;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + v2[1] * w2 + v3[1] * w3;
+	v_out[2] = v0[2] * w0 + v1[2] * w1 + v2[2] * w2 + v3[2] * w3;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3BezierN(a3real3p v_out, a3count order_N, const a3real3 v[], const a3real param)
+{
+	// Horner evaluation of the Bernstein form in O(N): the sum is factored 
+	//	by the larger of (1-t) and t so the running ratio stays in [0, 1] 
+	//	for interpolation; binomial coefficients are built incrementally
+	const a3real t = param, s = a3real_one - t;
+	const a3boolean fromEnd = (t <= a3real_half);
+	const a3real u = fromEnd ? a3divide(t, s) : a3divide(s, t);
+	a3real c = a3real_one, scale = a3real_one;
+	a3index i, k;
+	if (order_N == 0)
+		return a3real3SetReal3(v_out, v[0]);
+	k = fromEnd ? order_N : 0;
+	v_out[0] = v[k][0];
+	v_out[1] = v[k][1];
+	v_out[2] = v[k][2];
+	for (i = 1; i <= order_N; ++i)
+	{
+		c = c * (a3real)(order_N - i + 1) / (a3real)i;
+		k = fromEnd ? order_N - i : i;
+		v_out[0] = v_out[0] * u + v[k][0] * c;
+		v_out[1] = v_out[1] * u + v[k][1] * c;
+		v_out[2] = v_out[2] * u + v[k][2] * c;
+		scale *= fromEnd ? s : t;
+	}
+	v_out[0] *= scale;
+	v_out[1] *= scale;
+	v_out[2] *= scale;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3Slerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param)
+{
+	// angle from normalized dot; magnitudes blend with the same weights
+	const a3real lenProd = a3sqrt(a3real3Dot(v0, v0) * a3real3Dot(v1, v1));
+	const a3real cosAngle = a3divide(a3real3Dot(v0, v1), lenProd);
+	a3real angle, sinAngleInv, w0, w1;
+	if (cosAngle < a3real_one - a3real_epsilon && cosAngle > a3real_epsilon - a3real_one)
+	{
+		angle = a3acosr(cosAngle);
+		sinAngleInv = a3recip(a3sinr(angle));
+		w0 = a3sinr((a3real_one - param) * angle) * sinAngleInv;
+		w1 = a3sinr(param * angle) * sinAngleInv;
+		v_out[0] = v0[0] * w0 + v1[0] * w1;
+		v_out[1] = v0[1] * w0 + v1[1] * w1;
+		v_out[2] = v0[2] * w0 + v1[2] * w1;
+		return v_out;
+	}
+	return a3real3Lerp(v_out, v0, v1, param);
+}
+
+A3DM_INLINE a3real3r a3real3SlerpUnit(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param)
+{
+	const a3real cosAngle = a3real3Dot(v0, v1);
+	a3real angle, sinAngleInv, w0, w1;
+	if (cosAngle < a3real_one - a3real_epsilon && cosAngle > a3real_epsilon - a3real_one)
+	{
+		angle = a3acosr(cosAngle);
+		sinAngleInv = a3recip(a3sinr(angle));
+		w0 = a3sinr((a3real_one - param) * angle) * sinAngleInv;
+		w1 = a3sinr(param * angle) * sinAngleInv;
+		v_out[0] = v0[0] * w0 + v1[0] * w1;
+		v_out[1] = v0[1] * w0 + v1[1] * w1;
+		v_out[2] = v0[2] * w0 + v1[2] * w1;
+		return v_out;
+	}
+	return a3real3Lerp(v_out, v0, v1, param);
+}
+
+//-----------------------------------------------------------------------------
+// arc length
+
+A3DM_INLINE a3real a3real3InternalArcLength(const a3real3 sampleTable[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions)
+{
+	// internal: fill parameters and accumulated lengths for existing samples
+	const a3real dt = a3real_one / (a3real)numDivisions;
+	a3real total = a3real_zero, totalInv;
+	a3index i;
+	arclenTable_out[0] = a3real_zero;
+	for (i = 1; i <= numDivisions; ++i)
+		arclenTable_out[i] = total += a3real3Distance(sampleTable[i - 1], sampleTable[i]);
+	if (paramTable_out)
+		for (i = 0; i <= numDivisions; ++i)
+			paramTable_out[i] = (a3real)i * dt;
+	if (autoNormalize && total > a3real_zero)
+		for (i = 1, totalInv = a3recip(total); i <= numDivisions; ++i)
+			arclenTable_out[i] *= totalInv;
+	return total;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthCatmullRom(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p vPrev, const a3real3p v0, const a3real3p v1, const a3real3p vNext)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3CatmullRom(sampleTable_out[i], vPrev, v0, v1, vNext, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthHermiteControl(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p vControl0, const a3real3p vControl1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3HermiteControl(sampleTable_out[i], v0, v1, vControl0, vControl1, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthHermiteTangent(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p vTangent0, const a3real3p vTangent1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3HermiteTangent(sampleTable_out[i], v0, v1, vTangent0, vTangent1, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthBezier0(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3SetReal3(sampleTable_out[i], v0);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthBezier1(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3Lerp(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthBezier2(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3Bezier2(sampleTable_out[i], v0, v1, v2, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthBezier3(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real3p v3)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3Bezier3(sampleTable_out[i], v0, v1, v2, v3, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthBezierN(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real3 v[])
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3BezierN(sampleTable_out[i], order_N, v, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthSlerp(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3Slerp(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real3CalculateArcLengthSlerpUnit(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real3SlerpUnit(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real3InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+//-----------------------------------------------------------------------------
+// orthogonalization
+
+A3DM_INLINE a3real3r a3real3GramSchmidtOrtho(a3real3p v_out, const a3real3p v, const a3real3p vBase)
+{
+	const a3real ratio = a3real3ProjRatio(v, vBase);
+	v_out[0] = v[0] - vBase[0] * ratio;
+	v_out[1] = v[1] - vBase[1] * ratio;
+	v_out[2] = v[2] - vBase[2] * ratio;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3GramSchmidt(a3real3p v_inout, const a3real3p vBase)
+{
+	return a3real3GramSchmidtOrtho(v_inout, v_inout, vBase);
+}
+
+A3DM_INLINE a3real3r a3real3GramSchmidtOrtho2(a3real3p v0_out, a3real3p v1_out, const a3real3p v0, const a3real3p v1, const a3real3p vBase)
+{
+	a3real3 tmp;
+	a3real3GramSchmidtOrtho(v0_out, v0, vBase);
+	a3real3GramSchmidtOrtho(tmp, v1, vBase);
+	return a3real3GramSchmidtOrtho(v1_out, tmp, v0_out);
+}
+
+A3DM_INLINE a3real3r a3real3GramSchmidt2(a3real3p v0_inout, a3real3p v1_inout, const a3real3p vBase)
+{
+	return a3real3GramSchmidtOrtho2(v0_inout, v1_inout, v0_inout, v1_inout, vBase);
+}
+
+//-----------------------------------------------------------------------------
+// cross product and triangles
+
+A3DM_INLINE a3real3r a3real3Cross(a3real3p v_out, const a3real3p vL, const a3real3p vR)
+{
+	const a3real x = vL[1] * vR[2] - vL[2] * vR[1];
+	const a3real y = vL[2] * vR[0] - vL[0] * vR[2];
+	const a3real z = vL[0] * vR[1] - vL[1] * vR[0];
+	v_out[0] = x;
+	v_out[1] = y;
+	v_out[2] = z;
+	return v_out;
+}
+
+A3DM_INLINE a3real3r a3real3CrossUnit(a3real3p v_out, const a3real3p vL, const a3real3p vR)
+{
+	a3real3Cross(v_out, vL, vR);
+	return a3real3Normalize(v_out);
+}
+
+A3DM_INLINE a3real3r a3real3TriangleNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	a3real3 e0, e1;
+	a3real3Diff(e0, v1, v0);
+	a3real3Diff(e1, v2, v0);
+	return a3real3Cross(n_out, e0, e1);
+}
+
+A3DM_INLINE a3real3r a3real3TriangleNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	a3real3TriangleNormal(n_out, v0, v1, v2);
+	return a3real3Normalize(n_out);
+}
+
+A3DM_INLINE a3real a3real3TriangleAreaDoubledNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	return a3real3Length(a3real3TriangleNormal(n_out, v0, v1, v2));
+}
+
+A3DM_INLINE a3real a3real3TriangleAreaSquaredNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	return (a3real_quarter * a3real3LengthSquared(a3real3TriangleNormal(n_out, v0, v1, v2)));
+}
+
+A3DM_INLINE a3real a3real3TriangleAreaNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	return (a3real_half * a3real3Length(a3real3TriangleNormal(n_out, v0, v1, v2)));
+}
+
+A3DM_INLINE a3real a3real3TriangleAreaDoubledNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	a3real invLength;
+	a3real3TriangleNormal(n_out, v0, v1, v2);
+	a3real3NormalizeGetInvLength(n_out, &invLength);
+	return a3recipsafe(invLength);
+}
+
+A3DM_INLINE a3real a3real3TriangleAreaSquaredNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	const a3real area = a3real_half * a3real3TriangleAreaDoubledNormalUnit(n_out, v0, v1, v2);
+	return (area * area);
+}
+
+A3DM_INLINE a3real a3real3TriangleAreaNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	return (a3real_half * a3real3TriangleAreaDoubledNormalUnit(n_out, v0, v1, v2));
+}
+
+A3DM_INLINE a3real a3real3TriangleAreaDoubled(const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	a3real3 n;
+	return a3real3TriangleAreaDoubledNormal(n, v0, v1, v2);
+}
+
+A3DM_INLINE a3real a3real3TriangleAreaSquared(const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	a3real3 n;
+	return a3real3TriangleAreaSquaredNormal(n, v0, v1, v2);
+}
+
+A3DM_INLINE a3real a3real3TriangleArea(const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	a3real3 n;
+	return a3real3TriangleAreaNormal(n, v0, v1, v2);
+}
+
+A3DM_INLINE a3boolean a3real3PointIsInTriangleBarycentric(const a3real3p p, const a3real3p v0, const a3real3p v1, const a3real3p v2, a3real *param0, a3real *param1, a3real *param2)
+{
+	// barycentric coordinates from edge dot products (point is projected 
+	//	onto the triangle's plane in 3D); degenerate triangles contain nothing
+	a3real3 e0, e1, ep;
+	a3real d00, d01, d11, dp0, dp1, denom, b0 = a3real_zero, b1 = a3real_zero, b2 = a3real_zero;
+	a3boolean ret = a3false;
+	a3real3Diff(e0, v1, v0);
+	a3real3Diff(e1, v2, v0);
+	a3real3Diff(ep, p, v0);
+	d00 = a3real3Dot(e0, e0);
+	d01 = a3real3Dot(e0, e1);
+	d11 = a3real3Dot(e1, e1);
+	dp0 = a3real3Dot(ep, e0);
+	dp1 = a3real3Dot(ep, e1);
+	denom = d00 * d11 - d01 * d01;
+	if (denom != a3real_zero)
+	{
+		denom = a3recip(denom);
+		b1 = (d11 * dp0 - d01 * dp1) * denom;
+		b2 = (d00 * dp1 - d01 * dp0) * denom;
+		b0 = a3real_one - b1 - b2;
+		ret = (b0 >= a3real_zero && b1 >= a3real_zero && b2 >= a3real_zero);
+	}
+	if (param0)
+		*param0 = b0;
+	if (param1)
+		*param1 = b1;
+	if (param2)
+		*param2 = b2;
+	return ret;
+}
+
+A3DM_INLINE a3boolean a3real3PointIsInTriangle(const a3real3p p, const a3real3p v0, const a3real3p v1, const a3real3p v2)
+{
+	return a3real3PointIsInTriangleBarycentric(p, v0, v1, v2, 0, 0, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_VECTOR3_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_VECTOR_H
\ No newline at end of file
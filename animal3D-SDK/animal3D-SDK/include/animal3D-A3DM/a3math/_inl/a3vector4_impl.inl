@@ -0,0 +1,731 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	animal3D Math (A3DM) SDK
+	By Daniel S. Buckstein
+
+	a3vector4_impl.inl
+	Implementations for 4D vector functions.
+*/
+
+#ifdef __ANIMAL3D_A3DM_VECTOR_H
+#ifndef __ANIMAL3D_A3DM_VECTOR4_IMPL_INL
+#define __ANIMAL3D_A3DM_VECTOR4_IMPL_INL
+
+
+#include "../a3sqrt.h"
+#include "../a3trig.h"
+#include "a3intrin_impl.inl"
+
+
+A3_BEGIN_IMPL
+
+
+// preset constants
+A3DM_GLOBAL const a3vec4 a3vec4_zero = { { a3real_zero, a3real_zero, a3real_zero, a3real_zero } };
+A3DM_GLOBAL const a3vec4 a3vec4_one = { { a3real_one, a3real_one, a3real_one, a3real_one } };
+A3DM_GLOBAL const a3vec4 a3vec4_x = { { a3real_one, a3real_zero, a3real_zero, a3real_zero } };
+A3DM_GLOBAL const a3vec4 a3vec4_y = { { a3real_zero, a3real_one, a3real_zero, a3real_zero } };
+A3DM_GLOBAL const a3vec4 a3vec4_z = { { a3real_zero, a3real_zero, a3real_one, a3real_zero } };
+A3DM_GLOBAL const a3vec4 a3vec4_w = { { a3real_zero, a3real_zero, a3real_zero, a3real_one } };
+
+
+//-----------------------------------------------------------------------------
+// setters
+
+A3DM_INLINE a3real4r a3real4Set(a3real4p v_out, const a3real x, const a3real y, const a3real z, const a3real w)
+{
+	v_out[0] = x;
+	v_out[1] = y;
+	v_out[2] = z;
+	v_out[3] = w;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4SetReal2(a3real4p v_out, const a3real2p v)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = v_out[3] = a3real_zero;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4SetReal2Z(a3real4p v_out, const a3real2p v, const a3real z)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = z;
+	v_out[3] = a3real_zero;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4SetReal2ZW(a3real4p v_out, const a3real2p v, const a3real z, const a3real w)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = z;
+	v_out[3] = w;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4SetReal3(a3real4p v_out, const a3real3p v)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = v[2];
+	v_out[3] = a3real_zero;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4SetReal3W(a3real4p v_out, const a3real3p v, const a3real w)
+{
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = v[2];
+	v_out[3] = w;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4SetReal4(a3real4p v_out, const a3real4p v)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(v_out, _mm_loadu_ps(v));
+#else	// !A3_USING_INTRIN
+	v_out[0] = v[0];
+	v_out[1] = v[1];
+	v_out[2] = v[2];
+	v_out[3] = v[3];
+#endif	// A3_USING_INTRIN
+	return v_out;
+}
+
+//-----------------------------------------------------------------------------
+// length and products
+
+A3DM_INLINE a3real a3real4Dot(const a3real4p vL, const a3real4p vR)
+{
+#ifdef A3_USING_INTRIN
+	return _mm_cvtss_f32(a3intrinDot4(_mm_loadu_ps(vL), _mm_loadu_ps(vR)));
+#else	// !A3_USING_INTRIN
+	return (vL[0] * vR[0] + vL[1] * vR[1] + vL[2] * vR[2] + vL[3] * vR[3]);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real a3real4LengthSquared(const a3real4p v)
+{
+	return a3real4Dot(v, v);
+}
+
+A3DM_INLINE a3real a3real4LengthSquaredInverse(const a3real4p v)
+{
+	const a3real lenSq = a3real4Dot(v, v);
+	return a3recipsafe(lenSq);
+}
+
+A3DM_INLINE a3real a3real4Length(const a3real4p v)
+{
+	return a3sqrt(a3real4Dot(v, v));
+}
+
+A3DM_INLINE a3real a3real4LengthInverse(const a3real4p v)
+{
+	const a3real lenSq = a3real4Dot(v, v);
+	return a3sqrtSafeInverse(lenSq);
+}
+
+A3DM_INLINE a3real a3real4DistanceSquared(const a3real4p v0, const a3real4p v1)
+{
+#ifdef A3_USING_INTRIN
+	const __m128 d = _mm_sub_ps(_mm_loadu_ps(v1), _mm_loadu_ps(v0));
+	return _mm_cvtss_f32(a3intrinDot4(d, d));
+#else	// !A3_USING_INTRIN
+	const a3real d0 = v1[0] - v0[0], d1 = v1[1] - v0[1], d2 = v1[2] - v0[2], d3 = v1[3] - v0[3];
+	return (d0 * d0 + d1 * d1 + d2 * d2 + d3 * d3);
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real a3real4Distance(const a3real4p v0, const a3real4p v1)
+{
+	return a3sqrt(a3real4DistanceSquared(v0, v1));
+}
+
+A3DM_INLINE a3real a3real4ProjRatio(const a3real4p v, const a3real4p vBase)
+{
+	const a3real lenSq = a3real4Dot(vBase, vBase);
+	return a3divide(a3real4Dot(v, vBase), lenSq);
+}
+
+//-----------------------------------------------------------------------------
+// arithmetic
+
+A3DM_INLINE a3real4r a3real4Sum(a3real4p v_out, const a3real4p vL, const a3real4p vR)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(v_out, _mm_add_ps(_mm_loadu_ps(vL), _mm_loadu_ps(vR)));
+#else	// !A3_USING_INTRIN
+	v_out[0] = vL[0] + vR[0];
+	v_out[1] = vL[1] + vR[1];
+	v_out[2] = vL[2] + vR[2];
+	v_out[3] = vL[3] + vR[3];
+#endif	// A3_USING_INTRIN
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4Diff(a3real4p v_out, const a3real4p vL, const a3real4p vR)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(v_out, _mm_sub_ps(_mm_loadu_ps(vL), _mm_loadu_ps(vR)));
+#else	// !A3_USING_INTRIN
+	v_out[0] = vL[0] - vR[0];
+	v_out[1] = vL[1] - vR[1];
+	v_out[2] = vL[2] - vR[2];
+	v_out[3] = vL[3] - vR[3];
+#endif	// A3_USING_INTRIN
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4ProductS(a3real4p v_out, const a3real4p v, const a3real s)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(v_out, _mm_mul_ps(_mm_loadu_ps(v), _mm_set1_ps(s)));
+#else	// !A3_USING_INTRIN
+	v_out[0] = v[0] * s;
+	v_out[1] = v[1] * s;
+	v_out[2] = v[2] * s;
+	v_out[3] = v[3] * s;
+#endif	// A3_USING_INTRIN
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4QuotientS(a3real4p v_out, const a3real4p v, const a3real s)
+{
+	return a3real4ProductS(v_out, v, a3recip(s));
+}
+
+A3DM_INLINE a3real4r a3real4ProductComp(a3real4p v_out, const a3real4p vL, const a3real4p vR)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(v_out, _mm_mul_ps(_mm_loadu_ps(vL), _mm_loadu_ps(vR)));
+#else	// !A3_USING_INTRIN
+	v_out[0] = vL[0] * vR[0];
+	v_out[1] = vL[1] * vR[1];
+	v_out[2] = vL[2] * vR[2];
+	v_out[3] = vL[3] * vR[3];
+#endif	// A3_USING_INTRIN
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4QuotientComp(a3real4p v_out, const a3real4p vL, const a3real4p vR)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(v_out, _mm_div_ps(_mm_loadu_ps(vL), _mm_loadu_ps(vR)));
+#else	// !A3_USING_INTRIN
+	v_out[0] = vL[0] / vR[0];
+	v_out[1] = vL[1] / vR[1];
+	v_out[2] = vL[2] / vR[2];
+	v_out[3] = vL[3] / vR[3];
+#endif	// A3_USING_INTRIN
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4GetNegative(a3real4p v_out, const a3real4p v)
+{
+#ifdef A3_USING_INTRIN
+	_mm_storeu_ps(v_out, _mm_xor_ps(_mm_loadu_ps(v), _mm_set1_ps(-0.0f)));
+#else	// !A3_USING_INTRIN
+	v_out[0] = -v[0];
+	v_out[1] = -v[1];
+	v_out[2] = -v[2];
+	v_out[3] = -v[3];
+#endif	// A3_USING_INTRIN
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4Negate(a3real4p v_inout)
+{
+	return a3real4GetNegative(v_inout, v_inout);
+}
+
+A3DM_INLINE a3real4r a3real4Add(a3real4p vL_inout, const a3real4p vR)
+{
+	return a3real4Sum(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real4r a3real4Sub(a3real4p vL_inout, const a3real4p vR)
+{
+	return a3real4Diff(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real4r a3real4MulS(a3real4p v_inout, const a3real s)
+{
+	return a3real4ProductS(v_inout, v_inout, s);
+}
+
+A3DM_INLINE a3real4r a3real4DivS(a3real4p v_inout, const a3real s)
+{
+	return a3real4ProductS(v_inout, v_inout, a3recip(s));
+}
+
+A3DM_INLINE a3real4r a3real4MulComp(a3real4p vL_inout, const a3real4p vR)
+{
+	return a3real4ProductComp(vL_inout, vL_inout, vR);
+}
+
+A3DM_INLINE a3real4r a3real4DivComp(a3real4p vL_inout, const a3real4p vR)
+{
+	return a3real4QuotientComp(vL_inout, vL_inout, vR);
+}
+
+//-----------------------------------------------------------------------------
+// normalization and projection
+
+A3DM_INLINE a3real4r a3real4GetUnit(a3real4p v_out, const a3real4p v)
+{
+#ifdef A3_USING_INTRIN
+	const __m128 x = _mm_loadu_ps(v), lenSq = a3intrinDot4(x, x);
+	const __m128 invLen = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lenSq)), _mm_cmpgt_ps(lenSq, _mm_setzero_ps()));
+	_mm_storeu_ps(v_out, _mm_mul_ps(x, invLen));
+	return v_out;
+#else	// !A3_USING_INTRIN
+	return a3real4ProductS(v_out, v, a3real4LengthInverse(v));
+#endif	// A3_USING_INTRIN
+}
+
+A3DM_INLINE a3real4r a3real4Normalize(a3real4p v_inout)
+{
+	return a3real4GetUnit(v_inout, v_inout);
+}
+
+A3DM_INLINE a3real4r a3real4GetUnitInvLength(a3real4p v_out, const a3real4p v, a3real *invLen_out)
+{
+	const a3real invLength = a3real4LengthInverse(v);
+	if (invLen_out)
+		*invLen_out = invLength;
+	return a3real4ProductS(v_out, v, invLength);
+}
+
+A3DM_INLINE a3real4r a3real4NormalizeGetInvLength(a3real4p v_inout, a3real *invLen_out)
+{
+	return a3real4GetUnitInvLength(v_inout, v_inout, invLen_out);
+}
+
+A3DM_INLINE a3real4r a3real4Projected(a3real4p v_out, const a3real4p v, const a3real4p vBase)
+{
+	return a3real4ProductS(v_out, vBase, a3real4ProjRatio(v, vBase));
+}
+
+A3DM_INLINE a3real4r a3real4Proj(a3real4p v_inout, const a3real4p vBase)
+{
+	return a3real4Projected(v_inout, v_inout, vBase);
+}
+
+A3DM_INLINE a3real4r a3real4ProjectedGetRatio(a3real4p v_out, const a3real4p v, const a3real4p vBase, a3real *ratio_out)
+{
+	const a3real ratio = a3real4ProjRatio(v, vBase);
+	if (ratio_out)
+		*ratio_out = ratio;
+	return a3real4ProductS(v_out, vBase, ratio);
+}
+
+A3DM_INLINE a3real4r a3real4ProjGetRatio(a3real4p v_inout, const a3real4p vBase, a3real *ratio_out)
+{
+	return a3real4ProjectedGetRatio(v_inout, v_inout, vBase, ratio_out);
+}
+
+//-----------------------------------------------------------------------------
+// interpolation
+
+A3DM_INLINE a3real4r a3real4Lerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param)
+{
+#ifdef A3_USING_INTRIN
+	const __m128 x0 = _mm_loadu_ps(v0);
+	_mm_storeu_ps(v_out, a3intrinMulAdd(_mm_sub_ps(_mm_loadu_ps(v1), x0), _mm_set1_ps(param), x0));
+#else	// !A3_USING_INTRIN
+	v_out[0] = v0[0] + (v1[0] - v0[0]) * param;
+	v_out[1] = v0[1] + (v1[1] - v0[1]) * param;
+	v_out[2] = v0[2] + (v1[2] - v0[2]) * param;
+	v_out[3] = v0[3] + (v1[3] - v0[3]) * param;
+#endif	// A3_USING_INTRIN
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4NLerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param)
+{
+	a3real4Lerp(v_out, v0, v1, param);
+	return a3real4GetUnit(v_out, v_out);
+}
+
+A3DM_INLINE a3real4r a3real4Bilerp(a3real4p v_out, const a3real4p v00, const a3real4p v01, const a3real4p v10, const a3real4p v11, const a3real param0, const a3real param1)
+{
+	a3real4 v0, v1;
+	a3real4Lerp(v0, v00, v01, param0);
+	a3real4Lerp(v1, v10, v11, param0);
+	return a3real4Lerp(v_out, v0, v1, param1);
+}
+
+A3DM_INLINE a3real4r a3real4Trilerp(a3real4p v_out, const a3real4p v000, const a3real4p v001, const a3real4p v010, const a3real4p v011, const a3real4p v100, const a3real4p v101, const a3real4p v110, const a3real4p v111, const a3real param0, const a3real param1, const a3real param2)
+{
+	a3real4 v0, v1;
+	a3real4Bilerp(v0, v000, v001, v010, v011, param0, param1);
+	a3real4Bilerp(v1, v100, v101, v110, v111, param0, param1);
+	return a3real4Lerp(v_out, v0, v1, param2);
+}
+
+A3DM_INLINE a3real4r a3real4CatmullRom(a3real4p v_out, const a3real4p vPrev, const a3real4p v0, const a3real4p v1, const a3real4p vNext, const a3real param)
+{
+	// basis weights of the uniform Catmull-Rom matrix
+	const a3real t = param, t2 = t * t, t3 = t2 * t;
+	const a3real wPrev = a3real_half * (-t3 + t2 + t2 - t);
+	const a3real w0 = a3real_half * (t3 + t3 + t3 - t2 * a3real_five + a3real_two);
+	const a3real w1 = a3real_half * (-t3 - t3 - t3 + t2 * a3real_four + t);
+	const a3real wNext = a3real_half * (t3 - t2);
+	v_out[0] = vPrev[0] * wPrev + v0[0] * w0 + v1[0] * w1 + vNext[0] * wNext;
+	v_out[1] = vPrev[1] * wPrev + v0[1] * w0 + v1[1] * w1 + vNext[1] * wNext;
+	v_out[2] = vPrev[2] * wPrev + v0[2] * w0 + v1[2] * w1 + vNext[2] * wNext;
+	v_out[3] = vPrev[3] * wPrev + v0[3] * w0 + v1[3] * w1 + vNext[3] * wNext;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4HermiteTangent(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p vTangent0, const a3real4p vTangent1, const a3real param)
+{
+	// cubic Hermite basis
+	const a3real t = param, t2 = t * t, t3 = t2 * t;
+	const a3real w1 = t2 + t2 + t2 - t3 - t3;
+	const a3real w0 = a3real_one - w1;
+	const a3real wTangent0 = t3 - t2 - t2 + t;
+	const a3real wTangent1 = t3 - t2;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + vTangent0[0] * wTangent0 + vTangent1[0] * wTangent1;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + vTangent0[1] * wTangent0 + vTangent1[1] * wTangent1;
+	v_out[2] = v0[2] * w0 + v1[2] * w1 + vTangent0[2] * wTangent0 + vTangent1[2] * wTangent1;
+	v_out[3] = v0[3] * w0 + v1[3] * w1 + vTangent0[3] * wTangent0 + vTangent1[3] * wTangent1;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4HermiteControl(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p vControl0, const a3real4p vControl1, const a3real param)
+{
+	// handles are positions; tangents are the offsets from their points
+	a3real4 tangent0, tangent1;
+	a3real4Diff(tangent0, vControl0, v0);
+	a3real4Diff(tangent1, vControl1, v1);
+	return a3real4HermiteTangent(v_out, v0, v1, tangent0, tangent1, param);
+}
+
+A3DM_INLINE a3real4r a3real4Bezier0(a3real4p v_out, const a3real4p v0, const a3real param)
+{
+	// constant curve: parameter unused
+	(void)param;
+	return a3real4SetReal4(v_out, v0);
+}
+
+A3DM_INLINE a3real4r a3real4Bezier1(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param)
+{
+	return a3real4Lerp(v_out, v0, v1, param);
+}
+
+A3DM_INLINE a3real4r a3real4Bezier2(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real param)
+{
+	// Bernstein form of the recursive lerp
+	const a3real t = param, s = a3real_one - t;
+	const a3real w0 = s * s, w1 = a3real_two * s * t, w2 = t * t;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + v2[0] * w2;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + v2[1] * w2;
+	v_out[2] = v0[2] * w0 + v1[2] * w1 + v2[2] * w2;
+	v_out[3] = v0[3] * w0 + v1[3] * w1 + v2[3] * w2;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4Bezier3(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3, const a3real param)
+{
+	// Bernstein form of the recursive lerp
+	const a3real t = param, s = a3real_one - t;
+	const a3real w0 = s * s * s, w1 = a3real_three * s * s * t, w2 = a3real_three * s * t * t, w3 = t * t * t;
+	v_out[0] = v0[0] * w0 + v1[0] * w1 + v2[0] * w2 + v3[0] * w3;
+	v_out[1] = v0[1] * w0 + v1[1] * w1 + v2[1] * w2 + v3[1] * w3;
+	v_out[2] = v0[2] * w0 + v1[2] * w1 + v2[2] * w2 + v3[2] * w3;
+	v_out[3] = v0[3] * w0 + v1[3] * w1 + v2[3] * w2 + v3[3] * w3;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4BezierN(a3real4p v_out, a3count order_N, const a3real4 v[], const a3real param)
+{
+	// Horner evaluation of the Bernstein form in O(N): the sum is factored 
+	//	by the larger of (1-t) and t so the running ratio stays in [0, 1] 
+	//	for interpolation; binomial coefficients are built incrementally
+	const a3real t = param, s = a3real_one - t;
+	const a3boolean fromEnd = (t <= a3real_half);
+	const a3real u = fromEnd ? a3divide(t, s) : a3divide(s, t);
+	a3real c = a3real_one, scale = a3real_one;
+	a3index i, k;
+	if (order_N == 0)
+		return a3real4SetReal4(v_out, v[0]);
+	k = fromEnd ? order_N : 0;
+	v_out[0] = v[k][0];
+	v_out[1] = v[k][1];
+	v_out[2] = v[k][2];
+	v_out[3] = v[k][3];
+	for (i = 1; i <= order_N; ++i)
+	{
+		c = c * (a3real)(order_N - i + 1) / (a3real)i;
+		k = fromEnd ? order_N - i : i;
+		v_out[0] = v_out[0] * u + v[k][0] * c;
+		v_out[1] = v_out[1] * u + v[k][1] * c;
+		v_out[2] = v_out[2] * u + v[k][2] * c;
+		v_out[3] = v_out[3] * u + v[k][3] * c;
+		scale *= fromEnd ? s : t;
+	}
+	v_out[0] *= scale;
+	v_out[1] *= scale;
+	v_out[2] *= scale;
+	v_out[3] *= scale;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4Slerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param)
+{
+	// angle from normalized dot; magnitudes blend with the same weights
+	const a3real lenProd = a3sqrt(a3real4Dot(v0, v0) * a3real4Dot(v1, v1));
+	const a3real cosAngle = a3divide(a3real4Dot(v0, v1), lenProd);
+	a3real angle, sinAngleInv, w0, w1;
+	if (cosAngle < a3real_one - a3real_epsilon && cosAngle > a3real_epsilon - a3real_one)
+	{
+		angle = a3acosr(cosAngle);
+		sinAngleInv = a3recip(a3sinr(angle));
+		w0 = a3sinr((a3real_one - param) * angle) * sinAngleInv;
+		w1 = a3sinr(param * angle) * sinAngleInv;
+		v_out[0] = v0[0] * w0 + v1[0] * w1;
+		v_out[1] = v0[1] * w0 + v1[1] * w1;
+		v_out[2] = v0[2] * w0 + v1[2] * w1;
+		v_out[3] = v0[3] * w0 + v1[3] * w1;
+		return v_out;
+	}
+	return a3real4Lerp(v_out, v0, v1, param);
+}
+
+A3DM_INLINE a3real4r a3real4SlerpUnit(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param)
+{
+	const a3real cosAngle = a3real4Dot(v0, v1);
+	a3real angle, sinAngleInv, w0, w1;
+	if (cosAngle < a3real_one - a3real_epsilon && cosAngle > a3real_epsilon - a3real_one)
+	{
+		angle = a3acosr(cosAngle);
+		sinAngleInv = a3recip(a3sinr(angle));
+		w0 = a3sinr((a3real_one - param) * angle) * sinAngleInv;
+		w1 = a3sinr(param * angle) * sinAngleInv;
+		v_out[0] = v0[0] * w0 + v1[0] * w1;
+		v_out[1] = v0[1] * w0 + v1[1] * w1;
+		v_out[2] = v0[2] * w0 + v1[2] * w1;
+		v_out[3] = v0[3] * w0 + v1[3] * w1;
+		return v_out;
+	}
+	return a3real4Lerp(v_out, v0, v1, param);
+}
+
+//-----------------------------------------------------------------------------
+// arc length
+
+A3DM_INLINE a3real a3real4InternalArcLength(const a3real4 sampleTable[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions)
+{
+	// internal: fill parameters and accumulated lengths for existing samples
+	const a3real dt = a3real_one / (a3real)numDivisions;
+	a3real total = a3real_zero, totalInv;
+	a3index i;
+	arclenTable_out[0] = a3real_zero;
+	for (i = 1; i <= numDivisions; ++i)
+		arclenTable_out[i] = total += a3real4Distance(sampleTable[i - 1], sampleTable[i]);
+	if (paramTable_out)
+		for (i = 0; i <= numDivisions; ++i)
+			paramTable_out[i] = (a3real)i * dt;
+	if (autoNormalize && total > a3real_zero)
+		for (i = 1, totalInv = a3recip(total); i <= numDivisions; ++i)
+			arclenTable_out[i] *= totalInv;
+	return total;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthCatmullRom(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p vPrev, const a3real4p v0, const a3real4p v1, const a3real4p vNext)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4CatmullRom(sampleTable_out[i], vPrev, v0, v1, vNext, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthHermiteControl(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p vControl0, const a3real4p vControl1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4HermiteControl(sampleTable_out[i], v0, v1, vControl0, vControl1, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthHermiteTangent(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p vTangent0, const a3real4p vTangent1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4HermiteTangent(sampleTable_out[i], v0, v1, vTangent0, vTangent1, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthBezier0(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4SetReal4(sampleTable_out[i], v0);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthBezier1(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4Lerp(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthBezier2(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p v2)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4Bezier2(sampleTable_out[i], v0, v1, v2, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthBezier3(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4Bezier3(sampleTable_out[i], v0, v1, v2, v3, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthBezierN(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real4 v[])
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4BezierN(sampleTable_out[i], order_N, v, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthSlerp(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4Slerp(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+A3DM_INLINE a3real a3real4CalculateArcLengthSlerpUnit(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1)
+{
+	a3index i;
+	if (sampleTable_out && arclenTable_out && numDivisions)
+	{
+		for (i = 0; i <= numDivisions; ++i)
+			a3real4SlerpUnit(sampleTable_out[i], v0, v1, (a3real)i / (a3real)numDivisions);
+		return a3real4InternalArcLength(sampleTable_out, paramTable_out, arclenTable_out, autoNormalize, numDivisions);
+	}
+	return a3real_zero;
+}
+
+//-----------------------------------------------------------------------------
+// orthogonalization
+
+A3DM_INLINE a3real4r a3real4GramSchmidtOrtho(a3real4p v_out, const a3real4p v, const a3real4p vBase)
+{
+	const a3real ratio = a3real4ProjRatio(v, vBase);
+	v_out[0] = v[0] - vBase[0] * ratio;
+	v_out[1] = v[1] - vBase[1] * ratio;
+	v_out[2] = v[2] - vBase[2] * ratio;
+	v_out[3] = v[3] - vBase[3] * ratio;
+	return v_out;
+}
+
+A3DM_INLINE a3real4r a3real4GramSchmidt(a3real4p v_inout, const a3real4p vBase)
+{
+	return a3real4GramSchmidtOrtho(v_inout, v_inout, vBase);
+}
+
+A3DM_INLINE a3real4r a3real4GramSchmidtOrtho2(a3real4p v0_out, a3real4p v1_out, const a3real4p v0, const a3real4p v1, const a3real4p vBase)
+{
+	a3real4 tmp;
+	a3real4GramSchmidtOrtho(v0_out, v0, vBase);
+	a3real4GramSchmidtOrtho(tmp, v1, vBase);
+	return a3real4GramSchmidtOrtho(v1_out, tmp, v0_out);
+}
+
+A3DM_INLINE a3real4r a3real4GramSchmidt2(a3real4p v0_inout, a3real4p v1_inout, const a3real4p vBase)
+{
+	return a3real4GramSchmidtOrtho2(v0_inout, v1_inout, v0_inout, v1_inout, vBase);
+}
+
+A3DM_INLINE a3real4r a3real4GramSchmidtOrtho3(a3real4p v0_out, a3real4p v1_out, a3real4p v2_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p vBase)
+{
+	a3real4 tmp;
+	a3real4GramSchmidtOrtho2(v0_out, v1_out, v0, v1, vBase);
+	a3real4GramSchmidtOrtho(tmp, v2, vBase);
+	a3real4GramSchmidt(tmp, v0_out);
+	return a3real4GramSchmidtOrtho(v2_out, tmp, v1_out);
+}
+
+A3DM_INLINE a3real4r a3real4GramSchmidt3(a3real4p v0_inout, a3real4p v1_inout, a3real4p v2_inout, const a3real4p vBase)
+{
+	return a3real4GramSchmidtOrtho3(v0_inout, v1_inout, v2_inout, v0_inout, v1_inout, v2_inout, vBase);
+}
+
+//-----------------------------------------------------------------------------
+
+
+A3_END_IMPL
+
+
+#endif	// !__ANIMAL3D_A3DM_VECTOR4_IMPL_INL
+#endif	// __ANIMAL3D_A3DM_VECTOR_H
\ No newline at end of file
@@ -107,21 +107,21 @@ enum a3dualquatComponent
 // A3: Create identity dual quaternion.
 //	param Q_out: dual quaternion to initialize
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSetIdentity(a3real4x2p Q_out);
+A3DM_INLINE a3real4x2r a3dualquatSetIdentity(a3real4x2p Q_out);
 
 // A3: Create dual quaternion from a pair of quaternions.
 //	param Q_out: dual quaternion to initialize
 //	param rotateScaleQuat: 'real' quaternion part to encode rotation/scale
 //	param dualPartQuat: 'dual' quaternion part to encode translation
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSet(a3real4x2p Q_out, const a3real4 rotateScaleQuat, const a3real4 dualPartQuat);
+A3DM_INLINE a3real4x2r a3dualquatSet(a3real4x2p Q_out, const a3real4 rotateScaleQuat, const a3real4 dualPartQuat);
 
 // A3: Create dual quaternion from rotation axis and angle.
 //	param Q_out: dual quaternion to initialize
 //	param unitAxis: axis of rotation, unit length (for efficiency)
 //	param degrees: validated rotation angle in degrees
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSetAxisAngle(a3real4x2p Q_out, const a3real3p unitAxis, const a3real degrees);
+A3DM_INLINE a3real4x2r a3dualquatSetAxisAngle(a3real4x2p Q_out, const a3real3p unitAxis, const a3real degrees);
 
 // A3: Create dual quaternion from rotation and translation.
 //	param Q_out: dual quaternion to initialize
@@ -129,7 +129,7 @@ A3_INLINE a3real4x2r a3dualquatSetAxisAngle(a3real4x2p Q_out, const a3real3p uni
 //	param degrees: validated rotation angle in degrees
 //	param translate: translation vector to encode in dual part
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSetAxisAngleTranslate(a3real4x2p Q_out, const a3real3p unitAxis, const a3real degrees, const a3real3p translate);
+A3DM_INLINE a3real4x2r a3dualquatSetAxisAngleTranslate(a3real4x2p Q_out, const a3real3p unitAxis, const a3real degrees, const a3real3p translate);
 
 // A3: Create dual quaternion from Euler angles.
 //	param Q_out: dual quaternion to initialize
@@ -139,7 +139,7 @@ A3_INLINE a3real4x2r a3dualquatSetAxisAngleTranslate(a3real4x2p Q_out, const a3r
 //	param eulerIsXYZ: boolean to determine rotation order: 
 //		XYZ if true, ZYX if false
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSetEuler(a3real4x2p Q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3boolean eulerIsXYZ);
+A3DM_INLINE a3real4x2r a3dualquatSetEuler(a3real4x2p Q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3boolean eulerIsXYZ);
 
 // A3: Create dual quaternion from Euler angles and translation.
 //	param Q_out: dual quaternion to initialize
@@ -150,49 +150,49 @@ A3_INLINE a3real4x2r a3dualquatSetEuler(a3real4x2p Q_out, const a3real degrees_x
 //		XYZ if true, ZYX if false
 //	param translate: translation vector to encode in dual part
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSetEulerTranslate(a3real4x2p Q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3boolean eulerIsXYZ, const a3real3p translate);
+A3DM_INLINE a3real4x2r a3dualquatSetEulerTranslate(a3real4x2p Q_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3boolean eulerIsXYZ, const a3real3p translate);
 
 // A3: Create dual quaternion from translation.
 //	param Q_out: dual quaternion to initialize
 //	param translate: translation vector to encode in dual part
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSetTranslate(a3real4x2p Q_out, const a3real3p translate);
+A3DM_INLINE a3real4x2r a3dualquatSetTranslate(a3real4x2p Q_out, const a3real3p translate);
 
 // A3: Create dual quaternion from another dual quaternion.
 //	param Q_out: dual quaternion to initialize
 //	param Q: dual quaternion from which to copy
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatCopy(a3real4x2p Q_out, const a3real4x2p Q);
+A3DM_INLINE a3real4x2r a3dualquatCopy(a3real4x2p Q_out, const a3real4x2p Q);
 
 
 // A3: Get conjugate of dual quaternion: vector parts are negated.
 //	param Q_out: output dual quaternion to store conjugate
 //	param Q: input dual quaternion whose conjugate to get
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatGetConjugated(a3real4x2p Q_out, const a3real4x2p Q);
+A3DM_INLINE a3real4x2r a3dualquatGetConjugated(a3real4x2p Q_out, const a3real4x2p Q);
 
 // A3: Get inverse of assumed unit dual quaternion; same as get conjugate.
 //	param Q_out: output dual quaternion to store inverse
 //	param Q: input dual quaternion whose inverse to get
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatGetInverseIgnoreScale(a3real4x2p Q_out, const a3real4x2p Q);
+A3DM_INLINE a3real4x2r a3dualquatGetInverseIgnoreScale(a3real4x2p Q_out, const a3real4x2p Q);
 
 // A3: Conjugate dual quaternion (negate vector parts).
 //	param Q_inout: dual quaternion to conjugate and store
 //	return: Q_inout
-A3_INLINE a3real4x2r a3dualquatConjugate(a3real4x2p Q_inout);
+A3DM_INLINE a3real4x2r a3dualquatConjugate(a3real4x2p Q_inout);
 
 // A3: Invert assumed unit dual quaternion; same as conjugate.
 //	param Q_inout: dual quaternion to invert and store
 //	return: Q_inout
-A3_INLINE a3real4x2r a3dualquatInvertIgnoreScale(a3real4x2p Q_inout);
+A3DM_INLINE a3real4x2r a3dualquatInvertIgnoreScale(a3real4x2p Q_inout);
 
 // A3: Get the axis and angle of rotation of an assumed unit dual quaternion.
 //	param Q: dual quaternion from which to get axis and angle
 //	param unitAxis_out: variable to capture unit axis
 //	param degrees_out: pointer to variable to capture rotation angle in degrees
 //	return: Q
-A3_INLINE a3real4x2rk a3dualquatGetAxisAngleIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real *degrees_out);
+A3DM_INLINE a3real4x2rk a3dualquatGetAxisAngleIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real *degrees_out);
 
 // A3: Get rotation axis/angle, translate of an assumed unit dual quaternion.
 //	param Q: dual quaternion from which to get axis and angle
@@ -200,59 +200,59 @@ A3_INLINE a3real4x2rk a3dualquatGetAxisAngleIgnoreScale(const a3real4x2p Q, a3re
 //	param degrees_out: pointer to variable to capture rotation angle in degrees
 //	param translate_out: vector to capture translation vector
 //	return: Q
-A3_INLINE a3real4x2rk a3dualquatGetAxisAngleTranslateIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real *degrees_out, a3real3p translate_out);
+A3DM_INLINE a3real4x2rk a3dualquatGetAxisAngleTranslateIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real *degrees_out, a3real3p translate_out);
 
 
 // A3: Get the squared length (magnitude) of a dual quaternion.
 //	param Q: dual quaternion whose squared length to get
 //	return: squared length of dual quaternion: |Q|^2
-A3_INLINE a3real a3dualquatLengthSquared(const a3real4x2p Q);
+A3DM_INLINE a3real a3dualquatLengthSquared(const a3real4x2p Q);
 
 // A3: Get the inverse (reciprocal) squared length of a dual quaternion.
 //	param Q: dual quaternion whose inverse squared length to get
 //	return: inverse squared length of dual quaternion: 1 / |Q|^2
-A3_INLINE a3real a3dualquatLengthSquaredInverse(const a3real4x2p Q);
+A3DM_INLINE a3real a3dualquatLengthSquaredInverse(const a3real4x2p Q);
 
 // A3: Get the length (magnitude) of a dual quaternion.
 //	param Q: dual quaternion whose length to get
 //	return: length of dual quaternion: |Q|
-A3_INLINE a3real a3dualquatLength(const a3real4x2p Q);
+A3DM_INLINE a3real a3dualquatLength(const a3real4x2p Q);
 
 // A3: Get the inverse (reciprocal) length of a dual quaternion.
 //	param Q: dual quaternion whose inverse length to get
 //	return: inverse length of dual quaternion: 1 / |Q|
-A3_INLINE a3real a3dualquatLengthInverse(const a3real4x2p Q);
+A3DM_INLINE a3real a3dualquatLengthInverse(const a3real4x2p Q);
 
 // A3: Get unit dual quaternion, representing encoded rotation and translation.
 //	param Q_out: output dual quaternion to store unit of input: Q / |Q|
 //	param Q: input dual quaternion
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatGetUnit(a3real4x2p Q_out, const a3real4x2p Q);
+A3DM_INLINE a3real4x2r a3dualquatGetUnit(a3real4x2p Q_out, const a3real4x2p Q);
 
 // A3: Get unit dual quaternion and inverse length.
 //	param Q_out: output dual quaternion to store unit of input: Q / |Q|
 //	param Q: input dual quaternion
 //	param invLength_out: pointer to variable capturing inverse length: 1 / |Q|
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatGetUnitInvLength(a3real4x2p Q_out, const a3real4x2p Q, a3real *invLength_out);
+A3DM_INLINE a3real4x2r a3dualquatGetUnitInvLength(a3real4x2p Q_out, const a3real4x2p Q, a3real *invLength_out);
 
 // A3: Normalize dual quaternion, making it unit length.
 //	param Q_inout: output dual quaternion to store unit of input: Q /= |Q|
 //	return: Q_inout
-A3_INLINE a3real4x2r a3dualquatNormalize(a3real4x2p Q_inout);
+A3DM_INLINE a3real4x2r a3dualquatNormalize(a3real4x2p Q_inout);
 
 // A3: Normalize dual quaternion and get inverse length.
 //	param Q_inout: output dual quaternion to store unit of input: Q /= |Q|
 //	param invLength_out: pointer to variable capturing inverse length: 1 / |Q|
 //	return: Q_inout
-A3_INLINE a3real4x2r a3dualquatNormalizeGetInvLength(a3real4x2p Q_inout, a3real *invLength_out);
+A3DM_INLINE a3real4x2r a3dualquatNormalizeGetInvLength(a3real4x2p Q_inout, a3real *invLength_out);
 
 
 // A3: Convert dual quaternion to 4D transformation matrix.
 //	param m_out: output matrix representing rotation and translation
 //	param Q: input dual quaternion to convert
 //	return: m_out
-A3_INLINE a3real4x4r a3dualquatConvertToMat4IgnoreScale(a3real4x4p m_out, const a3real4x2 Q);
+A3DM_INLINE a3real4x4r a3dualquatConvertToMat4IgnoreScale(a3real4x4p m_out, const a3real4x2 Q);
 
 
 // A3: Calculate sum of dual quaternions.
@@ -260,52 +260,52 @@ A3_INLINE a3real4x4r a3dualquatConvertToMat4IgnoreScale(a3real4x4p m_out, const
 //	param QL: input left side dual quaternion
 //	param QR: input right side dual quaternion
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSum(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2p QR);
+A3DM_INLINE a3real4x2r a3dualquatSum(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2p QR);
 
 // A3: Calculate difference of dual quaternions.
 //	param Q_out: output dual quaternion to store difference of two inputs
 //	param QL: input left side dual quaternion
 //	param QR: input right side dual quaternion
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatDiff(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2p QR);
+A3DM_INLINE a3real4x2r a3dualquatDiff(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2p QR);
 
 // A3: Calculate product of dual quaternion and scalar.
 //	param Q_out: output dual quaternion to store scaled dual quaternion
 //	param Q: input vector to be scaled
 //	param s: scalar by which to multiply dual quaternion
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatProductS(a3real4x2p Q_out, const a3real4x2p Q, const a3real s);
+A3DM_INLINE a3real4x2r a3dualquatProductS(a3real4x2p Q_out, const a3real4x2p Q, const a3real s);
 
 // A3: Calculate quotient of dual quaternion and scalar.
 //	param Q_out: output dual quaternion to store scaled dual quaternion
 //	param Q: input vector to be scaled, numerator
 //	param s: scalar by which to divide dual quaternion, denominator
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatQuotientS(a3real4x2p Q_out, const a3real4x2p Q, const a3real s);
+A3DM_INLINE a3real4x2r a3dualquatQuotientS(a3real4x2p Q_out, const a3real4x2p Q, const a3real s);
 
 // A3: Add dual quaternions and store to left operand.
 //	param QL_inout: left side dual quaternion to which to add
 //	param QR: input right side dual quaternion
 //	return: QL_inout
-A3_INLINE a3real4x2r a3dualquatAdd(a3real4x2p QL_inout, const a3real4x2p QR);
+A3DM_INLINE a3real4x2r a3dualquatAdd(a3real4x2p QL_inout, const a3real4x2p QR);
 
 // A3: Subtract dual quaternions and store to left operand.
 //	param QL_inout: left side dual quaternion from which to subtract
 //	param QR: input right side dual quaternion
 //	return: QL_inout
-A3_INLINE a3real4x2r a3dualquatSub(a3real4x2p QL_inout, const a3real4x2p QR);
+A3DM_INLINE a3real4x2r a3dualquatSub(a3real4x2p QL_inout, const a3real4x2p QR);
 
 // A3: Multiply dual quaternion by scalar.
 //	param Q_inout: dual quaternion to scale
 //	param s: scalar by which to multiply dual quaternion
 //	return: Q_inout
-A3_INLINE a3real4x2r a3dualquatMulS(a3real4x2p Q_inout, const a3real s);
+A3DM_INLINE a3real4x2r a3dualquatMulS(a3real4x2p Q_inout, const a3real s);
 
 // A3: Divide dual quaternion by scalar.
 //	param Q_inout: dual quaternion to scale, numerator
 //	param s: scalar by which to divide dual quaternion, denominator
 //	return: Q_inout
-A3_INLINE a3real4x2r a3dualquatDivS(a3real4x2p Q_inout, const a3real s);
+A3DM_INLINE a3real4x2r a3dualquatDivS(a3real4x2p Q_inout, const a3real s);
 
 
 // A3: Calculate dual quaternion product.
@@ -313,32 +313,32 @@ A3_INLINE a3real4x2r a3dualquatDivS(a3real4x2p Q_inout, const a3real s);
 //	param QL: input left dual quaternion
 //	param QR: input right dual quaternion
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatProduct(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2 QR);
+A3DM_INLINE a3real4x2r a3dualquatProduct(a3real4x2p Q_out, const a3real4x2p QL, const a3real4x2 QR);
 
 // A3: Concatenate (multiply) dual quaternions and store in left input.
 //	param QL_inout: left input dual quaternion to store product
 //	param QR: input right dual quaternion
 //	return: QL_inout
-A3_INLINE a3real4x2r a3dualquatConcatL(a3real4x2p QL_inout, const a3real4x2 QR);
+A3DM_INLINE a3real4x2r a3dualquatConcatL(a3real4x2p QL_inout, const a3real4x2 QR);
 
 // A3: Concatenate (multiply) dual quaternions and store in right input.
 //	param QL: input left dual quaternion
 //	param QR_inout: right input dual quaternion to store product
 //	return: QR_inout
-A3_INLINE a3real4x2r a3dualquatConcatR(const a3real4x2p QL, a3real4x2 QR_inout);
+A3DM_INLINE a3real4x2r a3dualquatConcatR(const a3real4x2p QL, a3real4x2 QR_inout);
 
 // A3: Calculate vector transformed by assumed unit dual quaternion.
 //	param v_out: output rotated vector
 //	param v: input vector to transform by dual quaternion
 //	param Q: dual quaternion to transform vector
 //	return: v_out
-A3_INLINE a3real3r a3dualquatVec3GetTransformedIgnoreScale(a3real3p v_out, const a3real3p v, const a3real4x2p Q);
+A3DM_INLINE a3real3r a3dualquatVec3GetTransformedIgnoreScale(a3real3p v_out, const a3real3p v, const a3real4x2p Q);
 
 // A3: Transform vector by assumed unit quaternion.
 //	param v_inout: vector to rotate and store
 //	param Q: dual quaternion to transform vector
 //	return: v_inout
-A3_INLINE a3real3r a3dualquatVec3TransformIgnoreScale(a3real3p v_inout, const a3real4x2p Q);
+A3DM_INLINE a3real3r a3dualquatVec3TransformIgnoreScale(a3real3p v_inout, const a3real4x2p Q);
 
 
 // A3: Screw linear interpolation ("ScLERP") for assumed unit dual quaternions.
@@ -349,7 +349,7 @@ A3_INLINE a3real3r a3dualquatVec3TransformIgnoreScale(a3real3p v_inout, const a3
 //	param param: interpolation parameter (t); 
 //		result is Q0 when t=0 and Q1 when t=1
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSclerpUnit(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1, const a3real param);
+A3DM_INLINE a3real4x2r a3dualquatSclerpUnit(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1, const a3real param);
 
 // A3: Screw linear interpolation ("ScLERP") from identity to input.
 //	param Q_out: output dual quaternion to store interpolation result
@@ -357,7 +357,7 @@ A3_INLINE a3real4x2r a3dualquatSclerpUnit(a3real4x2p Q_out, const a3real4x2p Q0,
 //	param param: interpolation parameter (t); 
 //		result is identity when t=0 and Q1 when t=1
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSclerpUnitIdentityQ0(a3real4x2p Q_out, const a3real4x2p Q1, const a3real param);
+A3DM_INLINE a3real4x2r a3dualquatSclerpUnitIdentityQ0(a3real4x2p Q_out, const a3real4x2p Q1, const a3real param);
 
 // A3: Screw linear interpolation ("ScLERP") from input to identity.
 //	param Q_out: output dual quaternion to store interpolation result
@@ -365,7 +365,7 @@ A3_INLINE a3real4x2r a3dualquatSclerpUnitIdentityQ0(a3real4x2p Q_out, const a3re
 //	param param: interpolation parameter (t); 
 //		result is Q0 when t=0 and identity when t=1
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatSclerpUnitIdentityQ1(a3real4x2p Q_out, const a3real4x2p Q0, const a3real param);
+A3DM_INLINE a3real4x2r a3dualquatSclerpUnitIdentityQ1(a3real4x2p Q_out, const a3real4x2p Q0, const a3real param);
 
 // A3: Dual linear blend ("DLB") for dual quaternions with two inputs.
 //		Similar to NLERP for dual quaternions, just a normalized sum.
@@ -373,7 +373,7 @@ A3_INLINE a3real4x2r a3dualquatSclerpUnitIdentityQ1(a3real4x2p Q_out, const a3re
 //	param Q0: first input
 //	param Q1: second input
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatDLB2(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1);
+A3DM_INLINE a3real4x2r a3dualquatDLB2(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1);
 
 // A3: Dual linear blend ("DLB") for dual quaternions with four inputs.
 //		Similar to NLERP for dual quaternions, just a normalized sum.
@@ -383,7 +383,7 @@ A3_INLINE a3real4x2r a3dualquatDLB2(a3real4x2p Q_out, const a3real4x2p Q0, const
 //	param Q2: third input
 //	param Q3: fourth input
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatDLB4(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1, const a3real4x2p Q2, const a3real4x2p Q3);
+A3DM_INLINE a3real4x2r a3dualquatDLB4(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1, const a3real4x2p Q2, const a3real4x2p Q3);
 
 // A3: Dual linear blend ("DLB") for dual quaternions with array of inputs.
 //		Similar to NLERP for dual quaternions, just a normalized sum.
@@ -391,7 +391,17 @@ A3_INLINE a3real4x2r a3dualquatDLB4(a3real4x2p Q_out, const a3real4x2p Q0, const
 //	param Q: array of inputs
 //	param count: number of inputs
 //	return: Q_out
-A3_INLINE a3real4x2r a3dualquatDLB(a3real4x2p Q_out, const a3real4x2 Q[], const a3count count);
+A3DM_INLINE a3real4x2r a3dualquatDLB(a3real4x2p Q_out, const a3real4x2 Q[], const a3count count);
+
+// A3: Weighted dual linear blend ("DLB") of two assumed unit dual 
+//		quaternions: normalized (1 - t) Q0 + t Q1, with Q1 negated when its 
+//		real part opposes Q0's so the blend takes the short way around.
+//	param Q_out: output dual quaternion to store blend result
+//	param Q0: first input, result when t=0
+//	param Q1: second input, result when t=1
+//	param param: blend parameter (t)
+//	return: Q_out
+A3DM_INLINE a3real4x2r a3dualquatDLBParam(a3real4x2p Q_out, const a3real4x2p Q0, const a3real4x2p Q1, const a3real param);
 
 
 // A3: Encode translation vector into dual part of dual quaternion.
@@ -399,14 +409,14 @@ A3_INLINE a3real4x2r a3dualquatDLB(a3real4x2p Q_out, const a3real4x2 Q[], const
 //	param r: real part quaternion
 //	param translate: translation vector to encode to dual part
 //	return: d_out
-A3_INLINE a3real4r a3dualquatCalculateDualPart(a3real4p d_out, const a3real4p r, const a3real3p translate);
+A3DM_INLINE a3real4r a3dualquatCalculateDualPart(a3real4p d_out, const a3real4p r, const a3real3p translate);
 
 // A3: Decode dual part of dual quaternion to extract translation vector.
 //	param translate_out: output translation vector encoded in dual part
 //	param r: real part quaternion
 //	param d: dual part quaternion
 //	return: translate_out
-A3_INLINE a3real3r a3dualquatCalculateTranslateIgnoreScale(a3real3p translate_out, const a3real4p r, const a3real4p d);
+A3DM_INLINE a3real3r a3dualquatCalculateTranslateIgnoreScale(a3real3p translate_out, const a3real4p r, const a3real4p d);
 
 
 // A3: Get kinematic screw parameters from dual quaternion.
@@ -417,7 +427,38 @@ A3_INLINE a3real3r a3dualquatCalculateTranslateIgnoreScale(a3real3p translate_ou
 //	param degrees_out: pointer to variable to capture rotation angle in degrees
 //	param distance_out: pointer to variable to capture translation distance
 //	return: Q
-A3_INLINE a3real4x2rk a3dualquatCalculateScrewParamsIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real3p moment_out, a3real3p translate_out, a3real *degrees_out, a3real *distance_out);
+A3DM_INLINE a3real4x2rk a3dualquatCalculateScrewParamsIgnoreScale(const a3real4x2p Q, a3real3p unitAxis_out, a3real3p moment_out, a3real3p translate_out, a3real *degrees_out, a3real *distance_out);
+
+
+//-----------------------------------------------------------------------------
+// A3: Array (stream) utilities; blend whole pose buffers per call, e.g. one 
+//		transform per joint. With intrinsics, groups of 4 dual quaternions (8 
+//		with AVX) are transposed so each register holds one component of 
+//		every dual quaternion in the group, with the remainder handled one at 
+//		a time by a3dualquatDLBParam, which the lane path matches to within 
+//		3e-7 per component. Outputs may alias inputs.
+//		Built from source only (A3_OPEN_SOURCE); the prebuilt library 
+//		does not have them.
+#ifdef A3_OPEN_SOURCE
+
+// A3: Weighted DLB over arrays with one parameter for all pairs.
+//	param Q_out: output array of blended dual quaternions
+//	param Q0: input array of first dual quaternions
+//	param Q1: input array of second dual quaternions
+//	param param: blend parameter (t) used for all pairs
+//	param count: number of dual quaternions in each array
+//	return: Q_out
+A3DM_INLINE a3real4x2r a3dualquatDLBArray(a3real4x2 Q_out[], const a3real4x2 Q0[], const a3real4x2 Q1[], const a3real param, const a3count count);
+
+// A3: Weighted DLB over arrays with one parameter per pair.
+//	param Q_out: output array of blended dual quaternions
+//	param Q0: input array of first dual quaternions
+//	param Q1: input array of second dual quaternions
+//	param param: input array of blend parameters, one per pair
+//	param count: number of dual quaternions in each array
+//	return: Q_out
+A3DM_INLINE a3real4x2r a3dualquatDLBArrayParams(a3real4x2 Q_out[], const a3real4x2 Q0[], const a3real4x2 Q1[], const a3real param[], const a3count count);
+#endif	// A3_OPEN_SOURCE
 
 
 //-----------------------------------------------------------------------------
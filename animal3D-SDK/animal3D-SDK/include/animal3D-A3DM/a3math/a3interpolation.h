@@ -46,7 +46,7 @@ A3_BEGIN_DECL
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: linearly interpolated value from n0 to n1 at t (param)
-A3_INLINE a3real a3lerpFunc(const a3real n0, const a3real n1, const a3real param);
+A3DM_INLINE a3real a3lerpFunc(const a3real n0, const a3real n1, const a3real param);
 
 // A3: Inverse linear interpolation: given a known value 'value' and reference 
 //		values 'n0' and 'n1' (same as above), compute the 't' parameter that 
@@ -55,14 +55,14 @@ A3_INLINE a3real a3lerpFunc(const a3real n0, const a3real n1, const a3real param
 //	param n1: goal/end value, result when t=1
 //	param value: desired result of linear interpolation (lerp at t)
 //	return: interpolation parameter (t) that would yield input value
-A3_INLINE a3real a3lerpInverse(const a3real n0, const a3real n1, const a3real value);
+A3DM_INLINE a3real a3lerpInverse(const a3real n0, const a3real n1, const a3real value);
 
 // A3: Safe inverse linear interpolation; ensures input values are different.
 //	param n0: initial value
 //	param n1: goal/end value (not equal to n0)
 //	param value: desired result of linear interpolation
 //	return: interpolation parameter that would yield input value
-A3_INLINE a3real a3lerpSafeInverse(const a3real n0, const a3real n1, const a3real value);
+A3DM_INLINE a3real a3lerpSafeInverse(const a3real n0, const a3real n1, const a3real value);
 
 // A3: Remap value: calculate value contained in one range to another range.
 //	param n0_new: initial value of new range
@@ -71,7 +71,7 @@ A3_INLINE a3real a3lerpSafeInverse(const a3real n0, const a3real n1, const a3rea
 //	param n1: goal/end value of original range
 //	param value: input to be remapped from original to new range
 //	return: input value relative to new range
-A3_INLINE a3real a3remapFunc(const a3real n0_new, const a3real n1_new, const a3real n0, const a3real n1, const a3real value);
+A3DM_INLINE a3real a3remapFunc(const a3real n0_new, const a3real n1_new, const a3real n0, const a3real n1, const a3real value);
 
 // A3: Safe remap value; ensures input values are different.
 //	param n0_new: initial value of new range
@@ -80,7 +80,7 @@ A3_INLINE a3real a3remapFunc(const a3real n0_new, const a3real n1_new, const a3r
 //	param n1: goal/end value of original range (not equal to n0)
 //	param value: input to be remapped from original to new range
 //	return: input value relative to new range
-A3_INLINE a3real a3remapSafe(const a3real n0_new, const a3real n1_new, const a3real n0, const a3real n1, const a3real value);
+A3DM_INLINE a3real a3remapSafe(const a3real n0_new, const a3real n1_new, const a3real n0, const a3real n1, const a3real value);
 
 
 // A3: Bi-linear interpolation: calculate lerp between each range of numbers, 
@@ -92,7 +92,7 @@ A3_INLINE a3real a3remapSafe(const a3real n0_new, const a3real n1_new, const a3r
 //	param param0: parameter for interpolation within ranges (lerp)
 //	param param1: parameter for blending results of lerp (bi-lerp)
 //	return: interpolation between the results of interpolation within ranges
-A3_INLINE a3real a3bilerp(const a3real n00, const a3real n01, const a3real n10, const a3real n11, const a3real param0, const a3real param1);
+A3DM_INLINE a3real a3bilerp(const a3real n00, const a3real n01, const a3real n10, const a3real n11, const a3real param0, const a3real param1);
 
 // A3: Tri-linear interpolation: calculate bi-lerp between each set of ranges, 
 //		then lerp between the results.
@@ -108,7 +108,7 @@ A3_INLINE a3real a3bilerp(const a3real n00, const a3real n01, const a3real n10,
 //	param param1: parameter for blending in sets 000-011 and 100-111 (bi-lerp)
 //	param param2: parameter for blending results of bi-lerp (tri-lerp)
 //	return: interpolation between results of bi-lerp within sets
-A3_INLINE a3real a3trilerp(const a3real n000, const a3real n001, const a3real n010, const a3real n011, const a3real n100, const a3real n101, const a3real n110, const a3real n111, const a3real param0, const a3real param1, const a3real param2);
+A3DM_INLINE a3real a3trilerp(const a3real n000, const a3real n001, const a3real n010, const a3real n011, const a3real n100, const a3real n101, const a3real n110, const a3real n111, const a3real param0, const a3real param1, const a3real param2);
 
 
 // A3: Catmull-Rom spline interpolation.
@@ -119,7 +119,7 @@ A3_INLINE a3real a3trilerp(const a3real n000, const a3real n001, const a3real n0
 //	param param: interpolation parameter (t)
 //		result at t=0 is n0, result at t=1 is n1
 //	return: Catmull-Rom spline interpolation
-A3_INLINE a3real a3CatmullRom(const a3real nPrev, const a3real n0, const a3real n1, const a3real nNext, const a3real param);
+A3DM_INLINE a3real a3CatmullRom(const a3real nPrev, const a3real n0, const a3real n1, const a3real nNext, const a3real param);
 
 
 // A3: Cubic Hermite spline (c-spline) interpolation using control handles.
@@ -130,7 +130,7 @@ A3_INLINE a3real a3CatmullRom(const a3real nPrev, const a3real n0, const a3real
 //	param param: interpolation parameter (t)
 //		result at t=0 is n0, result at t=1 is n1
 //	return: c-spline interpolation
-A3_INLINE a3real a3HermiteControl(const a3real n0, const a3real n1, const a3real nControl0, const a3real nControl1, const a3real param);
+A3DM_INLINE a3real a3HermiteControl(const a3real n0, const a3real n1, const a3real nControl0, const a3real nControl1, const a3real param);
 
 // A3: Cubic Hermite spline (c-spline) interpolation using control tangents.
 //	param n0: initial control value of curve segment
@@ -140,14 +140,14 @@ A3_INLINE a3real a3HermiteControl(const a3real n0, const a3real n1, const a3real
 //	param param: interpolation parameter (t)
 //		result at t=0 is n0, result at t=1 is n1
 //	return: c-spline interpolation
-A3_INLINE a3real a3HermiteTangent(const a3real n0, const a3real n1, const a3real nTangent0, const a3real nTangent1, const a3real param);
+A3DM_INLINE a3real a3HermiteTangent(const a3real n0, const a3real n1, const a3real nTangent0, const a3real nTangent1, const a3real param);
 
 
 // A3: Bezier interpolation of order/degree zero (constant).
 //	param n0: first control value
 //	param param: interpolation parameter (t), not used
 //	return: n0 (constant)
-A3_INLINE a3real a3Bezier0(const a3real n0, const a3real param);
+A3DM_INLINE a3real a3Bezier0(const a3real n0, const a3real param);
 
 // A3: Bezier interpolation of first order/degree (linear).
 //	param n0: first control value
@@ -155,7 +155,7 @@ A3_INLINE a3real a3Bezier0(const a3real n0, const a3real param);
 //	param param: interpolation parameter (t), used for lerp; 
 //		result at t=0 is n0, result at t=1 is n1
 //	return: lerp(n0, n1, t)
-A3_INLINE a3real a3Bezier1(const a3real n0, const a3real n1, const a3real param);
+A3DM_INLINE a3real a3Bezier1(const a3real n0, const a3real n1, const a3real param);
 
 // A3: Bezier interpolation of second order/degree (quadratic).
 //	param n0: first control value
@@ -164,7 +164,7 @@ A3_INLINE a3real a3Bezier1(const a3real n0, const a3real n1, const a3real param)
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is n0, result at t=1 is n2
 //	return: lerp(Bezier1(n0, n1, t), Bezier1(n1, n2, t), t)
-A3_INLINE a3real a3Bezier2(const a3real n0, const a3real n1, const a3real n2, const a3real param);
+A3DM_INLINE a3real a3Bezier2(const a3real n0, const a3real n1, const a3real n2, const a3real param);
 
 // A3: Bezier interpolation of third order/degree (cubic).
 //	param n0: first control value
@@ -174,7 +174,7 @@ A3_INLINE a3real a3Bezier2(const a3real n0, const a3real n1, const a3real n2, co
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is n0, result at t=1 is n3
 //	return: lerp(Bezier2(n0, n1, n2, t), Bezier2(n1, n2, n3, t), t)
-A3_INLINE a3real a3Bezier3(const a3real n0, const a3real n1, const a3real n2, const a3real n3, const a3real param);
+A3DM_INLINE a3real a3Bezier3(const a3real n0, const a3real n1, const a3real n2, const a3real n3, const a3real param);
 
 // A3: Recursive Bezier interpolation of higher order (quartic, etc.).
 //	param order_N: order/degree of function (4 for quartic, etc.)
@@ -182,7 +182,7 @@ A3_INLINE a3real a3Bezier3(const a3real n0, const a3real n1, const a3real n2, co
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is n[0], result at t=1 is n[order_N]
 //	return: recursive lerp through each order/degree of Bezier until zero
-A3_INLINE a3real a3BezierN(a3count order_N, const a3real n[], const a3real param);
+A3DM_INLINE a3real a3BezierN(a3count order_N, const a3real n[], const a3real param);
 
 
 //-----------------------------------------------------------------------------
@@ -206,7 +206,7 @@ A3_INLINE a3real a3BezierN(a3count order_N, const a3real n[], const a3real param
 //	param n1: goal/end control value of curve segment
 //	param nNext: next control value (after n1)
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3calculateArcLengthCatmullRom(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real nPrev, const a3real n0, const a3real n1, const a3real nNext);
+A3DM_INLINE a3real a3calculateArcLengthCatmullRom(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real nPrev, const a3real n0, const a3real n1, const a3real nNext);
 
 // A3: Calculate arc length of a cubic Hermite curve segment with handles.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -221,7 +221,7 @@ A3_INLINE a3real a3calculateArcLengthCatmullRom(a3real sampleTable_out[], a3real
 //	param nControl0: control handle corresponding to n0
 //	param nControl1: control handle corresponding to n1
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3calculateArcLengthHermiteControl(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real nControl0, const a3real nControl1);
+A3DM_INLINE a3real a3calculateArcLengthHermiteControl(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real nControl0, const a3real nControl1);
 
 // A3: Calculate arc length of a cubic Hermite curve segment with tangents.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -236,7 +236,7 @@ A3_INLINE a3real a3calculateArcLengthHermiteControl(a3real sampleTable_out[], a3
 //	param nControl0: control tangent corresponding to n0
 //	param nControl1: control tangent corresponding to n1
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3calculateArcLengthHermiteTangent(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real nTangent0, const a3real nTangent1);
+A3DM_INLINE a3real a3calculateArcLengthHermiteTangent(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real nTangent0, const a3real nTangent1);
 
 // A3: Calculate arc length of order zero Bezier curve (constant); this is 
 //		an odd one to make an appearance because it always returns zero, but 
@@ -251,7 +251,7 @@ A3_INLINE a3real a3calculateArcLengthHermiteTangent(a3real sampleTable_out[], a3
 //	param n0: first control value
 //	param param: interpolation parameter (t), not used
 //	return: zero
-A3_INLINE a3real a3calculateArcLengthBezier0(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0);
+A3DM_INLINE a3real a3calculateArcLengthBezier0(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0);
 
 // A3: Calculate arc length of first order Bezier curve (linear).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -264,7 +264,7 @@ A3_INLINE a3real a3calculateArcLengthBezier0(a3real sampleTable_out[], a3real pa
 //	param n0: first control value
 //	param n1: second control value
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3calculateArcLengthBezier1(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1);
+A3DM_INLINE a3real a3calculateArcLengthBezier1(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1);
 
 // A3: Calculate arc length of second order Bezier curve (quadratic).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -278,7 +278,7 @@ A3_INLINE a3real a3calculateArcLengthBezier1(a3real sampleTable_out[], a3real pa
 //	param n1: second control value
 //	param n2: third control value
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3calculateArcLengthBezier2(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real n2);
+A3DM_INLINE a3real a3calculateArcLengthBezier2(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real n2);
 
 // A3: Calculate arc length of third order Bezier curve (cubic).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -293,7 +293,7 @@ A3_INLINE a3real a3calculateArcLengthBezier2(a3real sampleTable_out[], a3real pa
 //	param n2: third control value
 //	param n3: fourth control value
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3calculateArcLengthBezier3(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real n2, const a3real n3);
+A3DM_INLINE a3real a3calculateArcLengthBezier3(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real n0, const a3real n1, const a3real n2, const a3real n3);
 
 // A3: Calculate arc length of higher-order Bezier curve (quartic, etc.).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -306,7 +306,7 @@ A3_INLINE a3real a3calculateArcLengthBezier3(a3real sampleTable_out[], a3real pa
 //	param order_N: order/degree of function (4 for quartic, etc.)
 //	param n: array of control values
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3calculateArcLengthBezierN(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real n[]);
+A3DM_INLINE a3real a3calculateArcLengthBezierN(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real n[]);
 
 
 //-----------------------------------------------------------------------------
@@ -329,7 +329,7 @@ A3_INLINE a3real a3calculateArcLengthBezierN(a3real sampleTable_out[], a3real pa
 //		search for or approximate in paramTable
 //	param i: starting search index; zero if starting from beginning of tables
 //	return: approximated value interpolated at t in table
-A3_INLINE a3real a3sampleTableLerpIncrement(const a3real valueTable[], const a3real paramTable[], const a3real param, a3index i);
+A3DM_INLINE a3real a3sampleTableLerpIncrement(const a3real valueTable[], const a3real paramTable[], const a3real param, a3index i);
 
 // A3: Find index of parameter in table and approximate value by interpolating 
 //		surrounding samples in table; assumes that parameter values decrease 
@@ -343,7 +343,7 @@ A3_INLINE a3real a3sampleTableLerpIncrement(const a3real valueTable[], const a3r
 //		search for or approximate in paramTable
 //	param i: starting search index; zero if starting from beginning of tables
 //	return: approximated value interpolated at t in table
-A3_INLINE a3real a3sampleTableLerpDecrement(const a3real valueTable[], const a3real paramTable[], const a3real param, a3index i);
+A3DM_INLINE a3real a3sampleTableLerpDecrement(const a3real valueTable[], const a3real paramTable[], const a3real param, a3index i);
 
 // A3: Find index of parameter in table and approximate value by interpolating 
 //		surrounding samples in table; assumes that parameter values increase 
@@ -359,7 +359,7 @@ A3_INLINE a3real a3sampleTableLerpDecrement(const a3real valueTable[], const a3r
 //	param step: number of elements to increment by each iteration
 //	param i: starting search index; zero if starting from beginning of tables
 //	return: approximated value interpolated at t in table
-A3_INLINE a3real a3sampleTableLerpIncrementStep(const a3real valueTable[], const a3real paramTable[], const a3real param, const a3count step, a3index i);
+A3DM_INLINE a3real a3sampleTableLerpIncrementStep(const a3real valueTable[], const a3real paramTable[], const a3real param, const a3count step, a3index i);
 
 // A3: Find index of parameter in table and approximate value by interpolating 
 //		surrounding samples in table; assumes that parameter values decrease 
@@ -375,7 +375,7 @@ A3_INLINE a3real a3sampleTableLerpIncrementStep(const a3real valueTable[], const
 //	param step: number of elements to increment by each iteration
 //	param i: starting search index; zero if starting from beginning of tables
 //	return: approximated value interpolated at t in table
-A3_INLINE a3real a3sampleTableLerpDecrementStep(const a3real valueTable[], const a3real paramTable[], const a3real param, const a3count step, a3index i);
+A3DM_INLINE a3real a3sampleTableLerpDecrementStep(const a3real valueTable[], const a3real paramTable[], const a3real param, const a3count step, a3index i);
 
 
 // A3: Search for reference parameter in table, stop and get index when found; 
@@ -389,7 +389,7 @@ A3_INLINE a3real a3sampleTableLerpDecrementStep(const a3real valueTable[], const
 //	param i: starting search index; zero if starting from beginning of tables
 //	param param_out: optional pointer to value to capture interpolation param
 //	return: index of goal/end value index in table
-A3_INLINE a3index a3sampleTableLerpIncrementIndex(const a3real paramTable[], const a3real param, a3index i, a3real *param_out);
+A3DM_INLINE a3index a3sampleTableLerpIncrementIndex(const a3real paramTable[], const a3real param, a3index i, a3real *param_out);
 
 // A3: Search for reference parameter in table, stop and get index when found; 
 //		parameter decreases as index increases, does not interpolate; index 
@@ -402,7 +402,7 @@ A3_INLINE a3index a3sampleTableLerpIncrementIndex(const a3real paramTable[], con
 //	param i: starting search index; zero if starting from beginning of tables
 //	param param_out: optional pointer to value to capture interpolation param
 //	return: index of goal/end value index in table
-A3_INLINE a3index a3sampleTableLerpDecrementIndex(const a3real paramTable[], const a3real param, a3index i, a3real *param_out);
+A3DM_INLINE a3index a3sampleTableLerpDecrementIndex(const a3real paramTable[], const a3real param, a3index i, a3real *param_out);
 
 // A3: Search for reference parameter in table, stop and get index when found; 
 //		parameter increases as index increases, does not interpolate; index 
@@ -416,7 +416,7 @@ A3_INLINE a3index a3sampleTableLerpDecrementIndex(const a3real paramTable[], con
 //	param i: starting search index; zero if starting from beginning of tables
 //	param param_out: optional pointer to value to capture interpolation param
 //	return: index of goal/end value index in table
-A3_INLINE a3index a3sampleTableLerpIncrementStepIndex(const a3real paramTable[], const a3real param, const a3count step, a3index i, a3real *param_out);
+A3DM_INLINE a3index a3sampleTableLerpIncrementStepIndex(const a3real paramTable[], const a3real param, const a3count step, a3index i, a3real *param_out);
 
 // A3: Search for reference parameter in table, stop and get index when found; 
 //		parameter decreases as index increases, does not interpolate; index 
@@ -430,7 +430,7 @@ A3_INLINE a3index a3sampleTableLerpIncrementStepIndex(const a3real paramTable[],
 //	param i: starting search index; zero if starting from beginning of tables
 //	param param_out: optional pointer to value to capture interpolation param
 //	return: index of goal/end value index in table
-A3_INLINE a3index a3sampleTableLerpDecrementStepIndex(const a3real paramTable[], const a3real param, const a3count step, a3index i, a3real *param_out);
+A3DM_INLINE a3index a3sampleTableLerpDecrementStepIndex(const a3real paramTable[], const a3real param, const a3count step, a3index i, a3real *param_out);
 
 
 // A3: Generate a sample table by sampling a user function returning a real 
@@ -443,7 +443,7 @@ A3_INLINE a3index a3sampleTableLerpDecrementStepIndex(const a3real paramTable[],
 //	param paramMax: maximum parameter to user function (may not be [0, 1])
 //	param func: pointer to user function returning real and taking one real arg
 //	return: total number of samples (numDivisions*numSubdivisions + 1)
-A3_INLINE a3index a3sampleTableGenerate(a3real sampleTable_out[], a3real paramTable_out[], const a3count numDivisions, const a3count numSubdivisions, const a3real paramMin, const a3real paramMax, const a3realfunc func);
+A3DM_INLINE a3index a3sampleTableGenerate(a3real sampleTable_out[], a3real paramTable_out[], const a3count numDivisions, const a3count numSubdivisions, const a3real paramMin, const a3real paramMax, const a3realfunc func);
 
 // A3: Generate a sample table by sampling a user function returning a real 
 //		and taking one real argument; also stores arc length at each sample.
@@ -456,13 +456,13 @@ A3_INLINE a3index a3sampleTableGenerate(a3real sampleTable_out[], a3real paramTa
 //	param paramMax: maximum parameter to user function (may not be [0, 1])
 //	param func: pointer to user function returning real and taking one real arg
 //	return: total number of samples (numDivisions*numSubdivisions + 1)
-A3_INLINE a3index a3sampleTableGenerateArcLength(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count numSubdivisions, const a3real paramMin, const a3real paramMax, const a3realfunc func);
+A3DM_INLINE a3index a3sampleTableGenerateArcLength(a3real sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count numSubdivisions, const a3real paramMin, const a3real paramMax, const a3realfunc func);
 
 // A3: Get the number of samples (elements) needed to hold a user sample table.
 //	param numDivisions: number of segment divisions/samples
 //	param numSubdivisions: number of subsamples between samples
 //	return: total number of samples (numDivisions*numSubdivisions + 1)
-A3_INLINE a3index a3sampleTableGenerateNumSamplesRequired(const a3index numDivisions, const a3count numSubdivisions);
+A3DM_INLINE a3index a3sampleTableGenerateNumSamplesRequired(const a3index numDivisions, const a3count numSubdivisions);
 
 
 //-----------------------------------------------------------------------------
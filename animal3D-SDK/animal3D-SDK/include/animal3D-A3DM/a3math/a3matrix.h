@@ -248,88 +248,88 @@ union a3mat4
 // A3: Initialize matrix to identity.
 //	param m_out: matrix to initialize
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2SetIdentity(a3real2x2p m_out);
+A3DM_INLINE a3real2x2r a3real2x2SetIdentity(a3real2x2p m_out);
 
 // A3: Initialize matrix with elements.
 //	param m_out: matrix to initialize
 //	params x0...y1: major, minor elements
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2Set(a3real2x2p m_out, const a3real x0, const a3real y0, const a3real x1, const a3real y1);
+A3DM_INLINE a3real2x2r a3real2x2Set(a3real2x2p m_out, const a3real x0, const a3real y0, const a3real x1, const a3real y1);
 
 // A3: Initialize matrix with major vectors.
 //	param m_out: matrix to initialize
 //	param v0...v1: major vectors (e.g. if column-major, these are columns)
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2SetMajors(a3real2x2p m_out, const a3real2p v0, const a3real2p v1);
+A3DM_INLINE a3real2x2r a3real2x2SetMajors(a3real2x2p m_out, const a3real2p v0, const a3real2p v1);
 
 // A3: Initialize matrix with minor vectors.
 //	param m_out: matrix to initialize
 //	param v0...v1: minor vectors (e.g. if column-major, these are rows)
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2SetMinors(a3real2x2p m_out, const a3real2p v0, const a3real2p v1);
+A3DM_INLINE a3real2x2r a3real2x2SetMinors(a3real2x2p m_out, const a3real2p v0, const a3real2p v1);
 
 // A3: Initialize matrix with 2D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2SetReal2x2(a3real2x2p m_out, const a3real2x2p m);
+A3DM_INLINE a3real2x2r a3real2x2SetReal2x2(a3real2x2p m_out, const a3real2x2p m);
 
 // A3: Initialize matrix with 3D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2SetReal3x3(a3real2x2p m_out, const a3real3x3p m);
+A3DM_INLINE a3real2x2r a3real2x2SetReal3x3(a3real2x2p m_out, const a3real3x3p m);
 
 // A3: Initialize matrix with 4D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2SetReal4x4(a3real2x2p m_out, const a3real4x4p m);
+A3DM_INLINE a3real2x2r a3real2x2SetReal4x4(a3real2x2p m_out, const a3real4x4p m);
 
 
 // A3: Calculate matrix determinant; effectively its 'magnitude'.
 //	param m: matrix whose determinant to calculate
 //	return: determinant of matrix: |m|
-A3_INLINE a3real a3real2x2Determinant(const a3real2x2p m);
+A3DM_INLINE a3real a3real2x2Determinant(const a3real2x2p m);
 
 // A3: Calculate inverse (reciprocal) matrix determinant.
 //	param m: matrix whose inverse determinant to calculate
 //	return: inverse determinant of matrix: 1 / |m|
-A3_INLINE a3real a3real2x2DeterminantInverse(const a3real2x2p m);
+A3DM_INLINE a3real a3real2x2DeterminantInverse(const a3real2x2p m);
 
 // A3: Get negative matrix.
 //	param m_out: output matrix to store negative
 //	param m: input matrix whose negative to get
 //	return: m_out
-A3_INLINE a3real2x2r a3real2x2GetNegative(a3real2x2p m_out, const a3real2x2p m);
+A3DM_INLINE a3real2x2r a3real2x2GetNegative(a3real2x2p m_out, const a3real2x2p m);
 
 // A3: Get transpose of matrix: flip about the diagonal.
 //	param m_out: output matrix to store transpose
 //	param m: input matrix whose transpose to get
 //	return: m_out
-A3_INLINE a3real2x2r a3real2x2GetTransposed(a3real2x2p m_out, const a3real2x2p m);
+A3DM_INLINE a3real2x2r a3real2x2GetTransposed(a3real2x2p m_out, const a3real2x2p m);
 
 // A3: Get inverse of matrix: opposite; multiplying a matrix with its own 
 //		inverse yields the identity matrix.
 //	param m_out: output matrix to store inverse
 //	param m: input matrix whose inverse to get
 //	return: m_out
-A3_INLINE a3real2x2r a3real2x2GetInverse(a3real2x2p m_out, const a3real2x2p m);
+A3DM_INLINE a3real2x2r a3real2x2GetInverse(a3real2x2p m_out, const a3real2x2p m);
 
 // A3: Negate matrix.
 //	param m_inout: matrix to negate and store
 //	return: m_inout
-A3_INLINE a3real2x2r a3real2x2Negate(a3real2x2p m_inout);
+A3DM_INLINE a3real2x2r a3real2x2Negate(a3real2x2p m_inout);
 
 // A3: Transpose matrix.
 //	param m_inout: matrix to transpose and store
 //	return: m_inout
-A3_INLINE a3real2x2r a3real2x2Transpose(a3real2x2p m_inout);
+A3DM_INLINE a3real2x2r a3real2x2Transpose(a3real2x2p m_inout);
 
 // A3: Invert matrix.
 //	param m_inout: matrix to invert and store
 //	return: m_inout
-A3_INLINE a3real2x2r a3real2x2Invert(a3real2x2p m_inout);
+A3DM_INLINE a3real2x2r a3real2x2Invert(a3real2x2p m_inout);
 
 
 // A3: Calculate sum of two matrices.
@@ -337,52 +337,52 @@ A3_INLINE a3real2x2r a3real2x2Invert(a3real2x2p m_inout);
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2Sum(a3real2x2p m_out, const a3real2x2p mL, const a3real2x2p mR);
+A3DM_INLINE a3real2x2r a3real2x2Sum(a3real2x2p m_out, const a3real2x2p mL, const a3real2x2p mR);
 
 // A3: Calculate difference of two matrices.
 //	param m_out: output matrix, difference of mL and mR
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2Diff(a3real2x2p m_out, const a3real2x2p mL, const a3real2x2p mR);
+A3DM_INLINE a3real2x2r a3real2x2Diff(a3real2x2p m_out, const a3real2x2p mL, const a3real2x2p mR);
 
 // A3: Calculate product of matrix and scalar.
 //	param m_out: output matrix, product of input matrix and scalar
 //	param m: input matrix
 //	param s: scalar by which to multiply matrix
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2ProductS(a3real2x2p m_out, const a3real2x2p m, const a3real s);
+A3DM_INLINE a3real2x2r a3real2x2ProductS(a3real2x2p m_out, const a3real2x2p m, const a3real s);
 
 // A3: Calculate quotient of matrix and scalar.
 //	param m_out: output matrix, quotient of input matrix and scalar
 //	param m: input matrix, numerator
 //	param s: scalar by which to divide matrix, denominator
 //	return m_out
-A3_INLINE a3real2x2r a3real2x2QuotientS(a3real2x2p m_out, const a3real2x2p m, const a3real s);
+A3DM_INLINE a3real2x2r a3real2x2QuotientS(a3real2x2p m_out, const a3real2x2p m, const a3real s);
 
 // A3: Add two matrices.
 //	param mL_inout: matrix to which to add mR and store
 //	param mR: input right matrix
 //	return mL_inout
-A3_INLINE a3real2x2r a3real2x2Add(a3real2x2p mL_inout, const a3real2x2p mR);
+A3DM_INLINE a3real2x2r a3real2x2Add(a3real2x2p mL_inout, const a3real2x2p mR);
 
 // A3: Subtract two matrices.
 //	param mL_inout: matrix from which to subtract mR and store
 //	param mR: input right matrix
 //	return mL_inout
-A3_INLINE a3real2x2r a3real2x2Sub(a3real2x2p mL_inout, const a3real2x2p mR);
+A3DM_INLINE a3real2x2r a3real2x2Sub(a3real2x2p mL_inout, const a3real2x2p mR);
 
 // A3: Multiply matrix by scalar.
 //	param m_inout: matrix by which to multiply scalar and store
 //	param s: scalar to multiply matrix
 //	return m_inout
-A3_INLINE a3real2x2r a3real2x2MulS(a3real2x2p m_inout, const a3real s);
+A3DM_INLINE a3real2x2r a3real2x2MulS(a3real2x2p m_inout, const a3real s);
 
 // A3: Divide matrix by scalar.
 //	param m_inout: matrix by which to divide scalar and store, numerator
 //	param s: scalar to divide matrix, denominator
 //	return m_inout
-A3_INLINE a3real2x2r a3real2x2DivS(a3real2x2p m_inout, const a3real s);
+A3DM_INLINE a3real2x2r a3real2x2DivS(a3real2x2p m_inout, const a3real s);
 
 
 // A3: Calculate transformed vector by matrix, left-handed.
@@ -390,64 +390,64 @@ A3_INLINE a3real2x2r a3real2x2DivS(a3real2x2p m_inout, const a3real s);
 //	param v: input vector
 //	param m: matrix by which to transform vector
 //	return: v_out
-A3_INLINE a3real2r a3real2Real2x2ProductL(a3real2p v_out, const a3real2p v, const a3real2x2p m);
+A3DM_INLINE a3real2r a3real2Real2x2ProductL(a3real2p v_out, const a3real2p v, const a3real2x2p m);
 
 // A3: Calculate transformed vector by matrix, right-handed.
 //	param v_out: resulting vector of input transformed by matrix
 //	param m: matrix by which to transform vector
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real2r a3real2Real2x2ProductR(a3real2p v_out, const a3real2x2p m, const a3real2p v);
+A3DM_INLINE a3real2r a3real2Real2x2ProductR(a3real2p v_out, const a3real2x2p m, const a3real2p v);
 
 // A3: Transform vector by matrix, left-handed.
 //	param v_inout: vector to transform by matrix and store
 //	param m: matrix by which to transform vector
 //	return: v_inout
-A3_INLINE a3real2r a3real2Real2x2MulL(a3real2p v_inout, const a3real2x2p m);
+A3DM_INLINE a3real2r a3real2Real2x2MulL(a3real2p v_inout, const a3real2x2p m);
 
 // A3: Transform vector by matrix, right-handed.
 //	param m: matrix by which to transform vector
 //	param v_inout: vector to transform by matrix and store
 //	return: v_inout
-A3_INLINE a3real2r a3real2Real2x2MulR(const a3real2x2p m, a3real2p v_inout);
+A3DM_INLINE a3real2r a3real2Real2x2MulR(const a3real2x2p m, a3real2p v_inout);
 
 // A3: Calculate matrix product.
 //	param m_out: product of input matrices
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return: m_out
-A3_INLINE a3real2x2r a3real2x2Product(a3real2x2p m_out, const a3real2x2p mL, const a3real2x2p mR);
+A3DM_INLINE a3real2x2r a3real2x2Product(a3real2x2p m_out, const a3real2x2p mL, const a3real2x2p mR);
 
 // A3: Concatenate (multiply) matrices, left-handed.
 //	param mL_inout: left matrix to multiply and store
 //	param mR: input right matrix
 //	return: mL_inout
-A3_INLINE a3real2x2r a3real2x2ConcatL(a3real2x2p mL_inout, const a3real2x2p mR);
+A3DM_INLINE a3real2x2r a3real2x2ConcatL(a3real2x2p mL_inout, const a3real2x2p mR);
 
 // A3: Concatenate (multiply) matrices, right-handed.
 //	param mL: input left matrix
 //	param mR_inout: right matrix to multiply and store
 //	return: mR_inout
-A3_INLINE a3real2x2r a3real2x2ConcatR(const a3real2x2p mL, a3real2x2p mR_inout);
+A3DM_INLINE a3real2x2r a3real2x2ConcatR(const a3real2x2p mL, a3real2x2p mR_inout);
 
 
 // A3: Set matrix to represent uniform scale transformation.
 //	param m_out: output transformation matrix
 //	param s: uniform scalar
 //	return: m_out
-A3_INLINE a3real2x2r a3real2x2SetScale(a3real2x2p m_out, const a3real s);
+A3DM_INLINE a3real2x2r a3real2x2SetScale(a3real2x2p m_out, const a3real s);
 
 // A3: Set matrix to represent non-uniform scale transformation.
 //	param m_out: output transformation matrix
 //	param sx...sy: scalars about each axis
 //	return: m_out
-A3_INLINE a3real2x2r a3real2x2SetNonUnif(a3real2x2p m_out, const a3real sx, const a3real sy);
+A3DM_INLINE a3real2x2r a3real2x2SetNonUnif(a3real2x2p m_out, const a3real sx, const a3real sy);
 
 // A3: Set matrix to represent rotation transformation.
 //	param m_out: output transformation matrix
 //	param degrees: validated rotation angle in degrees
 //	return: m_out
-A3_INLINE a3real2x2r a3real2x2SetRotate(a3real2x2p m_out, const a3real degrees);
+A3DM_INLINE a3real2x2r a3real2x2SetRotate(a3real2x2p m_out, const a3real degrees);
 
 
 //-----------------------------------------------------------------------------
@@ -456,88 +456,88 @@ A3_INLINE a3real2x2r a3real2x2SetRotate(a3real2x2p m_out, const a3real degrees);
 // A3: Initialize matrix to identity.
 //	param m_out: matrix to initialize
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3SetIdentity(a3real3x3p m_out);
+A3DM_INLINE a3real3x3r a3real3x3SetIdentity(a3real3x3p m_out);
 
 // A3: Initialize matrix with elements.
 //	param m_out: matrix to initialize
 //	params x0...z2: major, minor elements
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3Set(a3real3x3p m_out, const a3real x0, const a3real y0, const a3real z0, const a3real x1, const a3real y1, const a3real z1, const a3real x2, const a3real y2, const a3real z2);
+A3DM_INLINE a3real3x3r a3real3x3Set(a3real3x3p m_out, const a3real x0, const a3real y0, const a3real z0, const a3real x1, const a3real y1, const a3real z1, const a3real x2, const a3real y2, const a3real z2);
 
 // A3: Initialize matrix with major vectors.
 //	param m_out: matrix to initialize
 //	param v0...v2: major vectors (e.g. if column-major, these are columns)
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3SetMajors(a3real3x3p m_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real3x3r a3real3x3SetMajors(a3real3x3p m_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Initialize matrix with minor vectors.
 //	param m_out: matrix to initialize
 //	param v0...v2: minor vectors (e.g. if column-major, these are rows)
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3SetMinors(a3real3x3p m_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real3x3r a3real3x3SetMinors(a3real3x3p m_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Initialize matrix with 2D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3SetReal2x2(a3real3x3p m_out, const a3real2x2p m);
+A3DM_INLINE a3real3x3r a3real3x3SetReal2x2(a3real3x3p m_out, const a3real2x2p m);
 
 // A3: Initialize matrix with 3D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3SetReal3x3(a3real3x3p m_out, const a3real3x3p m);
+A3DM_INLINE a3real3x3r a3real3x3SetReal3x3(a3real3x3p m_out, const a3real3x3p m);
 
 // A3: Initialize matrix with 4D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3SetReal4x4(a3real3x3p m_out, const a3real4x4p m);
+A3DM_INLINE a3real3x3r a3real3x3SetReal4x4(a3real3x3p m_out, const a3real4x4p m);
 
 
 // A3: Calculate matrix determinant; effectively its 'magnitude'.
 //	param m: matrix whose determinant to calculate
 //	return: determinant of matrix: |m|
-A3_INLINE a3real a3real3x3Determinant(const a3real3x3p m);
+A3DM_INLINE a3real a3real3x3Determinant(const a3real3x3p m);
 
 // A3: Calculate inverse (reciprocal) matrix determinant.
 //	param m: matrix whose inverse determinant to calculate
 //	return: inverse determinant of matrix: 1 / |m|
-A3_INLINE a3real a3real3x3DeterminantInverse(const a3real3x3p m);
+A3DM_INLINE a3real a3real3x3DeterminantInverse(const a3real3x3p m);
 
 // A3: Get negative matrix.
 //	param m_out: output matrix to store negative
 //	param m: input matrix whose negative to get
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3GetNegative(a3real3x3p m_out, const a3real3x3p m);
+A3DM_INLINE a3real3x3r a3real3x3GetNegative(a3real3x3p m_out, const a3real3x3p m);
 
 // A3: Get transpose of matrix: flip about the diagonal.
 //	param m_out: output matrix to store transpose
 //	param m: input matrix whose transpose to get
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3GetTransposed(a3real3x3p m_out, const a3real3x3p m);
+A3DM_INLINE a3real3x3r a3real3x3GetTransposed(a3real3x3p m_out, const a3real3x3p m);
 
 // A3: Get inverse of matrix: opposite; multiplying a matrix with its own 
 //		inverse yields the identity matrix.
 //	param m_out: output matrix to store inverse
 //	param m: input matrix whose inverse to get
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3GetInverse(a3real3x3p m_out, const a3real3x3p m);
+A3DM_INLINE a3real3x3r a3real3x3GetInverse(a3real3x3p m_out, const a3real3x3p m);
 
 // A3: Negate matrix.
 //	param m_inout: matrix to negate and store
 //	return: m_inout
-A3_INLINE a3real3x3r a3real3x3Negate(a3real3x3p m_inout);
+A3DM_INLINE a3real3x3r a3real3x3Negate(a3real3x3p m_inout);
 
 // A3: Transpose matrix.
 //	param m_inout: matrix to transpose and store
 //	return: m_inout
-A3_INLINE a3real3x3r a3real3x3Transpose(a3real3x3p m_inout);
+A3DM_INLINE a3real3x3r a3real3x3Transpose(a3real3x3p m_inout);
 
 // A3: Invert matrix.
 //	param m_inout: matrix to invert and store
 //	return: m_inout
-A3_INLINE a3real3x3r a3real3x3Invert(a3real3x3p m_inout);
+A3DM_INLINE a3real3x3r a3real3x3Invert(a3real3x3p m_inout);
 
 
 // A3: Calculate sum of two matrices.
@@ -545,52 +545,52 @@ A3_INLINE a3real3x3r a3real3x3Invert(a3real3x3p m_inout);
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3Sum(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR);
+A3DM_INLINE a3real3x3r a3real3x3Sum(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR);
 
 // A3: Calculate difference of two matrices.
 //	param m_out: output matrix, difference of mL and mR
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3Diff(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR);
+A3DM_INLINE a3real3x3r a3real3x3Diff(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR);
 
 // A3: Calculate product of matrix and scalar.
 //	param m_out: output matrix, product of input matrix and scalar
 //	param m: input matrix
 //	param s: scalar by which to multiply matrix
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3ProductS(a3real3x3p m_out, const a3real3x3p m, const a3real s);
+A3DM_INLINE a3real3x3r a3real3x3ProductS(a3real3x3p m_out, const a3real3x3p m, const a3real s);
 
 // A3: Calculate quotient of matrix and scalar.
 //	param m_out: output matrix, quotient of input matrix and scalar
 //	param m: input matrix, numerator
 //	param s: scalar by which to divide matrix, denominator
 //	return m_out
-A3_INLINE a3real3x3r a3real3x3QuotientS(a3real3x3p m_out, const a3real3x3p m, const a3real s);
+A3DM_INLINE a3real3x3r a3real3x3QuotientS(a3real3x3p m_out, const a3real3x3p m, const a3real s);
 
 // A3: Add two matrices.
 //	param mL_inout: matrix to which to add mR and store
 //	param mR: input right matrix
 //	return mL_inout
-A3_INLINE a3real3x3r a3real3x3Add(a3real3x3p mL_inout, const a3real3x3p mR);
+A3DM_INLINE a3real3x3r a3real3x3Add(a3real3x3p mL_inout, const a3real3x3p mR);
 
 // A3: Subtract two matrices.
 //	param mL_inout: matrix from which to subtract mR and store
 //	param mR: input right matrix
 //	return mL_inout
-A3_INLINE a3real3x3r a3real3x3Sub(a3real3x3p mL_inout, const a3real3x3p mR);
+A3DM_INLINE a3real3x3r a3real3x3Sub(a3real3x3p mL_inout, const a3real3x3p mR);
 
 // A3: Multiply matrix by scalar.
 //	param m_inout: matrix by which to multiply scalar and store
 //	param s: scalar to multiply matrix
 //	return m_inout
-A3_INLINE a3real3x3r a3real3x3MulS(a3real3x3p m_inout, const a3real s);
+A3DM_INLINE a3real3x3r a3real3x3MulS(a3real3x3p m_inout, const a3real s);
 
 // A3: Divide matrix by scalar.
 //	param m_inout: matrix by which to divide scalar and store, numerator
 //	param s: scalar to divide matrix, denominator
 //	return m_inout
-A3_INLINE a3real3x3r a3real3x3DivS(a3real3x3p m_inout, const a3real s);
+A3DM_INLINE a3real3x3r a3real3x3DivS(a3real3x3p m_inout, const a3real s);
 
 
 // A3: Calculate transformed vector by matrix, left-handed.
@@ -598,76 +598,76 @@ A3_INLINE a3real3x3r a3real3x3DivS(a3real3x3p m_inout, const a3real s);
 //	param v: input vector
 //	param m: matrix by which to transform vector
 //	return: v_out
-A3_INLINE a3real3r a3real3Real3x3ProductL(a3real3p v_out, const a3real3p v, const a3real3x3p m);
+A3DM_INLINE a3real3r a3real3Real3x3ProductL(a3real3p v_out, const a3real3p v, const a3real3x3p m);
 
 // A3: Calculate transformed vector by matrix, right-handed.
 //	param v_out: resulting vector of input transformed by matrix
 //	param m: matrix by which to transform vector
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real3r a3real3Real3x3ProductR(a3real3p v_out, const a3real3x3p m, const a3real3p v);
+A3DM_INLINE a3real3r a3real3Real3x3ProductR(a3real3p v_out, const a3real3x3p m, const a3real3p v);
 
 // A3: Transform vector by matrix, left-handed.
 //	param v_inout: vector to transform by matrix and store
 //	param m: matrix by which to transform vector
 //	return: v_inout
-A3_INLINE a3real3r a3real3Real3x3MulL(a3real3p v_inout, const a3real3x3p m);
+A3DM_INLINE a3real3r a3real3Real3x3MulL(a3real3p v_inout, const a3real3x3p m);
 
 // A3: Transform vector by matrix, right-handed.
 //	param m: matrix by which to transform vector
 //	param v_inout: vector to transform by matrix and store
 //	return: v_inout
-A3_INLINE a3real3r a3real3Real3x3MulR(const a3real3x3p m, a3real3p v_inout);
+A3DM_INLINE a3real3r a3real3Real3x3MulR(const a3real3x3p m, a3real3p v_inout);
 
 // A3: Calculate matrix product.
 //	param m_out: product of input matrices
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3Product(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR);
+A3DM_INLINE a3real3x3r a3real3x3Product(a3real3x3p m_out, const a3real3x3p mL, const a3real3x3p mR);
 
 // A3: Concatenate (multiply) matrices, left-handed.
 //	param mL_inout: left matrix to multiply and store
 //	param mR: input right matrix
 //	return: mL_inout
-A3_INLINE a3real3x3r a3real3x3ConcatL(a3real3x3p mL_inout, const a3real3x3p mR);
+A3DM_INLINE a3real3x3r a3real3x3ConcatL(a3real3x3p mL_inout, const a3real3x3p mR);
 
 // A3: Concatenate (multiply) matrices, right-handed.
 //	param mL: input left matrix
 //	param mR_inout: right matrix to multiply and store
 //	return: mR_inout
-A3_INLINE a3real3x3r a3real3x3ConcatR(const a3real3x3p mL, a3real3x3p mR_inout);
+A3DM_INLINE a3real3x3r a3real3x3ConcatR(const a3real3x3p mL, a3real3x3p mR_inout);
 
 
 // A3: Set matrix to represent uniform scale transformation.
 //	param m_out: output transformation matrix
 //	param s: uniform scalar
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3SetScale(a3real3x3p m_out, const a3real s);
+A3DM_INLINE a3real3x3r a3real3x3SetScale(a3real3x3p m_out, const a3real s);
 
 // A3: Set matrix to represent non-uniform scale transformation.
 //	param m_out: output transformation matrix
 //	param sx...sz: scalars about each axis
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3SetNonUnif(a3real3x3p m_out, const a3real sx, const a3real sy, const a3real sz);
+A3DM_INLINE a3real3x3r a3real3x3SetNonUnif(a3real3x3p m_out, const a3real sx, const a3real sy, const a3real sz);
 
 // A3: Set matrix to represent rotation transformation about X axis.
 //	param m_out: output transformation matrix
 //	param degrees: validated rotation angle in degrees
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3SetRotateX(a3real3x3p m_out, const a3real degrees);
+A3DM_INLINE a3real3x3r a3real3x3SetRotateX(a3real3x3p m_out, const a3real degrees);
 
 // A3: Set matrix to represent rotation transformation about Y axis.
 //	param m_out: output transformation matrix
 //	param degrees: validated rotation angle in degrees
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3SetRotateY(a3real3x3p m_out, const a3real degrees);
+A3DM_INLINE a3real3x3r a3real3x3SetRotateY(a3real3x3p m_out, const a3real degrees);
 
 // A3: Set matrix to represent rotation transformation about Z axis.
 //	param m_out: output transformation matrix
 //	param degrees: validated rotation angle in degrees
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3SetRotateZ(a3real3x3p m_out, const a3real degrees);
+A3DM_INLINE a3real3x3r a3real3x3SetRotateZ(a3real3x3p m_out, const a3real degrees);
 
 // A3: Set matrix to represent rotation transformation given Euler angles in 
 //		XYZ order.
@@ -676,7 +676,7 @@ A3_INLINE a3real3x3r a3real3x3SetRotateZ(a3real3x3p m_out, const a3real degrees)
 //	param degrees_y: validated rotation angle in degrees about Y axis
 //	param degrees_z: validated rotation angle in degrees about Z axis
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3SetRotateXYZ(a3real3x3p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z);
+A3DM_INLINE a3real3x3r a3real3x3SetRotateXYZ(a3real3x3p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z);
 
 // A3: Set matrix to represent rotation transformation given Euler angles in 
 //		ZYX order.
@@ -685,7 +685,7 @@ A3_INLINE a3real3x3r a3real3x3SetRotateXYZ(a3real3x3p m_out, const a3real degree
 //	param degrees_y: validated rotation angle in degrees about Y axis
 //	param degrees_z: validated rotation angle in degrees about Z axis
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3SetRotateZYX(a3real3x3p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z);
+A3DM_INLINE a3real3x3r a3real3x3SetRotateZYX(a3real3x3p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z);
 
 // A3: Extract Euler angles in XYZ order from rotation matrix.
 //	param m: input transformation matrix from which to extract angles
@@ -693,7 +693,7 @@ A3_INLINE a3real3x3r a3real3x3SetRotateZYX(a3real3x3p m_out, const a3real degree
 //	param degrees_y_out: pointer to variable to capture degrees about Y axis
 //	param degrees_z_out: pointer to variable to capture degrees about Z axis
 //	return: m
-A3_INLINE a3real3x3rk a3real3x3GetEulerXYZIgnoreScale(const a3real3x3p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out);
+A3DM_INLINE a3real3x3rk a3real3x3GetEulerXYZIgnoreScale(const a3real3x3p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out);
 
 // A3: Extract Euler angles in ZYX order from rotation matrix.
 //	param m: input transformation matrix from which to extract angles
@@ -701,7 +701,7 @@ A3_INLINE a3real3x3rk a3real3x3GetEulerXYZIgnoreScale(const a3real3x3p m, a3real
 //	param degrees_y_out: pointer to variable to capture degrees about Y axis
 //	param degrees_z_out: pointer to variable to capture degrees about Z axis
 //	return: m
-A3_INLINE a3real3x3rk a3real3x3GetEulerZYXIgnoreScale(const a3real3x3p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out);
+A3DM_INLINE a3real3x3rk a3real3x3GetEulerZYXIgnoreScale(const a3real3x3p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out);
 
 
 //-----------------------------------------------------------------------------
@@ -710,88 +710,88 @@ A3_INLINE a3real3x3rk a3real3x3GetEulerZYXIgnoreScale(const a3real3x3p m, a3real
 // A3: Initialize matrix to identity.
 //	param m_out: matrix to initialize
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4SetIdentity(a3real4x4p m_out);
+A3DM_INLINE a3real4x4r a3real4x4SetIdentity(a3real4x4p m_out);
 
 // A3: Initialize matrix with elements.
 //	param m_out: matrix to initialize
 //	params x0...w3: major, minor elements
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4Set(a3real4x4p m_out, const a3real x0, const a3real y0, const a3real z0, const a3real w0, const a3real x1, const a3real y1, const a3real z1, const a3real w1, const a3real x2, const a3real y2, const a3real z2, const a3real w2, const a3real x3, const a3real y3, const a3real z3, const a3real w3);
+A3DM_INLINE a3real4x4r a3real4x4Set(a3real4x4p m_out, const a3real x0, const a3real y0, const a3real z0, const a3real w0, const a3real x1, const a3real y1, const a3real z1, const a3real w1, const a3real x2, const a3real y2, const a3real z2, const a3real w2, const a3real x3, const a3real y3, const a3real z3, const a3real w3);
 
 // A3: Initialize matrix with major vectors.
 //	param m_out: matrix to initialize
 //	param v0...v3: major vectors (e.g. if column-major, these are columns)
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4SetMajors(a3real4x4p m_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3);
+A3DM_INLINE a3real4x4r a3real4x4SetMajors(a3real4x4p m_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3);
 
 // A3: Initialize matrix with minor vectors.
 //	param m_out: matrix to initialize
 //	param v0...v3: minor vectors (e.g. if column-major, these are rows)
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4SetMinors(a3real4x4p m_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3);
+A3DM_INLINE a3real4x4r a3real4x4SetMinors(a3real4x4p m_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3);
 
 // A3: Initialize matrix with 2D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4SetReal2x2(a3real4x4p m_out, const a3real2x2p m);
+A3DM_INLINE a3real4x4r a3real4x4SetReal2x2(a3real4x4p m_out, const a3real2x2p m);
 
 // A3: Initialize matrix with 3D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4SetReal3x3(a3real4x4p m_out, const a3real3x3p m);
+A3DM_INLINE a3real4x4r a3real4x4SetReal3x3(a3real4x4p m_out, const a3real3x3p m);
 
 // A3: Initialize matrix with 4D matrix.
 //	param m_out: matrix to initialize
 //	param m: matrix to copy
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4SetReal4x4(a3real4x4p m_out, const a3real4x4p m);
+A3DM_INLINE a3real4x4r a3real4x4SetReal4x4(a3real4x4p m_out, const a3real4x4p m);
 
 
 // A3: Calculate matrix determinant; effectively its 'magnitude'.
 //	param m: matrix whose determinant to calculate
 //	return: determinant of matrix: |m|
-A3_INLINE a3real a3real4x4Determinant(const a3real4x4p m);
+A3DM_INLINE a3real a3real4x4Determinant(const a3real4x4p m);
 
 // A3: Calculate inverse (reciprocal) matrix determinant.
 //	param m: matrix whose inverse determinant to calculate
 //	return: inverse determinant of matrix: 1 / |m|
-A3_INLINE a3real a3real4x4DeterminantInverse(const a3real4x4p m);
+A3DM_INLINE a3real a3real4x4DeterminantInverse(const a3real4x4p m);
 
 // A3: Get negative matrix.
 //	param m_out: output matrix to store negative
 //	param m: input matrix whose negative to get
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4GetNegative(a3real4x4p m_out, const a3real4x4p m);
+A3DM_INLINE a3real4x4r a3real4x4GetNegative(a3real4x4p m_out, const a3real4x4p m);
 
 // A3: Get transpose of matrix: flip about the diagonal.
 //	param m_out: output matrix to store transpose
 //	param m: input matrix whose transpose to get
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4GetTransposed(a3real4x4p m_out, const a3real4x4p m);
+A3DM_INLINE a3real4x4r a3real4x4GetTransposed(a3real4x4p m_out, const a3real4x4p m);
 
 // A3: Get inverse of matrix: opposite; multiplying a matrix with its own 
 //		inverse yields the identity matrix.
 //	param m_out: output matrix to store inverse
 //	param m: input matrix whose inverse to get
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4GetInverse(a3real4x4p m_out, const a3real4x4p m);
+A3DM_INLINE a3real4x4r a3real4x4GetInverse(a3real4x4p m_out, const a3real4x4p m);
 
 // A3: Negate matrix.
 //	param m_inout: matrix to negate and store
 //	return: m_inout
-A3_INLINE a3real4x4r a3real4x4Negate(a3real4x4p m_inout);
+A3DM_INLINE a3real4x4r a3real4x4Negate(a3real4x4p m_inout);
 
 // A3: Transpose matrix.
 //	param m_inout: matrix to transpose and store
 //	return: m_inout
-A3_INLINE a3real4x4r a3real4x4Transpose(a3real4x4p m_inout);
+A3DM_INLINE a3real4x4r a3real4x4Transpose(a3real4x4p m_inout);
 
 // A3: Invert matrix.
 //	param m_inout: matrix to invert and store
 //	return: m_inout
-A3_INLINE a3real4x4r a3real4x4Invert(a3real4x4p m_inout);
+A3DM_INLINE a3real4x4r a3real4x4Invert(a3real4x4p m_inout);
 
 
 // A3: Calculate sum of two matrices.
@@ -799,52 +799,52 @@ A3_INLINE a3real4x4r a3real4x4Invert(a3real4x4p m_inout);
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4Sum(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR);
+A3DM_INLINE a3real4x4r a3real4x4Sum(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR);
 
 // A3: Calculate difference of two matrices.
 //	param m_out: output matrix, difference of mL and mR
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4Diff(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR);
+A3DM_INLINE a3real4x4r a3real4x4Diff(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR);
 
 // A3: Calculate product of matrix and scalar.
 //	param m_out: output matrix, product of input matrix and scalar
 //	param m: input matrix
 //	param s: scalar by which to multiply matrix
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4ProductS(a3real4x4p m_out, const a3real4x4p m, const a3real s);
+A3DM_INLINE a3real4x4r a3real4x4ProductS(a3real4x4p m_out, const a3real4x4p m, const a3real s);
 
 // A3: Calculate quotient of matrix and scalar.
 //	param m_out: output matrix, quotient of input matrix and scalar
 //	param m: input matrix, numerator
 //	param s: scalar by which to divide matrix, denominator
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4QuotientS(a3real4x4p m_out, const a3real4x4p m, const a3real s);
+A3DM_INLINE a3real4x4r a3real4x4QuotientS(a3real4x4p m_out, const a3real4x4p m, const a3real s);
 
 // A3: Add two matrices.
 //	param mL_inout: matrix to which to add mR and store
 //	param mR: input right matrix
 //	return mL_inout
-A3_INLINE a3real4x4r a3real4x4Add(a3real4x4p mL_inout, const a3real4x4p mR);
+A3DM_INLINE a3real4x4r a3real4x4Add(a3real4x4p mL_inout, const a3real4x4p mR);
 
 // A3: Subtract two matrices.
 //	param mL_inout: matrix from which to subtract mR and store
 //	param mR: input right matrix
 //	return mL_inout
-A3_INLINE a3real4x4r a3real4x4Sub(a3real4x4p mL_inout, const a3real4x4p mR);
+A3DM_INLINE a3real4x4r a3real4x4Sub(a3real4x4p mL_inout, const a3real4x4p mR);
 
 // A3: Multiply matrix by scalar.
 //	param m_inout: matrix by which to multiply scalar and store
 //	param s: scalar to multiply matrix
 //	return m_inout
-A3_INLINE a3real4x4r a3real4x4MulS(a3real4x4p m_inout, const a3real s);
+A3DM_INLINE a3real4x4r a3real4x4MulS(a3real4x4p m_inout, const a3real s);
 
 // A3: Divide matrix by scalar.
 //	param m_inout: matrix by which to divide scalar and store, numerator
 //	param s: scalar to divide matrix, denominator
 //	return m_inout
-A3_INLINE a3real4x4r a3real4x4DivS(a3real4x4p m_inout, const a3real s);
+A3DM_INLINE a3real4x4r a3real4x4DivS(a3real4x4p m_inout, const a3real s);
 
 
 // A3: Calculate transformed vector by matrix, left-handed.
@@ -852,76 +852,76 @@ A3_INLINE a3real4x4r a3real4x4DivS(a3real4x4p m_inout, const a3real s);
 //	param v: input vector
 //	param m: matrix by which to transform vector
 //	return: v_out
-A3_INLINE a3real4r a3real4Real4x4ProductL(a3real4p v_out, const a3real4p v, const a3real4x4p m);
+A3DM_INLINE a3real4r a3real4Real4x4ProductL(a3real4p v_out, const a3real4p v, const a3real4x4p m);
 
 // A3: Calculate transformed vector by matrix, right-handed.
 //	param v_out: resulting vector of input transformed by matrix
 //	param m: matrix by which to transform vector
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real4r a3real4Real4x4ProductR(a3real4p v_out, const a3real4x4p m, const a3real4p v);
+A3DM_INLINE a3real4r a3real4Real4x4ProductR(a3real4p v_out, const a3real4x4p m, const a3real4p v);
 
 // A3: Transform vector by matrix, left-handed.
 //	param v_inout: vector to transform by matrix and store
 //	param m: matrix by which to transform vector
 //	return: v_inout
-A3_INLINE a3real4r a3real4Real4x4MulL(a3real4p v_inout, const a3real4x4p m);
+A3DM_INLINE a3real4r a3real4Real4x4MulL(a3real4p v_inout, const a3real4x4p m);
 
 // A3: Transform vector by matrix, right-handed.
 //	param m: matrix by which to transform vector
 //	param v_inout: vector to transform by matrix and store
 //	return: v_inout
-A3_INLINE a3real4r a3real4Real4x4MulR(const a3real4x4p m, a3real4p v_inout);
+A3DM_INLINE a3real4r a3real4Real4x4MulR(const a3real4x4p m, a3real4p v_inout);
 
 // A3: Calculate matrix product.
 //	param m_out: product of input matrices
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4Product(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR);
+A3DM_INLINE a3real4x4r a3real4x4Product(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR);
 
 // A3: Concatenate (multiply) matrices, left-handed.
 //	param mL_inout: left matrix to multiply and store
 //	param mR: input right matrix
 //	return: mL_inout
-A3_INLINE a3real4x4r a3real4x4ConcatL(a3real4x4p mL_inout, const a3real4x4p mR);
+A3DM_INLINE a3real4x4r a3real4x4ConcatL(a3real4x4p mL_inout, const a3real4x4p mR);
 
 // A3: Concatenate (multiply) matrices, right-handed.
 //	param mL: input left matrix
 //	param mR_inout: right matrix to multiply and store
 //	return: mR_inout
-A3_INLINE a3real4x4r a3real4x4ConcatR(const a3real4x4p mL, a3real4x4p mR_inout);
+A3DM_INLINE a3real4x4r a3real4x4ConcatR(const a3real4x4p mL, a3real4x4p mR_inout);
 
 
 // A3: Set matrix to represent uniform scale transformation.
 //	param m_out: output transformation matrix
 //	param s: uniform scalar
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4SetScale(a3real4x4p m_out, const a3real s);
+A3DM_INLINE a3real4x4r a3real4x4SetScale(a3real4x4p m_out, const a3real s);
 
 // A3: Set matrix to represent non-uniform scale transformation.
 //	param m_out: output transformation matrix
 //	param sx...sz: scalars about each axis
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4SetNonUnif(a3real4x4p m_out, const a3real sx, const a3real sy, const a3real sz);
+A3DM_INLINE a3real4x4r a3real4x4SetNonUnif(a3real4x4p m_out, const a3real sx, const a3real sy, const a3real sz);
 
 // A3: Set matrix to represent rotation transformation about X axis.
 //	param m_out: output transformation matrix
 //	param degrees: validated rotation angle in degrees
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4SetRotateX(a3real4x4p m_out, const a3real degrees);
+A3DM_INLINE a3real4x4r a3real4x4SetRotateX(a3real4x4p m_out, const a3real degrees);
 
 // A3: Set matrix to represent rotation transformation about Y axis.
 //	param m_out: output transformation matrix
 //	param degrees: validated rotation angle in degrees
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4SetRotateY(a3real4x4p m_out, const a3real degrees);
+A3DM_INLINE a3real4x4r a3real4x4SetRotateY(a3real4x4p m_out, const a3real degrees);
 
 // A3: Set matrix to represent rotation transformation about Z axis.
 //	param m_out: output transformation matrix
 //	param degrees: validated rotation angle in degrees
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4SetRotateZ(a3real4x4p m_out, const a3real degrees);
+A3DM_INLINE a3real4x4r a3real4x4SetRotateZ(a3real4x4p m_out, const a3real degrees);
 
 // A3: Set matrix to represent rotation transformation given Euler angles in 
 //		XYZ order.
@@ -930,7 +930,7 @@ A3_INLINE a3real4x4r a3real4x4SetRotateZ(a3real4x4p m_out, const a3real degrees)
 //	param degrees_y: validated rotation angle in degrees about Y axis
 //	param degrees_z: validated rotation angle in degrees about Z axis
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4SetRotateXYZ(a3real4x4p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z);
+A3DM_INLINE a3real4x4r a3real4x4SetRotateXYZ(a3real4x4p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z);
 
 // A3: Set matrix to represent rotation transformation given Euler angles in 
 //		ZYX order.
@@ -939,7 +939,7 @@ A3_INLINE a3real4x4r a3real4x4SetRotateXYZ(a3real4x4p m_out, const a3real degree
 //	param degrees_y: validated rotation angle in degrees about Y axis
 //	param degrees_z: validated rotation angle in degrees about Z axis
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4SetRotateZYX(a3real4x4p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z);
+A3DM_INLINE a3real4x4r a3real4x4SetRotateZYX(a3real4x4p m_out, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z);
 
 // A3: Extract Euler angles in XYZ order from rotation matrix.
 //	param m: input transformation matrix from which to extract angles
@@ -947,7 +947,7 @@ A3_INLINE a3real4x4r a3real4x4SetRotateZYX(a3real4x4p m_out, const a3real degree
 //	param degrees_y_out: pointer to variable to capture degrees about Y axis
 //	param degrees_z_out: pointer to variable to capture degrees about Z axis
 //	return: m
-A3_INLINE a3real4x4rk a3real4x4GetEulerXYZIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out);
+A3DM_INLINE a3real4x4rk a3real4x4GetEulerXYZIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out);
 
 // A3: Extract Euler angles in ZYX order from rotation matrix.
 //	param m: input transformation matrix from which to extract angles
@@ -955,7 +955,7 @@ A3_INLINE a3real4x4rk a3real4x4GetEulerXYZIgnoreScale(const a3real4x4p m, a3real
 //	param degrees_y_out: pointer to variable to capture degrees about Y axis
 //	param degrees_z_out: pointer to variable to capture degrees about Z axis
 //	return: m
-A3_INLINE a3real4x4rk a3real4x4GetEulerZYXIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out);
+A3DM_INLINE a3real4x4rk a3real4x4GetEulerZYXIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out);
 
 // A3: Extract Euler angles in XYZ order and translation from transformation.
 //	param m: input transformation matrix from which to extract angles
@@ -964,7 +964,7 @@ A3_INLINE a3real4x4rk a3real4x4GetEulerZYXIgnoreScale(const a3real4x4p m, a3real
 //	param degrees_z_out: pointer to variable to capture degrees about Z axis
 //	param translate_out: vector to capture translation
 //	return: m
-A3_INLINE a3real4x4rk a3real4x4GetEulerXYZTranslateIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out, a3real3p translate_out);
+A3DM_INLINE a3real4x4rk a3real4x4GetEulerXYZTranslateIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out, a3real3p translate_out);
 
 // A3: Extract Euler angles in ZYX order and translation from transformation.
 //	param m: input transformation matrix from which to extract angles
@@ -973,7 +973,7 @@ A3_INLINE a3real4x4rk a3real4x4GetEulerXYZTranslateIgnoreScale(const a3real4x4p
 //	param degrees_z_out: pointer to variable to capture degrees about Z axis
 //	param translate_out: vector to capture translation
 //	return: m
-A3_INLINE a3real4x4rk a3real4x4GetEulerZYXTranslateIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out, a3real3p translate_out);
+A3DM_INLINE a3real4x4rk a3real4x4GetEulerZYXTranslateIgnoreScale(const a3real4x4p m, a3real *degrees_x_out, a3real *degrees_y_out, a3real *degrees_z_out, a3real3p translate_out);
 
 
 //-----------------------------------------------------------------------------
@@ -984,83 +984,83 @@ A3_INLINE a3real4x4rk a3real4x4GetEulerZYXTranslateIgnoreScale(const a3real4x4p
 //	param v: input vector to transform
 //	param m: matrix by which to transform vector
 //	return: v_out
-A3_INLINE a3real4r a3real4ProductTransform(a3real4p v_out, const a3real4p v, const a3real4x4p m);
+A3DM_INLINE a3real4r a3real4ProductTransform(a3real4p v_out, const a3real4p v, const a3real4x4p m);
 
 // A3: Calculate transformed vector as 4x3 (faster than full 4x4); right-handed.
 //	param v_out: output transformed vector
 //	param m: matrix by which to transform vector
 //	param v: input vector to transform
 //	return: v_out
-A3_INLINE a3real4r a3real4TransformProduct(a3real4p v_out, const a3real4x4p m, const a3real4p v);
+A3DM_INLINE a3real4r a3real4TransformProduct(a3real4p v_out, const a3real4x4p m, const a3real4p v);
 
 // A3: Concatenate/multiply/transform vectors as 4x3; left-handed.
 //	param v_inout: vector to transform and store
 //	param m: matrix by which to transform vector
 //	return: v_inout
-A3_INLINE a3real4r a3real4MulTransform(a3real4p v_inout, const a3real4x4p m);
+A3DM_INLINE a3real4r a3real4MulTransform(a3real4p v_inout, const a3real4x4p m);
 
 // A3: Concatenate/multiply/transform vectors as 4x3; right-handed.
 //	param m: matrix by which to transform vector
 //	param v_inout: vector to transform and store
 //	return: v_inout
-A3_INLINE a3real4r a3real4TransformMul(const a3real4x4p m, a3real4p v_inout);
+A3DM_INLINE a3real4r a3real4TransformMul(const a3real4x4p m, a3real4p v_inout);
 
 // A3: Calculate matrix product as 4x3 (faster than full 4x4).
 //	param m_out: output matrix, product
 //	param mL: input left matrix
 //	param mR: input right matrix
 //	return m_out
-A3_INLINE a3real4x4r a3real4x4ProductTransform(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR);
+A3DM_INLINE a3real4x4r a3real4x4ProductTransform(a3real4x4p m_out, const a3real4x4p mL, const a3real4x4p mR);
 
 // A3: Concatenate matrix as 4x3; left-handed.
 //	param mL_inout: matrix to concatinate and store
 //	param mR: input right matrix
 //	return mL_inout
-A3_INLINE a3real4x4r a3real4x4MulTransform(a3real4x4p mL_inout, const a3real4x4p mR);
+A3DM_INLINE a3real4x4r a3real4x4MulTransform(a3real4x4p mL_inout, const a3real4x4p mR);
 
 // A3: Concatenate matrix as 4x3; right-handed.
 //	param mL: input left matrix
 //	param mR_inout: matrix to concatinate and store
 //	return mR_inout
-A3_INLINE a3real4x4r a3real4x4TransformMul(const a3real4x4p mL, a3real4x4p mR_inout);
+A3DM_INLINE a3real4x4r a3real4x4TransformMul(const a3real4x4p mL, a3real4x4p mR_inout);
 
 
 // A3: Calculate inverse of matrix as transform (faster than full 4x4).
 //	param m_out: output matrix inverse
 //	param m: matrix of which to calculate inverse
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4TransformInverse(a3real4x4p m_out, const a3real4x4p m);
+A3DM_INLINE a3real4x4r a3real4x4TransformInverse(a3real4x4p m_out, const a3real4x4p m);
 
 // A3: Calculate inverse of matrix as transform; assumes no scale because 
 //		it's fastest to ignore scale.
 //	param m_out: output matrix inverse
 //	param m: matrix of which to calculate inverse
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4TransformInverseIgnoreScale(a3real4x4p m_out, const a3real4x4p m);
+A3DM_INLINE a3real4x4r a3real4x4TransformInverseIgnoreScale(a3real4x4p m_out, const a3real4x4p m);
 
 // A3: Calculate inverse of matrix as transform; assumes uniform scale because 
 //		it's faster than the complete inverse.
 //	param m_out: output matrix inverse
 //	param m: matrix of which to calculate inverse
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4TransformInverseUniformScale(a3real4x4p m_out, const a3real4x4p m);
+A3DM_INLINE a3real4x4r a3real4x4TransformInverseUniformScale(a3real4x4p m_out, const a3real4x4p m);
 
 // A3: Invert matrix as transform (faster than full 4x4).
 //	param m_inout: matrix to invert and store
 //	return: m_inout
-A3_INLINE a3real4x4r a3real4x4TransformInvert(a3real4x4p m_inout);
+A3DM_INLINE a3real4x4r a3real4x4TransformInvert(a3real4x4p m_inout);
 
 // A3: Invert matrix as transform; assumes no scale because 
 //		it's fastest to ignore scale.
 //	param m_inout: matrix to invert and store
 //	return: m_inout
-A3_INLINE a3real4x4r a3real4x4TransformInvertIgnoreScale(a3real4x4p m_inout);
+A3DM_INLINE a3real4x4r a3real4x4TransformInvertIgnoreScale(a3real4x4p m_inout);
 
 // A3: Invert matrix as transform; assumes uniform scale because 
 //		it's faster than the complete inverse.
 //	param m_inout: matrix to invert and store
 //	return: m_inout
-A3_INLINE a3real4x4r a3real4x4TransformInvertUniformScale(a3real4x4p m_inout);
+A3DM_INLINE a3real4x4r a3real4x4TransformInvertUniformScale(a3real4x4p m_inout);
 
 
 // A3: Prepare a 3D "look-at" matrix given "center" and "target".
@@ -1070,7 +1070,7 @@ A3_INLINE a3real4x4r a3real4x4TransformInvertUniformScale(a3real4x4p m_inout);
 //	param targetPos: target reference position (looking at); cannot equal eyePos
 //	param worldUpVec: constant 'up' vector for complete transform; not zero vec
 //	return: m_out
-A3_INLINE a3real3x3r a3real3x3MakeLookAt(a3real3x3p m_out, a3real3x3p mInv_out_opt, const a3real3p eyePos, const a3real3p targetPos, const a3real3p worldUpVec);
+A3DM_INLINE a3real3x3r a3real3x3MakeLookAt(a3real3x3p m_out, a3real3x3p mInv_out_opt, const a3real3p eyePos, const a3real3p targetPos, const a3real3p worldUpVec);
 
 // A3: Prepare a "look-at" transform given "center" and "target", stores 
 //		refernce position (eyePos) as translation.
@@ -1080,7 +1080,7 @@ A3_INLINE a3real3x3r a3real3x3MakeLookAt(a3real3x3p m_out, a3real3x3p mInv_out_o
 //	param targetPos: target reference position (looking at); cannot equal eyePos
 //	param worldUpVec: constant 'up' vector for complete transform; not zero vec
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4MakeLookAt(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real3p eyePos, const a3real3p targetPos, const a3real3p worldUpVec);
+A3DM_INLINE a3real4x4r a3real4x4MakeLookAt(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real3p eyePos, const a3real3p targetPos, const a3real3p worldUpVec);
 
 
 // A3: Perspective projection matrix using vertical field of view.
@@ -1091,7 +1091,7 @@ A3_INLINE a3real4x4r a3real4x4MakeLookAt(a3real4x4p m_out, a3real4x4p mInv_out_o
 //	param nearDist: distance to near plane; must be greater than zero
 //	param farDist: distance to far plane; must be greater than nearDist
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4MakePerspectiveProjection(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real fovyDegrees, const a3real aspect, const a3real nearDist, const a3real farDist);
+A3DM_INLINE a3real4x4r a3real4x4MakePerspectiveProjection(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real fovyDegrees, const a3real aspect, const a3real nearDist, const a3real farDist);
 
 // A3: Perspective projection matrix using clipping plane distances.
 //	param m_out: output projection matrix
@@ -1103,7 +1103,7 @@ A3_INLINE a3real4x4r a3real4x4MakePerspectiveProjection(a3real4x4p m_out, a3real
 //	param nearDist: distance to near plane; must be greater than zero
 //	param farDist: distance to far plane; must be greater than nearDist
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4MakePerspectiveProjectionPlanes(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real rightDist, const a3real leftDist, const a3real topDist, const a3real bottomDist, const a3real nearDist, const a3real farDist);
+A3DM_INLINE a3real4x4r a3real4x4MakePerspectiveProjectionPlanes(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real rightDist, const a3real leftDist, const a3real topDist, const a3real bottomDist, const a3real nearDist, const a3real farDist);
 
 
 // A3: Orthographic projection matrix using viewport dimensions.
@@ -1114,7 +1114,7 @@ A3_INLINE a3real4x4r a3real4x4MakePerspectiveProjectionPlanes(a3real4x4p m_out,
 //	param nearDist: distance to near plane; cannot equal farDist
 //	param farDist: distance to far plane; cannot equal nearDist
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4MakeOrthographicProjection(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real width, const a3real height, const a3real nearDist, const a3real farDist);
+A3DM_INLINE a3real4x4r a3real4x4MakeOrthographicProjection(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real width, const a3real height, const a3real nearDist, const a3real farDist);
 
 // A3: Orthographic projection matrix using clipping plane distances.
 //	param m_out: output projection matrix
@@ -1126,7 +1126,7 @@ A3_INLINE a3real4x4r a3real4x4MakeOrthographicProjection(a3real4x4p m_out, a3rea
 //	param nearDist: distance to near plane; cannot equal farDist
 //	param farDist: distance to far plane; cannot equal nearDist
 //	return: m_out
-A3_INLINE a3real4x4r a3real4x4MakeOrthographicProjectionPlanes(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real rightDist, const a3real leftDist, const a3real topDist, const a3real bottomDist, const a3real nearDist, const a3real farDist);
+A3DM_INLINE a3real4x4r a3real4x4MakeOrthographicProjectionPlanes(a3real4x4p m_out, a3real4x4p mInv_out_opt, const a3real rightDist, const a3real leftDist, const a3real topDist, const a3real bottomDist, const a3real nearDist, const a3real farDist);
 
 
 // A3: Convert monoscopic projection to stereo projections.
@@ -1140,34 +1140,86 @@ A3_INLINE a3real4x4r a3real4x4MakeOrthographicProjectionPlanes(a3real4x4p m_out,
 //	param convergenceDist: distance to convergence/focus plane; must be 
 //		greater than zero for perspective projections
 //	return: mR_out
-A3_INLINE a3real4x4r a3real4x4ConvertProjectionToStereo(a3real4x4p mL_out, a3real4x4p mR_out, a3real4x4p mInvL_out_opt, a3real4x4p mInvR_out_opt, const a3real4x4p mono, const a3real4x4p monoInv_opt, const a3real interocularDist, const a3real convergenceDist);
+A3DM_INLINE a3real4x4r a3real4x4ConvertProjectionToStereo(a3real4x4p mL_out, a3real4x4p mR_out, a3real4x4p mInvL_out_opt, a3real4x4p mInvR_out_opt, const a3real4x4p mono, const a3real4x4p monoInv_opt, const a3real interocularDist, const a3real convergenceDist);
 
 
 // A3: Check if a matrix could represent a perspective projection.
 //	param m: matrix to check
 //	return: boolean describing whether matrix is possibly perspective
-A3_INLINE a3boolean a3real4x4CheckPerspective(const a3real4x4p m);
+A3DM_INLINE a3boolean a3real4x4CheckPerspective(const a3real4x4p m);
 
 // A3: Check if a matrix could represent an orthographic projection.
 //	param m: matrix to check
 //	return: boolean describing whether matrix is possibly orthographic
-A3_INLINE a3boolean a3real4x4CheckOrthographic(const a3real4x4p m);
+A3DM_INLINE a3boolean a3real4x4CheckOrthographic(const a3real4x4p m);
 
 // A3: Check if a matrix could represent a stereoscopic projection.
 //	param m: matrix to check
 //	return: boolean describing whether matrix is possibly stereoscopic
-A3_INLINE a3boolean a3real4x4CheckStereo(const a3real4x4p m);
+A3DM_INLINE a3boolean a3real4x4CheckStereo(const a3real4x4p m);
 
 
 // A3: Check if a matrix could represent a perspective stereo projection.
 //	param m: matrix to check
 //	return: 1 if yes, 0 if not perspective, -1 if perspective but not stereo
-A3_INLINE a3integer a3real4x4CheckPerspectiveStereo(const a3real4x4p m);
+A3DM_INLINE a3integer a3real4x4CheckPerspectiveStereo(const a3real4x4p m);
 
 // A3: Check if a matrix could represent an orthographic stereo projection.
 //	param m: matrix to check
 //	return: 1 if yes, 0 if not orthographic, -1 if orthographic but not stereo
-A3_INLINE a3integer a3real4x4CheckOrthographicStereo(const a3real4x4p m);
+A3DM_INLINE a3integer a3real4x4CheckOrthographicStereo(const a3real4x4p m);
+
+
+//-----------------------------------------------------------------------------
+// A3: Array (stream) utilities; process many matrices per call. With 
+//		intrinsics, inverses transpose groups of 4 matrices (8 with AVX) so 
+//		each register holds one element of every matrix in the group, with 
+//		the remainder handled one matrix at a time; products keep shared 
+//		operands in registers across the array. Outputs may alias inputs.
+//		Built from source only (A3_OPEN_SOURCE); the prebuilt library 
+//		does not have them.
+#ifdef A3_OPEN_SOURCE
+
+// A3: Calculate matrix products pairwise: m_out[i] = mL[i] * mR[i].
+//	param m_out: output array of products
+//	param mL: input array of left matrices
+//	param mR: input array of right matrices
+//	param count: number of matrices in each array
+//	return: m_out
+A3DM_INLINE a3real4x4r a3real4x4ProductArray(a3real4x4 m_out[], const a3real4x4 mL[], const a3real4x4 mR[], const a3count count);
+
+// A3: Calculate products with a shared left matrix: m_out[i] = mL * mR[i].
+//	param m_out: output array of products
+//	param mL: input left matrix used for all products
+//	param mR: input array of right matrices
+//	param count: number of matrices in each array
+//	return: m_out
+A3DM_INLINE a3real4x4r a3real4x4ProductArrayUniformL(a3real4x4 m_out[], const a3real4x4p mL, const a3real4x4 mR[], const a3count count);
+
+// A3: Calculate products with a shared right matrix: m_out[i] = mL[i] * mR.
+//	param m_out: output array of products
+//	param mL: input array of left matrices
+//	param mR: input right matrix used for all products
+//	param count: number of matrices in each array
+//	return: m_out
+A3DM_INLINE a3real4x4r a3real4x4ProductArrayUniformR(a3real4x4 m_out[], const a3real4x4 mL[], const a3real4x4p mR, const a3count count);
+
+// A3: Calculate inverses of affine transforms (same as transform inverse).
+//	param m_out: output array of inverses
+//	param m: input array of matrices whose bottom row is (0, 0, 0, 1)
+//	param count: number of matrices in each array
+//	return: m_out
+A3DM_INLINE a3real4x4r a3real4x4TransformInverseArray(a3real4x4 m_out[], const a3real4x4 m[], const a3count count);
+
+// A3: Calculate transposed inverses of affine transforms; the upper 3x3 of 
+//		each result is the normal matrix and its bottom row holds the 
+//		inverse translation.
+//	param m_out: output array of inverse-transposes
+//	param m: input array of matrices whose bottom row is (0, 0, 0, 1)
+//	param count: number of matrices in each array
+//	return: m_out
+A3DM_INLINE a3real4x4r a3real4x4TransformInverseTransposeArray(a3real4x4 m_out[], const a3real4x4 m[], const a3count count);
+#endif	// A3_OPEN_SOURCE
 
 
 //-----------------------------------------------------------------------------
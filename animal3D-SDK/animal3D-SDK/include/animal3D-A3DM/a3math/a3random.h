@@ -40,58 +40,187 @@ A3_BEGIN_DECL
 
 // A3: Get maximum random number.
 //	return: max random number
-A3_INLINE a3integer a3randomGetMax();
+A3DM_INLINE a3integer a3randomGetMax();
 
 // A3: Get current random seed (also last random returned).
 //	return: random seed (last random returned)
-A3_INLINE a3integer a3randomGetSeed();
+A3DM_INLINE a3integer a3randomGetSeed();
 
 // A3: Set random seed, defines new seed for random number generator.
 //	param seed: new random seed
 //	return: old random seed (last random returned)
-A3_INLINE a3integer a3randomSetSeed(const a3integer seed);
+A3DM_INLINE a3integer a3randomSetSeed(const a3integer seed);
 
 
 // A3: Quick n' dirty random number generator that's been around since the 
 //		70's; don't forget to set the seed for actual randomness.
 //	return: random integer in [0, max)
-A3_INLINE a3integer a3randomInt();
+A3DM_INLINE a3integer a3randomInt();
 
 // A3: Generate random decimal number.
 //	return: random real number in [0, max)
-A3_INLINE a3real a3random();
+A3DM_INLINE a3real a3random();
 
 // A3: Generate non-negative normalized random decimal number.
 //	return: random real number in [0, 1)
-A3_INLINE a3real a3randomNormalized();
+A3DM_INLINE a3real a3randomNormalized();
 
 // A3: Generate symmetric (bi-directional) normalized random decimal number. 
 //	return: random real number in [-1, 1)
-A3_INLINE a3real a3randomSymmetric();
+A3DM_INLINE a3real a3randomSymmetric();
 
 
 // A3: Generate non-negative ranged random decimal number.
 //	param nMax: maximum real number in range
 //	return: random real number in [0, nMax)
-A3_INLINE a3real a3randomMax(const a3real nMax);
+A3DM_INLINE a3real a3randomMax(const a3real nMax);
 
 // A3: Generate non-negative ranged random integer.
 //	param nMax: maximum integer in range
 //	return: random integer in [0, nMax)
-A3_INLINE a3integer a3randomMaxInt(const a3integer nMax);
+A3DM_INLINE a3integer a3randomMaxInt(const a3integer nMax);
 
 
 // A3: Generate ranged random decimal number.
 //	param nMin: minimum real number in range
 //	param nMax: maximum real number in range
 //	return: random real number in [nMin, nMax)
-A3_INLINE a3real a3randomRange(const a3real nMin, const a3real nMax);
+A3DM_INLINE a3real a3randomRange(const a3real nMin, const a3real nMax);
 
 // A3: Generate non-negative ranged random decimal number.
 //	param nMin: minimum integer in range
 //	param nMax: maximum integer in range
 //	return: random integer in [nMin, nMax)
-A3_INLINE a3integer a3randomRangeInt(const a3integer nMin, const a3integer nMax);
+A3DM_INLINE a3integer a3randomRangeInt(const a3integer nMin, const a3integer nMax);
+
+
+//-----------------------------------------------------------------------------
+// A3: Random number streams. The functions above share one hidden seed, so 
+//	they cannot be called from parallel jobs without locking, and the order 
+//	of calls decides the results. A stream carries its own state: eight 
+//	xoshiro128** generators (Blackman & Vigna), each 2^64 draws apart, whose 
+//	outputs are interleaved; one step of all eight maps onto one AVX2 or two 
+//	SSE2 registers, so bulk fills run with intrinsics. The sequence depends 
+//	only on the seed and the number of values drawn, not on call sizes or 
+//	the instruction set (ranged reals may round differently where the 
+//	compiler fuses the scale and offset). Hand each job its own stream (see 
+//	split) and results do not depend on how many threads run the jobs. 
+//	Built from source only (A3_OPEN_SOURCE); the prebuilt library does not 
+//	have them.
+
+#ifndef __cplusplus
+typedef struct a3randomStream	a3randomStream;
+#endif	// !__cplusplus
+
+// A3: Random number stream state; no dynamic memory, copy freely.
+//	member state: generator state, word-major (state[w][g] is word w of 
+//		generator g)
+//	member block: last eight outputs, not yet all used
+//	member index: index of next unused output in block
+struct a3randomStream
+{
+	a3ui32 state[4][8];
+	a3ui32 block[8];
+	a3ui32 index;
+};
+
+#ifdef A3_OPEN_SOURCE
+
+// A3: Initialize stream from seed.
+//	param stream: pointer to stream
+//	param seed: any seed, including zero
+//	return: stream
+A3DM_INLINE a3randomStream *a3randomStreamInit(a3randomStream *stream, const a3bigindex seed);
+
+// A3: Initialize stream from seed and a sequence key (e.g. agent or chunk 
+//		index) without jumping; keys are hashed into the seed, so streams 
+//		are independent for practical purposes but not provably disjoint; 
+//		use split for guaranteed disjoint sub-streams.
+//	param stream: pointer to stream
+//	param seed: any seed, including zero
+//	param sequence: sequence key
+//	return: stream
+A3DM_INLINE a3randomStream *a3randomStreamInitSequence(a3randomStream *stream, const a3bigindex seed, const a3bigindex sequence);
+
+// A3: Jump stream ahead by 2^96 draws per generator, starting a sub-stream 
+//		that never overlaps the one left behind (2^32 sub-streams).
+//	param stream: pointer to stream
+//	return: stream
+A3DM_INLINE a3randomStream *a3randomStreamJump(a3randomStream *stream);
+
+// A3: Split a sub-stream off a stream: the output takes the current 
+//		sub-stream and the source jumps to the next; call once per job, in 
+//		job order, from a single thread.
+//	param stream_out: pointer to stream receiving current sub-stream
+//	param stream: pointer to source stream
+//	return: stream_out
+A3DM_INLINE a3randomStream *a3randomStreamSplit(a3randomStream *stream_out, a3randomStream *stream);
+
+
+// A3: Draw random 32-bit integer from stream.
+//	param stream: pointer to stream
+//	return: random integer in [0, 2^32)
+A3DM_INLINE a3ui32 a3randomStreamInt(a3randomStream *stream);
+
+// A3: Draw non-negative normalized random decimal number from stream.
+//	param stream: pointer to stream
+//	return: random real number in [0, 1)
+A3DM_INLINE a3real a3randomStreamNormalized(a3randomStream *stream);
+
+// A3: Draw symmetric normalized random decimal number from stream.
+//	param stream: pointer to stream
+//	return: random real number in [-1, 1)
+A3DM_INLINE a3real a3randomStreamSymmetric(a3randomStream *stream);
+
+// A3: Draw ranged random decimal number from stream.
+//	param stream: pointer to stream
+//	param nMin: minimum real number in range
+//	param nMax: maximum real number in range
+//	return: random real number in [nMin, nMax)
+A3DM_INLINE a3real a3randomStreamRange(a3randomStream *stream, const a3real nMin, const a3real nMax);
+
+// A3: Draw ranged random integer from stream.
+//	param stream: pointer to stream
+//	param nMin: minimum integer in range (inclusive)
+//	param nMax: upper bound of range (exclusive)
+//	return: random integer in [nMin, nMax), nMin if range is empty
+A3DM_INLINE a3integer a3randomStreamRangeInt(a3randomStream *stream, const a3integer nMin, const a3integer nMax);
+
+
+// A3: Fill array with random 32-bit integers from stream; same values as 
+//		the same number of single draws.
+//	param values_out: array of values to fill
+//	param stream: pointer to stream
+//	param count: number of values
+//	return: count if success, zero if invalid params
+A3DM_INLINE a3count a3randomStreamFillInt(a3ui32 values_out[], a3randomStream *stream, const a3count count);
+
+// A3: Fill array with non-negative normalized random decimal numbers from 
+//		stream; same values as the same number of single draws.
+//	param values_out: array of values to fill, each in [0, 1)
+//	param stream: pointer to stream
+//	param count: number of values
+//	return: count if success, zero if invalid params
+A3DM_INLINE a3count a3randomStreamFillNormalized(a3real values_out[], a3randomStream *stream, const a3count count);
+
+// A3: Fill array with symmetric normalized random decimal numbers from 
+//		stream; same values as the same number of single draws.
+//	param values_out: array of values to fill, each in [-1, 1)
+//	param stream: pointer to stream
+//	param count: number of values
+//	return: count if success, zero if invalid params
+A3DM_INLINE a3count a3randomStreamFillSymmetric(a3real values_out[], a3randomStream *stream, const a3count count);
+
+// A3: Fill array with ranged random decimal numbers from stream; same 
+//		values as the same number of single draws.
+//	param values_out: array of values to fill, each in [nMin, nMax)
+//	param stream: pointer to stream
+//	param count: number of values
+//	param nMin: minimum real number in range
+//	param nMax: maximum real number in range
+//	return: count if success, zero if invalid params
+A3DM_INLINE a3count a3randomStreamFillRange(a3real values_out[], a3randomStream *stream, const a3count count, const a3real nMin, const a3real nMax);
+#endif	// A3_OPEN_SOURCE
 
 
 //-----------------------------------------------------------------------------
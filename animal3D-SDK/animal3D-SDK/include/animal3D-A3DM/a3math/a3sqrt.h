@@ -38,38 +38,47 @@ A3_BEGIN_DECL
 
 //-----------------------------------------------------------------------------
 
+// A3: Precise square roots are exported by the precompiled library; they are 
+//		inline with everything else when built from source.
+#ifdef A3_OPEN_SOURCE
+#define A3_SQRT_EXTERN	A3DM_INLINE
+#else	// !A3_OPEN_SOURCE
+#define A3_SQRT_EXTERN	extern
+#endif	// A3_OPEN_SOURCE
+
+
 // A3: Compute fast square root using Quake's method ("0x5f3759df") using 
 //		Newton's approximation method. Note: only works with float precision.
 //	param x: number to square root
 //	return: approximate square root of x
-A3_INLINE a3f32 a3sqrtf0x(const a3f32 x);
+A3DM_INLINE a3f32 a3sqrtf0x(const a3f32 x);
 
 // A3: Compute fast inverse square root using Quake's method and Newton's 
 //		approximation method.
 //	param x: number to square root and invert
 //	return: approximate inverse (reciprocal) square root of x
-A3_INLINE a3f32 a3sqrtf0xInverse(const a3f32 x);
+A3DM_INLINE a3f32 a3sqrtf0xInverse(const a3f32 x);
 
 
 // A3: Fast and precise square root for floats.
 //	param x: number to square root
 //	return: square root of x
-extern a3f32 a3sqrtf(const a3f32 x);
+A3_SQRT_EXTERN a3f32 a3sqrtf(const a3f32 x);
 
 // A3: Fast and precise square root for doubles.
 //	param x: number to square root
 //	return: square root of x
-extern a3f64 a3sqrtd(const a3f64 x);
+A3_SQRT_EXTERN a3f64 a3sqrtd(const a3f64 x);
 
 // A3: Fast and precise inverse square root for floats.
 //	param x: number to square root
 //	return: square root of x
-extern a3f32 a3sqrtfInverse(const a3f32 x);
+A3_SQRT_EXTERN a3f32 a3sqrtfInverse(const a3f32 x);
 
 // A3: Fast and precise inverse square root for doubles.
 //	param x: number to square root
 //	return: square root of x
-extern a3f64 a3sqrtdInverse(const a3f64 x);
+A3_SQRT_EXTERN a3f64 a3sqrtdInverse(const a3f64 x);
 
 
 // A3: Macros for generalizing square root based on active real type.
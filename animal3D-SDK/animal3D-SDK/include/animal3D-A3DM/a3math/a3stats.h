@@ -36,32 +36,33 @@ A3_BEGIN_DECL
 
 
 //-----------------------------------------------------------------------------
-// median, mean, variance, standard deviation (with options to return mean)
+// median, mean, variance, standard deviation (with options to return mean); 
+//	real forms reduce with intrinsics when available
 
 // A3: Calculate median of real data set.
 //	param data: array of data values
 //	param n: number of elements
 //	return: median value (half of all values are greater, half are less)
-A3_INLINE a3real a3median(const a3real data[], const a3count n);
+A3DM_INLINE a3real a3median(const a3real data[], const a3count n);
 
 // A3: Calculate median of integer data set.
 //	param data: array of data values
 //	param n: number of elements
 //	return: median value (half of all values are greater, half are less)
-A3_INLINE a3real a3medianInt(const a3integer data[], const a3count n);
+A3DM_INLINE a3real a3medianInt(const a3integer data[], const a3count n);
 
 
 // A3: Calculate mean (average) of real data set.
 //	param data: array of data values
 //	param n: number of elements
 //	return: mean value (average of all values)
-A3_INLINE a3real a3mean(const a3real data[], const a3count n);
+A3DM_INLINE a3real a3mean(const a3real data[], const a3count n);
 
 // A3: Calculate mean (average) of integer data set.
 //	param data: array of data values
 //	param n: number of elements
 //	return: mean value (average of all values)
-A3_INLINE a3real a3meanInt(const a3integer data[], const a3count n);
+A3DM_INLINE a3real a3meanInt(const a3integer data[], const a3count n);
 
 
 // A3: Calculate variance of real data set.
@@ -69,14 +70,14 @@ A3_INLINE a3real a3meanInt(const a3integer data[], const a3count n);
 //	param n: number of elements
 //	param mean_out: optional pointer to store mean calculated in function
 //	return: variance (squared standard deviation)
-A3_INLINE a3real a3variance(const a3real data[], const a3count n, a3real *mean_out);
+A3DM_INLINE a3real a3variance(const a3real data[], const a3count n, a3real *mean_out);
 
 // A3: Calculate variance of integer data set.
 //	param data: array of data values
 //	param n: number of elements
 //	param mean_out: optional pointer to store mean calculated in function
 //	return: variance (squared standard deviation)
-A3_INLINE a3real a3varianceInt(const a3integer data[], const a3count n, a3real *mean_out);
+A3DM_INLINE a3real a3varianceInt(const a3integer data[], const a3count n, a3real *mean_out);
 
 
 // A3: Calculate standard deviation of real data set.
@@ -84,32 +85,185 @@ A3_INLINE a3real a3varianceInt(const a3integer data[], const a3count n, a3real *
 //	param n: number of elements
 //	param mean_out: optional pointer to store mean calculated in function
 //	return: standard deviation (average offset from mean)
-A3_INLINE a3real a3standardDeviation(const a3real data[], const a3count n, a3real *mean_out);
+A3DM_INLINE a3real a3standardDeviation(const a3real data[], const a3count n, a3real *mean_out);
 
 // A3: Calculate standard deviation of integer data set.
 //	param data: array of data values
 //	param n: number of elements
 //	param mean_out: optional pointer to store mean calculated in function
 //	return: standard deviation (average offset from mean)
-A3_INLINE a3real a3standardDeviationInt(const a3integer data[], const a3count n, a3real *mean_out);
+A3DM_INLINE a3real a3standardDeviationInt(const a3integer data[], const a3count n, a3real *mean_out);
+
+
+//-----------------------------------------------------------------------------
+// A3: Streaming statistics. The functions above need the whole data set at 
+//	once; the accumulators below take one value (or one array) at a time in 
+//	constant memory, so they can be updated every frame, and the mergeable 
+//	ones can be filled per thread and combined afterwards. Sums are kept in 
+//	double precision so long runs do not drift.
+
+#ifndef __cplusplus
+typedef struct a3statsAccumulator			a3statsAccumulator;
+typedef struct a3statsQuantileEstimator		a3statsQuantileEstimator;
+typedef struct a3statsQuantileSketch		a3statsQuantileSketch;
+#endif	// !__cplusplus
+
+// A3: Number of buckets in quantile sketch; with 1% relative accuracy the 
+//		sketch spans a range of 8e8 above its minimum value (e.g. 1 
+//		microsecond to 800 seconds).
+#define a3statsQuantileSketchBuckets	1024
+
+// A3: Running count, mean, variance and extremes (Welford's method); 
+//		mergeable (Chan, Golub & LeVeque).
+//	member count: number of values added
+//	member mean: mean of values added
+//	member m2: sum of squared differences from mean
+//	member minimum, maximum: extremes of values added
+struct a3statsAccumulator
+{
+	a3bigcount count;
+	a3f64 mean, m2;
+	a3f64 minimum, maximum;
+};
+
+// A3: Single quantile estimated with five markers (P-squared, Jain & 
+//		Chlamtac 1985); constant memory and time but not mergeable; close 
+//		for smooth distributions, but interpolates across gaps in the data 
+//		(e.g. rare spikes), where the sketch below is the safer choice.
+//	member quantile: quantile estimated, in [0, 1]
+//	member count: number of values added
+//	member height: marker heights; the first values added until five
+//	member position: marker positions (actual, desired) and desired step
+struct a3statsQuantileEstimator
+{
+	a3real quantile;
+	a3bigcount count;
+	a3f64 height[5];
+	a3f64 position[5], desired[5], step[5];
+};
+
+// A3: Histogram of positive values in logarithmic buckets (after DDSketch, 
+//		Masson, Rim & Lee 2019): any quantile is within the relative 
+//		accuracy of a value in the set; merging adds counts, so per-thread 
+//		sketches combine exactly. Values at or below the minimum share the 
+//		first bucket, values past the last bucket share the last.
+//	member bucket: count per bucket
+//	member count: number of values added
+//	member minimum, maximum: extremes of values added
+//	member minValue: lowest value resolved
+//	member logGamma: log of bucket growth factor
+struct a3statsQuantileSketch
+{
+	a3ui32 bucket[a3statsQuantileSketchBuckets];
+	a3bigcount count;
+	a3f64 minimum, maximum;
+	a3f64 minValue, logGamma;
+};
+
+
+// A3: Reset accumulator.
+//	param acc: pointer to accumulator
+//	return: acc
+A3DM_INLINE a3statsAccumulator *a3statsAccumulatorReset(a3statsAccumulator *acc);
+
+// A3: Add value to accumulator.
+//	param acc: pointer to accumulator
+//	param x: value to add
+//	return: acc
+A3DM_INLINE a3statsAccumulator *a3statsAccumulatorAdd(a3statsAccumulator *acc, const a3real x);
+
+// A3: Add array of values to accumulator; blocks are reduced with 
+//		intrinsics and merged in, matching single adds to within rounding.
+//	param acc: pointer to accumulator
+//	param data: array of data values
+//	param n: number of elements
+//	return: acc
+A3DM_INLINE a3statsAccumulator *a3statsAccumulatorAddArray(a3statsAccumulator *acc, const a3real data[], const a3count n);
+
+// A3: Merge accumulator into another, as if all values were added to it.
+//	param acc: pointer to accumulator receiving values
+//	param other: pointer to accumulator to merge
+//	return: acc
+A3DM_INLINE a3statsAccumulator *a3statsAccumulatorMerge(a3statsAccumulator *acc, const a3statsAccumulator *other);
+
+// A3: Get mean of values in accumulator.
+//	param acc: pointer to accumulator
+//	return: mean, zero if empty
+A3DM_INLINE a3real a3statsAccumulatorGetMean(const a3statsAccumulator *acc);
+
+// A3: Get variance of values in accumulator (population, as a3variance).
+//	param acc: pointer to accumulator
+//	return: variance, zero if empty
+A3DM_INLINE a3real a3statsAccumulatorGetVariance(const a3statsAccumulator *acc);
+
+// A3: Get standard deviation of values in accumulator.
+//	param acc: pointer to accumulator
+//	return: standard deviation, zero if empty
+A3DM_INLINE a3real a3statsAccumulatorGetStandardDeviation(const a3statsAccumulator *acc);
+
+
+// A3: Reset quantile estimator.
+//	param est: pointer to estimator
+//	param quantile: quantile to estimate, in [0, 1] (e.g. 0.99 for p99)
+//	return: est
+A3DM_INLINE a3statsQuantileEstimator *a3statsQuantileEstimatorReset(a3statsQuantileEstimator *est, const a3real quantile);
+
+// A3: Add value to quantile estimator.
+//	param est: pointer to estimator
+//	param x: value to add
+//	return: est
+A3DM_INLINE a3statsQuantileEstimator *a3statsQuantileEstimatorAdd(a3statsQuantileEstimator *est, const a3real x);
+
+// A3: Get estimated quantile; exact (nearest rank) until five values.
+//	param est: pointer to estimator
+//	return: quantile estimate, zero if empty
+A3DM_INLINE a3real a3statsQuantileEstimatorGet(const a3statsQuantileEstimator *est);
+
+
+// A3: Reset quantile sketch.
+//	param sketch: pointer to sketch
+//	param relativeAccuracy: relative error bound of quantiles, in (0, 1) 
+//		(e.g. 0.01); sets the range covered by the buckets
+//	param minValue: lowest positive value resolved
+//	return: sketch if success, null if invalid params
+A3DM_INLINE a3statsQuantileSketch *a3statsQuantileSketchReset(a3statsQuantileSketch *sketch, const a3real relativeAccuracy, const a3real minValue);
+
+// A3: Add value to quantile sketch.
+//	param sketch: pointer to sketch
+//	param x: value to add
+//	return: sketch
+A3DM_INLINE a3statsQuantileSketch *a3statsQuantileSketchAdd(a3statsQuantileSketch *sketch, const a3real x);
+
+// A3: Merge quantile sketch into another reset with the same parameters.
+//	param sketch: pointer to sketch receiving values
+//	param other: pointer to sketch to merge
+//	return: sketch if success, null if parameters differ
+A3DM_INLINE a3statsQuantileSketch *a3statsQuantileSketchMerge(a3statsQuantileSketch *sketch, const a3statsQuantileSketch *other);
+
+// A3: Get quantile from sketch (nearest rank); quantiles zero and one are 
+//		the exact extremes.
+//	param sketch: pointer to sketch
+//	param quantile: quantile to get, in [0, 1] (e.g. 0.5 for p50)
+//	return: quantile, zero if empty
+A3DM_INLINE a3real a3statsQuantileSketchGet(const a3statsQuantileSketch *sketch, const a3real quantile);
 
 
 // A3: Calculate factorial of number.
 //	param n: number
 //	return: factorial of n (n!)
-A3_INLINE a3biginteger a3factorial(a3bigcount n);
+A3DM_INLINE a3biginteger a3factorial(a3bigcount n);
 
 // A3: Calculate permutations (number of ways to order k elements in a set of n items).
 //	param n: set size
 //	param k: number of elements to permute (order)
 //	return: nPk (number of permutations of k elements in set of n items)
-A3_INLINE a3biginteger a3permutations(const a3bigcount n, const a3bigindex k);
+A3DM_INLINE a3biginteger a3permutations(const a3bigcount n, const a3bigindex k);
 
 // A3: Calculate combinations (number of ways to choose k elements in a set of n items).
 //	param n: set size
 //	param k: number of elements to choose
 //	return: nCk (number of combinations of k elements in set of n items)
-A3_INLINE a3biginteger a3combinations(const a3bigcount n, const a3bigindex k);
+A3DM_INLINE a3biginteger a3combinations(const a3bigcount n, const a3bigindex k);
 
 
 //-----------------------------------------------------------------------------
@@ -37,6 +37,11 @@ A3_BEGIN_DECL
 
 
 //-----------------------------------------------------------------------------
+// A3: Lookup tables. Built from source (A3_OPEN_SOURCE) a table is optional: 
+//	without one, sine and cosine are evaluated with the table-free 
+//	polynomials below; with a table set, the degree and radian sine, cosine 
+//	and tangent functions sample it instead. The prebuilt library always 
+//	samples the table, so one must be set before use.
 
 // A3: Initialize data tables for fast trigonometry.
 //	param samplesPerDegree: number of divisions in a single degree (1 or more)
@@ -47,7 +52,7 @@ A3_BEGIN_DECL
 //		the table should be (samplesPerDegree x 720 + 1) x 3
 //	return: number of values if success
 //	return: 0 if fail
-A3_INLINE a3index a3trigInit(const a3index samplesPerDegree, a3real table_out[]);
+A3DM_INLINE a3index a3trigInit(const a3index samplesPerDegree, a3real table_out[]);
 
 // A3: Set pointer to existing table and samples per degree.
 //	param samplesPerDegree: number of divisions in a single degree (1 or more)
@@ -55,17 +60,17 @@ A3_INLINE a3index a3trigInit(const a3index samplesPerDegree, a3real table_out[])
 //		(initialized using a3trigInit)
 //	return: number of values if success
 //	return: 0 if fail
-A3_INLINE a3index a3trigInitSetTables(const a3index samplesPerDegree, const a3real table[]);
+A3DM_INLINE a3index a3trigInitSetTables(const a3index samplesPerDegree, const a3real table[]);
 
 // A3: Check the number of samples that would be required for the trig table.
 //	param samplesPerDegree: desired number of divisions per degree (1 or more)
 //	return: number of values required (for pre-allocation)
-A3_INLINE a3index a3trigInitSamplesRequired(const a3index samplesPerDegree);
+A3DM_INLINE a3index a3trigInitSamplesRequired(const a3index samplesPerDegree);
 
 // A3: Delete trig data tables.
 //	return: 1 if success
 //	return: 0 if fail
-A3_INLINE a3index a3trigFree();
+A3DM_INLINE a3index a3trigFree();
 
 
 //-----------------------------------------------------------------------------
@@ -79,22 +84,22 @@ A3_INLINE a3index a3trigFree();
 // A3: Validate degree parameter for sine, cosine and tangent functions.
 //	param x: input to function in degrees
 //	return: param in valid range [-360, +360]
-A3_INLINE a3real a3trigValid_sind(a3real x);
+A3DM_INLINE a3real a3trigValid_sind(a3real x);
 
 // A3: Validate radian parameter for sine, cosine and tangent functions.
 //	param x: input to function in radians
 //	return: param in valid range [-2pi, +2pi]
-A3_INLINE a3real a3trigValid_sinr(a3real x);
+A3DM_INLINE a3real a3trigValid_sinr(a3real x);
 
 // A3: Validate parameter for inverse sine and inverse cosine functions.
 //	param x: input to function
 //	return: param in valid range [-1, +1]
-A3_INLINE a3real a3trigValid_asin(a3real x);
+A3DM_INLINE a3real a3trigValid_asin(a3real x);
 
 // A3: Validate parameter for inverse tangent function.
 //	param x: input to function
 //	return: param in valid range for maximum precision (-pi/2, +pi/2)
-A3_INLINE a3real a3trigValid_atan(a3real x);
+A3DM_INLINE a3real a3trigValid_atan(a3real x);
 
 
 //-----------------------------------------------------------------------------
@@ -112,125 +117,125 @@ A3_INLINE a3real a3trigValid_atan(a3real x);
 // A3: Sine with degree input.
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: sin(x), range [-1, +1]
-A3_INLINE a3real a3sind(const a3real x);
+A3DM_INLINE a3real a3sind(const a3real x);
 
 // A3: Cosine with degree input.
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: cos(x), range [-1, +1]
-A3_INLINE a3real a3cosd(const a3real x);
+A3DM_INLINE a3real a3cosd(const a3real x);
 
 // A3: Tangent with degree input (tan = sin/cos).
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: tan(x), range (-inf, +inf)
-A3_INLINE a3real a3tand(const a3real x);
+A3DM_INLINE a3real a3tand(const a3real x);
 
 // A3: Sine with radian input.
 //	param x: input to function in radians, domain [-2pi, +2pi]
 //	return: sin(x), range [-1, +1]
-A3_INLINE a3real a3sinr(const a3real x);
+A3DM_INLINE a3real a3sinr(const a3real x);
 
 // A3: Cosine with radian input.
 //	param x: input to function in radians, domain [-2pi, +2pi]
 //	return: cos(x), range [-1, +1]
-A3_INLINE a3real a3cosr(const a3real x);
+A3DM_INLINE a3real a3cosr(const a3real x);
 
 // A3: Tangent with radian input (tan = sin/cos).
 //	param x: input to function in radians, domain [-2pi, +2pi]
 //	return: tan(x), range (-inf, +inf)
-A3_INLINE a3real a3tanr(const a3real x);
+A3DM_INLINE a3real a3tanr(const a3real x);
 
 
 // A3: Inverse sine with degree output.
 //	param x: input to function, domain [-1, +1]
 //	return: asin(x) in degrees, range [-90, +90]
-A3_INLINE a3real a3asind(const a3real x);
+A3DM_INLINE a3real a3asind(const a3real x);
 
 // A3: Inverse cosine with degree output.
 //	param x: input to function, domain [-1, +1]
 //	return: acos(x) in degrees, range [0, +180]
-A3_INLINE a3real a3acosd(const a3real x);
+A3DM_INLINE a3real a3acosd(const a3real x);
 
 // A3: Inverse tangent with degree output.
 //	param x: input to function, domain (-inf, +inf)
 //	return: atan(x) in degrees, range (-90, +90)
-A3_INLINE a3real a3atand(const a3real x);
+A3DM_INLINE a3real a3atand(const a3real x);
 
 // A3: Inverse sine with radian output.
 //	param x: input to function, domain [-1, +1]
 //	return: asin(x) in radians, range [-pi/2, +pi/2]
-A3_INLINE a3real a3asinr(const a3real x);
+A3DM_INLINE a3real a3asinr(const a3real x);
 
 // A3: Inverse cosine with radian output.
 //	param x: input to function, domain [-1, +1]
 //	return: acos(x) in radians, range [0, +pi]
-A3_INLINE a3real a3acosr(const a3real x);
+A3DM_INLINE a3real a3acosr(const a3real x);
 
 // A3: Inverse tangent with radian output.
 //	param x: input to function, domain (-inf, +inf)
 //	return: atan(x) in radians, range [-pi/2, +pi/2]
-A3_INLINE a3real a3atanr(const a3real x);
+A3DM_INLINE a3real a3atanr(const a3real x);
 
 
 // A3: Cosecant with degree input.
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: 1/sin(x), range (-inf, -1] U [+1, +inf)
-A3_INLINE a3real a3cscd(const a3real x);
+A3DM_INLINE a3real a3cscd(const a3real x);
 
 // A3: Secant with degree input.
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: 1/cos(x), range (-inf, -1] U [+1, +inf)
-A3_INLINE a3real a3secd(const a3real x);
+A3DM_INLINE a3real a3secd(const a3real x);
 
 // A3: Cotangent with degree input (cot = cos/sin).
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: 1/tan(x), range (-inf, +inf)
-A3_INLINE a3real a3cotd(const a3real x);
+A3DM_INLINE a3real a3cotd(const a3real x);
 
 // A3: Cosecant with radian input.
 //	param x: input to function in degrees, domain [-2pi, +2pi]
 //	return: 1/sin(x), range (-inf, -1] U [+1, +inf)
-A3_INLINE a3real a3cscr(const a3real x);
+A3DM_INLINE a3real a3cscr(const a3real x);
 
 // A3: Secant with radian input.
 //	param x: input to function in degrees, domain [-2pi, +2pi]
 //	return: 1/cos(x), range (-inf, -1] U [+1, +inf)
-A3_INLINE a3real a3secr(const a3real x);
+A3DM_INLINE a3real a3secr(const a3real x);
 
 // A3: Cotangent with degree input (cot = cos/sin).
 //	param x: input to function in degrees, domain [-2pi, +2pi]
 //	return: 1/tan(x), range (-inf, +inf)
-A3_INLINE a3real a3cotr(const a3real x);
+A3DM_INLINE a3real a3cotr(const a3real x);
 
 
 // A3: Inverse cosecant with degree output.
 //	param x: input to function, domain (-inf, -1] U [+1, +inf)
 //	return: acsc(x) in degrees, range (-90, +90)
-A3_INLINE a3real a3acscd(const a3real x);
+A3DM_INLINE a3real a3acscd(const a3real x);
 
 // A3: Inverse secant with degree output.
 //	param x: input to function, domain (-inf, -1] U [+1, +inf)
 //	return: asec(x) in degrees, range (0, +180)
-A3_INLINE a3real a3asecd(const a3real x);
+A3DM_INLINE a3real a3asecd(const a3real x);
 
 // A3: Inverse cotangent with degree output.
 //	param x: input to function, domain (-inf, +inf)
 //	return: acot(x) in degrees, range (-90, +90)
-A3_INLINE a3real a3acotd(const a3real x);
+A3DM_INLINE a3real a3acotd(const a3real x);
 
 // A3: Inverse cosecant with degree output.
 //	param x: input to function, domain (-inf, -1] U [+1, +inf)
 //	return: acsc(x) in degrees, range (-pi/2, +pi/2)
-A3_INLINE a3real a3acscr(const a3real x);
+A3DM_INLINE a3real a3acscr(const a3real x);
 
 // A3: Inverse secant with degree output.
 //	param x: input to function, domain (-inf, -1] U [+1, +inf)
 //	return: asec(x) in degrees, range (0, +pi)
-A3_INLINE a3real a3asecr(const a3real x);
+A3DM_INLINE a3real a3asecr(const a3real x);
 
 // A3: Inverse cotangent with degree output.
 //	param x: input to function, domain (-inf, +inf)
 //	return: acot(x) in degrees, range (-pi/2, +pi/2)
-A3_INLINE a3real a3acotr(const a3real x);
+A3DM_INLINE a3real a3acotr(const a3real x);
 
 
 // A3: Inverse tangent with degree output using two parameters; since 
@@ -238,69 +243,169 @@ A3_INLINE a3real a3acotr(const a3real x);
 //	param y: numerator used to calculate tangent
 //	param x: denominator used to calculate tangent
 //	return: atan(y/x) in degrees, range (-90, +90)
-A3_INLINE a3real a3atan2d(const a3real y, const a3real x);
+A3DM_INLINE a3real a3atan2d(const a3real y, const a3real x);
 
 // A3: Inverse tangent with radian output using two parameters; since 
 //		tan(a) = y/x, breaks down inverse solution depending on y and x.
 //	param y: numerator used to calculate tangent
 //	param x: denominator used to calculate tangent
 //	return: atan(y/x) in radians, range (-pi/2, +pi/2)
-A3_INLINE a3real a3atan2r(const a3real y, const a3real x);
+A3DM_INLINE a3real a3atan2r(const a3real y, const a3real x);
 
 
 // A3: Set number of iterations in a Taylor series for solving trig functions.
 //	param n: number of iterations
 //	return: old number of iterations
-A3_INLINE a3index a3trigSetTaylorIterations(const a3index n);
+A3DM_INLINE a3index a3trigSetTaylorIterations(const a3index n);
 
 // A3: Get number of iterations in a Taylor series for solving trig functions.
 //	return: number of iterations
-A3_INLINE a3index a3trigGetTaylorIterations();
+A3DM_INLINE a3index a3trigGetTaylorIterations();
 
 
 // A3: Calculate sine using a Taylor series given degree input.
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: sin(x), range [-1, +1]
-A3_INLINE a3real a3sindTaylor(const a3real x);
+A3DM_INLINE a3real a3sindTaylor(const a3real x);
 
 // A3: Calculate cosine using a Taylor series given degree input.
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: cos(x), range [-1, +1]
-A3_INLINE a3real a3cosdTaylor(const a3real x);
+A3DM_INLINE a3real a3cosdTaylor(const a3real x);
 
 // A3: Calculate tangent using a Taylor series given degree input.
 //	param x: input to function in degrees, domain [-360, +360]
 //	return: tan(x), range [-1, +1]
-A3_INLINE a3real a3tandTaylor(const a3real x);
+A3DM_INLINE a3real a3tandTaylor(const a3real x);
 
 // A3: Calculate sine using a Taylor series given radian input.
 //	param x: input to function in degrees, domain [-2pi, +2pi]
 //	return: sin(x), range [-1, +1]
-A3_INLINE a3real a3sinrTaylor(const a3real x);
+A3DM_INLINE a3real a3sinrTaylor(const a3real x);
 
 // A3: Calculate cosine using a Taylor series given radian input.
 //	param x: input to function in degrees, domain [-2pi, +2pi]
 //	return: cos(x), range [-1, +1]
-A3_INLINE a3real a3cosrTaylor(const a3real x);
+A3DM_INLINE a3real a3cosrTaylor(const a3real x);
 
 // A3: Calculate tangent using a Taylor series given radian input.
 //	param x: input to function in degrees, domain [-2pi, +2pi]
 //	return: tan(x), range [-1, +1]
-A3_INLINE a3real a3tanrTaylor(const a3real x);
+A3DM_INLINE a3real a3tanrTaylor(const a3real x);
 
 // A3: Calculate sine and cosine using a Taylor series given degree input.
 //	param x: input to function in degrees, domain [-360, +360]
 //	param sin_out: pointer to value to store sine result, range [-1, +1]
 //	param cos_out: pointer to value to store cosine result, range [-1, +1]
 //	return: x (original input for reuse)
-A3_INLINE a3real a3trigTaylor_sind_cosd(const a3real x, a3real *sin_out, a3real *cos_out);
+A3DM_INLINE a3real a3trigTaylor_sind_cosd(const a3real x, a3real *sin_out, a3real *cos_out);
 
 // A3: Calculate sine and cosine using a Taylor series given radian input.
 //	param x: input to function in radians, domain [-2pi, +2pi]
 //	param sin_out: pointer to value to store sine result, range [-1, +1]
 //	param cos_out: pointer to value to store cosine result, range [-1, +1]
 //	return: x (original input for reuse)
-A3_INLINE a3real a3trigTaylor_sinr_cosr(const a3real x, a3real *sin_out, a3real *cos_out);
+A3DM_INLINE a3real a3trigTaylor_sinr_cosr(const a3real x, a3real *sin_out, a3real *cos_out);
+
+
+//-----------------------------------------------------------------------------
+// A3: Table-free polynomial trigonometry. Inputs are reduced to an octant 
+//	(sine, cosine: quarter turns about zero; arctangent: ratios in [0, 1]) 
+//	and evaluated with minimax polynomials, so any input is accepted and no 
+//	table or global state is touched; safe to call from any thread. Array 
+//	variants process 4 values at a time with intrinsics (8 with AVX) and 
+//	match the single-value functions to within rounding. Built from source 
+//	only (A3_OPEN_SOURCE); the prebuilt library does not have them.
+
+#ifndef __cplusplus
+typedef enum a3trigAccuracy	a3trigAccuracy;
+#endif	// !__cplusplus
+
+// A3: Accuracy tiers for polynomial trigonometry; absolute error against 
+//		double precision for float inputs up to a few thousand degrees.
+//		The full-tier sine and cosine bound assumes separately rounded 
+//		multiplies and adds; if the compiler contracts them into fused 
+//		multiply-adds (e.g. gcc's default -ffp-contract=fast on FMA targets) 
+//		the bound is 1.2e-6 instead.
+enum a3trigAccuracy
+{
+	a3trigAccuracy_full,	// sine, cosine within 2e-7 (1.2e-6 contracted); arctangent within 3e-7 radians
+	a3trigAccuracy_fast		// sine, cosine within 2e-5; arctangent within 2e-5 radians
+};
+
+#ifdef A3_OPEN_SOURCE
+
+// A3: Calculate sine and cosine using polynomials given radian input.
+//	param x: input to function in radians
+//	param accuracy: accuracy tier
+//	param sin_out: pointer to value to store sine result (null to skip)
+//	param cos_out: pointer to value to store cosine result (null to skip)
+//	return: x (original input for reuse)
+A3DM_INLINE a3real a3trigPoly_sinr_cosr(const a3real x, const a3trigAccuracy accuracy, a3real *sin_out, a3real *cos_out);
+
+// A3: Calculate sine and cosine using polynomials given degree input.
+//	param x: input to function in degrees
+//	param accuracy: accuracy tier
+//	param sin_out: pointer to value to store sine result (null to skip)
+//	param cos_out: pointer to value to store cosine result (null to skip)
+//	return: x (original input for reuse)
+A3DM_INLINE a3real a3trigPoly_sind_cosd(const a3real x, const a3trigAccuracy accuracy, a3real *sin_out, a3real *cos_out);
+
+// A3: Calculate two-parameter inverse tangent using polynomials; a zero 
+//		denominator is taken to be positive regardless of sign.
+//	param y: numerator used to calculate tangent
+//	param x: denominator used to calculate tangent
+//	param accuracy: accuracy tier
+//	return: atan2(y, x) in radians, range [-pi, +pi]
+A3DM_INLINE a3real a3trigPoly_atan2r(const a3real y, const a3real x, const a3trigAccuracy accuracy);
+
+// A3: Calculate two-parameter inverse tangent using polynomials.
+//	param y: numerator used to calculate tangent
+//	param x: denominator used to calculate tangent
+//	param accuracy: accuracy tier
+//	return: atan2(y, x) in degrees, range [-180, +180]
+A3DM_INLINE a3real a3trigPoly_atan2d(const a3real y, const a3real x, const a3trigAccuracy accuracy);
+
+// A3: Calculate sine and cosine of an array of radian inputs.
+//	param sin_out: output array of sines (null to skip)
+//	param cos_out: output array of cosines (null to skip)
+//	param x: input array in radians
+//	param count: number of values in each array
+//	param accuracy: accuracy tier
+//	return: count if success
+//	return: 0 if fail
+A3DM_INLINE a3index a3trigPolyArray_sinr_cosr(a3real sin_out[], a3real cos_out[], const a3real x[], const a3count count, const a3trigAccuracy accuracy);
+
+// A3: Calculate sine and cosine of an array of degree inputs.
+//	param sin_out: output array of sines (null to skip)
+//	param cos_out: output array of cosines (null to skip)
+//	param x: input array in degrees
+//	param count: number of values in each array
+//	param accuracy: accuracy tier
+//	return: count if success
+//	return: 0 if fail
+A3DM_INLINE a3index a3trigPolyArray_sind_cosd(a3real sin_out[], a3real cos_out[], const a3real x[], const a3count count, const a3trigAccuracy accuracy);
+
+// A3: Calculate two-parameter inverse tangent of arrays, radian output.
+//	param atan2_out: output array of angles in radians
+//	param y: input array of numerators
+//	param x: input array of denominators
+//	param count: number of values in each array
+//	param accuracy: accuracy tier
+//	return: count if success
+//	return: 0 if fail
+A3DM_INLINE a3index a3trigPolyArray_atan2r(a3real atan2_out[], const a3real y[], const a3real x[], const a3count count, const a3trigAccuracy accuracy);
+
+// A3: Calculate two-parameter inverse tangent of arrays, degree output.
+//	param atan2_out: output array of angles in degrees
+//	param y: input array of numerators
+//	param x: input array of denominators
+//	param count: number of values in each array
+//	param accuracy: accuracy tier
+//	return: count if success
+//	return: 0 if fail
+A3DM_INLINE a3index a3trigPolyArray_atan2d(a3real atan2_out[], const a3real y[], const a3real x[], const a3count count, const a3trigAccuracy accuracy);
+#endif	// A3_OPEN_SOURCE
 
 
 //-----------------------------------------------------------------------------
@@ -315,13 +420,13 @@ A3_INLINE a3real a3trigTaylor_sinr_cosr(const a3real x, a3real *sin_out, a3real
 //	param totalAzimuth: arc coverage of circle in degrees, [0, 360]
 //	param numSlices: number of slices in discrete circle
 //	return: ratio of real to discrete circle size
-A3_INLINE a3real a3trigPointToEdgeRatio(const a3real totalAzimuth, const a3count numSlices);
+A3DM_INLINE a3real a3trigPointToEdgeRatio(const a3real totalAzimuth, const a3count numSlices);
 
 // A3: Calculate the size ratio of a discrete to real circle.
 //	param totalAzimuth: arc coverage of circle in degrees, [0, 360]
 //	param numSlices: number of slices in discrete circle
 //	return: ratio of discrete to real circle size
-A3_INLINE a3real a3trigEdgeToPointRatio(const a3real totalAzimuth, const a3count numSlices);
+A3DM_INLINE a3real a3trigEdgeToPointRatio(const a3real totalAzimuth, const a3count numSlices);
 
 // A3: Calculate the size ratio of a real to discrete sphere.
 //	param totalAzimuth: azimuth coverage of sphere in degrees, [0, 360]
@@ -329,7 +434,7 @@ A3_INLINE a3real a3trigEdgeToPointRatio(const a3real totalAzimuth, const a3count
 //	param numSlices: number of slices in discrete sphere (azimuth divisions)
 //	param numStacks: number of stacks in discrete sphere (elevation divisions)
 //	return: ratio of real to discrete sphere size
-A3_INLINE a3real a3trigPointToFaceRatio(const a3real totalAzimuth, const a3real totalElevation, const a3count numSlices, const a3count numStacks);
+A3DM_INLINE a3real a3trigPointToFaceRatio(const a3real totalAzimuth, const a3real totalElevation, const a3count numSlices, const a3count numStacks);
 
 // A3: Calculate the size ratio of a discrete to real sphere.
 //	param totalAzimuth: azimuth coverage of sphere in degrees, [0, 360]
@@ -337,7 +442,7 @@ A3_INLINE a3real a3trigPointToFaceRatio(const a3real totalAzimuth, const a3real
 //	param numSlices: number of slices in discrete sphere (azimuth divisions)
 //	param numStacks: number of stacks in discrete sphere (elevation divisions)
 //	return: ratio of discrete to real sphere size
-A3_INLINE a3real a3trigFaceToPointRatio(const a3real totalAzimuth, const a3real totalElevation, const a3count numSlices, const a3count numStacks);
+A3DM_INLINE a3real a3trigFaceToPointRatio(const a3real totalAzimuth, const a3real totalElevation, const a3count numSlices, const a3count numStacks);
 
 
 //-----------------------------------------------------------------------------
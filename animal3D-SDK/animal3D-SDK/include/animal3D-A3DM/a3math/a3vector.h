@@ -169,120 +169,120 @@ union a3vec4
 //	param x: first component
 //	param y: second component
 //	return: v_out
-A3_INLINE a3real2r a3real2Set(a3real2p v_out, const a3real x, const a3real y);
+A3DM_INLINE a3real2r a3real2Set(a3real2p v_out, const a3real x, const a3real y);
 
 // A3: Initialize vector with a 2D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real2r a3real2SetReal2(a3real2p v_out, const a3real2p v);
+A3DM_INLINE a3real2r a3real2SetReal2(a3real2p v_out, const a3real2p v);
 
 // A3: Initialize vector with a 3D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real2r a3real2SetReal3(a3real2p v_out, const a3real3p v);
+A3DM_INLINE a3real2r a3real2SetReal3(a3real2p v_out, const a3real3p v);
 
 // A3: Initialize vector with 4D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real2r a3real2SetReal4(a3real2p v_out, const a3real4p v);
+A3DM_INLINE a3real2r a3real2SetReal4(a3real2p v_out, const a3real4p v);
 
 
 // A3: Calculate squared length (magnitude) of vector.
 //	param v: input vector
 //	return: squared length of vector: |v|^2
-A3_INLINE a3real a3real2LengthSquared(const a3real2p v);
+A3DM_INLINE a3real a3real2LengthSquared(const a3real2p v);
 
 // A3: Calculate inverse (reciprocal) squared length (magnitude) of vector.
 //	param v: input vector
 //	return: inverse squared length of vector: 1 / |v|^2
-A3_INLINE a3real a3real2LengthSquaredInverse(const a3real2p v);
+A3DM_INLINE a3real a3real2LengthSquaredInverse(const a3real2p v);
 
 // A3: Calculate length (magnitude) of vector.
 //	param v: input vector
 //	return: length of vector: |v|
-A3_INLINE a3real a3real2Length(const a3real2p v);
+A3DM_INLINE a3real a3real2Length(const a3real2p v);
 
 // A3: Calculate inverse (reciprocal) length (magnitude) of vector.
 //	param v: input vector
 //	return: inverse length of vector: 1 / |v|
-A3_INLINE a3real a3real2LengthInverse(const a3real2p v);
+A3DM_INLINE a3real a3real2LengthInverse(const a3real2p v);
 
 // A3: Get unit direction of vector.
 //	param v_out: output vector, direction of input: v / |v|
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real2r a3real2GetUnit(a3real2p v_out, const a3real2p v);
+A3DM_INLINE a3real2r a3real2GetUnit(a3real2p v_out, const a3real2p v);
 
 // A3: Normalize vector, making it unit length (direction).
 //	param v_inout: vector to normalize: v /= |v|
 //	return: v_inout
-A3_INLINE a3real2r a3real2Normalize(a3real2p v_inout);
+A3DM_INLINE a3real2r a3real2Normalize(a3real2p v_inout);
 
 // A3: Get unit direction of vector and inverse length.
 //	param v_out: output vector, direction of input: v / |v|
 //	param v: input vector
 //	param invLength_out: pointer to variable capturing inverse length: 1 / |v|
 //	return: v_out
-A3_INLINE a3real2r a3real2GetUnitInvLength(a3real2p v_out, const a3real2p v, a3real *invLength_out);
+A3DM_INLINE a3real2r a3real2GetUnitInvLength(a3real2p v_out, const a3real2p v, a3real *invLength_out);
 
 // A3: Normalize vector, making it unit length (direction), get inverse length.
 //	param v_inout: vector to normalize: v /= |v|
 //	param invLength_out: pointer to variable capturing inverse length: 1 / |v|
 //	return: v_inout
-A3_INLINE a3real2r a3real2NormalizeGetInvLength(a3real2p v_inout, a3real *invLength_out);
+A3DM_INLINE a3real2r a3real2NormalizeGetInvLength(a3real2p v_inout, a3real *invLength_out);
 
 // A3: Get negative vector.
 //	param v_out: output vector, negative of input: -v
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real2r a3real2GetNegative(a3real2p v_out, const a3real2p v);
+A3DM_INLINE a3real2r a3real2GetNegative(a3real2p v_out, const a3real2p v);
 
 // A3: Negate vector.
 //	param v_inout: vector to negate: v = -v
 //	return: v_inout
-A3_INLINE a3real2r a3real2Negate(a3real2p v_inout);
+A3DM_INLINE a3real2r a3real2Negate(a3real2p v_inout);
 
 
 // A3: Calculate dot product (relative alignment) of two vectors.
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: dot product: vL dot vR
-A3_INLINE a3real a3real2Dot(const a3real2p vL, const a3real2p vR);
+A3DM_INLINE a3real a3real2Dot(const a3real2p vL, const a3real2p vR);
 
 // A3: Calculate squared distance between two vectors.
 //	param v0: input first vector
 //	param v1: input second vector
 //	return: squared distance between vectors: |v1 - v0|^2
-A3_INLINE a3real a3real2DistanceSquared(const a3real2p v0, const a3real2p v1);
+A3DM_INLINE a3real a3real2DistanceSquared(const a3real2p v0, const a3real2p v1);
 
 // A3: Calculate distance between two vectors.
 //	param v0: input first vector
 //	param v1: input second vector
 //	return: distance between vectors: |v1 - v0|
-A3_INLINE a3real a3real2Distance(const a3real2p v0, const a3real2p v1);
+A3DM_INLINE a3real a3real2Distance(const a3real2p v0, const a3real2p v1);
 
 // A3: Calculate size ratio of vector projection.
 //	param v: input vector to project
 //	param vBase: vector to project onto
 //	return: ratio of projected vector length to base vector length: 
 //		(v dot vBase) / |vBase|^2
-A3_INLINE a3real a3real2ProjRatio(const a3real2p v, const a3real2p vBase);
+A3DM_INLINE a3real a3real2ProjRatio(const a3real2p v, const a3real2p vBase);
 
 // A3: Calculate vector projection.
 //	param v_out: output of vector projection: v projected onto vBase
 //	param v: input vector to project
 //	param vBase: vector to project onto
 //	return: v_out
-A3_INLINE a3real2r a3real2Projected(a3real2p v_out, const a3real2p v, const a3real2p vBase);
+A3DM_INLINE a3real2r a3real2Projected(a3real2p v_out, const a3real2p v, const a3real2p vBase);
 
 // A3: Project vector.
 //	param v_inout: vector to project
 //	param vBase: vector to project onto
 //	return: v_inout
-A3_INLINE a3real2r a3real2Proj(a3real2p v_inout, const a3real2p vBase);
+A3DM_INLINE a3real2r a3real2Proj(a3real2p v_inout, const a3real2p vBase);
 
 // A3: Calculate vector projection and get projection ratio.
 //	param v_out: output of vector projection: v projected onto vBase
@@ -291,7 +291,7 @@ A3_INLINE a3real2r a3real2Proj(a3real2p v_inout, const a3real2p vBase);
 //	param ratio_out: pointer to variable capturing projection ratio: 
 //		(v dot vBase) / |vBase|^2
 //	return: v_out
-A3_INLINE a3real2r a3real2ProjectedGetRatio(a3real2p v_out, const a3real2p v, const a3real2p vBase, a3real *ratio_out);
+A3DM_INLINE a3real2r a3real2ProjectedGetRatio(a3real2p v_out, const a3real2p v, const a3real2p vBase, a3real *ratio_out);
 
 // A3: Project vector and get projection ratio.
 //	param v_inout: vector to project
@@ -299,85 +299,85 @@ A3_INLINE a3real2r a3real2ProjectedGetRatio(a3real2p v_out, const a3real2p v, co
 //	param ratio_out: pointer to variable capturing projection ratio: 
 //		(v dot vBase) / |vBase|^2
 //	return: v_inout
-A3_INLINE a3real2r a3real2ProjGetRatio(a3real2p v_inout, const a3real2p vBase, a3real *ratio_out);
+A3DM_INLINE a3real2r a3real2ProjGetRatio(a3real2p v_inout, const a3real2p vBase, a3real *ratio_out);
 
 // A3: Calculate sum of vectors.
 //	param v_out: output vector to store sum of two inputs
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real2r a3real2Sum(a3real2p v_out, const a3real2p vL, const a3real2p vR);
+A3DM_INLINE a3real2r a3real2Sum(a3real2p v_out, const a3real2p vL, const a3real2p vR);
 
 // A3: Calculate difference of vectors.
 //	param v_out: output vector to store difference of two inputs
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real2r a3real2Diff(a3real2p v_out, const a3real2p vL, const a3real2p vR);
+A3DM_INLINE a3real2r a3real2Diff(a3real2p v_out, const a3real2p vL, const a3real2p vR);
 
 // A3: Calculate product of vector and scalar.
 //	param v_out: output vector to store scaled vector
 //	param v: input vector to be scaled
 //	param s: scalar by which to multiply vector
 //	return: v_out
-A3_INLINE a3real2r a3real2ProductS(a3real2p v_out, const a3real2p v, const a3real s);
+A3DM_INLINE a3real2r a3real2ProductS(a3real2p v_out, const a3real2p v, const a3real s);
 
 // A3: Calculate quotient of vector and scalar.
 //	param v_out: output vector to store scaled vector
 //	param v: input vector to be scaled, numerator
 //	param s: scalar by which to divide vector, denominator
 //	return: v_out
-A3_INLINE a3real2r a3real2QuotientS(a3real2p v_out, const a3real2p v, const a3real s);
+A3DM_INLINE a3real2r a3real2QuotientS(a3real2p v_out, const a3real2p v, const a3real s);
 
 // A3: Calculate component-wise product of two vectors.
 //	param v_out: output vector to store product vector: vL * vR components
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real2r a3real2ProductComp(a3real2p v_out, const a3real2p vL, const a3real2p vR);
+A3DM_INLINE a3real2r a3real2ProductComp(a3real2p v_out, const a3real2p vL, const a3real2p vR);
 
 // A3: Calculate component-wise quotient of two vectors.
 //	param v_out: output vector to store quotient vector: vL / vR components
 //	param vL: input left side vector, numerator
 //	param vR: input right side vector, denominator
 //	return: v_out
-A3_INLINE a3real2r a3real2QuotientComp(a3real2p v_out, const a3real2p vL, const a3real2p vR);
+A3DM_INLINE a3real2r a3real2QuotientComp(a3real2p v_out, const a3real2p vL, const a3real2p vR);
 
 // A3: Add vectors and store to left operand.
 //	param vL_inout: left side vector to which to add
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real2r a3real2Add(a3real2p vL_inout, const a3real2p vR);
+A3DM_INLINE a3real2r a3real2Add(a3real2p vL_inout, const a3real2p vR);
 
 // A3: Subtract vectors and store to left operand.
 //	param vL_inout: left side vector from which to subtract
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real2r a3real2Sub(a3real2p vL_inout, const a3real2p vR);
+A3DM_INLINE a3real2r a3real2Sub(a3real2p vL_inout, const a3real2p vR);
 
 // A3: Multiply vector by scalar.
 //	param v_inout: vector to scale
 //	param s: scalar by which to multiply vector
 //	return: v_inout
-A3_INLINE a3real2r a3real2MulS(a3real2p v_inout, const a3real s);
+A3DM_INLINE a3real2r a3real2MulS(a3real2p v_inout, const a3real s);
 
 // A3: Divide vector by scalar.
 //	param v_inout: vector to scale, numerator
 //	param s: scalar by which to multiply vector, denominator
 //	return: v_inout
-A3_INLINE a3real2r a3real2DivS(a3real2p v_inout, const a3real s);
+A3DM_INLINE a3real2r a3real2DivS(a3real2p v_inout, const a3real s);
 
 // A3: Component-wise product of two vectors, store in left operand.
 //	param vL_inout: left side vector to multiply and store: vL *= vR components
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real2r a3real2MulComp(a3real2p vL_inout, const a3real2p vR);
+A3DM_INLINE a3real2r a3real2MulComp(a3real2p vL_inout, const a3real2p vR);
 
 // A3: Component-wise quotient of two vectors, store in left operand.
 //	param vL_inout: left side vector to divide and store: vL /= vR components
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real2r a3real2DivComp(a3real2p vL_inout, const a3real2p vR);
+A3DM_INLINE a3real2r a3real2DivComp(a3real2p vL_inout, const a3real2p vR);
 
 
 // A3: Linear interpolation ("LERP"): calculate linear interpolation between 
@@ -389,7 +389,7 @@ A3_INLINE a3real2r a3real2DivComp(a3real2p vL_inout, const a3real2p vR);
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real2r a3real2Lerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
+A3DM_INLINE a3real2r a3real2Lerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
 
 // A3: Normalized linear interpolation ("NLERP"): calculate lerp between 
 //		reference vectors 'v0' and 'v1' using a interpolation parameter 
@@ -401,7 +401,7 @@ A3_INLINE a3real2r a3real2Lerp(a3real2p v_out, const a3real2p v0, const a3real2p
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real2r a3real2NLerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
+A3DM_INLINE a3real2r a3real2NLerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
 
 // A3: Bi-linear interpolation: calculate lerp between each range of numbers, 
 //		[v00, v01] and [v10, v11], and then calculate lerp between the results.
@@ -413,7 +413,7 @@ A3_INLINE a3real2r a3real2NLerp(a3real2p v_out, const a3real2p v0, const a3real2
 //	param param0: parameter for interpolation within ranges (lerp)
 //	param param1: parameter for blending results of lerp (bi-lerp)
 //	return: v_out
-A3_INLINE a3real2r a3real2Bilerp(a3real2p v_out, const a3real2p v00, const a3real2p v01, const a3real2p v10, const a3real2p v11, const a3real param0, const a3real param1);
+A3DM_INLINE a3real2r a3real2Bilerp(a3real2p v_out, const a3real2p v00, const a3real2p v01, const a3real2p v10, const a3real2p v11, const a3real param0, const a3real param1);
 
 // A3: Tri-linear interpolation: calculate bi-lerp between each set of ranges, 
 //		then lerp between the results.
@@ -430,7 +430,7 @@ A3_INLINE a3real2r a3real2Bilerp(a3real2p v_out, const a3real2p v00, const a3rea
 //	param param1: parameter for blending in sets 000-011 and 100-111 (bi-lerp)
 //	param param2: parameter for blending results of bi-lerp (tri-lerp)
 //	return: v_out
-A3_INLINE a3real2r a3real2Trilerp(a3real2p v_out, const a3real2p v000, const a3real2p v001, const a3real2p v010, const a3real2p v011, const a3real2p v100, const a3real2p v101, const a3real2p v110, const a3real2p v111, const a3real param0, const a3real param1, const a3real param2);
+A3DM_INLINE a3real2r a3real2Trilerp(a3real2p v_out, const a3real2p v000, const a3real2p v001, const a3real2p v010, const a3real2p v011, const a3real2p v100, const a3real2p v101, const a3real2p v110, const a3real2p v111, const a3real param0, const a3real param1, const a3real param2);
 
 // A3: Catmull-Rom spline interpolation.
 //	param v_out: output interpolated vector
@@ -441,7 +441,7 @@ A3_INLINE a3real2r a3real2Trilerp(a3real2p v_out, const a3real2p v000, const a3r
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real2r a3real2CatmullRom(a3real2p v_out, const a3real2p vPrev, const a3real2p v0, const a3real2p v1, const a3real2p vNext, const a3real param);
+A3DM_INLINE a3real2r a3real2CatmullRom(a3real2p v_out, const a3real2p vPrev, const a3real2p v0, const a3real2p v1, const a3real2p vNext, const a3real param);
 
 // A3: Cubic Hermite spline (c-spline) interpolation using control handles.
 //	param v_out: output interpolated vector
@@ -452,7 +452,7 @@ A3_INLINE a3real2r a3real2CatmullRom(a3real2p v_out, const a3real2p vPrev, const
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real2r a3real2HermiteControl(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p vControl0, const a3real2p vControl1, const a3real param);
+A3DM_INLINE a3real2r a3real2HermiteControl(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p vControl0, const a3real2p vControl1, const a3real param);
 
 // A3: Cubic Hermite spline (c-spline) interpolation using control tangents.
 //	param v_out: output interpolated vector
@@ -463,14 +463,14 @@ A3_INLINE a3real2r a3real2HermiteControl(a3real2p v_out, const a3real2p v0, cons
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real2r a3real2HermiteTangent(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p vTangent0, const a3real2p vTangent1, const a3real param);
+A3DM_INLINE a3real2r a3real2HermiteTangent(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p vTangent0, const a3real2p vTangent1, const a3real param);
 
 // A3: Bezier interpolation of order/degree zero (constant).
 //	param v_out: output interpolated vector
 //	param v0: first control vector
 //	param param: interpolation parameter (t), not used
 //	return: v_out
-A3_INLINE a3real2r a3real2Bezier0(a3real2p v_out, const a3real2p v0, const a3real param);
+A3DM_INLINE a3real2r a3real2Bezier0(a3real2p v_out, const a3real2p v0, const a3real param);
 
 // A3: Bezier interpolation of first order/degree (linear).
 //	param v_out: output interpolated vector
@@ -479,7 +479,7 @@ A3_INLINE a3real2r a3real2Bezier0(a3real2p v_out, const a3real2p v0, const a3rea
 //	param param: interpolation parameter (t), used for lerp; 
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real2r a3real2Bezier1(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
+A3DM_INLINE a3real2r a3real2Bezier1(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
 
 // A3: Bezier interpolation of second order/degree (quadratic).
 //	param v_out: output interpolated vector
@@ -489,7 +489,7 @@ A3_INLINE a3real2r a3real2Bezier1(a3real2p v_out, const a3real2p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v0, result at t=1 is v2
 //	return: v_out
-A3_INLINE a3real2r a3real2Bezier2(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real param);
+A3DM_INLINE a3real2r a3real2Bezier2(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real param);
 
 // A3: Bezier interpolation of third order/degree (cubic).
 //	param v_out: output interpolated vector
@@ -500,7 +500,7 @@ A3_INLINE a3real2r a3real2Bezier2(a3real2p v_out, const a3real2p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v0, result at t=1 is v3
 //	return: v_out
-A3_INLINE a3real2r a3real2Bezier3(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real2p v3, const a3real param);
+A3DM_INLINE a3real2r a3real2Bezier3(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real2p v3, const a3real param);
 
 // A3: Recursive Bezier interpolation of higher order (quartic, etc.).
 //	param v_out: output interpolated vector
@@ -509,7 +509,7 @@ A3_INLINE a3real2r a3real2Bezier3(a3real2p v_out, const a3real2p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v[0], result at t=1 is v[order_N]
 //	return: v_out
-A3_INLINE a3real2r a3real2BezierN(a3real2p v_out, a3count order_N, const a3real2 v[], const a3real param);
+A3DM_INLINE a3real2r a3real2BezierN(a3real2p v_out, a3count order_N, const a3real2 v[], const a3real param);
 
 // A3: Spherical linear interpolation ("SLERP"): interpolation along the arc 
 //		with a uniform rate of change; improves on nlerp which yields the same 
@@ -520,7 +520,7 @@ A3_INLINE a3real2r a3real2BezierN(a3real2p v_out, a3count order_N, const a3real2
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real2r a3real2Slerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
+A3DM_INLINE a3real2r a3real2Slerp(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
 
 // A3: Spherical linear interpolation ("SLERP"): interpolation along the arc 
 //		with a uniform rate of change; improves on nlerp which yields the same 
@@ -532,7 +532,7 @@ A3_INLINE a3real2r a3real2Slerp(a3real2p v_out, const a3real2p v0, const a3real2
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real2r a3real2SlerpUnit(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
+A3DM_INLINE a3real2r a3real2SlerpUnit(a3real2p v_out, const a3real2p v0, const a3real2p v1, const a3real param);
 
 // A3: Calculate arc length of a Catmull-Rom curve segment.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -547,7 +547,7 @@ A3_INLINE a3real2r a3real2SlerpUnit(a3real2p v_out, const a3real2p v0, const a3r
 //	param v1: goal/end control vector of curve segment
 //	param vNext: next control vector (after v1)
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthCatmullRom(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p vPrev, const a3real2p v0, const a3real2p v1, const a3real2p vNext);
+A3DM_INLINE a3real a3real2CalculateArcLengthCatmullRom(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p vPrev, const a3real2p v0, const a3real2p v1, const a3real2p vNext);
 
 // A3: Calculate arc length of a cubic Hermite curve segment with handles.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -562,7 +562,7 @@ A3_INLINE a3real a3real2CalculateArcLengthCatmullRom(a3real2 sampleTable_out[],
 //	param vControl0: control handle corresponding to v0
 //	param vControl1: control handle corresponding to v1
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthHermiteControl(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p vControl0, const a3real2p vControl1);
+A3DM_INLINE a3real a3real2CalculateArcLengthHermiteControl(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p vControl0, const a3real2p vControl1);
 
 // A3: Calculate arc length of a cubic Hermite curve segment with tangents.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -577,7 +577,7 @@ A3_INLINE a3real a3real2CalculateArcLengthHermiteControl(a3real2 sampleTable_out
 //	param vControl0: control tangent corresponding to v0
 //	param vControl1: control tangent corresponding to v1
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthHermiteTangent(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p vTangent0, const a3real2p vTangent1);
+A3DM_INLINE a3real a3real2CalculateArcLengthHermiteTangent(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p vTangent0, const a3real2p vTangent1);
 
 // A3: Calculate arc length of order zero Bezier curve (constant); this is 
 //		an odd one to make an appearance because it always returns zero, but 
@@ -592,7 +592,7 @@ A3_INLINE a3real a3real2CalculateArcLengthHermiteTangent(a3real2 sampleTable_out
 //	param v0: first control vector
 //	param param: interpolation parameter (t), not used
 //	return: zero
-A3_INLINE a3real a3real2CalculateArcLengthBezier0(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0);
+A3DM_INLINE a3real a3real2CalculateArcLengthBezier0(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0);
 
 // A3: Calculate arc length of first order Bezier curve (linear).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -605,7 +605,7 @@ A3_INLINE a3real a3real2CalculateArcLengthBezier0(a3real2 sampleTable_out[], a3r
 //	param v0: first control vector
 //	param v1: second control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthBezier1(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1);
+A3DM_INLINE a3real a3real2CalculateArcLengthBezier1(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1);
 
 // A3: Calculate arc length of second order Bezier curve (quadratic).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -619,7 +619,7 @@ A3_INLINE a3real a3real2CalculateArcLengthBezier1(a3real2 sampleTable_out[], a3r
 //	param v1: second control vector
 //	param v2: third control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthBezier2(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p v2);
+A3DM_INLINE a3real a3real2CalculateArcLengthBezier2(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p v2);
 
 // A3: Calculate arc length of third order Bezier curve (cubic).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -634,7 +634,7 @@ A3_INLINE a3real a3real2CalculateArcLengthBezier2(a3real2 sampleTable_out[], a3r
 //	param v2: third control vector
 //	param v3: fourth control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthBezier3(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real2p v3);
+A3DM_INLINE a3real a3real2CalculateArcLengthBezier3(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1, const a3real2p v2, const a3real2p v3);
 
 // A3: Calculate arc length of higher-order Bezier curve (quartic, etc.).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -647,7 +647,7 @@ A3_INLINE a3real a3real2CalculateArcLengthBezier3(a3real2 sampleTable_out[], a3r
 //	param order_N: order/degree of function (4 for quartic, etc.)
 //	param v: array of control vectors
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthBezierN(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real2 v[]);
+A3DM_INLINE a3real a3real2CalculateArcLengthBezierN(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real2 v[]);
 
 // A3: Calculate arc length of a slerp curve segment.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -660,7 +660,7 @@ A3_INLINE a3real a3real2CalculateArcLengthBezierN(a3real2 sampleTable_out[], a3r
 //	param v0: initial control vector of curve segment
 //	param v1: goal/end control vector of curve segment
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthSlerp(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1);
+A3DM_INLINE a3real a3real2CalculateArcLengthSlerp(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1);
 
 // A3: Calculate arc length of a slerp curve segment with unit length inputs.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -673,7 +673,7 @@ A3_INLINE a3real a3real2CalculateArcLengthSlerp(a3real2 sampleTable_out[], a3rea
 //	param v0: initial control vector of curve segment
 //	param v1: goal/end control vector of curve segment
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real2CalculateArcLengthSlerpUnit(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1);
+A3DM_INLINE a3real a3real2CalculateArcLengthSlerpUnit(a3real2 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real2p v0, const a3real2p v1);
 
 
 // A3: Gram-Schmidt orthogonalization: flatten the input vector so that it 
@@ -683,41 +683,41 @@ A3_INLINE a3real a3real2CalculateArcLengthSlerpUnit(a3real2 sampleTable_out[], a
 //	param v: vector to orthogonalize
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v_out
-A3_INLINE a3real2r a3real2GramSchmidtOrtho(a3real2p v_out, const a3real2p v, const a3real2p vBase);
+A3DM_INLINE a3real2r a3real2GramSchmidtOrtho(a3real2p v_out, const a3real2p v, const a3real2p vBase);
 
 // A3: Gram-Schmidt orthogonalize.
 //	param v_inout: vector to orthogonalize and store
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v_out
-A3_INLINE a3real2r a3real2GramSchmidt(a3real2p v_inout, const a3real2p vBase);
+A3DM_INLINE a3real2r a3real2GramSchmidt(a3real2p v_inout, const a3real2p vBase);
 
 
 // A3: 2D cross product: get the signed length of the perpendicular axis (Z).
 //	param vL: input left vector
 //	param vR: input right vector
 //	return: length of perpendicular axis, also area of parallelogram
-A3_INLINE a3real a3real2CrossZ(const a3real2p vL, const a3real2p vR);
+A3DM_INLINE a3real a3real2CrossZ(const a3real2p vL, const a3real2p vR);
 
 // A3: Calculate double area of a triangle.
 //	param v0: first vertex of triangle
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: double area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real2TriangleAreaDoubled(const a3real2p v0, const a3real2p v1, const a3real2p v2);
+A3DM_INLINE a3real a3real2TriangleAreaDoubled(const a3real2p v0, const a3real2p v1, const a3real2p v2);
 
 // A3: Calculate squared area of a triangle.
 //	param v0: first vertex of triangle
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: squared area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real2TriangleAreaSquared(const a3real2p v0, const a3real2p v1, const a3real2p v2);
+A3DM_INLINE a3real a3real2TriangleAreaSquared(const a3real2p v0, const a3real2p v1, const a3real2p v2);
 
 // A3: Calculate area of a triangle.
 //	param v0: first vertex of triangle
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real2TriangleArea(const a3real2p v0, const a3real2p v1, const a3real2p v2);
+A3DM_INLINE a3real a3real2TriangleArea(const a3real2p v0, const a3real2p v1, const a3real2p v2);
 
 
 // A3: Test whether point is in triangle.
@@ -726,7 +726,7 @@ A3_INLINE a3real a3real2TriangleArea(const a3real2p v0, const a3real2p v1, const
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: boolean describing whether triangle is in triangle
-A3_INLINE a3boolean a3real2PointIsInTriangle(const a3real2p p, const a3real2p v0, const a3real2p v1, const a3real2p v2);
+A3DM_INLINE a3boolean a3real2PointIsInTriangle(const a3real2p p, const a3real2p v0, const a3real2p v1, const a3real2p v2);
 
 // A3: Test whether point is in triangle and get barycentric coordinates.
 //	param p: point to test whether contained in triangle
@@ -737,7 +737,7 @@ A3_INLINE a3boolean a3real2PointIsInTriangle(const a3real2p p, const a3real2p v0
 //	param param1: pointer to variable to capture second barycentric coordinate
 //	param param2: pointer to variable to capture third barycentric coordinate
 //	return: boolean describing whether triangle is in triangle
-A3_INLINE a3boolean a3real2PointIsInTriangleBarycentric(const a3real2p p, const a3real2p v0, const a3real2p v1, const a3real2p v2, a3real *param0, a3real *param1, a3real *param2);
+A3DM_INLINE a3boolean a3real2PointIsInTriangleBarycentric(const a3real2p p, const a3real2p v0, const a3real2p v1, const a3real2p v2, a3real *param0, a3real *param1, a3real *param2);
 
 
 //-----------------------------------------------------------------------------
@@ -749,127 +749,127 @@ A3_INLINE a3boolean a3real2PointIsInTriangleBarycentric(const a3real2p p, const
 //	param y: second component
 //	param z: third component
 //	return: v_out
-A3_INLINE a3real3r a3real3Set(a3real3p v_out, const a3real x, const a3real y, const a3real z);
+A3DM_INLINE a3real3r a3real3Set(a3real3p v_out, const a3real x, const a3real y, const a3real z);
 
 // A3: Initialize vector with a 2D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real3r a3real3SetReal2(a3real3p v_out, const a3real2p v);
+A3DM_INLINE a3real3r a3real3SetReal2(a3real3p v_out, const a3real2p v);
 
 // A3: Initialize vector with a 2D vector and a third component.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	param z: third component
 //	return: v_out
-A3_INLINE a3real3r a3real3SetReal2Z(a3real3p v_out, const a3real2p v, const a3real z);
+A3DM_INLINE a3real3r a3real3SetReal2Z(a3real3p v_out, const a3real2p v, const a3real z);
 
 // A3: Initialize vector with a 3D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real3r a3real3SetReal3(a3real3p v_out, const a3real3p v);
+A3DM_INLINE a3real3r a3real3SetReal3(a3real3p v_out, const a3real3p v);
 
 // A3: Initialize vector with a 4D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real3r a3real3SetReal4(a3real3p v_out, const a3real4p v);
+A3DM_INLINE a3real3r a3real3SetReal4(a3real3p v_out, const a3real4p v);
 
 
 // A3: Calculate squared length (magnitude) of vector.
 //	param v: input vector
 //	return: squared length of vector: |v|^2
-A3_INLINE a3real a3real3LengthSquared(const a3real3p v);
+A3DM_INLINE a3real a3real3LengthSquared(const a3real3p v);
 
 // A3: Calculate inverse (reciprocal) squared length (magnitude) of vector.
 //	param v: input vector
 //	return: inverse squared length of vector: 1 / |v|^2
-A3_INLINE a3real a3real3LengthSquaredInverse(const a3real3p v);
+A3DM_INLINE a3real a3real3LengthSquaredInverse(const a3real3p v);
 
 // A3: Calculate length (magnitude) of vector.
 //	param v: input vector
 //	return: length of vector: |v|
-A3_INLINE a3real a3real3Length(const a3real3p v);
+A3DM_INLINE a3real a3real3Length(const a3real3p v);
 
 // A3: Calculate inverse (reciprocal) length (magnitude) of vector.
 //	param v: input vector
 //	return: inverse length of vector: 1 / |v|
-A3_INLINE a3real a3real3LengthInverse(const a3real3p v);
+A3DM_INLINE a3real a3real3LengthInverse(const a3real3p v);
 
 // A3: Get unit direction of vector.
 //	param v_out: output vector, direction of input: v / |v|
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real3r a3real3GetUnit(a3real3p v_out, const a3real3p v);
+A3DM_INLINE a3real3r a3real3GetUnit(a3real3p v_out, const a3real3p v);
 
 // A3: Normalize vector, making it unit length (direction).
 //	param v_inout: vector to normalize: v /= |v|
 //	return: v_inout
-A3_INLINE a3real3r a3real3Normalize(a3real3p v_inout);
+A3DM_INLINE a3real3r a3real3Normalize(a3real3p v_inout);
 
 // A3: Get unit direction of vector and inverse length.
 //	param v_out: output vector, direction of input: v / |v|
 //	param v: input vector
 //	param invLength_out: pointer to variable capturing inverse length: 1 / |v|
 //	return: v_out
-A3_INLINE a3real3r a3real3GetUnitInvLength(a3real3p v_out, const a3real3p v, a3real *invLength_out);
+A3DM_INLINE a3real3r a3real3GetUnitInvLength(a3real3p v_out, const a3real3p v, a3real *invLength_out);
 
 // A3: Normalize vector, making it unit length (direction), get inverse length.
 //	param v_inout: vector to normalize: v /= |v|
 //	param invLength_out: pointer to variable capturing inverse length: 1 / |v|
 //	return: v_inout
-A3_INLINE a3real3r a3real3NormalizeGetInvLength(a3real3p v_inout, a3real *invLength_out);
+A3DM_INLINE a3real3r a3real3NormalizeGetInvLength(a3real3p v_inout, a3real *invLength_out);
 
 // A3: Get negative vector.
 //	param v_out: output vector, negative of input: -v
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real3r a3real3GetNegative(a3real3p v_out, const a3real3p v);
+A3DM_INLINE a3real3r a3real3GetNegative(a3real3p v_out, const a3real3p v);
 
 // A3: Negate vector.
 //	param v_inout: vector to negate: v = -v
 //	return: v_inout
-A3_INLINE a3real3r a3real3Negate(a3real3p v_inout);
+A3DM_INLINE a3real3r a3real3Negate(a3real3p v_inout);
 
 
 // A3: Calculate dot product (relative alignment) of two vectors.
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: dot product: vL dot vR
-A3_INLINE a3real a3real3Dot(const a3real3p vL, const a3real3p vR);
+A3DM_INLINE a3real a3real3Dot(const a3real3p vL, const a3real3p vR);
 
 // A3: Calculate squared distance between two vectors.
 //	param v0: input first vector
 //	param v1: input second vector
 //	return: squared distance between vectors: |v1 - v0|^2
-A3_INLINE a3real a3real3DistanceSquared(const a3real3p v0, const a3real3p v1);
+A3DM_INLINE a3real a3real3DistanceSquared(const a3real3p v0, const a3real3p v1);
 
 // A3: Calculate distance between two vectors.
 //	param v0: input first vector
 //	param v1: input second vector
 //	return: distance between vectors: |v1 - v0|
-A3_INLINE a3real a3real3Distance(const a3real3p v0, const a3real3p v1);
+A3DM_INLINE a3real a3real3Distance(const a3real3p v0, const a3real3p v1);
 
 // A3: Calculate size ratio of vector projection.
 //	param v: input vector to project
 //	param vBase: vector to project onto
 //	return: ratio of projected vector length to base vector length: 
 //		(v dot vBase) / |vBase|^2
-A3_INLINE a3real a3real3ProjRatio(const a3real3p v, const a3real3p vBase);
+A3DM_INLINE a3real a3real3ProjRatio(const a3real3p v, const a3real3p vBase);
 
 // A3: Calculate vector projection.
 //	param v_out: output of vector projection: v projected onto vBase
 //	param v: input vector to project
 //	param vBase: vector to project onto
 //	return: v_out
-A3_INLINE a3real3r a3real3Projected(a3real3p v_out, const a3real3p v, const a3real3p vBase);
+A3DM_INLINE a3real3r a3real3Projected(a3real3p v_out, const a3real3p v, const a3real3p vBase);
 
 // A3: Project vector.
 //	param v_inout: vector to project
 //	param vBase: vector to project onto
 //	return: v_inout
-A3_INLINE a3real3r a3real3Proj(a3real3p v_inout, const a3real3p vBase);
+A3DM_INLINE a3real3r a3real3Proj(a3real3p v_inout, const a3real3p vBase);
 
 // A3: Calculate vector projection and get projection ratio.
 //	param v_out: output of vector projection: v projected onto vBase
@@ -878,7 +878,7 @@ A3_INLINE a3real3r a3real3Proj(a3real3p v_inout, const a3real3p vBase);
 //	param ratio_out: pointer to variable capturing projection ratio: 
 //		(v dot vBase) / |vBase|^2
 //	return: v_out
-A3_INLINE a3real3r a3real3ProjectedGetRatio(a3real3p v_out, const a3real3p v, const a3real3p vBase, a3real *ratio_out);
+A3DM_INLINE a3real3r a3real3ProjectedGetRatio(a3real3p v_out, const a3real3p v, const a3real3p vBase, a3real *ratio_out);
 
 // A3: Project vector and get projection ratio.
 //	param v_inout: vector to project
@@ -886,85 +886,85 @@ A3_INLINE a3real3r a3real3ProjectedGetRatio(a3real3p v_out, const a3real3p v, co
 //	param ratio_out: pointer to variable capturing projection ratio: 
 //		(v dot vBase) / |vBase|^2
 //	return: v_inout
-A3_INLINE a3real3r a3real3ProjGetRatio(a3real3p v_inout, const a3real3p vBase, a3real *ratio_out);
+A3DM_INLINE a3real3r a3real3ProjGetRatio(a3real3p v_inout, const a3real3p vBase, a3real *ratio_out);
 
 // A3: Calculate sum of vectors.
 //	param v_out: output vector to store sum of two inputs
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real3r a3real3Sum(a3real3p v_out, const a3real3p vL, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3Sum(a3real3p v_out, const a3real3p vL, const a3real3p vR);
 
 // A3: Calculate difference of vectors.
 //	param v_out: output vector to store difference of two inputs
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real3r a3real3Diff(a3real3p v_out, const a3real3p vL, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3Diff(a3real3p v_out, const a3real3p vL, const a3real3p vR);
 
 // A3: Calculate product of vector and scalar.
 //	param v_out: output vector to store scaled vector
 //	param v: input vector to be scaled
 //	param s: scalar by which to multiply vector
 //	return: v_out
-A3_INLINE a3real3r a3real3ProductS(a3real3p v_out, const a3real3p v, const a3real s);
+A3DM_INLINE a3real3r a3real3ProductS(a3real3p v_out, const a3real3p v, const a3real s);
 
 // A3: Calculate quotient of vector and scalar.
 //	param v_out: output vector to store scaled vector
 //	param v: input vector to be scaled, numerator
 //	param s: scalar by which to divide vector, denominator
 //	return: v_out
-A3_INLINE a3real3r a3real3QuotientS(a3real3p v_out, const a3real3p v, const a3real s);
+A3DM_INLINE a3real3r a3real3QuotientS(a3real3p v_out, const a3real3p v, const a3real s);
 
 // A3: Calculate component-wise product of two vectors.
 //	param v_out: output vector to store product vector: vL * vR components
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real3r a3real3ProductComp(a3real3p v_out, const a3real3p vL, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3ProductComp(a3real3p v_out, const a3real3p vL, const a3real3p vR);
 
 // A3: Calculate component-wise quotient of two vectors.
 //	param v_out: output vector to store quotient vector: vL / vR components
 //	param vL: input left side vector, numerator
 //	param vR: input right side vector, denominator
 //	return: v_out
-A3_INLINE a3real3r a3real3QuotientComp(a3real3p v_out, const a3real3p vL, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3QuotientComp(a3real3p v_out, const a3real3p vL, const a3real3p vR);
 
 // A3: Add vectors and store to left operand.
 //	param vL_inout: left side vector to which to add
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real3r a3real3Add(a3real3p vL_inout, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3Add(a3real3p vL_inout, const a3real3p vR);
 
 // A3: Subtract vectors and store to left operand.
 //	param vL_inout: left side vector from which to subtract
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real3r a3real3Sub(a3real3p vL_inout, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3Sub(a3real3p vL_inout, const a3real3p vR);
 
 // A3: Multiply vector by scalar.
 //	param v_inout: vector to scale
 //	param s: scalar by which to multiply vector
 //	return: v_inout
-A3_INLINE a3real3r a3real3MulS(a3real3p v_inout, const a3real s);
+A3DM_INLINE a3real3r a3real3MulS(a3real3p v_inout, const a3real s);
 
 // A3: Divide vector by scalar.
 //	param v_inout: vector to scale, numerator
 //	param s: scalar by which to multiply vector, denominator
 //	return: v_inout
-A3_INLINE a3real3r a3real3DivS(a3real3p v_inout, const a3real s);
+A3DM_INLINE a3real3r a3real3DivS(a3real3p v_inout, const a3real s);
 
 // A3: Component-wise product of two vectors, store in left operand.
 //	param vL_inout: left side vector to multiply and store: vL *= vR components
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real3r a3real3MulComp(a3real3p vL_inout, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3MulComp(a3real3p vL_inout, const a3real3p vR);
 
 // A3: Component-wise quotient of two vectors, store in left operand.
 //	param vL_inout: left side vector to divide and store: vL /= vR components
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real3r a3real3DivComp(a3real3p vL_inout, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3DivComp(a3real3p vL_inout, const a3real3p vR);
 
 
 // A3: Linear interpolation ("LERP"): calculate linear interpolation between 
@@ -976,7 +976,7 @@ A3_INLINE a3real3r a3real3DivComp(a3real3p vL_inout, const a3real3p vR);
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real3r a3real3Lerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
+A3DM_INLINE a3real3r a3real3Lerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
 
 // A3: Normalized linear interpolation ("NLERP"): calculate lerp between 
 //		reference vectors 'v0' and 'v1' using a interpolation parameter 
@@ -988,7 +988,7 @@ A3_INLINE a3real3r a3real3Lerp(a3real3p v_out, const a3real3p v0, const a3real3p
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real3r a3real3NLerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
+A3DM_INLINE a3real3r a3real3NLerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
 
 // A3: Bi-linear interpolation: calculate lerp between each range of numbers, 
 //		[v00, v01] and [v10, v11], and then calculate lerp between the results.
@@ -1000,7 +1000,7 @@ A3_INLINE a3real3r a3real3NLerp(a3real3p v_out, const a3real3p v0, const a3real3
 //	param param0: parameter for interpolation within ranges (lerp)
 //	param param1: parameter for blending results of lerp (bi-lerp)
 //	return: v_out
-A3_INLINE a3real3r a3real3Bilerp(a3real3p v_out, const a3real3p v00, const a3real3p v01, const a3real3p v10, const a3real3p v11, const a3real param0, const a3real param1);
+A3DM_INLINE a3real3r a3real3Bilerp(a3real3p v_out, const a3real3p v00, const a3real3p v01, const a3real3p v10, const a3real3p v11, const a3real param0, const a3real param1);
 
 // A3: Tri-linear interpolation: calculate bi-lerp between each set of ranges, 
 //		then lerp between the results.
@@ -1017,7 +1017,7 @@ A3_INLINE a3real3r a3real3Bilerp(a3real3p v_out, const a3real3p v00, const a3rea
 //	param param1: parameter for blending in sets 000-011 and 100-111 (bi-lerp)
 //	param param2: parameter for blending results of bi-lerp (tri-lerp)
 //	return: v_out
-A3_INLINE a3real3r a3real3Trilerp(a3real3p v_out, const a3real3p v000, const a3real3p v001, const a3real3p v010, const a3real3p v011, const a3real3p v100, const a3real3p v101, const a3real3p v110, const a3real3p v111, const a3real param0, const a3real param1, const a3real param2);
+A3DM_INLINE a3real3r a3real3Trilerp(a3real3p v_out, const a3real3p v000, const a3real3p v001, const a3real3p v010, const a3real3p v011, const a3real3p v100, const a3real3p v101, const a3real3p v110, const a3real3p v111, const a3real param0, const a3real param1, const a3real param2);
 
 // A3: Catmull-Rom spline interpolation.
 //	param v_out: output interpolated vector
@@ -1028,7 +1028,7 @@ A3_INLINE a3real3r a3real3Trilerp(a3real3p v_out, const a3real3p v000, const a3r
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real3r a3real3CatmullRom(a3real3p v_out, const a3real3p vPrev, const a3real3p v0, const a3real3p v1, const a3real3p vNext, const a3real param);
+A3DM_INLINE a3real3r a3real3CatmullRom(a3real3p v_out, const a3real3p vPrev, const a3real3p v0, const a3real3p v1, const a3real3p vNext, const a3real param);
 
 // A3: Cubic Hermite spline (c-spline) interpolation using control handles.
 //	param v_out: output interpolated vector
@@ -1039,7 +1039,7 @@ A3_INLINE a3real3r a3real3CatmullRom(a3real3p v_out, const a3real3p vPrev, const
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real3r a3real3HermiteControl(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p vControl0, const a3real3p vControl1, const a3real param);
+A3DM_INLINE a3real3r a3real3HermiteControl(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p vControl0, const a3real3p vControl1, const a3real param);
 
 // A3: Cubic Hermite spline (c-spline) interpolation using control tangents.
 //	param v_out: output interpolated vector
@@ -1050,14 +1050,14 @@ A3_INLINE a3real3r a3real3HermiteControl(a3real3p v_out, const a3real3p v0, cons
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real3r a3real3HermiteTangent(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p vTangent0, const a3real3p vTangent1, const a3real param);
+A3DM_INLINE a3real3r a3real3HermiteTangent(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p vTangent0, const a3real3p vTangent1, const a3real param);
 
 // A3: Bezier interpolation of order/degree zero (constant).
 //	param v_out: output interpolated vector
 //	param v0: first control vector
 //	param param: interpolation parameter (t), not used
 //	return: v_out
-A3_INLINE a3real3r a3real3Bezier0(a3real3p v_out, const a3real3p v0, const a3real param);
+A3DM_INLINE a3real3r a3real3Bezier0(a3real3p v_out, const a3real3p v0, const a3real param);
 
 // A3: Bezier interpolation of first order/degree (linear).
 //	param v_out: output interpolated vector
@@ -1066,7 +1066,7 @@ A3_INLINE a3real3r a3real3Bezier0(a3real3p v_out, const a3real3p v0, const a3rea
 //	param param: interpolation parameter (t), used for lerp; 
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real3r a3real3Bezier1(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
+A3DM_INLINE a3real3r a3real3Bezier1(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
 
 // A3: Bezier interpolation of second order/degree (quadratic).
 //	param v_out: output interpolated vector
@@ -1076,7 +1076,7 @@ A3_INLINE a3real3r a3real3Bezier1(a3real3p v_out, const a3real3p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v0, result at t=1 is v2
 //	return: v_out
-A3_INLINE a3real3r a3real3Bezier2(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real param);
+A3DM_INLINE a3real3r a3real3Bezier2(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real param);
 
 // A3: Bezier interpolation of third order/degree (cubic).
 //	param v_out: output interpolated vector
@@ -1087,7 +1087,7 @@ A3_INLINE a3real3r a3real3Bezier2(a3real3p v_out, const a3real3p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v0, result at t=1 is v3
 //	return: v_out
-A3_INLINE a3real3r a3real3Bezier3(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real3p v3, const a3real param);
+A3DM_INLINE a3real3r a3real3Bezier3(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real3p v3, const a3real param);
 
 // A3: Recursive Bezier interpolation of higher order (quartic, etc.).
 //	param v_out: output interpolated vector
@@ -1096,7 +1096,7 @@ A3_INLINE a3real3r a3real3Bezier3(a3real3p v_out, const a3real3p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v[0], result at t=1 is v[order_N]
 //	return: v_out
-A3_INLINE a3real3r a3real3BezierN(a3real3p v_out, a3count order_N, const a3real3 v[], const a3real param);
+A3DM_INLINE a3real3r a3real3BezierN(a3real3p v_out, a3count order_N, const a3real3 v[], const a3real param);
 
 // A3: Spherical linear interpolation ("SLERP"): interpolation along the arc 
 //		with a uniform rate of change; improves on nlerp which yields the same 
@@ -1107,7 +1107,7 @@ A3_INLINE a3real3r a3real3BezierN(a3real3p v_out, a3count order_N, const a3real3
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real3r a3real3Slerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
+A3DM_INLINE a3real3r a3real3Slerp(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
 
 // A3: Spherical linear interpolation ("SLERP"): interpolation along the arc 
 //		with a uniform rate of change; improves on nlerp which yields the same 
@@ -1119,7 +1119,7 @@ A3_INLINE a3real3r a3real3Slerp(a3real3p v_out, const a3real3p v0, const a3real3
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real3r a3real3SlerpUnit(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
+A3DM_INLINE a3real3r a3real3SlerpUnit(a3real3p v_out, const a3real3p v0, const a3real3p v1, const a3real param);
 
 // A3: Calculate arc length of a Catmull-Rom curve segment.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1134,7 +1134,7 @@ A3_INLINE a3real3r a3real3SlerpUnit(a3real3p v_out, const a3real3p v0, const a3r
 //	param v1: goal/end control vector of curve segment
 //	param vNext: next control vector (after v1)
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthCatmullRom(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p vPrev, const a3real3p v0, const a3real3p v1, const a3real3p vNext);
+A3DM_INLINE a3real a3real3CalculateArcLengthCatmullRom(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p vPrev, const a3real3p v0, const a3real3p v1, const a3real3p vNext);
 
 // A3: Calculate arc length of a cubic Hermite curve segment with handles.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1149,7 +1149,7 @@ A3_INLINE a3real a3real3CalculateArcLengthCatmullRom(a3real3 sampleTable_out[],
 //	param vControl0: control handle corresponding to v0
 //	param vControl1: control handle corresponding to v1
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthHermiteControl(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p vControl0, const a3real3p vControl1);
+A3DM_INLINE a3real a3real3CalculateArcLengthHermiteControl(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p vControl0, const a3real3p vControl1);
 
 // A3: Calculate arc length of a cubic Hermite curve segment with tangents.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1164,7 +1164,7 @@ A3_INLINE a3real a3real3CalculateArcLengthHermiteControl(a3real3 sampleTable_out
 //	param vControl0: control tangent corresponding to v0
 //	param vControl1: control tangent corresponding to v1
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthHermiteTangent(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p vTangent0, const a3real3p vTangent1);
+A3DM_INLINE a3real a3real3CalculateArcLengthHermiteTangent(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p vTangent0, const a3real3p vTangent1);
 
 // A3: Calculate arc length of order zero Bezier curve (constant); this is 
 //		an odd one to make an appearance because it always returns zero, but 
@@ -1179,7 +1179,7 @@ A3_INLINE a3real a3real3CalculateArcLengthHermiteTangent(a3real3 sampleTable_out
 //	param v0: first control vector
 //	param param: interpolation parameter (t), not used
 //	return: zero
-A3_INLINE a3real a3real3CalculateArcLengthBezier0(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0);
+A3DM_INLINE a3real a3real3CalculateArcLengthBezier0(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0);
 
 // A3: Calculate arc length of first order Bezier curve (linear).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1192,7 +1192,7 @@ A3_INLINE a3real a3real3CalculateArcLengthBezier0(a3real3 sampleTable_out[], a3r
 //	param v0: first control vector
 //	param v1: second control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthBezier1(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1);
+A3DM_INLINE a3real a3real3CalculateArcLengthBezier1(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1);
 
 // A3: Calculate arc length of second order Bezier curve (quadratic).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1206,7 +1206,7 @@ A3_INLINE a3real a3real3CalculateArcLengthBezier1(a3real3 sampleTable_out[], a3r
 //	param v1: second control vector
 //	param v2: third control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthBezier2(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3CalculateArcLengthBezier2(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate arc length of third order Bezier curve (cubic).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1221,7 +1221,7 @@ A3_INLINE a3real a3real3CalculateArcLengthBezier2(a3real3 sampleTable_out[], a3r
 //	param v2: third control vector
 //	param v3: fourth control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthBezier3(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real3p v3);
+A3DM_INLINE a3real a3real3CalculateArcLengthBezier3(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1, const a3real3p v2, const a3real3p v3);
 
 // A3: Calculate arc length of higher-order Bezier curve (quartic, etc.).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1234,7 +1234,7 @@ A3_INLINE a3real a3real3CalculateArcLengthBezier3(a3real3 sampleTable_out[], a3r
 //	param order_N: order/degree of function (4 for quartic, etc.)
 //	param v: array of control vectors
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthBezierN(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real3 v[]);
+A3DM_INLINE a3real a3real3CalculateArcLengthBezierN(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real3 v[]);
 
 // A3: Calculate arc length of a slerp curve segment.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1247,7 +1247,7 @@ A3_INLINE a3real a3real3CalculateArcLengthBezierN(a3real3 sampleTable_out[], a3r
 //	param v0: initial control vector of curve segment
 //	param v1: goal/end control vector of curve segment
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthSlerp(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1);
+A3DM_INLINE a3real a3real3CalculateArcLengthSlerp(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1);
 
 // A3: Calculate arc length of a slerp curve segment with unit length inputs.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1260,7 +1260,7 @@ A3_INLINE a3real a3real3CalculateArcLengthSlerp(a3real3 sampleTable_out[], a3rea
 //	param v0: initial control vector of curve segment
 //	param v1: goal/end control vector of curve segment
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real3CalculateArcLengthSlerpUnit(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1);
+A3DM_INLINE a3real a3real3CalculateArcLengthSlerpUnit(a3real3 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real3p v0, const a3real3p v1);
 
 
 // A3: Gram-Schmidt orthogonalization: flatten the input vector so that it 
@@ -1270,7 +1270,7 @@ A3_INLINE a3real a3real3CalculateArcLengthSlerpUnit(a3real3 sampleTable_out[], a
 //	param v: vector to orthogonalize
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v_out
-A3_INLINE a3real3r a3real3GramSchmidtOrtho(a3real3p v_out, const a3real3p v, const a3real3p vBase);
+A3DM_INLINE a3real3r a3real3GramSchmidtOrtho(a3real3p v_out, const a3real3p v, const a3real3p vBase);
 
 // A3: Gram-Schmidt orthogonalization for multiple vectors.
 //	param v0_out: result of Gram-Schmidt process on first vector
@@ -1279,20 +1279,20 @@ A3_INLINE a3real3r a3real3GramSchmidtOrtho(a3real3p v_out, const a3real3p v, con
 //	param v1: second vector to orthogonalize
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v1_out
-A3_INLINE a3real3r a3real3GramSchmidtOrtho2(a3real3p v0_out, a3real3p v1_out, const a3real3p v0, const a3real3p v1, const a3real3p vBase);
+A3DM_INLINE a3real3r a3real3GramSchmidtOrtho2(a3real3p v0_out, a3real3p v1_out, const a3real3p v0, const a3real3p v1, const a3real3p vBase);
 
 // A3: Gram-Schmidt orthogonalize.
 //	param v_inout: vector to orthogonalize and store
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v_out
-A3_INLINE a3real3r a3real3GramSchmidt(a3real3p v_inout, const a3real3p vBase);
+A3DM_INLINE a3real3r a3real3GramSchmidt(a3real3p v_inout, const a3real3p vBase);
 
 // A3: Gram-Schmidt orthogonalize multiple vectors.
 //	param v0_inout: first vector to orthogonalize and store
 //	param v1_inout: second vector to orthogonalize and store
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v1_out
-A3_INLINE a3real3r a3real3GramSchmidt2(a3real3p v0_inout, a3real3p v1_inout, const a3real3p vBase);
+A3DM_INLINE a3real3r a3real3GramSchmidt2(a3real3p v0_inout, a3real3p v1_inout, const a3real3p vBase);
 
 
 // A3: Cross product: calculate the vector perpendicular to both inputs.
@@ -1300,14 +1300,14 @@ A3_INLINE a3real3r a3real3GramSchmidt2(a3real3p v0_inout, a3real3p v1_inout, con
 //	param vL: input left vector
 //	param vR: input right vector
 //	return: v_out
-A3_INLINE a3real3r a3real3Cross(a3real3p v_out, const a3real3p vL, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3Cross(a3real3p v_out, const a3real3p vL, const a3real3p vR);
 
 // A3: Cross product, unit length: calculate cross product, normalize result.
 //	param v_out: cross product of vL and vR, magnitude is parallelapiped volume
 //	param vL: input left vector
 //	param vR: input right vector
 //	return: v_out
-A3_INLINE a3real3r a3real3CrossUnit(a3real3p v_out, const a3real3p vL, const a3real3p vR);
+A3DM_INLINE a3real3r a3real3CrossUnit(a3real3p v_out, const a3real3p vL, const a3real3p vR);
 
 // A3: Calculate the normal vector of a triangle.
 //	param n_out: normal vector of triangle formed by v0, v1 and v2
@@ -1315,7 +1315,7 @@ A3_INLINE a3real3r a3real3CrossUnit(a3real3p v_out, const a3real3p vL, const a3r
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: v_out
-A3_INLINE a3real3r a3real3TriangleNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real3r a3real3TriangleNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate the unit length normal vector of a triangle.
 //	param n_out: unit normal vector of triangle formed by v0, v1 and v2
@@ -1323,7 +1323,7 @@ A3_INLINE a3real3r a3real3TriangleNormal(a3real3p n_out, const a3real3p v0, cons
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: v_out
-A3_INLINE a3real3r a3real3TriangleNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real3r a3real3TriangleNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate double area of a triangle and normal.
 //	param n_out: normal vector of triangle formed by v0, v1 and v2
@@ -1331,7 +1331,7 @@ A3_INLINE a3real3r a3real3TriangleNormalUnit(a3real3p n_out, const a3real3p v0,
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: double area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleAreaDoubledNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleAreaDoubledNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate squared area of a triangle and normal.
 //	param n_out: normal vector of triangle formed by v0, v1 and v2
@@ -1339,7 +1339,7 @@ A3_INLINE a3real a3real3TriangleAreaDoubledNormal(a3real3p n_out, const a3real3p
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: squared area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleAreaSquaredNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleAreaSquaredNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate area of a triangle and normal.
 //	param n_out: normal vector of triangle formed by v0, v1 and v2
@@ -1347,7 +1347,7 @@ A3_INLINE a3real a3real3TriangleAreaSquaredNormal(a3real3p n_out, const a3real3p
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleAreaNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleAreaNormal(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate double area of a triangle and unit normal.
 //	param n_out: unit normal vector of triangle formed by v0, v1 and v2
@@ -1355,7 +1355,7 @@ A3_INLINE a3real a3real3TriangleAreaNormal(a3real3p n_out, const a3real3p v0, co
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: double area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleAreaDoubledNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleAreaDoubledNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate squared area of a triangle and unit normal.
 //	param n_out: unit normal vector of triangle formed by v0, v1 and v2
@@ -1363,7 +1363,7 @@ A3_INLINE a3real a3real3TriangleAreaDoubledNormalUnit(a3real3p n_out, const a3re
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: squared area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleAreaSquaredNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleAreaSquaredNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate area of a triangle and unit normal.
 //	param n_out: unit normal vector of triangle formed by v0, v1 and v2
@@ -1371,28 +1371,28 @@ A3_INLINE a3real a3real3TriangleAreaSquaredNormalUnit(a3real3p n_out, const a3re
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleAreaNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleAreaNormalUnit(a3real3p n_out, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate double area of a triangle.
 //	param v0: first vertex of triangle
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: double area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleAreaDoubled(const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleAreaDoubled(const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate squared area of a triangle.
 //	param v0: first vertex of triangle
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: squared area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleAreaSquared(const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleAreaSquared(const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Calculate area of a triangle.
 //	param v0: first vertex of triangle
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: area of triangle formed by v0, v1 and v2
-A3_INLINE a3real a3real3TriangleArea(const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3real a3real3TriangleArea(const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 
 // A3: Test whether point is in triangle.
@@ -1401,7 +1401,7 @@ A3_INLINE a3real a3real3TriangleArea(const a3real3p v0, const a3real3p v1, const
 //	param v1: second vertex of triangle
 //	param v2: third vertex of triangle
 //	return: boolean describing whether triangle is in triangle
-A3_INLINE a3boolean a3real3PointIsInTriangle(const a3real3p p, const a3real3p v0, const a3real3p v1, const a3real3p v2);
+A3DM_INLINE a3boolean a3real3PointIsInTriangle(const a3real3p p, const a3real3p v0, const a3real3p v1, const a3real3p v2);
 
 // A3: Test whether point is in triangle and get barycentric coordinates.
 //	param p: point to test whether contained in triangle
@@ -1412,7 +1412,7 @@ A3_INLINE a3boolean a3real3PointIsInTriangle(const a3real3p p, const a3real3p v0
 //	param param1: pointer to variable to capture second barycentric coordinate
 //	param param2: pointer to variable to capture third barycentric coordinate
 //	return: boolean describing whether triangle is in triangle
-A3_INLINE a3boolean a3real3PointIsInTriangleBarycentric(const a3real3p p, const a3real3p v0, const a3real3p v1, const a3real3p v2, a3real *param0, a3real *param1, a3real *param2);
+A3DM_INLINE a3boolean a3real3PointIsInTriangleBarycentric(const a3real3p p, const a3real3p v0, const a3real3p v1, const a3real3p v2, a3real *param0, a3real *param1, a3real *param2);
 
 
 //-----------------------------------------------------------------------------
@@ -1425,20 +1425,20 @@ A3_INLINE a3boolean a3real3PointIsInTriangleBarycentric(const a3real3p p, const
 //	param z: third component
 //	param w: fourth component
 //	return: v_out
-A3_INLINE a3real4r a3real4Set(a3real4p v_out, const a3real x, const a3real y, const a3real z, const a3real w);
+A3DM_INLINE a3real4r a3real4Set(a3real4p v_out, const a3real x, const a3real y, const a3real z, const a3real w);
 
 // A3: Initialize vector with a 2D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real4r a3real4SetReal2(a3real4p v_out, const a3real2p v);
+A3DM_INLINE a3real4r a3real4SetReal2(a3real4p v_out, const a3real2p v);
 
 // A3: Initialize vector with a 2D vector and a third component.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	param z: third component
 //	return: v_out
-A3_INLINE a3real4r a3real4SetReal2Z(a3real4p v_out, const a3real2p v, const a3real z);
+A3DM_INLINE a3real4r a3real4SetReal2Z(a3real4p v_out, const a3real2p v, const a3real z);
 
 // A3: Initialize vector with a 2D vector, a third and a fourth component.
 //	param v_out: vector to initialize
@@ -1446,120 +1446,120 @@ A3_INLINE a3real4r a3real4SetReal2Z(a3real4p v_out, const a3real2p v, const a3re
 //	param z: third component
 //	param w: fourth component
 //	return: v_out
-A3_INLINE a3real4r a3real4SetReal2ZW(a3real4p v_out, const a3real2p v, const a3real z, const a3real w);
+A3DM_INLINE a3real4r a3real4SetReal2ZW(a3real4p v_out, const a3real2p v, const a3real z, const a3real w);
 
 // A3: Initialize vector with a 3D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real4r a3real4SetReal3(a3real4p v_out, const a3real3p v);
+A3DM_INLINE a3real4r a3real4SetReal3(a3real4p v_out, const a3real3p v);
 
 // A3: Initialize vector with a 3D vector and a fourth component.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	param w: fourth component
 //	return: v_out
-A3_INLINE a3real4r a3real4SetReal3W(a3real4p v_out, const a3real3p v, const a3real w);
+A3DM_INLINE a3real4r a3real4SetReal3W(a3real4p v_out, const a3real3p v, const a3real w);
 
 // A3: Initialize vector with a 4D vector.
 //	param v_out: vector to initialize
 //	param v: other vector to copy values from
 //	return: v_out
-A3_INLINE a3real4r a3real4SetReal4(a3real4p v_out, const a3real4p v);
+A3DM_INLINE a3real4r a3real4SetReal4(a3real4p v_out, const a3real4p v);
 
 
 // A3: Calculate squared length (magnitude) of vector.
 //	param v: input vector
 //	return: squared length of vector: |v|^2
-A3_INLINE a3real a3real4LengthSquared(const a3real4p v);
+A3DM_INLINE a3real a3real4LengthSquared(const a3real4p v);
 
 // A3: Calculate inverse (reciprocal) squared length (magnitude) of vector.
 //	param v: input vector
 //	return: inverse squared length of vector: 1 / |v|^2
-A3_INLINE a3real a3real4LengthSquaredInverse(const a3real4p v);
+A3DM_INLINE a3real a3real4LengthSquaredInverse(const a3real4p v);
 
 // A3: Calculate length (magnitude) of vector.
 //	param v: input vector
 //	return: length of vector: |v|
-A3_INLINE a3real a3real4Length(const a3real4p v);
+A3DM_INLINE a3real a3real4Length(const a3real4p v);
 
 // A3: Calculate inverse (reciprocal) length (magnitude) of vector.
 //	param v: input vector
 //	return: inverse length of vector: 1 / |v|
-A3_INLINE a3real a3real4LengthInverse(const a3real4p v);
+A3DM_INLINE a3real a3real4LengthInverse(const a3real4p v);
 
 // A3: Get unit direction of vector.
 //	param v_out: output vector, direction of input: v / |v|
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real4r a3real4GetUnit(a3real4p v_out, const a3real4p v);
+A3DM_INLINE a3real4r a3real4GetUnit(a3real4p v_out, const a3real4p v);
 
 // A3: Normalize vector, making it unit length (direction).
 //	param v_inout: vector to normalize: v /= |v|
 //	return: v_inout
-A3_INLINE a3real4r a3real4Normalize(a3real4p v_inout);
+A3DM_INLINE a3real4r a3real4Normalize(a3real4p v_inout);
 
 // A3: Normalize vector, making it unit length (direction), get inverse length.
 //	param v_inout: vector to normalize: v /= |v|
 //	param invLength_out: pointer to variable capturing inverse length: 1 / |v|
 //	return: v_inout
-A3_INLINE a3real4r a3real4GetUnitInvLength(a3real4p v_out, const a3real4p v, a3real *invLen_out);
+A3DM_INLINE a3real4r a3real4GetUnitInvLength(a3real4p v_out, const a3real4p v, a3real *invLen_out);
 
 // A3: Get negative vector.
 //	param v_out: output vector, negative of input: -v
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real4r a3real4NormalizeGetInvLength(a3real4p v_inout, a3real *invLen_out);
+A3DM_INLINE a3real4r a3real4NormalizeGetInvLength(a3real4p v_inout, a3real *invLen_out);
 
 // A3: Get negative vector.
 //	param v_out: output vector, negative of input: -v
 //	param v: input vector
 //	return: v_out
-A3_INLINE a3real4r a3real4GetNegative(a3real4p v_out, const a3real4p v);
+A3DM_INLINE a3real4r a3real4GetNegative(a3real4p v_out, const a3real4p v);
 
 // A3: Negate vector.
 //	param v_inout: vector to negate: v = -v
 //	return: v_inout
-A3_INLINE a3real4r a3real4Negate(a3real4p v_inout);
+A3DM_INLINE a3real4r a3real4Negate(a3real4p v_inout);
 
 
 // A3: Calculate dot product (relative alignment) of two vectors.
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: dot product: vL dot vR
-A3_INLINE a3real a3real4Dot(const a3real4p vL, const a3real4p vR);
+A3DM_INLINE a3real a3real4Dot(const a3real4p vL, const a3real4p vR);
 
 // A3: Calculate squared distance between two vectors.
 //	param v0: input first vector
 //	param v1: input second vector
 //	return: squared distance between vectors: |v1 - v0|^2
-A3_INLINE a3real a3real4DistanceSquared(const a3real4p v0, const a3real4p v1);
+A3DM_INLINE a3real a3real4DistanceSquared(const a3real4p v0, const a3real4p v1);
 
 // A3: Calculate distance between two vectors.
 //	param v0: input first vector
 //	param v1: input second vector
 //	return: distance between vectors: |v1 - v0|
-A3_INLINE a3real a3real4Distance(const a3real4p v0, const a3real4p v1);
+A3DM_INLINE a3real a3real4Distance(const a3real4p v0, const a3real4p v1);
 
 // A3: Calculate size ratio of vector projection.
 //	param v: input vector to project
 //	param vBase: vector to project onto
 //	return: ratio of projected vector length to base vector length: 
 //		(v dot vBase) / |vBase|^2
-A3_INLINE a3real a3real4ProjRatio(const a3real4p v, const a3real4p vBase);
+A3DM_INLINE a3real a3real4ProjRatio(const a3real4p v, const a3real4p vBase);
 
 // A3: Calculate vector projection.
 //	param v_out: output of vector projection: v projected onto vBase
 //	param v: input vector to project
 //	param vBase: vector to project onto
 //	return: v_out
-A3_INLINE a3real4r a3real4Projected(a3real4p v_out, const a3real4p v, const a3real4p vBase);
+A3DM_INLINE a3real4r a3real4Projected(a3real4p v_out, const a3real4p v, const a3real4p vBase);
 
 // A3: Project vector.
 //	param v_inout: vector to project
 //	param vBase: vector to project onto
 //	return: v_inout
-A3_INLINE a3real4r a3real4Proj(a3real4p v_inout, const a3real4p vBase);
+A3DM_INLINE a3real4r a3real4Proj(a3real4p v_inout, const a3real4p vBase);
 
 // A3: Calculate vector projection and get projection ratio.
 //	param v_out: output of vector projection: v projected onto vBase
@@ -1568,7 +1568,7 @@ A3_INLINE a3real4r a3real4Proj(a3real4p v_inout, const a3real4p vBase);
 //	param ratio_out: pointer to variable capturing projection ratio: 
 //		(v dot vBase) / |vBase|^2
 //	return: v_out
-A3_INLINE a3real4r a3real4ProjectedGetRatio(a3real4p v_out, const a3real4p v, const a3real4p vBase, a3real *ratio_out);
+A3DM_INLINE a3real4r a3real4ProjectedGetRatio(a3real4p v_out, const a3real4p v, const a3real4p vBase, a3real *ratio_out);
 
 // A3: Project vector and get projection ratio.
 //	param v_inout: vector to project
@@ -1576,85 +1576,85 @@ A3_INLINE a3real4r a3real4ProjectedGetRatio(a3real4p v_out, const a3real4p v, co
 //	param ratio_out: pointer to variable capturing projection ratio: 
 //		(v dot vBase) / |vBase|^2
 //	return: v_inout
-A3_INLINE a3real4r a3real4ProjGetRatio(a3real4p v_inout, const a3real4p vBase, a3real *ratio_out);
+A3DM_INLINE a3real4r a3real4ProjGetRatio(a3real4p v_inout, const a3real4p vBase, a3real *ratio_out);
 
 // A3: Calculate sum of vectors.
 //	param v_out: output vector to store sum of two inputs
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real4r a3real4Sum(a3real4p v_out, const a3real4p vL, const a3real4p vR);
+A3DM_INLINE a3real4r a3real4Sum(a3real4p v_out, const a3real4p vL, const a3real4p vR);
 
 // A3: Calculate difference of vectors.
 //	param v_out: output vector to store difference of two inputs
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real4r a3real4Diff(a3real4p v_out, const a3real4p vL, const a3real4p vR);
+A3DM_INLINE a3real4r a3real4Diff(a3real4p v_out, const a3real4p vL, const a3real4p vR);
 
 // A3: Calculate product of vector and scalar.
 //	param v_out: output vector to store scaled vector
 //	param v: input vector to be scaled
 //	param s: scalar by which to multiply vector
 //	return: v_out
-A3_INLINE a3real4r a3real4ProductS(a3real4p v_out, const a3real4p v, const a3real s);
+A3DM_INLINE a3real4r a3real4ProductS(a3real4p v_out, const a3real4p v, const a3real s);
 
 // A3: Calculate quotient of vector and scalar.
 //	param v_out: output vector to store scaled vector
 //	param v: input vector to be scaled, numerator
 //	param s: scalar by which to divide vector, denominator
 //	return: v_out
-A3_INLINE a3real4r a3real4QuotientS(a3real4p v_out, const a3real4p v, const a3real s);
+A3DM_INLINE a3real4r a3real4QuotientS(a3real4p v_out, const a3real4p v, const a3real s);
 
 // A3: Calculate component-wise product of two vectors.
 //	param v_out: output vector to store product vector: vL * vR components
 //	param vL: input left side vector
 //	param vR: input right side vector
 //	return: v_out
-A3_INLINE a3real4r a3real4ProductComp(a3real4p v_out, const a3real4p vL, const a3real4p vR);
+A3DM_INLINE a3real4r a3real4ProductComp(a3real4p v_out, const a3real4p vL, const a3real4p vR);
 
 // A3: Calculate component-wise quotient of two vectors.
 //	param v_out: output vector to store quotient vector: vL / vR components
 //	param vL: input left side vector, numerator
 //	param vR: input right side vector, denominator
 //	return: v_out
-A3_INLINE a3real4r a3real4QuotientComp(a3real4p v_out, const a3real4p vL, const a3real4p vR);
+A3DM_INLINE a3real4r a3real4QuotientComp(a3real4p v_out, const a3real4p vL, const a3real4p vR);
 
 // A3: Add vectors and store to left operand.
 //	param vL_inout: left side vector to which to add
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real4r a3real4Add(a3real4p vL_inout, const a3real4p vR);
+A3DM_INLINE a3real4r a3real4Add(a3real4p vL_inout, const a3real4p vR);
 
 // A3: Subtract vectors and store to left operand.
 //	param vL_inout: left side vector from which to subtract
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real4r a3real4Sub(a3real4p vL_inout, const a3real4p vR);
+A3DM_INLINE a3real4r a3real4Sub(a3real4p vL_inout, const a3real4p vR);
 
 // A3: Multiply vector by scalar.
 //	param v_inout: vector to scale
 //	param s: scalar by which to multiply vector
 //	return: v_inout
-A3_INLINE a3real4r a3real4MulS(a3real4p v_inout, const a3real s);
+A3DM_INLINE a3real4r a3real4MulS(a3real4p v_inout, const a3real s);
 
 // A3: Divide vector by scalar.
 //	param v_inout: vector to scale, numerator
 //	param s: scalar by which to multiply vector, denominator
 //	return: v_inout
-A3_INLINE a3real4r a3real4DivS(a3real4p v_inout, const a3real s);
+A3DM_INLINE a3real4r a3real4DivS(a3real4p v_inout, const a3real s);
 
 // A3: Component-wise product of two vectors, store in left operand.
 //	param vL_inout: left side vector to multiply and store: vL *= vR components
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real4r a3real4MulComp(a3real4p vL_inout, const a3real4p vR);
+A3DM_INLINE a3real4r a3real4MulComp(a3real4p vL_inout, const a3real4p vR);
 
 // A3: Component-wise quotient of two vectors, store in left operand.
 //	param vL_inout: left side vector to divide and store: vL /= vR components
 //	param vR: input right side vector
 //	return: vL_inout
-A3_INLINE a3real4r a3real4DivComp(a3real4p vL_inout, const a3real4p vR);
+A3DM_INLINE a3real4r a3real4DivComp(a3real4p vL_inout, const a3real4p vR);
 
 
 // A3: Linear interpolation ("LERP"): calculate linear interpolation between 
@@ -1666,7 +1666,7 @@ A3_INLINE a3real4r a3real4DivComp(a3real4p vL_inout, const a3real4p vR);
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real4r a3real4Lerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
+A3DM_INLINE a3real4r a3real4Lerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
 
 // A3: Normalized linear interpolation ("NLERP"): calculate lerp between 
 //		reference vectors 'v0' and 'v1' using a interpolation parameter 
@@ -1678,7 +1678,7 @@ A3_INLINE a3real4r a3real4Lerp(a3real4p v_out, const a3real4p v0, const a3real4p
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real4r a3real4NLerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
+A3DM_INLINE a3real4r a3real4NLerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
 
 // A3: Bi-linear interpolation: calculate lerp between each range of numbers, 
 //		[v00, v01] and [v10, v11], and then calculate lerp between the results.
@@ -1690,7 +1690,7 @@ A3_INLINE a3real4r a3real4NLerp(a3real4p v_out, const a3real4p v0, const a3real4
 //	param param0: parameter for interpolation within ranges (lerp)
 //	param param1: parameter for blending results of lerp (bi-lerp)
 //	return: v_out
-A3_INLINE a3real4r a3real4Bilerp(a3real4p v_out, const a3real4p v00, const a3real4p v01, const a3real4p v10, const a3real4p v11, const a3real param0, const a3real param1);
+A3DM_INLINE a3real4r a3real4Bilerp(a3real4p v_out, const a3real4p v00, const a3real4p v01, const a3real4p v10, const a3real4p v11, const a3real param0, const a3real param1);
 
 // A3: Tri-linear interpolation: calculate bi-lerp between each set of ranges, 
 //		then lerp between the results.
@@ -1707,7 +1707,7 @@ A3_INLINE a3real4r a3real4Bilerp(a3real4p v_out, const a3real4p v00, const a3rea
 //	param param1: parameter for blending in sets 000-011 and 100-111 (bi-lerp)
 //	param param2: parameter for blending results of bi-lerp (tri-lerp)
 //	return: v_out
-A3_INLINE a3real4r a3real4Trilerp(a3real4p v_out, const a3real4p v000, const a3real4p v001, const a3real4p v010, const a3real4p v011, const a3real4p v100, const a3real4p v101, const a3real4p v110, const a3real4p v111, const a3real param0, const a3real param1, const a3real param2);
+A3DM_INLINE a3real4r a3real4Trilerp(a3real4p v_out, const a3real4p v000, const a3real4p v001, const a3real4p v010, const a3real4p v011, const a3real4p v100, const a3real4p v101, const a3real4p v110, const a3real4p v111, const a3real param0, const a3real param1, const a3real param2);
 
 // A3: Catmull-Rom spline interpolation.
 //	param v_out: output interpolated vector
@@ -1718,7 +1718,7 @@ A3_INLINE a3real4r a3real4Trilerp(a3real4p v_out, const a3real4p v000, const a3r
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real4r a3real4CatmullRom(a3real4p v_out, const a3real4p vPrev, const a3real4p v0, const a3real4p v1, const a3real4p vNext, const a3real param);
+A3DM_INLINE a3real4r a3real4CatmullRom(a3real4p v_out, const a3real4p vPrev, const a3real4p v0, const a3real4p v1, const a3real4p vNext, const a3real param);
 
 // A3: Cubic Hermite spline (c-spline) interpolation using control handles.
 //	param v_out: output interpolated vector
@@ -1729,7 +1729,7 @@ A3_INLINE a3real4r a3real4CatmullRom(a3real4p v_out, const a3real4p vPrev, const
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real4r a3real4HermiteControl(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p vControl0, const a3real4p vControl1, const a3real param);
+A3DM_INLINE a3real4r a3real4HermiteControl(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p vControl0, const a3real4p vControl1, const a3real param);
 
 // A3: Cubic Hermite spline (c-spline) interpolation using control tangents.
 //	param v_out: output interpolated vector
@@ -1740,14 +1740,14 @@ A3_INLINE a3real4r a3real4HermiteControl(a3real4p v_out, const a3real4p v0, cons
 //	param param: interpolation parameter (t)
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real4r a3real4HermiteTangent(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p vTangent0, const a3real4p vTangent1, const a3real param);
+A3DM_INLINE a3real4r a3real4HermiteTangent(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p vTangent0, const a3real4p vTangent1, const a3real param);
 
 // A3: Bezier interpolation of order/degree zero (constant).
 //	param v_out: output interpolated vector
 //	param v0: first control vector
 //	param param: interpolation parameter (t), not used
 //	return: v_out
-A3_INLINE a3real4r a3real4Bezier0(a3real4p v_out, const a3real4p v0, const a3real param);
+A3DM_INLINE a3real4r a3real4Bezier0(a3real4p v_out, const a3real4p v0, const a3real param);
 
 // A3: Bezier interpolation of first order/degree (linear).
 //	param v_out: output interpolated vector
@@ -1756,7 +1756,7 @@ A3_INLINE a3real4r a3real4Bezier0(a3real4p v_out, const a3real4p v0, const a3rea
 //	param param: interpolation parameter (t), used for lerp; 
 //		result at t=0 is v0, result at t=1 is v1
 //	return: v_out
-A3_INLINE a3real4r a3real4Bezier1(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
+A3DM_INLINE a3real4r a3real4Bezier1(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
 
 // A3: Bezier interpolation of second order/degree (quadratic).
 //	param v_out: output interpolated vector
@@ -1766,7 +1766,7 @@ A3_INLINE a3real4r a3real4Bezier1(a3real4p v_out, const a3real4p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v0, result at t=1 is v2
 //	return: v_out
-A3_INLINE a3real4r a3real4Bezier2(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real param);
+A3DM_INLINE a3real4r a3real4Bezier2(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real param);
 
 // A3: Bezier interpolation of third order/degree (cubic).
 //	param v_out: output interpolated vector
@@ -1777,7 +1777,7 @@ A3_INLINE a3real4r a3real4Bezier2(a3real4p v_out, const a3real4p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v0, result at t=1 is v3
 //	return: v_out
-A3_INLINE a3real4r a3real4Bezier3(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3, const a3real param);
+A3DM_INLINE a3real4r a3real4Bezier3(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3, const a3real param);
 
 // A3: Recursive Bezier interpolation of higher order (quartic, etc.).
 //	param v_out: output interpolated vector
@@ -1786,7 +1786,7 @@ A3_INLINE a3real4r a3real4Bezier3(a3real4p v_out, const a3real4p v0, const a3rea
 //	param param: interpolation parameter (t), used for recursive lerp; 
 //		result at t=0 is v[0], result at t=1 is v[order_N]
 //	return: v_out
-A3_INLINE a3real4r a3real4BezierN(a3real4p v_out, a3count order_N, const a3real4 v[], const a3real param);
+A3DM_INLINE a3real4r a3real4BezierN(a3real4p v_out, a3count order_N, const a3real4 v[], const a3real param);
 
 // A3: Spherical linear interpolation ("SLERP"): interpolation along the arc 
 //		with a uniform rate of change; improves on nlerp which yields the same 
@@ -1797,7 +1797,7 @@ A3_INLINE a3real4r a3real4BezierN(a3real4p v_out, a3count order_N, const a3real4
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real4r a3real4Slerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
+A3DM_INLINE a3real4r a3real4Slerp(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
 
 // A3: Spherical linear interpolation ("SLERP"): interpolation along the arc 
 //		with a uniform rate of change; improves on nlerp which yields the same 
@@ -1809,7 +1809,7 @@ A3_INLINE a3real4r a3real4Slerp(a3real4p v_out, const a3real4p v0, const a3real4
 //	param param: interpolation parameter; t values in [0, 1] result in 
 //		interpolation, others yield extrapolation
 //	return: v_out
-A3_INLINE a3real4r a3real4SlerpUnit(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
+A3DM_INLINE a3real4r a3real4SlerpUnit(a3real4p v_out, const a3real4p v0, const a3real4p v1, const a3real param);
 
 // A3: Calculate arc length of a Catmull-Rom curve segment.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1824,7 +1824,7 @@ A3_INLINE a3real4r a3real4SlerpUnit(a3real4p v_out, const a3real4p v0, const a3r
 //	param v1: goal/end control vector of curve segment
 //	param vNext: next control vector (after v1)
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthCatmullRom(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p vPrev, const a3real4p v0, const a3real4p v1, const a3real4p vNext);
+A3DM_INLINE a3real a3real4CalculateArcLengthCatmullRom(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p vPrev, const a3real4p v0, const a3real4p v1, const a3real4p vNext);
 
 // A3: Calculate arc length of a cubic Hermite curve segment with handles.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1839,7 +1839,7 @@ A3_INLINE a3real a3real4CalculateArcLengthCatmullRom(a3real4 sampleTable_out[],
 //	param vControl0: control handle corresponding to v0
 //	param vControl1: control handle corresponding to v1
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthHermiteControl(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p vControl0, const a3real4p vControl1);
+A3DM_INLINE a3real a3real4CalculateArcLengthHermiteControl(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p vControl0, const a3real4p vControl1);
 
 // A3: Calculate arc length of a cubic Hermite curve segment with tangents.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1854,7 +1854,7 @@ A3_INLINE a3real a3real4CalculateArcLengthHermiteControl(a3real4 sampleTable_out
 //	param vControl0: control tangent corresponding to v0
 //	param vControl1: control tangent corresponding to v1
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthHermiteTangent(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p vTangent0, const a3real4p vTangent1);
+A3DM_INLINE a3real a3real4CalculateArcLengthHermiteTangent(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p vTangent0, const a3real4p vTangent1);
 
 // A3: Calculate arc length of order zero Bezier curve (constant); this is 
 //		an odd one to make an appearance because it always returns zero, but 
@@ -1869,7 +1869,7 @@ A3_INLINE a3real a3real4CalculateArcLengthHermiteTangent(a3real4 sampleTable_out
 //	param v0: first control vector
 //	param param: interpolation parameter (t), not used
 //	return: zero
-A3_INLINE a3real a3real4CalculateArcLengthBezier0(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0);
+A3DM_INLINE a3real a3real4CalculateArcLengthBezier0(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0);
 
 // A3: Calculate arc length of first order Bezier curve (linear).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1882,7 +1882,7 @@ A3_INLINE a3real a3real4CalculateArcLengthBezier0(a3real4 sampleTable_out[], a3r
 //	param v0: first control vector
 //	param v1: second control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthBezier1(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1);
+A3DM_INLINE a3real a3real4CalculateArcLengthBezier1(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1);
 
 // A3: Calculate arc length of second order Bezier curve (quadratic).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1896,7 +1896,7 @@ A3_INLINE a3real a3real4CalculateArcLengthBezier1(a3real4 sampleTable_out[], a3r
 //	param v1: second control vector
 //	param v2: third control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthBezier2(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p v2);
+A3DM_INLINE a3real a3real4CalculateArcLengthBezier2(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p v2);
 
 // A3: Calculate arc length of third order Bezier curve (cubic).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1911,7 +1911,7 @@ A3_INLINE a3real a3real4CalculateArcLengthBezier2(a3real4 sampleTable_out[], a3r
 //	param v2: third control vector
 //	param v3: fourth control vector
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthBezier3(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3);
+A3DM_INLINE a3real a3real4CalculateArcLengthBezier3(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p v3);
 
 // A3: Calculate arc length of higher-order Bezier curve (quartic, etc.).
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1924,7 +1924,7 @@ A3_INLINE a3real a3real4CalculateArcLengthBezier3(a3real4 sampleTable_out[], a3r
 //	param order_N: order/degree of function (4 for quartic, etc.)
 //	param v: array of control vectors
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthBezierN(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real4 v[]);
+A3DM_INLINE a3real a3real4CalculateArcLengthBezierN(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3count order_N, const a3real4 v[]);
 
 // A3: Calculate arc length of a slerp curve segment.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1937,7 +1937,7 @@ A3_INLINE a3real a3real4CalculateArcLengthBezierN(a3real4 sampleTable_out[], a3r
 //	param v0: initial control vector of curve segment
 //	param v1: goal/end control vector of curve segment
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthSlerp(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1);
+A3DM_INLINE a3real a3real4CalculateArcLengthSlerp(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1);
 
 // A3: Calculate arc length of a slerp curve segment with unit length inputs.
 //	param sampleTable_out: array of samples captured while calculating length
@@ -1950,7 +1950,7 @@ A3_INLINE a3real a3real4CalculateArcLengthSlerp(a3real4 sampleTable_out[], a3rea
 //	param v0: initial control vector of curve segment
 //	param v1: goal/end control vector of curve segment
 //	return: total arc length of segment; zero if invalid params
-A3_INLINE a3real a3real4CalculateArcLengthSlerpUnit(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1);
+A3DM_INLINE a3real a3real4CalculateArcLengthSlerpUnit(a3real4 sampleTable_out[], a3real paramTable_out[], a3real arclenTable_out[], const a3boolean autoNormalize, const a3count numDivisions, const a3real4p v0, const a3real4p v1);
 
 
 // A3: Gram-Schmidt orthogonalization: flatten the input vector so that it 
@@ -1960,7 +1960,7 @@ A3_INLINE a3real a3real4CalculateArcLengthSlerpUnit(a3real4 sampleTable_out[], a
 //	param v: vector to orthogonalize
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v_out
-A3_INLINE a3real4r a3real4GramSchmidtOrtho(a3real4p v_out, const a3real4p v, const a3real4p vBase);
+A3DM_INLINE a3real4r a3real4GramSchmidtOrtho(a3real4p v_out, const a3real4p v, const a3real4p vBase);
 
 // A3: Gram-Schmidt orthogonalization for multiple vectors.
 //	param v0_out: result of Gram-Schmidt process on first vector
@@ -1969,7 +1969,7 @@ A3_INLINE a3real4r a3real4GramSchmidtOrtho(a3real4p v_out, const a3real4p v, con
 //	param v1: second vector to orthogonalize
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v1_out
-A3_INLINE a3real4r a3real4GramSchmidtOrtho2(a3real4p v0_out, a3real4p v1_out, const a3real4p v0, const a3real4p v1, const a3real4p vBase);
+A3DM_INLINE a3real4r a3real4GramSchmidtOrtho2(a3real4p v0_out, a3real4p v1_out, const a3real4p v0, const a3real4p v1, const a3real4p vBase);
 
 // A3: Gram-Schmidt orthogonalization for multiple vectors.
 //	param v0_out: result of Gram-Schmidt process on first vector
@@ -1980,20 +1980,20 @@ A3_INLINE a3real4r a3real4GramSchmidtOrtho2(a3real4p v0_out, a3real4p v1_out, co
 //	param v2: third vector to orthogonalize
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v2_out
-A3_INLINE a3real4r a3real4GramSchmidtOrtho3(a3real4p v0_out, a3real4p v1_out, a3real4p v2_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p vBase);
+A3DM_INLINE a3real4r a3real4GramSchmidtOrtho3(a3real4p v0_out, a3real4p v1_out, a3real4p v2_out, const a3real4p v0, const a3real4p v1, const a3real4p v2, const a3real4p vBase);
 
 // A3: Gram-Schmidt orthogonalize.
 //	param v_inout: vector to orthogonalize and store
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v_out
-A3_INLINE a3real4r a3real4GramSchmidt(a3real4p v_inout, const a3real4p vBase);
+A3DM_INLINE a3real4r a3real4GramSchmidt(a3real4p v_inout, const a3real4p vBase);
 
 // A3: Gram-Schmidt orthogonalize multiple vectors.
 //	param v0_inout: first vector to orthogonalize and store
 //	param v1_inout: second vector to orthogonalize and store
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v1_out
-A3_INLINE a3real4r a3real4GramSchmidt2(a3real4p v0_inout, a3real4p v1_inout, const a3real4p vBase);
+A3DM_INLINE a3real4r a3real4GramSchmidt2(a3real4p v0_inout, a3real4p v1_inout, const a3real4p vBase);
 
 // A3: Gram-Schmidt orthogonalize multiple vectors.
 //	param v0_inout: first vector to orthogonalize and store
@@ -2001,7 +2001,7 @@ A3_INLINE a3real4r a3real4GramSchmidt2(a3real4p v0_inout, a3real4p v1_inout, con
 //	param v2_inout: third vector to orthogonalize and store
 //	param vBase: fixed base vector to orthogonalize against
 //	return: v2_out
-A3_INLINE a3real4r a3real4GramSchmidt3(a3real4p v0_inout, a3real4p v1_inout, a3real4p v2_inout, const a3real4p vBase);
+A3DM_INLINE a3real4r a3real4GramSchmidt3(a3real4p v0_inout, a3real4p v1_inout, a3real4p v2_inout, const a3real4p vBase);
 
 
 //-----------------------------------------------------------------------------
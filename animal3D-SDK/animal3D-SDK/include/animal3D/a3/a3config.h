@@ -54,15 +54,34 @@
 
 
 // inline declaration
-#ifdef A3_OPEN_SOURCE
-#define A3_INLINE	static inline
-#define A3_GLOBAL	static
-#else	// !A3_OPEN_SOURCE
 #define A3_INLINE	inline
 #define A3_GLOBAL
+
+
+// math library (A3DM) inline declaration: built from source, every 
+//	function is defined in every unit that includes it; otherwise the 
+//	prebuilt library provides the definitions
+#ifdef A3_OPEN_SOURCE
+#define A3DM_INLINE	static inline
+#define A3DM_GLOBAL	static
+#else	// !A3_OPEN_SOURCE
+#define A3DM_INLINE	inline
+#define A3DM_GLOBAL
 #endif	// A3_OPEN_SOURCE
 
 
+// math library mutable state (e.g. tables, seeds): built from source, 
+//	the state is declared in every unit and defined in exactly one unit, 
+//	which defines A3DM_DEFINE_STATE before including the library
+#if (defined A3_OPEN_SOURCE && !defined A3DM_DEFINE_STATE)
+#define A3DM_STATE				extern
+#define A3DM_STATE_INIT(value)	
+#else	// !(A3_OPEN_SOURCE && !A3DM_DEFINE_STATE)
+#define A3DM_STATE				
+#define A3DM_STATE_INIT(value)	= value
+#endif	// (A3_OPEN_SOURCE && !A3DM_DEFINE_STATE)
+
+
 // begin and end definitions, namespace macros (if applicable)
 #ifdef __cplusplus
 #define A3_BEGIN		//namespace a3dm {
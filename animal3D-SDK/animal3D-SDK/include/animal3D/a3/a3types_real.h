@@ -31,23 +31,16 @@
 
 //-----------------------------------------------------------------------------
 // intrinsics include
-
-#ifdef A3_USING_INTRIN
-//-----------------------------------------------------------------------------
-// unsupported feature message
-#pragma message ("\
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// \n\
-/// ****A3 WARNING**** User specified A3_USING_INTRIN not supported in current version; undefining INTRIN macro.            /// \n\
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////   ")
-#undef A3_USING_INTRIN
-//-----------------------------------------------------------------------------
-#endif	// A3_USING_INTRIN
-
+//	SSE4.1 is the baseline; AVX, AVX2 and FMA are used when the compiler 
+//	targets them (e.g. /arch:AVX2 or -mavx2 -mfma)
 
 #ifdef A3_USING_INTRIN
 #ifndef A3_INTRIN_INCLUDED
 #define A3_INTRIN_INCLUDED
-#include <xmmintrin.h>
+#include <smmintrin.h>
+#if (defined __AVX__ || defined __AVX2__)
+#include <immintrin.h>
+#endif	// (defined __AVX__ || defined __AVX2__)
 #endif	// !A3_INTRIN_INCLUDED
 #endif	// A3_USING_INTRIN
 
@@ -68,28 +61,9 @@ typedef long double			a3f128;
 
 // aliases for decimal (real) number types
 #ifdef A3_USING_INTRIN
-// f32 is real (float)
+// f32 is real (float); intrinsic registers are only used inside the math 
+//	implementation, storage remains plain arrays so components stay indexable
 typedef a3f32				a3real;
-
-// define vector base types and their pointers as intrinsic types
-typedef __m64				a3real2[1];	// 2 floats
-typedef __m128				a3real3[1];	// 3 floats + 1 pad
-typedef __m128				a3real4[1]; // 4 floats
-
-// define parameter (p), return (r) and const return (rk) types as pointers
-typedef __m64				a3real2p[], *a3real2r;
-typedef __m128				a3real3p[], *a3real3r;
-typedef __m128				a3real4p[], *a3real4r;
-typedef __m64	const		*a3real2rk;
-typedef __m128	const		*a3real3rk;
-typedef __m128	const		*a3real4rk;
-
-// padding argument for 3D vector base
-// used in places where the size of a 3D vector matters
-// e.g. param in creating a 3D matrix
-#define A3PAD(a,b)	,__pad##a##b 
-#define A3PAD0		,a3real_zero 
-
 #else	// !A3_USING_INTRIN
 #ifdef A3_REAL_F64
 // f64 is real (double)
@@ -103,6 +77,7 @@ typedef a3f128				a3real;
 typedef a3f32				a3real;
 #endif	// A3_REAL_F128
 #endif	// A3_REAL_F64
+#endif	// A3_USING_INTRIN
 
 // define vector base types and their pointers as arrays of real
 typedef a3real				a3real2[2], a3real3[3], a3real4[4];
@@ -115,7 +90,6 @@ typedef a3real	const		*a3real2rk, *a3real3rk, *a3real4rk;
 #define A3PAD(a,b)	
 #define A3PAD0		
 
-#endif	// A3_USING_INTRIN
 
 // multi-dimensional arrays for a variety of matrix base types and pointers
 typedef a3real2				a3real2x2[2], a3real2x3[3], a3real2x4[4];
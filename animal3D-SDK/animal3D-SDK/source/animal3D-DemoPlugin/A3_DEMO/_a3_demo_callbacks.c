@@ -114,6 +114,8 @@ void a3demo_unloadValidate(a3_DemoState const* demoState);
 //-----------------------------------------------------------------------------
 
 void a3starter_load(a3_DemoState const* demoState, a3_DemoMode0_Starter* demoMode);
+void a3starter_unload(a3_DemoState const* demoState, a3_DemoMode0_Starter* demoMode);
+void a3starter_unloadJobs(a3_DemoState const* demoState, a3_DemoMode0_Starter* demoMode);
 
 void a3starter_loadValidate(a3_DemoState const* demoState, a3_DemoMode0_Starter* demoMode);
 
@@ -160,6 +162,9 @@ void a3demo_unload(a3_DemoState* demoState)
 	a3demo_unloadShaders(demoState);
 	a3demo_unloadTextures(demoState);
 	a3demo_unloadFramebuffers(demoState);
+
+	// demo modes
+	a3starter_unload(demoState, demoState->demoMode0_starter);
 }
 
 
@@ -272,7 +277,8 @@ A3DYLIBSYMBOL a3_DemoState *a3demoCB_unload(a3_DemoState *demoState, a3boolean h
 {
 	// release things that need releasing always, whether hotbuilding or not
 	// e.g. kill thread
-	// nothing in this example, but then...
+	if (demoState)
+		a3starter_unloadJobs(demoState, demoState->demoMode0_starter);
 
 	// release persistent state if not hotbuilding
 	// good idea to release in reverse order that things were loaded...
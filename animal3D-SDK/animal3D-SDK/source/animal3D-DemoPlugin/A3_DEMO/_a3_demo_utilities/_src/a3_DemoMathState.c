@@ -0,0 +1,31 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_DemoMathState.c
+	Single definition of the math library state (trig table, random seed) 
+		when the math library is built from source (A3_OPEN_SOURCE); 
+		every other unit only declares it.
+*/
+
+#define A3DM_DEFINE_STATE
+#include "animal3D-A3DM/animal3D-A3DM.h"
+
+
+//-----------------------------------------------------------------------------
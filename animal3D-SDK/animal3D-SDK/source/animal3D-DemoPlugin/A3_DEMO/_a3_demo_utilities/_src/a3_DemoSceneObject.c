@@ -147,6 +147,58 @@ extern inline void a3demo_updateModelMatrixStack(a3_DemoModelMatrixStack* model,
 	a3real4x4SetReal4x4(model->atlasMat.m, atlasMat);
 }
 
+extern inline void a3demo_updateModelMatrixStackArray(a3_DemoModelMatrixStack* modelBase, a3_DemoSceneObject const* sceneObjectBase, a3ui32 const count, a3real4x4p const projectionMat_viewer, a3real4x4p const modelMat_viewer, a3real4x4p const modelMatInv_viewer, a3real4x4p const atlasMat)
+{
+	// same results as updating each stack, but objects are gathered into 
+	//	contiguous blocks so each step runs over a whole block at once
+#ifdef A3_OPEN_SOURCE
+	a3mat4 modelMat[16], modelMatInv[16], modelViewMat[16], modelViewMatInv[16], inverseTranspose[16];
+	a3ui32 i, j, n;
+	for (i = 0; i < count; i += n)
+	{
+		n = a3minimum(count - i, 16);
+		for (j = 0; j < n; ++j)
+			modelMat[j] = sceneObjectBase[i + j].modelMat;
+
+		a3real4x4TransformInverseArray(&modelMatInv->m, &modelMat->m, n);
+		a3real4x4ProductArrayUniformL(&modelViewMat->m, modelMatInv_viewer, &modelMat->m, n);
+		a3real4x4ProductArrayUniformR(&modelViewMatInv->m, &modelMatInv->m, modelMat_viewer, n);
+		for (j = 0; j < n; ++j)
+		{
+			modelBase[i + j].modelMat = modelMat[j];
+			modelBase[i + j].modelMatInverse = modelMatInv[j];
+			modelBase[i + j].modelViewMat = modelViewMat[j];
+			modelBase[i + j].modelViewMatInverse = modelViewMatInv[j];
+			a3real4x4SetReal4x4(modelBase[i + j].atlasMat.m, atlasMat);
+		}
+
+		// inverse-transposes with the bottom row cleared
+		a3real4x4TransformInverseTransposeArray(&inverseTranspose->m, &modelMat->m, n);
+		for (j = 0; j < n; ++j)
+		{
+			inverseTranspose[j].m03 = inverseTranspose[j].m13 = inverseTranspose[j].m23 = inverseTranspose[j].m33 = a3real_zero;
+			modelBase[i + j].modelMatInverseTranspose = inverseTranspose[j];
+		}
+		a3real4x4TransformInverseTransposeArray(&inverseTranspose->m, &modelViewMat->m, n);
+		for (j = 0; j < n; ++j)
+		{
+			inverseTranspose[j].m03 = inverseTranspose[j].m13 = inverseTranspose[j].m23 = inverseTranspose[j].m33 = a3real_zero;
+			modelBase[i + j].modelViewMatInverseTranspose = inverseTranspose[j];
+		}
+
+		// reuse the block for model-view-projection
+		a3real4x4ProductArrayUniformL(&modelMat->m, projectionMat_viewer, &modelViewMat->m, n);
+		for (j = 0; j < n; ++j)
+			modelBase[i + j].modelViewProjectionMat = modelMat[j];
+	}
+#else	// !A3_OPEN_SOURCE
+	// the prebuilt math library has no array kernels: one stack at a time
+	a3ui32 i;
+	for (i = 0; i < count; ++i)
+		a3demo_updateModelMatrixStack(modelBase + i, projectionMat_viewer, modelMat_viewer, modelMatInv_viewer, sceneObjectBase[i].modelMat.m, atlasMat);
+#endif	// A3_OPEN_SOURCE
+}
+
 extern inline void a3demo_updateViewerMatrixStack(a3_DemoViewerMatrixStack* viewer, a3real4x4p const modelMat_viewer, a3real4x4p const modelMatInv_viewer, a3real4x4p const projectionMat, a3real4x4p const projectionMatInv, a3real4x4p const biasMat, a3real4x4p const biasMatInv)
 {
 	a3real4x4SetReal4x4(viewer->projectionMat.m, projectionMat);
@@ -128,6 +128,7 @@ extern "C"
 	inline void a3demo_resetModelMatrixStack(a3_DemoModelMatrixStack* model);
 	inline void a3demo_resetViewerMatrixStack(a3_DemoViewerMatrixStack* viewer);
 	inline void a3demo_updateModelMatrixStack(a3_DemoModelMatrixStack* model, a3real4x4p const projectionMat_viewer, a3real4x4p const modelMat_viewer, a3real4x4p const modelMatInv_viewer, a3real4x4p const modelMat, a3real4x4p const atlasMat);
+	inline void a3demo_updateModelMatrixStackArray(a3_DemoModelMatrixStack* modelBase, a3_DemoSceneObject const* sceneObjectBase, a3ui32 const count, a3real4x4p const projectionMat_viewer, a3real4x4p const modelMat_viewer, a3real4x4p const modelMatInv_viewer, a3real4x4p const atlasMat);
 	inline void a3demo_updateViewerMatrixStack(a3_DemoViewerMatrixStack* viewer, a3real4x4p const modelMat_viewer, a3real4x4p const modelMatInv_viewer, a3real4x4p const projectionMat, a3real4x4p const projectionMatInv, a3real4x4p const biasMat, a3real4x4p const biasMatInv);
 
 
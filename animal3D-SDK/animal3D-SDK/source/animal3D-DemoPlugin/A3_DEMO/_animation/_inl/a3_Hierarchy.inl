@@ -50,14 +50,27 @@ A3_INLINE a3ret a3hierarchyIsSiblingNode(const a3_Hierarchy *hierarchy, const a3
 	return -1;
 }
 
+A3_INLINE a3ret a3hierarchyGetChildren(const a3ui32 **children_out, const a3_Hierarchy *hierarchy, const a3ui32 index)
+{
+	if (children_out && hierarchy && hierarchy->topology->child && index < hierarchy->numNodes)
+	{
+		*children_out = hierarchy->topology->child + hierarchy->topology->childOffset[index];
+		return (hierarchy->topology->childOffset[index + 1] - hierarchy->topology->childOffset[index]);
+	}
+	return -1;
+}
+
 A3_INLINE a3ret a3hierarchyIsAncestorNode(const a3_Hierarchy *hierarchy, const a3ui32 ancestorIndex, const a3ui32 otherIndex)
 {
-	a3ui32 i = otherIndex;
+	a3i32 i = otherIndex;
 	if (hierarchy && hierarchy->nodes && otherIndex < hierarchy->numNodes && ancestorIndex < hierarchy->numNodes)
 	{
-		while (i > ancestorIndex)
+		// pre-order range check
+		if (hierarchy->topology->order)
+			return (hierarchy->topology->order[otherIndex] - hierarchy->topology->order[ancestorIndex] < hierarchy->topology->subtreeSize[ancestorIndex]);
+		while (i > (a3i32)ancestorIndex)
 			i = hierarchy->nodes[i].parentIndex;
-		return (i == ancestorIndex);
+		return (i == (a3i32)ancestorIndex);
 	}
 	return -1;
 }
@@ -53,18 +53,40 @@ inline a3i32 a3hierarchyPoseGroupGetNodePoseOffsetIndex(const a3_HierarchyPoseGr
 
 //-----------------------------------------------------------------------------
 
-// update inverse object-space matrices
-inline a3i32 a3hierarchyStateUpdateObjectInverse(const a3_HierarchyState *state, const a3boolean usingScale)
+// mark node dirty
+inline a3i32 a3hierarchyStateSetDirty(const a3_HierarchyState *state, const a3ui32 nodeIndex)
 {
+	if (state && state->dirty && nodeIndex < state->poseGroup->hierarchy->numNodes)
+	{
+		state->dirty[nodeIndex >> 5] |= (1u << (nodeIndex & 31));
+		return 1;
+	}
 	return -1;
 }
 
-// update bind-to-current given bind-pose object-space transforms
-inline a3i32 a3hierarchyStateUpdateObjectBindToCurrent(const a3_HierarchyState *state, const a3_HierarchyTransform *objectSpaceBindInverse)
+// mark all nodes dirty
+inline a3i32 a3hierarchyStateSetDirtyAll(const a3_HierarchyState *state)
 {
+	if (state && state->dirty)
+	{
+		const a3ui32 nodeCount = state->poseGroup->hierarchy->numNodes;
+		a3ui32 i;
+		for (i = 0; i < (nodeCount >> 5); ++i)
+			state->dirty[i] = 0xffffffff;
+		if (nodeCount & 31)
+			state->dirty[i] = (1u << (nodeCount & 31)) - 1;
+		return nodeCount;
+	}
 	return -1;
 }
 
+// check if node is dirty
+inline a3boolean a3hierarchyStateIsDirty(const a3_HierarchyState *state, const a3ui32 nodeIndex)
+{
+	return (state && state->dirty && nodeIndex < state->poseGroup->hierarchy->numNodes &&
+		(state->dirty[nodeIndex >> 5] & (1u << (nodeIndex & 31))));
+}
+
 
 //-----------------------------------------------------------------------------
 
@@ -30,6 +30,11 @@
 
 //-----------------------------------------------------------------------------
 
+// check if node is in mask
+inline a3boolean a3hierarchyMaskContains(const a3_HierarchyMask *mask, const a3ui32 nodeIndex)
+{
+	return (nodeIndex < mask->hierarchy->numNodes && (mask->bits[nodeIndex >> 5] >> (nodeIndex & 31) & 1));
+}
 
 
 //-----------------------------------------------------------------------------
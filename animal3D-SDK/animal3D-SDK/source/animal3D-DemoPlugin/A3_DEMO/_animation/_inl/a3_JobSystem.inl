@@ -0,0 +1,55 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_JobSystem.inl
+	Inline definitions for job system.
+*/
+
+#ifdef __ANIMAL3D_JOBSYSTEM_H
+#ifndef __ANIMAL3D_JOBSYSTEM_INL
+#define __ANIMAL3D_JOBSYSTEM_INL
+
+
+//-----------------------------------------------------------------------------
+
+// reset counter
+inline a3i32 a3jobCounterReset(a3_JobCounter *counter)
+{
+	if (counter)
+	{
+		counter->count = 0;
+		return 1;
+	}
+	return -1;
+}
+
+// check if counted jobs are done
+inline a3boolean a3jobCounterIsDone(const a3_JobCounter *counter)
+{
+	return (counter && counter->count <= 0);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+#endif	// !__ANIMAL3D_JOBSYSTEM_INL
+#endif	// __ANIMAL3D_JOBSYSTEM_H
@@ -29,43 +29,90 @@
 
 //-----------------------------------------------------------------------------
 
-// calculate clip duration as sum of keyframes' durations
+// calculate clip duration as sum of clip frames' durations
 inline a3i32 a3clipCalculateDuration(a3_Clip* clip)
 {
 	a3f32 clipDuration = 0;
 
-	for (a3ui32 i = 0; i < clip->keyframeCount; i++)
+	// frames run from first to last, either direction
+	const a3i32 step = clip->last_keyframe >= clip->first_keyframe ? +1 : -1;
+	a3index index = clip->first_keyframe;
+
+	for (a3ui32 i = 0; i < clip->keyframeCount; i++, index += step)
 	{
-		clipDuration += clip->framePool->keyframe[i].duration;
+		clipDuration += clip->frame ? clip->frame[i].duration : clip->framePool->keyframe[index].duration;
 	}
 
 	// set clip duration
 	clip->duration = clipDuration;
 
 	// set clip inverse duration
-	clip->durationInv = 1.0f / clipDuration;
+	clip->durationInv = a3recipsafe(clipDuration);
 
 	return -1;
 }
 
-// calculate keyframes' durations by distributing clip's duration
+// calculate clip frames' durations by distributing clip's duration
 inline a3i32 a3clipDistributeDuration(a3_Clip* clip, const a3real newClipDuration)
 {
-	a3f32 newDuration = newClipDuration / clip->keyframeCount;
-
-	for (a3ui32 i = 0; i < clip->keyframeCount; i++)
+	if (clip && clip->frame && clip->keyframeCount)
 	{
-		clip->framePool->keyframe[i].duration = newDuration;
-		clip->framePool->keyframe[i].durationInv = 1.0f / newDuration;
-	}
+		const a3f32 newDuration = newClipDuration / clip->keyframeCount;
+		const a3f32 newDurationInv = a3recipsafe(newDuration);
 
-	// set new duration and inverse duration for clip
-	clip->duration = newClipDuration;
-	clip->durationInv = 1.0f / newClipDuration;
+		// clip frames are stored in clip order, so direction does not matter
+		for (a3ui32 i = 0; i < clip->keyframeCount; i++)
+		{
+			clip->frame[i].duration = newDuration;
+			clip->frame[i].durationInv = newDurationInv;
+		}
 
+		// set new duration and inverse duration for clip
+		clip->duration = newClipDuration;
+		clip->durationInv = a3recipsafe(newClipDuration);
+
+		return clip->keyframeCount;
+	}
 	return -1;
 }
 
+// get ordinal of referenced keyframe in clip order
+inline a3ui32 a3clipGetFrameOrdinal(a3_Clip const* clip, const a3index keyframeIndex)
+{
+	return (keyframeIndex >= clip->first_keyframe
+		? keyframeIndex - clip->first_keyframe
+		: clip->first_keyframe - keyframeIndex);
+}
+
+// evaluate cached interval polynomial
+inline a3real a3clipFrameEvaluate(a3_ClipFrame const* clipFrame, const a3real param)
+{
+	a3real const* c = clipFrame->coeff;
+	return (c[0] + param * (c[1] + param * (c[2] + param * c[3])));
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal: frame interval containing clip time and param within it; the 
+//	time is clamped and the end of the clip lands in the last interval
+inline a3ui32 a3clipBakeInternalFrame(a3_ClipBake const* clipBake, const a3real clipTime, a3real* param_out)
+{
+	const a3real frame = a3clamp(a3real_zero, (a3real)clipBake->frameCount, clipTime * clipBake->rate);
+	a3ui32 index = (a3ui32)frame;
+	index -= (index >= clipBake->frameCount);
+	*param_out = frame - (a3real)index;
+	return index;
+}
+
+// sample scalar value at clip time
+inline a3real a3clipBakeSample(a3_ClipBake const* clipBake, const a3real clipTime)
+{
+	a3real u;
+	const a3ui32 index = a3clipBakeInternalFrame(clipBake, clipTime, &u);
+	return a3lerp(clipBake->value[index], clipBake->value[index + 1], u);
+}
+
 
 //-----------------------------------------------------------------------------
 
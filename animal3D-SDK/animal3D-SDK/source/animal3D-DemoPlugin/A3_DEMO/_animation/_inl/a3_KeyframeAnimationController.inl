@@ -31,124 +31,94 @@
 
 //-----------------------------------------------------------------------------
 
-// update clip controller
-inline a3i32 a3clipControllerUpdate(a3_ClipController* clipCtrl, const a3real dt)
+// internal: resolve clip, keyframe and params of controller from its times; 
+//	transitions are applied while time is outside the clip, with the same 
+//	hop limit as the set so that zero-duration loops cannot stall
+inline void a3clipControllerInternalResolve(a3_ClipController* clipCtrl)
 {
-	// step/nearest:
-	// nothing special, same as lab1
-
-	// lerp:
-	// if end, k0 <- k1, calc new k1
-	// if begin, k1 <- k0, calc new k0
-
-	// Catmull:
-	// if over: kp <- k0 <- k1 <- kn, calc new kn
-	// if begin: kn <- k1 <- k0 <- kp, calc new kp
-
-
-	clipCtrl->currentClip = &clipCtrl->clipPool->clip[clipCtrl->clipIndex];
-	clipCtrl->keyframePtr0 = &clipCtrl->currentClip->framePool->keyframe[clipCtrl->keyframeIndex0];
-	clipCtrl->keyframePtr1 = &clipCtrl->currentClip->framePool->keyframe[clipCtrl->keyframeIndex0];
-
-	if (clipCtrl->clipIndex != clipCtrl->currentClip->index);
+	a3_Clip const* clip = clipCtrl->clipPool->clip + clipCtrl->clipIndex;
+	a3_ClipTransition const* transition;
+	a3real t = clipCtrl->clipTime, kt = clipCtrl->keyframeTime, overflow;
+	a3ui32 hops, ordinal;
+
+	// clip changed externally or keyframe outside of clip: search from start
+	ordinal = a3clipGetFrameOrdinal(clip, clipCtrl->keyframeIndex0);
+	if (clip != clipCtrl->currentClip || ordinal >= clip->keyframeCount)
 	{
-		clipCtrl->currentClip = &clipCtrl->clipPool->clip[clipCtrl->clipIndex];
-		//a3clipControllerInit(clipCtrl, clipCtrl->name, clipCtrl->currentClip->forwardTransition->clipPool,
-			//clipCtrl->currentClip->forwardTransition->clipIndex, clipCtrl->currentClip->forwardTransition->clipTime,
-			//clipCtrl->currentClip->forwardTransition->playbackDirection);
+		ordinal = 0;
+		kt = t;
 	}
 
-	if (clipCtrl->playbackDirection == 0)
+	// clip terminus: only forward playback leaves at exactly the end so 
+	//	that paused and reversing controllers may sit there
+	for (hops = 0; hops < a3clipController_hopsMax && ((clipCtrl->playbackDirection > a3real_zero ? t >= clip->duration : t > clip->duration) || t < a3real_zero); ++hops)
 	{
-		//break;
-	}
-	//forward
-	if (clipCtrl->playbackDirection == 1)
-	{
-		clipCtrl->keyframePtr1 = &clipCtrl->currentClip->framePool->keyframe[clipCtrl->keyframeIndex0 + 1];
-		if (!clipCtrl->keyframePtr1)
+		if (t >= clip->duration)
 		{
-			clipCtrl->keyframePtr1 = &clipCtrl->currentClip->framePool->keyframe[clipCtrl->keyframeIndex0];
+			transition = clip->forwardTransition;
+			overflow = t - clip->duration;
 		}
-
-		//Pre-resolution | increment time.
-		clipCtrl->clipTime += dt;
-		clipCtrl->keyframeTime += dt;
-
-		//Resolve time
-		// Forward terminus
-		if (clipCtrl->clipParam >= 1)
-		{
-			a3clipControllerInit(clipCtrl, clipCtrl->name, clipCtrl->currentClip->forwardTransition->clipPool,
-				clipCtrl->currentClip->forwardTransition->clipIndex, clipCtrl->currentClip->forwardTransition->clipTime,
-				clipCtrl->currentClip->forwardTransition->playbackDirection);
-		}
-		// Update keyframe details if necessary
-		if (clipCtrl->keyframeTime >= clipCtrl->keyframePtr0->duration)
-		{
-			//move keyFrameTime to next keyframe
-			clipCtrl->keyframeTime = clipCtrl->keyframeTime - clipCtrl->keyframePtr0->duration;
-
-			//move to next keyframe
-			if (clipCtrl->currentClip->keyframeCount > clipCtrl->keyframeIndex0)
-			{
-				clipCtrl->keyframeIndex0++;
-				clipCtrl->keyframePtr0 = &clipCtrl->currentClip->framePool->keyframe[clipCtrl->keyframeIndex0];
-			}
-		}
-
-		//Post-resolution | normalize params.
-		//t = (current time - key start * durationInv
-		clipCtrl->keyframeParam = clipCtrl->keyframeTime * clipCtrl->keyframePtr0->durationInv;
-		clipCtrl->clipParam = clipCtrl->clipTime * clipCtrl->currentClip->durationInv;
-
-	}
-
-	//reverse
-	if (clipCtrl->playbackDirection == -1)
-	{
-		clipCtrl->keyframePtr1 = &clipCtrl->currentClip->framePool->keyframe[clipCtrl->keyframeIndex0 - 1];
-		if (!clipCtrl->keyframePtr1)
+		else
 		{
-			clipCtrl->keyframePtr1 = &clipCtrl->currentClip->framePool->keyframe[clipCtrl->keyframeIndex0];
+			transition = clip->reverseTransition;
+			overflow = -t;
 		}
 
-		//Pre-resolution | increment time.
-		clipCtrl->clipTime -= dt;
-		clipCtrl->keyframeTime -= dt;
-
-		//Resolve time
-		// Reverse terminus
-		if (clipCtrl->clipTime <= 0)
+		if (transition)
 		{
-			// apply reverse transition
-			a3clipControllerInit(clipCtrl, clipCtrl->name, clipCtrl->currentClip->reverseTransition->clipPool,
-				clipCtrl->currentClip->reverseTransition->clipIndex,
-				clipCtrl->currentClip->reverseTransition->clipTime,
-				clipCtrl->currentClip->reverseTransition->playbackDirection);
+			// jump to target clip; negative time means its end
+			clipCtrl->clipIndex = transition->clipIndex;
+			clip = clipCtrl->clipPool->clip + transition->clipIndex;
+			clipCtrl->playbackDirection = transition->playbackDirection;
+			t = transition->clipTime < a3real_zero ? clip->duration : transition->clipTime;
+			t += overflow * transition->playbackDirection;
 		}
-		// Update keyframe details if necessary
-		if (clipCtrl->keyframeTime < 0.0)
+		else
 		{
-			//move keyFrameTime to next keyframe
-			clipCtrl->keyframeTime = clipCtrl->keyframePtr0->duration + clipCtrl->keyframeTime;
-
-			//move to next keyframe
-			if (clipCtrl->currentClip->first_keyframe < clipCtrl->keyframeIndex0)
-			{
-				clipCtrl->keyframeIndex0--;
-				clipCtrl->keyframePtr0 = &clipCtrl->currentClip->framePool->keyframe[clipCtrl->keyframeIndex0];
-			}
+			// no transition: loop current clip in current direction
+			t = clipCtrl->playbackDirection >= a3real_zero ? overflow : clip->duration - overflow;
 		}
+		ordinal = 0;
+		kt = t;
+	}
 
-		//Post-resolution | normalize params.
-		//t = (current time - key start * durationInv
-		clipCtrl->keyframeParam = clipCtrl->keyframeTime * clipCtrl->keyframePtr0->durationInv;
-		clipCtrl->clipParam = clipCtrl->clipTime * clipCtrl->currentClip->durationInv;
+	// degenerate clips (e.g. zero duration) cannot absorb time; clamp
+	t = a3clamp(a3real_zero, clip->duration, t);
+
+	// keyframe: walk from current keyframe in either direction
+	while (kt >= clip->frame[ordinal].duration && ordinal + 1 < clip->keyframeCount)
+		kt -= clip->frame[ordinal++].duration;
+	while (kt < a3real_zero && ordinal > 0)
+		kt += clip->frame[--ordinal].duration;
+	kt = a3clamp(a3real_zero, clip->frame[ordinal].duration, kt);
+
+	// interval runs to the next keyframe in clip order; the last holds
+	clipCtrl->currentClip = clip;
+	clipCtrl->clipTime = t;
+	clipCtrl->clipParam = t * clip->durationInv;
+	clipCtrl->keyframeIndex0 = clip->last_keyframe >= clip->first_keyframe ? clip->first_keyframe + ordinal : clip->first_keyframe - ordinal;
+	clipCtrl->keyframeIndex1 = ordinal + 1 < clip->keyframeCount ? (clip->last_keyframe >= clip->first_keyframe ? clipCtrl->keyframeIndex0 + 1 : clipCtrl->keyframeIndex0 - 1) : clipCtrl->keyframeIndex0;
+	clipCtrl->keyframeTime = kt;
+	clipCtrl->keyframeParam = kt * clip->frame[ordinal].durationInv;
+	clipCtrl->keyframePtr0 = clip->framePool->keyframe + clipCtrl->keyframeIndex0;
+	clipCtrl->keyframePtr1 = clip->framePool->keyframe + clipCtrl->keyframeIndex1;
+}
 
-		
+// update clip controller
+inline a3i32 a3clipControllerUpdate(a3_ClipController* clipCtrl, const a3real dt)
+{
+	if (clipCtrl && clipCtrl->clipPool && clipCtrl->clipPool->frame && clipCtrl->clipIndex < clipCtrl->clipPool->count)
+	{
+		// pre-resolution: advance both times in playback direction
+		const a3real step = dt * clipCtrl->playbackDirection;
+		clipCtrl->clipTime += step;
+		clipCtrl->keyframeTime += step;
+
+		// resolve clip and keyframe boundaries, then normalize
+		a3clipControllerInternalResolve(clipCtrl);
+		return 1;
 	}
-	return 1;
+	return -1;
 }
 
 
@@ -163,30 +133,35 @@ inline a3i32 a3clipControllerSetClip(a3_ClipController* clipCtrl, const a3_ClipP
 // evaluate the current value at time
 inline a3i32 a3clipControllerEvaluate(a3_ClipController const* clipCtrl, a3_Sample* sample_out)
 {
-	if (clipCtrl && clipCtrl->currentClip && sample_out)
+	if (clipCtrl && clipCtrl->currentClip && clipCtrl->currentClip->frame && sample_out)
 	{
-		// 0: no interpolation
+		// interval mode (step, lerp, Catmull-Rom, Hermite, Bezier) is baked 
+		//	into the clip frame's coefficients by the clip
+		a3_Clip const* clip = clipCtrl->currentClip;
 		*sample_out = clipCtrl->keyframePtr0->sample;
-
-		// 1:
-		// if (u <0.5) then k0, else k1
-
-		// 2: lerp
 		sample_out->time = clipCtrl->keyframeTime;
-		sample_out->value = a3lerp(
-			clipCtrl->keyframePtr0->sample.value,
-			clipCtrl->keyframePtr1->sample.value,
-			clipCtrl->keyframeParam
-		);
-
-		// 3: Catmull-Rom/cubic Hermite
-
+		sample_out->value = a3clipFrameEvaluate(clip->frame + a3clipGetFrameOrdinal(clip, clipCtrl->keyframeIndex0), clipCtrl->keyframeParam);
 
 		return clipCtrl->keyframeIndex0;
 	}
 	return -1;
 }
 
+// evaluate the current channel poses
+inline a3i32 a3clipControllerEvaluatePose(a3_ClipController const* clipCtrl, a3_SpatialPose* pose_out)
+{
+	if (clipCtrl && clipCtrl->currentClip && pose_out)
+	{
+		// interval runs to the next keyframe in clip order; the last holds
+		a3_Clip const* clip = clipCtrl->currentClip;
+		a3_Keyframe const* keyframe = clip->framePool->keyframe + clipCtrl->keyframeIndex0;
+		a3_Keyframe const* keyframeNext = clipCtrl->keyframeIndex0 == clip->last_keyframe ? keyframe
+			: clip->last_keyframe > clip->first_keyframe ? keyframe + 1 : keyframe - 1;
+		return a3keyframeEvaluatePose(pose_out, keyframe, keyframeNext, clip->framePool->poseCount, clipCtrl->keyframeParam);
+	}
+	return -1;
+}
+
 
 //-----------------------------------------------------------------------------
 
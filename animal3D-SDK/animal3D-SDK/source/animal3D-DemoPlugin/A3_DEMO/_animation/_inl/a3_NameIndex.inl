@@ -0,0 +1,66 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_NameIndex.inl
+	Inline definitions for hashed name lookup.
+*/
+
+#ifdef __ANIMAL3D_NAMEINDEX_H
+#ifndef __ANIMAL3D_NAMEINDEX_INL
+#define __ANIMAL3D_NAMEINDEX_INL
+
+
+//-----------------------------------------------------------------------------
+
+// hash name (FNV-1a, stops at terminator or maximum name size)
+inline a3ui32 a3nameIndexHash(const a3byte name[a3nameIndex_nameSize])
+{
+	a3ui32 hash = 2166136261u, i;
+	for (i = 0; i < a3nameIndex_nameSize && name[i]; ++i)
+	{
+		hash ^= (a3ubyte)name[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+// find record index by name
+inline a3i32 a3nameIndexFind(const a3_NameIndex* nameIndex, const a3byte name[a3nameIndex_nameSize])
+{
+	if (nameIndex && nameIndex->head && name && *name)
+	{
+		const a3ui32 hash = a3nameIndexHash(name);
+		a3i32 i;
+
+		// cached hash rejects nearly every other record in the chain
+		for (i = nameIndex->head[hash & nameIndex->bucketMask]; i >= 0; i = nameIndex->next[i])
+			if (nameIndex->hash[i] == hash &&
+				!strncmp(nameIndex->nameBase + (a3ui64)nameIndex->nameStride * i, name, a3nameIndex_nameSize))
+				return i;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+#endif	// !__ANIMAL3D_NAMEINDEX_INL
+#endif	// __ANIMAL3D_NAMEINDEX_H
@@ -0,0 +1,161 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_PathCurve.inl
+	Inline definitions for path curve.
+*/
+
+#ifdef __ANIMAL3D_PATHCURVE_H
+#ifndef __ANIMAL3D_PATHCURVE_INL
+#define __ANIMAL3D_PATHCURVE_INL
+
+
+//-----------------------------------------------------------------------------
+
+// internal: derivative of Catmull-Rom segment with respect to its parameter
+inline a3vec3 *a3pathCurveInternalDerivative(a3vec3 *v_out, const a3vec3 *pPrev, const a3vec3 *p0, const a3vec3 *p1, const a3vec3 *pNext, const a3real t)
+{
+	// derivatives of the basis weights
+	const a3real u = t * t * a3real_three;
+	const a3real wPrev = a3real_half * (t * a3real_four - u - a3real_one);
+	const a3real w0 = a3real_half * (u + u + u - (t + t) * a3real_five);
+	const a3real w1 = a3real_half * ((t + t) * a3real_four - u - u - u + a3real_one);
+	const a3real wNext = a3real_half * (u - t - t);
+	v_out->x = pPrev->x * wPrev + p0->x * w0 + p1->x * w1 + pNext->x * wNext;
+	v_out->y = pPrev->y * wPrev + p0->y * w0 + p1->y * w1 + pNext->y * wNext;
+	v_out->z = pPrev->z * wPrev + p0->z * w0 + p1->z * w1 + pNext->z * wNext;
+	return v_out;
+}
+
+// internal: parameter at distance, without validation
+inline a3real a3pathCurveInternalGetParam(const a3_PathCurve *curve, const a3real distance)
+{
+	const a3real *const sampleLength = curve->sampleLength;
+	a3real d = distance, span, u, u2, f;
+	a3ui32 k, lo, hi, mid;
+
+	// wrap closed paths, clamp open ones
+	if (curve->closed && curve->length > a3real_zero)
+	{
+		d -= (a3real)(a3i32)(d * curve->lengthInv) * curve->length;
+		if (d < a3real_zero)
+			d += curve->length;
+	}
+	d = a3clamp(a3real_zero, curve->length, d);
+
+	// the lookup bounds the search to intervals overlapping one entry
+	k = (a3ui32)(d * curve->lookupScale);
+	k = a3minimum(k, curve->lookupCount - 1);
+	lo = curve->lookup[k];
+	hi = curve->lookup[k + 1];
+	while (lo < hi)
+	{
+		mid = (lo + hi + 1) >> 1;
+		if (sampleLength[mid] <= d)
+			lo = mid;
+		else
+			hi = mid - 1;
+	}
+
+	// Hermite in length between samples, from zero to one with the sampled 
+	//	rates as slopes
+	span = sampleLength[lo + 1] - sampleLength[lo];
+	if (span > a3real_zero)
+	{
+		u = (d - sampleLength[lo]) / span;
+		u2 = u * u;
+		f = (u2 * u - u2 - u2 + u) * span * curve->sampleRate[lo] + (u2 * a3real_three - u2 * u * a3real_two) + (u2 * u - u2) * span * curve->sampleRate[lo + 1];
+		f = a3clamp(a3real_zero, a3real_one, f);
+	}
+	else
+		f = a3real_zero;
+	return (((a3real)lo + f) * curve->samplesPerSegmentInv);
+}
+
+// internal: evaluate at parameter, without validation
+inline a3i32 a3pathCurveInternalEvaluate(const a3_PathCurve *curve, a3vec3 *position_out, a3vec3 *tangent_out, const a3real param)
+{
+	const a3ui32 n = curve->pointCount;
+	const a3ui32 segment = param > a3real_zero ? a3minimum((a3ui32)param, curve->segmentCount - 1) : 0;
+	const a3real t = a3clamp(a3real_zero, a3real_one, param - (a3real)segment);
+	const a3vec3 *p0 = curve->point + segment, *pPrev, *p1, *pNext;
+	a3real lenSq;
+
+	// neighbors wrap on closed paths and repeat the ends on open ones
+	if (curve->closed)
+	{
+		pPrev = segment ? p0 - 1 : curve->point + n - 1;
+		p1 = segment + 1 < n ? p0 + 1 : curve->point;
+		pNext = segment + 2 < n ? p0 + 2 : curve->point + (segment + 2 - n);
+	}
+	else
+	{
+		pPrev = segment ? p0 - 1 : p0;
+		p1 = p0 + 1;
+		pNext = segment + 2 < n ? p0 + 2 : p1;
+	}
+	if (position_out)
+		a3real3CatmullRom(position_out->v, pPrev->v, p0->v, p1->v, pNext->v, t);
+	if (tangent_out)
+	{
+		a3pathCurveInternalDerivative(tangent_out, pPrev, p0, p1, pNext, t);
+		lenSq = a3real3LengthSquared(tangent_out->v);
+		if (lenSq > a3real_zero)
+			a3real3MulS(tangent_out->v, a3sqrtInverse(lenSq));
+	}
+	return segment;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// get parameter at distance
+inline a3i32 a3pathCurveGetParam(const a3_PathCurve *curve, a3real *param_out, const a3real distance)
+{
+	if (curve && curve->point && param_out)
+	{
+		*param_out = a3pathCurveInternalGetParam(curve, distance);
+		return a3minimum((a3ui32)*param_out, curve->segmentCount - 1);
+	}
+	return -1;
+}
+
+// evaluate at parameter
+inline a3i32 a3pathCurveEvaluate(const a3_PathCurve *curve, a3vec3 *position_out, a3vec3 *tangent_out, const a3real param)
+{
+	if (curve && curve->point)
+		return a3pathCurveInternalEvaluate(curve, position_out, tangent_out, param);
+	return -1;
+}
+
+// evaluate at distance
+inline a3i32 a3pathCurveSample(const a3_PathCurve *curve, a3vec3 *position_out, a3vec3 *tangent_out, const a3real distance)
+{
+	if (curve && curve->point)
+		return a3pathCurveInternalEvaluate(curve, position_out, tangent_out, a3pathCurveInternalGetParam(curve, distance));
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+#endif	// !__ANIMAL3D_PATHCURVE_INL
+#endif	// __ANIMAL3D_PATHCURVE_H
@@ -0,0 +1,65 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_PosePipeline.inl
+	Inline definitions for pose pipeline.
+*/
+
+#ifdef __ANIMAL3D_POSEPIPELINE_H
+#ifndef __ANIMAL3D_POSEPIPELINE_INL
+#define __ANIMAL3D_POSEPIPELINE_INL
+
+
+//-----------------------------------------------------------------------------
+
+// run all stages for one character
+inline a3i32 a3posePipelineUpdateCharacter(const a3_PosePipeline *pipeline, const a3ui32 characterIndex)
+{
+	if (pipeline && characterIndex < pipeline->characterCount)
+	{
+		const a3_ClipControllerSet *const ctrlSet = pipeline->ctrlSet;
+		const a3_HierarchyState *const state = pipeline->hierarchyState + characterIndex;
+		const a3_HierarchyPoseGroup *const poseGroup = state->poseGroup;
+		const a3_KeyframePool *const framePool = ctrlSet->clipPool->clip[ctrlSet->clipIndex[characterIndex]].framePool;
+		const a3ui32 nodeCount = poseGroup->hierarchy->numNodes;
+		const a3ui32 pose0 = (a3ui32)framePool->keyframe[ctrlSet->keyframeIndex0[characterIndex]].data % poseGroup->poseCount;
+		const a3ui32 pose1 = (a3ui32)framePool->keyframe[ctrlSet->keyframeIndex1[characterIndex]].data % poseGroup->poseCount;
+		a3i32 ret;
+
+		// sample and blend: interpolate deltas, then apply to base pose
+		a3spatialPoseLerpArray(state->samplePose->spatialPose, poseGroup->hpose[pose0].spatialPose, poseGroup->hpose[pose1].spatialPose, ctrlSet->keyframeParam[characterIndex], nodeCount);
+		a3spatialPoseConcatArray(state->samplePose->spatialPose, poseGroup->hpose[0].spatialPose, state->samplePose->spatialPose, nodeCount);
+
+		// FK over changed nodes, then inverse and skinning in one pass
+		a3hierarchyStateUpdateLocalSpace(state);
+		ret = a3kinematicsSolveForwardDirty(state);
+		a3hierarchyStateUpdateObjectInverseBindToCurrent(state, pipeline->objectSpaceBindInverse, pipeline->usingScale);
+		return ret;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+#endif	// !__ANIMAL3D_POSEPIPELINE_INL
+#endif	// __ANIMAL3D_POSEPIPELINE_H
@@ -30,6 +30,219 @@
 
 //-----------------------------------------------------------------------------
 
+// reset pose to identity; transform is rebuilt immediately
+inline a3i32 a3spatialPoseReset(a3_SpatialPose* spatialPose)
+{
+	if (spatialPose)
+	{
+		spatialPose->transform = a3mat4_identity;
+		spatialPose->rotation.x = spatialPose->rotation.y = spatialPose->rotation.z = a3real_zero;
+		spatialPose->rotation.w = a3real_one;
+		spatialPose->scale.x = spatialPose->scale.y = spatialPose->scale.z = a3real_one;
+		spatialPose->scale.w = a3real_zero;
+		spatialPose->translation.x = spatialPose->translation.y = spatialPose->translation.z = spatialPose->translation.w = a3real_zero;
+		spatialPose->channel = spatialPose->dirty = a3poseChannel_none;
+		spatialPose->pad[0] = spatialPose->pad[1] = 0;
+		return 1;
+	}
+	return -1;
+}
+
+// copy pose, marking old and new channels dirty
+inline a3i32 a3spatialPoseCopy(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose_in)
+{
+	if (spatialPose_out && spatialPose_in)
+	{
+		// channels the output had or now has must be rebuilt
+		const a3_SpatialPoseChannel dirty = spatialPose_out->dirty | spatialPose_out->channel | spatialPose_in->channel | spatialPose_in->dirty;
+		*spatialPose_out = *spatialPose_in;
+		spatialPose_out->dirty = dirty;
+		return 1;
+	}
+	return -1;
+}
+
+// set orientation from Euler angles in degrees
+inline a3i32 a3spatialPoseSetRotation(a3_SpatialPose* spatialPose, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3_SpatialPoseEulerOrder order)
+{
+	if (spatialPose)
+	{
+		if (order == a3poseEulerOrder_xyz)
+			a3quatSetEulerXYZ(spatialPose->rotation.v, a3trigValid_sind(degrees_x), a3trigValid_sind(degrees_y), a3trigValid_sind(degrees_z));
+		else
+			a3quatSetEulerZYX(spatialPose->rotation.v, a3trigValid_sind(degrees_x), a3trigValid_sind(degrees_y), a3trigValid_sind(degrees_z));
+		spatialPose->channel |= a3poseChannel_orient_xyz;
+		spatialPose->dirty |= a3poseChannel_orient_xyz;
+		return 1;
+	}
+	return -1;
+}
+
+// set scale
+inline a3i32 a3spatialPoseSetScale(a3_SpatialPose* spatialPose, const a3real scale_x, const a3real scale_y, const a3real scale_z)
+{
+	if (spatialPose)
+	{
+		spatialPose->scale.x = scale_x;
+		spatialPose->scale.y = scale_y;
+		spatialPose->scale.z = scale_z;
+		spatialPose->channel |= a3poseChannel_scale_xyz;
+		spatialPose->dirty |= a3poseChannel_scale_xyz;
+		return 1;
+	}
+	return -1;
+}
+
+// set translation
+inline a3i32 a3spatialPoseSetTranslation(a3_SpatialPose* spatialPose, const a3real translate_x, const a3real translate_y, const a3real translate_z)
+{
+	if (spatialPose)
+	{
+		spatialPose->translation.x = translate_x;
+		spatialPose->translation.y = translate_y;
+		spatialPose->translation.z = translate_z;
+		spatialPose->channel |= a3poseChannel_translate_xyz;
+		spatialPose->dirty |= a3poseChannel_translate_xyz;
+		return 1;
+	}
+	return -1;
+}
+
+// rebuild transform from channels if any are dirty
+inline a3i32 a3spatialPoseConvert(a3_SpatialPose* spatialPose)
+{
+	if (spatialPose)
+	{
+		a3mat4* const m = &spatialPose->transform;
+		if (!spatialPose->dirty)
+			return 0;
+
+		// basis depends on rotation and scale only
+		if (spatialPose->dirty & (a3poseChannel_orient_xyz | a3poseChannel_scale_xyz))
+		{
+			const a3real x = spatialPose->rotation.x, y = spatialPose->rotation.y, z = spatialPose->rotation.z, w = spatialPose->rotation.w;
+			const a3real x2 = x + x, y2 = y + y, z2 = z + z;
+			const a3real xx = x * x2, yy = y * y2, zz = z * z2;
+			const a3real xy = x * y2, yz = y * z2, zx = z * x2;
+			const a3real wx = w * x2, wy = w * y2, wz = w * z2;
+			const a3real sx = spatialPose->scale.x, sy = spatialPose->scale.y, sz = spatialPose->scale.z;
+			m->x0 = (a3real_one - yy - zz) * sx;
+			m->y0 = (xy + wz) * sx;
+			m->z0 = (zx - wy) * sx;
+			m->x1 = (xy - wz) * sy;
+			m->y1 = (a3real_one - xx - zz) * sy;
+			m->z1 = (yz + wx) * sy;
+			m->x2 = (zx + wy) * sz;
+			m->y2 = (yz - wx) * sz;
+			m->z2 = (a3real_one - xx - yy) * sz;
+			m->w0 = m->w1 = m->w2 = a3real_zero;
+		}
+		if (spatialPose->dirty & a3poseChannel_translate_xyz)
+		{
+			m->x3 = spatialPose->translation.x;
+			m->y3 = spatialPose->translation.y;
+			m->z3 = spatialPose->translation.z;
+			m->w3 = a3real_one;
+		}
+		spatialPose->dirty = a3poseChannel_none;
+		return 1;
+	}
+	return -1;
+}
+
+// concatenate poses channel-wise
+inline a3i32 a3spatialPoseConcat(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose_lhs, const a3_SpatialPose* spatialPose_rhs)
+{
+	if (spatialPose_out && spatialPose_lhs && spatialPose_rhs)
+	{
+		const a3_SpatialPoseChannel channel = spatialPose_lhs->channel | spatialPose_rhs->channel;
+
+		// identity channels on either side leave the other side unchanged
+		if (channel & a3poseChannel_orient_xyz)
+		{
+			const a3vec4 qL = spatialPose_lhs->rotation, qR = spatialPose_rhs->rotation;
+			spatialPose_out->rotation.x = qL.w * qR.x + qR.w * qL.x + qL.y * qR.z - qL.z * qR.y;
+			spatialPose_out->rotation.y = qL.w * qR.y + qR.w * qL.y + qL.z * qR.x - qL.x * qR.z;
+			spatialPose_out->rotation.z = qL.w * qR.z + qR.w * qL.z + qL.x * qR.y - qL.y * qR.x;
+			spatialPose_out->rotation.w = qL.w * qR.w - qL.x * qR.x - qL.y * qR.y - qL.z * qR.z;
+		}
+		else
+			spatialPose_out->rotation = spatialPose_lhs->rotation;
+		if (channel & a3poseChannel_scale_xyz)
+		{
+			spatialPose_out->scale.x = spatialPose_lhs->scale.x * spatialPose_rhs->scale.x;
+			spatialPose_out->scale.y = spatialPose_lhs->scale.y * spatialPose_rhs->scale.y;
+			spatialPose_out->scale.z = spatialPose_lhs->scale.z * spatialPose_rhs->scale.z;
+		}
+		else
+			spatialPose_out->scale = spatialPose_lhs->scale;
+		if (channel & a3poseChannel_translate_xyz)
+		{
+			spatialPose_out->translation.x = spatialPose_lhs->translation.x + spatialPose_rhs->translation.x;
+			spatialPose_out->translation.y = spatialPose_lhs->translation.y + spatialPose_rhs->translation.y;
+			spatialPose_out->translation.z = spatialPose_lhs->translation.z + spatialPose_rhs->translation.z;
+		}
+		else
+			spatialPose_out->translation = spatialPose_lhs->translation;
+
+		// output differs from whatever its transform held before
+		spatialPose_out->dirty |= spatialPose_out->channel | channel;
+		spatialPose_out->channel = channel;
+		return 1;
+	}
+	return -1;
+}
+
+// interpolate poses channel-wise
+inline a3i32 a3spatialPoseLerp(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose0, const a3_SpatialPose* spatialPose1, const a3real u)
+{
+	if (spatialPose_out && spatialPose0 && spatialPose1)
+	{
+		const a3_SpatialPoseChannel channel = spatialPose0->channel | spatialPose1->channel;
+
+		// rotation: 4 lerps, flip second input onto the same hemisphere
+		if (channel & a3poseChannel_orient_xyz)
+		{
+			const a3vec4 q0 = spatialPose0->rotation, q1 = spatialPose1->rotation;
+			const a3real u1 = (q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w) < a3real_zero ? -u : u;
+			const a3real u0 = a3real_one - u;
+			a3real x = q0.x * u0 + q1.x * u1, y = q0.y * u0 + q1.y * u1, z = q0.z * u0 + q1.z * u1, w = q0.w * u0 + q1.w * u1;
+			const a3real lenSq = x * x + y * y + z * z + w * w;
+			const a3real lenInv = lenSq > a3real_zero ? a3sqrtInverse(lenSq) : a3real_zero;
+			spatialPose_out->rotation.x = x * lenInv;
+			spatialPose_out->rotation.y = y * lenInv;
+			spatialPose_out->rotation.z = z * lenInv;
+			spatialPose_out->rotation.w = w * lenInv;
+		}
+		else
+			spatialPose_out->rotation = spatialPose0->rotation;
+
+		// scale: 3 lerps
+		if (channel & a3poseChannel_scale_xyz)
+		{
+			spatialPose_out->scale.x = a3lerp(spatialPose0->scale.x, spatialPose1->scale.x, u);
+			spatialPose_out->scale.y = a3lerp(spatialPose0->scale.y, spatialPose1->scale.y, u);
+			spatialPose_out->scale.z = a3lerp(spatialPose0->scale.z, spatialPose1->scale.z, u);
+		}
+		else
+			spatialPose_out->scale = spatialPose0->scale;
+
+		// translation: 3 lerps
+		if (channel & a3poseChannel_translate_xyz)
+		{
+			spatialPose_out->translation.x = a3lerp(spatialPose0->translation.x, spatialPose1->translation.x, u);
+			spatialPose_out->translation.y = a3lerp(spatialPose0->translation.y, spatialPose1->translation.y, u);
+			spatialPose_out->translation.z = a3lerp(spatialPose0->translation.z, spatialPose1->translation.z, u);
+		}
+		else
+			spatialPose_out->translation = spatialPose0->translation;
+
+		spatialPose_out->dirty |= spatialPose_out->channel | channel;
+		spatialPose_out->channel = channel;
+		return 1;
+	}
+	return -1;
+}
 
 
 //-----------------------------------------------------------------------------
@@ -37,6 +37,8 @@
 inline a3ret a3hierarchyInternalGetIndex(const a3_Hierarchy *hierarchy, const a3byte name[a3node_nameSize])
 {
 	a3ui32 i;
+	if (hierarchy->nameIndex->head && *name)
+		return a3nameIndexFind(hierarchy->nameIndex, name);
 	for (i = 0; i < hierarchy->numNodes; ++i)
 		if (!strncmp(hierarchy->nodes[i].name, name, a3node_nameSize))
 			return i;
@@ -51,6 +53,86 @@ inline void a3hierarchyInternalSetNode(a3_HierarchyNode *node, const a3ui32 inde
 	node->parentIndex = parentIndex;
 }
 
+inline void a3hierarchyInternalReleaseTopology(a3_HierarchyTopology *topology)
+{
+	free(topology->childOffset);
+	memset(topology, 0, sizeof(a3_HierarchyTopology));
+}
+
+// every pass runs in index order or reverse, relying on parents preceding 
+//	children, so the whole build is linear in node count
+inline a3ui32 a3hierarchyInternalBuildTopology(a3_HierarchyTopology *topology, const a3_HierarchyNode *nodes, const a3ui32 numNodes)
+{
+	a3ui32 *const offset = topology->levelOffset;
+	a3ui32 i, levelCount = 0, rootOrder = 0;
+	a3i32 parentIndex;
+
+	// depth, subtree size and extent, and child counts (stored one ahead)
+	memset(topology->childOffset, 0, sizeof(a3ui32) * (numNodes + 1));
+	for (i = 0; i < numNodes; ++i)
+	{
+		parentIndex = nodes[i].parentIndex;
+		topology->depth[i] = parentIndex >= 0 ? topology->depth[parentIndex] + 1 : 0;
+		if (topology->depth[i] >= levelCount)
+			levelCount = topology->depth[i] + 1;
+		if (parentIndex >= 0)
+			++topology->childOffset[parentIndex + 1];
+		topology->subtreeSize[i] = 1;
+		topology->subtreeEnd[i] = i;
+	}
+	for (i = numNodes; i-- > 0; )
+	{
+		parentIndex = nodes[i].parentIndex;
+		if (parentIndex >= 0)
+		{
+			topology->subtreeSize[parentIndex] += topology->subtreeSize[i];
+			if (topology->subtreeEnd[parentIndex] < topology->subtreeEnd[i])
+				topology->subtreeEnd[parentIndex] = topology->subtreeEnd[i];
+		}
+	}
+
+	// level sizes, then starts; place nodes, advancing each level's start 
+	//	to its end, then shift back
+	memset(offset, 0, sizeof(a3ui32) * (levelCount + 1));
+	for (i = 0; i < numNodes; ++i)
+		++offset[topology->depth[i] + 1];
+	for (i = 1; i <= levelCount; ++i)
+		offset[i] += offset[i - 1];
+	for (i = 0; i < numNodes; ++i)
+		topology->levelNode[offset[topology->depth[i]]++] = i;
+	for (i = levelCount; i > 0; --i)
+		offset[i] = offset[i - 1];
+	offset[0] = 0;
+	for (i = 0; i < numNodes; ++i)
+		topology->levelParent[i] = nodes[topology->levelNode[i]].parentIndex;
+
+	// child starts; place children in index order using the pre-order 
+	//	positions as a per-node cursor, then assign positions: a node's 
+	//	first child follows it, each next child follows the previous subtree
+	for (i = 1; i <= numNodes; ++i)
+		topology->childOffset[i] += topology->childOffset[i - 1];
+	for (i = 0; i < numNodes; ++i)
+		topology->order[i] = topology->childOffset[i];
+	for (i = 0; i < numNodes; ++i)
+		if ((parentIndex = nodes[i].parentIndex) >= 0)
+			topology->child[topology->order[parentIndex]++] = i;
+	for (i = 0; i < numNodes; ++i)
+		if (nodes[i].parentIndex < 0)
+		{
+			topology->order[i] = rootOrder;
+			rootOrder += topology->subtreeSize[i];
+		}
+	for (i = 0; i < numNodes; ++i)
+	{
+		const a3ui32 *child = topology->child + topology->childOffset[i], *const end = topology->child + topology->childOffset[i + 1];
+		a3ui32 position = topology->order[i] + 1;
+		topology->orderNode[topology->order[i]] = i;
+		for (; child < end; position += topology->subtreeSize[*(child++)])
+			topology->order[*child] = position;
+	}
+	return (topology->levelCount = levelCount);
+}
+
 
 //-----------------------------------------------------------------------------
 
@@ -58,7 +140,7 @@ a3ret a3hierarchyCreate(a3_Hierarchy *hierarchy_out, const a3ui32 numNodes, cons
 {
 	if (hierarchy_out && numNodes)
 	{
-		if (!hierarchy_out->nodes)
+		if (!hierarchy_out->nodes && !hierarchy_out->topology->childOffset)
 		{
 			const a3ui32 dataSize = sizeof(a3_HierarchyNode) * numNodes;
 			a3ui32 i;
@@ -66,6 +148,8 @@ a3ret a3hierarchyCreate(a3_Hierarchy *hierarchy_out, const a3ui32 numNodes, cons
 			hierarchy_out->nodes = (a3_HierarchyNode *)malloc(dataSize);
 			memset(hierarchy_out->nodes, 0, dataSize);
 			hierarchy_out->numNodes = numNodes;
+			memset(hierarchy_out->topology, 0, sizeof(a3_HierarchyTopology));
+			a3nameIndexCreate(hierarchy_out->nameIndex, hierarchy_out->nodes->name, sizeof(a3_HierarchyNode), numNodes);
 			if (names_opt)
 			{
 				for (i = 0; i < numNodes; ++i)
@@ -75,6 +159,7 @@ a3ret a3hierarchyCreate(a3_Hierarchy *hierarchy_out, const a3ui32 numNodes, cons
 						{
 							strncpy(hierarchy_out->nodes[i].name, tmpName, a3node_nameSize);
 							hierarchy_out->nodes[i].name[a3node_nameSize - 1] = 0;
+							a3nameIndexUpdate(hierarchy_out->nameIndex, i);
 						}
 						else
 							printf("\n A3 Warning: Ignoring duplicate name string passed to hierarchy allocator.");
@@ -99,6 +184,7 @@ a3ret a3hierarchySetNode(const a3_Hierarchy *hierarchy, const a3ui32 index, cons
 			{
 				node = hierarchy->nodes + index;
 				a3hierarchyInternalSetNode(node, index, parentIndex, name);
+				a3nameIndexUpdate(hierarchy->nameIndex, index);
 				return index;
 			}
 			else
@@ -108,6 +194,34 @@ a3ret a3hierarchySetNode(const a3_Hierarchy *hierarchy, const a3ui32 index, cons
 	return -1;
 }
 
+a3ret a3hierarchyUpdateTopology(a3_Hierarchy *hierarchy)
+{
+	if (hierarchy && hierarchy->nodes && hierarchy->numNodes)
+	{
+		a3_HierarchyTopology *const topology = hierarchy->topology;
+		const a3ui32 numNodes = hierarchy->numNodes;
+		if (!topology->childOffset)
+		{
+			// offsets, then per node arrays, then level offsets
+			a3ui32 *data = (a3ui32 *)malloc(sizeof(a3ui32) * (numNodes * 10 + 2));
+			if (!data)
+				return -1;
+			topology->childOffset = data;
+			topology->child = (data += numNodes + 1);
+			topology->depth = (data += numNodes);
+			topology->order = (data += numNodes);
+			topology->orderNode = (data += numNodes);
+			topology->subtreeSize = (data += numNodes);
+			topology->subtreeEnd = (data += numNodes);
+			topology->levelNode = (data += numNodes);
+			topology->levelParent = (a3i32 *)(data += numNodes);
+			topology->levelOffset = (data += numNodes);
+		}
+		return a3hierarchyInternalBuildTopology(topology, hierarchy->nodes, numNodes);
+	}
+	return -1;
+}
+
 a3ret a3hierarchyGetNodeIndex(const a3_Hierarchy *hierarchy, const a3byte name[a3node_nameSize])
 {
 	if (hierarchy)
@@ -158,7 +272,7 @@ a3ret a3hierarchyLoadBinary(a3_Hierarchy *hierarchy, const a3_FileStream *fileSt
 	a3ui32 dataSize = 0;
 	if (hierarchy && fileStream)
 	{
-		if (!hierarchy->nodes)
+		if (!hierarchy->nodes && !hierarchy->topology->childOffset)
 		{
 			fp = fileStream->stream;
 			if (fp)
@@ -168,6 +282,9 @@ a3ret a3hierarchyLoadBinary(a3_Hierarchy *hierarchy, const a3_FileStream *fileSt
 				dataSize = sizeof(a3_HierarchyNode) * hierarchy->numNodes;
 				hierarchy->nodes = (a3_HierarchyNode *)malloc(dataSize);
 				ret += (a3ui32)fread(hierarchy->nodes, 1, dataSize, fp);
+				a3nameIndexCreate(hierarchy->nameIndex, hierarchy->nodes->name, sizeof(a3_HierarchyNode), hierarchy->numNodes);
+				memset(hierarchy->topology, 0, sizeof(a3_HierarchyTopology));
+				a3hierarchyUpdateTopology(hierarchy);
 			}
 			return ret;
 		}
@@ -198,7 +315,7 @@ a3ret a3hierarchyCopyFromString(a3_Hierarchy *hierarchy, const a3byte *str)
 	a3ui32 dataSize = 0;
 	if (hierarchy && str)
 	{
-		if (!hierarchy->nodes)
+		if (!hierarchy->nodes && !hierarchy->topology->childOffset)
 		{
 			memcpy(&hierarchy->numNodes, str, sizeof(a3ui32));
 			str += sizeof(a3ui32);
@@ -207,6 +324,9 @@ a3ret a3hierarchyCopyFromString(a3_Hierarchy *hierarchy, const a3byte *str)
 			hierarchy->nodes = (a3_HierarchyNode *)malloc(dataSize);
 			memcpy(hierarchy->nodes, str, dataSize);
 			str += dataSize;
+			a3nameIndexCreate(hierarchy->nameIndex, hierarchy->nodes->name, sizeof(a3_HierarchyNode), hierarchy->numNodes);
+			memset(hierarchy->topology, 0, sizeof(a3_HierarchyTopology));
+			a3hierarchyUpdateTopology(hierarchy);
 
 			// done
 			return (a3i32)(str - start);
@@ -236,6 +356,8 @@ a3ret a3hierarchyRelease(a3_Hierarchy *hierarchy)
 	{
 		if (hierarchy->nodes)
 		{
+			a3nameIndexRelease(hierarchy->nameIndex);
+			a3hierarchyInternalReleaseTopology(hierarchy->topology);
 			free(hierarchy->nodes);
 			hierarchy->nodes = 0;
 			hierarchy->numNodes = 0;
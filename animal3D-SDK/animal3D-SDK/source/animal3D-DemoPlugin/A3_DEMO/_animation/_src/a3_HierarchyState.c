@@ -24,21 +24,336 @@
 
 #include "../a3_HierarchyState.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 
 //-----------------------------------------------------------------------------
 
+// alignment of pose and transform buffers in bytes
+#define A3_HIERARCHYSTATE_ALIGN		16
+
+// round size up to alignment
+#define A3_HIERARCHYSTATE_ALIGNED(size)	(((size) + (A3_HIERARCHYSTATE_ALIGN - 1)) & ~(size_t)(A3_HIERARCHYSTATE_ALIGN - 1))
+
+
+// internal: allocate aligned block; the address returned by malloc is kept 
+//	in the bytes just before the aligned address
+inline void *a3hierarchyStateInternalAlloc(const size_t size)
+{
+	void *const raw = malloc(size + A3_HIERARCHYSTATE_ALIGN + sizeof(void *));
+	void **block = 0;
+	if (raw)
+	{
+		block = (void **)A3_HIERARCHYSTATE_ALIGNED((size_t)raw + sizeof(void *));
+		block[-1] = raw;
+	}
+	return block;
+}
+
+// internal: release aligned block
+inline void a3hierarchyStateInternalFree(void *block)
+{
+	if (block)
+		free(((void **)block)[-1]);
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal: invert object-space transforms; rigid transforms only need the 
+//	rotation transposed, otherwise the math library's batched affine inverse
+inline void a3hierarchyStateInternalInverseArray(a3mat4 *m_out, const a3mat4 *m, const a3ui32 count, const a3boolean usingScale)
+{
+	a3ui32 i;
+	if (!usingScale)
+		for (i = 0; i < count; ++i)
+			a3real4x4TransformInverseIgnoreScale(m_out[i].m, m[i].m);
+	else
+#ifdef A3_OPEN_SOURCE
+		a3real4x4TransformInverseArray(&m_out->m, &m->m, count);
+#else	// !A3_OPEN_SOURCE
+		for (i = 0; i < count; ++i)
+			a3real4x4TransformInverse(m_out[i].m, m[i].m);
+#endif	// A3_OPEN_SOURCE
+}
+
+// internal: pairwise products of transforms
+inline void a3hierarchyStateInternalProductArray(a3mat4 *m_out, const a3mat4 *mL, const a3mat4 *mR, const a3ui32 count)
+{
+#ifdef A3_OPEN_SOURCE
+	a3real4x4ProductArray(&m_out->m, &mL->m, &mR->m, count);
+#else	// !A3_OPEN_SOURCE
+	a3ui32 i;
+	for (i = 0; i < count; ++i)
+		a3real4x4Product(m_out[i].m, mL[i].m, mR[i].m);
+#endif	// A3_OPEN_SOURCE
+}
+
+
 // initialize pose set given an initialized hierarchy and key pose count
 a3i32 a3hierarchyPoseGroupCreate(a3_HierarchyPoseGroup *poseGroup_out, const a3_Hierarchy *hierarchy, const a3ui32 poseCount)
 {
+	if (poseGroup_out && !poseGroup_out->hpose && hierarchy && hierarchy->nodes && poseCount)
+	{
+		const a3ui32 spatialPoseCount = hierarchy->numNodes * poseCount;
+		const size_t spatialPoseSize = A3_HIERARCHYSTATE_ALIGNED(sizeof(a3_SpatialPose) * spatialPoseCount);
+		const size_t dataSize = spatialPoseSize + sizeof(a3_HierarchyPose) * poseCount;
+		a3ui32 i;
+
+		// single block: spatial poses first, then hierarchy poses
+		poseGroup_out->spatialPosePool = (a3_SpatialPose *)a3hierarchyStateInternalAlloc(dataSize);
+		if (!poseGroup_out->spatialPosePool)
+			return -1;
+		poseGroup_out->hpose = (a3_HierarchyPose *)((a3byte *)poseGroup_out->spatialPosePool + spatialPoseSize);
+		poseGroup_out->hierarchy = hierarchy;
+		poseGroup_out->poseCount = poseCount;
+
+		for (i = 0; i < poseCount; ++i)
+			poseGroup_out->hpose[i].spatialPose = poseGroup_out->spatialPosePool + i * hierarchy->numNodes;
+		a3spatialPoseResetArray(poseGroup_out->spatialPosePool, spatialPoseCount);
+		return poseCount;
+	}
 	return -1;
 }
 
 // release pose set
 a3i32 a3hierarchyPoseGroupRelease(a3_HierarchyPoseGroup *poseGroup)
 {
+	if (poseGroup && poseGroup->hpose)
+	{
+		a3hierarchyStateInternalFree(poseGroup->spatialPosePool);
+		poseGroup->spatialPosePool = 0;
+		poseGroup->hpose = 0;
+		poseGroup->poseCount = 0;
+		return 1;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// maximum length of a line in HTR file
+#define A3_HTR_LINEMAX		512
+
+// sections of HTR file
+typedef enum a3_HTRSection
+{
+	a3htr_none,
+	a3htr_header,
+	a3htr_hierarchy,
+	a3htr_basePosition,
+	a3htr_segmentFrames,
+} a3_HTRSection;
+
+
+// internal: read next values on line
+inline a3ui32 a3hierarchyPoseGroupInternalReadHTR(a3real *value_out, const a3ui32 count, const a3byte *delim)
+{
+	a3byte *token;
+	a3ui32 i;
+	for (i = 0; i < count && (token = strtok(0, delim)); ++i)
+		value_out[i] = (a3real)atof(token);
+	return i;
+}
+
+// internal: convert HTR translation and rotation units
+inline void a3hierarchyPoseGroupInternalConvertHTR(a3real channel[6], const a3real scaleFactor, const a3boolean radians)
+{
+	channel[0] *= scaleFactor;
+	channel[1] *= scaleFactor;
+	channel[2] *= scaleFactor;
+	if (radians)
+	{
+		channel[3] = a3rad2deg(channel[3]);
+		channel[4] = a3rad2deg(channel[4]);
+		channel[5] = a3rad2deg(channel[5]);
+	}
+}
+
+// internal: set spatial pose from HTR channels: translation, rotation in 
+//	degrees, uniform scale; channels left at identity stay unflagged so that 
+//	blending can skip them
+inline void a3hierarchyPoseGroupInternalSetHTR(a3_SpatialPose *spatialPose, const a3real channel[6], const a3real scale, const a3boolean orderXYZ)
+{
+	a3spatialPoseReset(spatialPose);
+	if (channel[3] != a3real_zero || channel[4] != a3real_zero || channel[5] != a3real_zero)
+		a3spatialPoseSetRotation(spatialPose, channel[3], channel[4], channel[5], orderXYZ ? a3poseEulerOrder_xyz : a3poseEulerOrder_zyx);
+	if (scale != a3real_one)
+		a3spatialPoseSetScale(spatialPose, scale, scale, scale);
+	if (channel[0] != a3real_zero || channel[1] != a3real_zero || channel[2] != a3real_zero)
+		a3spatialPoseSetTranslation(spatialPose, channel[0], channel[1], channel[2]);
+	a3spatialPoseConvert(spatialPose);
+}
+
+
+// load hierarchy and pose group from HTR file
+a3i32 a3hierarchyPoseGroupLoadHTR(a3_HierarchyPoseGroup *poseGroup_out, a3_Hierarchy *hierarchy_out, const a3byte *resourceFilePath)
+{
+	if (poseGroup_out && !poseGroup_out->hpose && hierarchy_out && !hierarchy_out->nodes && resourceFilePath && *resourceFilePath)
+	{
+		const a3byte *const delim = " \t\r\n";
+		a3byte line[A3_HTR_LINEMAX], *token, *parent;
+		a3_HTRSection section = a3htr_none;
+		a3ui32 numSegments = 0, numFrames = 0, nodeCount = 0, lineNumber = 0, frame;
+		a3i32 nodeIndex = -1, parentIndex;
+		a3boolean orderXYZ = a3false, radians = a3false, result = a3true;
+		a3real scaleFactor = a3real_one, channel[7];
+
+		// one line buffer on the stack; tokens are parsed in place
+		FILE *fp = fopen(resourceFilePath, "r");
+		if (!fp)
+		{
+			printf("\n A3 Warning: Could not open HTR file \'%s\'", resourceFilePath);
+			return 0;
+		}
+
+		while (result && fgets(line, sizeof(line), fp))
+		{
+			++lineNumber;
+			if (line[0] == '#' || !(token = strtok(line, delim)))
+				continue;
+
+			// section tag
+			if (*token == '[')
+			{
+				if ((parent = strchr(++token, ']')) != 0)
+					*parent = 0;
+				if (!strcmp(token, "Header"))
+					section = a3htr_header;
+				else if (!strcmp(token, "SegmentNames&Hierarchy"))
+				{
+					// header is complete: allocate everything once
+					section = a3htr_hierarchy;
+					result = numSegments && numFrames &&
+						a3hierarchyCreate(hierarchy_out, numSegments, 0) > 0 &&
+						a3hierarchyPoseGroupCreate(poseGroup_out, hierarchy_out, numFrames + 1) > 0;
+				}
+				else if (!strcmp(token, "BasePosition"))
+					section = a3htr_basePosition;
+				else if (!strcmp(token, "EndOfFile"))
+					break;
+				else
+				{
+					section = a3htr_segmentFrames;
+					nodeIndex = a3hierarchyGetNodeIndex(hierarchy_out, token);
+					if (nodeIndex < 0)
+						printf("\n A3 Warning: Ignoring unknown segment \'%s\' in HTR file.", token);
+				}
+				continue;
+			}
+
+			switch (section)
+			{
+			case a3htr_header:
+				// keyword and value
+				if ((parent = strtok(0, delim)) != 0)
+				{
+					if (!strcmp(token, "NumSegments"))
+						numSegments = (a3ui32)atoi(parent);
+					else if (!strcmp(token, "NumFrames"))
+						numFrames = (a3ui32)atoi(parent);
+					else if (!strcmp(token, "ScaleFactor"))
+						scaleFactor = (a3real)atof(parent);
+					else if (!strcmp(token, "RotationUnits"))
+						radians = (*parent == 'R' || *parent == 'r');
+					else if (!strcmp(token, "EulerRotationOrder"))
+					{
+						orderXYZ = !strcmp(parent, "XYZ");
+						result = orderXYZ || !strcmp(parent, "ZYX");
+					}
+				}
+				break;
+			case a3htr_hierarchy:
+				// child and parent; parents must be listed first
+				parent = strtok(0, delim);
+				parentIndex = (parent && strcmp(parent, "GLOBAL")) ? a3hierarchyGetNodeIndex(hierarchy_out, parent) : -1;
+				result = parent && nodeCount < numSegments && (parentIndex >= 0 || !strcmp(parent, "GLOBAL"));
+				if (result)
+					a3hierarchySetNode(hierarchy_out, nodeCount++, parentIndex, token);
+				break;
+			case a3htr_basePosition:
+				// name, translation, rotation, bone length
+				nodeIndex = a3hierarchyGetNodeIndex(hierarchy_out, token);
+				result = nodeIndex >= 0 && a3hierarchyPoseGroupInternalReadHTR(channel, 7, delim) == 7;
+				if (result)
+				{
+					a3hierarchyPoseGroupInternalConvertHTR(channel, scaleFactor, radians);
+					a3hierarchyPoseGroupInternalSetHTR(poseGroup_out->hpose[0].spatialPose + nodeIndex, channel, a3real_one, orderXYZ);
+				}
+				break;
+			case a3htr_segmentFrames:
+				// frame, translation, rotation, scale
+				frame = (a3ui32)atoi(token);
+				if (nodeIndex >= 0 && frame < numFrames)
+				{
+					result = a3hierarchyPoseGroupInternalReadHTR(channel, 7, delim) == 7;
+					if (result)
+					{
+						a3hierarchyPoseGroupInternalConvertHTR(channel, scaleFactor, radians);
+						a3hierarchyPoseGroupInternalSetHTR(poseGroup_out->hpose[frame + 1].spatialPose + nodeIndex, channel, channel[6], orderXYZ);
+					}
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		fclose(fp);
+
+		// all segments must be described
+		if (result && nodeCount == numSegments && poseGroup_out->hpose && a3hierarchyUpdateTopology(hierarchy_out) > 0)
+			return poseGroup_out->poseCount;
+
+		printf("\n A3 Warning: Failed to load HTR file \'%s\' (line %u).", resourceFilePath, lineNumber);
+		a3hierarchyPoseGroupRelease(poseGroup_out);
+		a3hierarchyRelease(hierarchy_out);
+		return 0;
+	}
+	return -1;
+}
+
+// save pose group to binary file
+a3i32 a3hierarchyPoseGroupSaveBinary(const a3_HierarchyPoseGroup *poseGroup, const a3_FileStream *fileStream)
+{
+	FILE *fp;
+	a3ui32 ret = 0;
+	if (poseGroup && poseGroup->hpose && fileStream)
+	{
+		fp = fileStream->stream;
+		if (fp)
+		{
+			const a3ui32 header[3] = { poseGroup->poseCount, poseGroup->hierarchy->numNodes, sizeof(a3_SpatialPose) };
+			ret += (a3ui32)fwrite(header, 1, sizeof(header), fp);
+			ret += (a3ui32)fwrite(poseGroup->spatialPosePool, 1, sizeof(a3_SpatialPose) * header[0] * header[1], fp);
+		}
+		return ret;
+	}
+	return -1;
+}
+
+// load pose group from binary file
+a3i32 a3hierarchyPoseGroupLoadBinary(a3_HierarchyPoseGroup *poseGroup_out, const a3_Hierarchy *hierarchy, const a3_FileStream *fileStream)
+{
+	FILE *fp;
+	a3ui32 ret = 0;
+	if (poseGroup_out && !poseGroup_out->hpose && hierarchy && hierarchy->nodes && fileStream)
+	{
+		fp = fileStream->stream;
+		if (fp)
+		{
+			// reject data for another hierarchy or pose layout
+			a3ui32 header[3] = { 0 };
+			ret += (a3ui32)fread(header, 1, sizeof(header), fp);
+			if (ret != sizeof(header) || header[1] != hierarchy->numNodes || header[2] != sizeof(a3_SpatialPose) ||
+				a3hierarchyPoseGroupCreate(poseGroup_out, hierarchy, header[0]) <= 0)
+				return 0;
+			ret += (a3ui32)fread(poseGroup_out->spatialPosePool, 1, sizeof(a3_SpatialPose) * header[0] * header[1], fp);
+		}
+		return ret;
+	}
 	return -1;
 }
 
@@ -48,12 +363,131 @@ a3i32 a3hierarchyPoseGroupRelease(a3_HierarchyPoseGroup *poseGroup)
 // initialize hierarchy state given an initialized hierarchy
 a3i32 a3hierarchyStateCreate(a3_HierarchyState *state_out, const a3_HierarchyPoseGroup *poseGroup)
 {
+	if (state_out && !state_out->samplePose->spatialPose && poseGroup && poseGroup->hpose)
+	{
+		const a3ui32 nodeCount = poseGroup->hierarchy->numNodes;
+		const size_t spatialPoseSize = A3_HIERARCHYSTATE_ALIGNED(sizeof(a3_SpatialPose) * nodeCount);
+		const size_t transformSize = A3_HIERARCHYSTATE_ALIGNED(sizeof(a3mat4) * nodeCount);
+		const size_t dirtySize = sizeof(a3ui32) * ((nodeCount + 31) >> 5);
+		const a3_HierarchyTopology *const topology = poseGroup->hierarchy->topology;
+		a3byte *data;
+		a3ui32 i;
+		if (!topology->levelCount)
+			return -1;
+		data = (a3byte *)a3hierarchyStateInternalAlloc(spatialPoseSize + transformSize * 5 + dirtySize);
+		if (!data)
+			return -1;
+
+		// sample pose, then local, object, inverse object, bind-to-current 
+		//	and parent inverse scratch transforms, then dirty bits; level tables and subtree extents are 
+		//	shared by all states of the hierarchy
+		state_out->poseGroup = poseGroup;
+		state_out->samplePose->spatialPose = (a3_SpatialPose *)data;
+		state_out->localSpace->transform = (a3mat4 *)(data += spatialPoseSize);
+		state_out->objectSpace->transform = (a3mat4 *)(data += transformSize);
+		state_out->objectSpaceInverse->transform = (a3mat4 *)(data += transformSize);
+		state_out->objectSpaceBindToCurrent->transform = (a3mat4 *)(data += transformSize);
+		state_out->parentInverse->transform = (a3mat4 *)(data += transformSize);
+		state_out->dirty = (a3ui32 *)(data += transformSize);
+		state_out->levelNode = topology->levelNode;
+		state_out->levelParent = topology->levelParent;
+		state_out->levelOffset = topology->levelOffset;
+		state_out->levelCount = topology->levelCount;
+		state_out->subtreeEnd = topology->subtreeEnd;
+
+		// start from base pose, everything dirty
+		memcpy(state_out->samplePose->spatialPose, poseGroup->hpose[0].spatialPose, sizeof(a3_SpatialPose) * nodeCount);
+		for (i = 0; i < nodeCount; ++i)
+		{
+			a3spatialPoseConvert(state_out->samplePose->spatialPose + i);
+			state_out->localSpace->transform[i] = state_out->samplePose->spatialPose[i].transform;
+			state_out->objectSpace->transform[i] = a3mat4_identity;
+			state_out->objectSpaceInverse->transform[i] = a3mat4_identity;
+			state_out->objectSpaceBindToCurrent->transform[i] = a3mat4_identity;
+			state_out->parentInverse->transform[i] = a3mat4_identity;
+		}
+		a3hierarchyStateSetDirtyAll(state_out);
+		return nodeCount;
+	}
 	return -1;
 }
 
 // release hierarchy state
 a3i32 a3hierarchyStateRelease(a3_HierarchyState *state)
 {
+	if (state && state->samplePose->spatialPose)
+	{
+		a3hierarchyStateInternalFree(state->samplePose->spatialPose);
+		memset(state, 0, sizeof(a3_HierarchyState));
+		return 1;
+	}
+	return -1;
+}
+
+// update local-space matrices from sample pose
+a3i32 a3hierarchyStateUpdateLocalSpace(const a3_HierarchyState *state)
+{
+	if (state && state->samplePose->spatialPose)
+	{
+		const a3ui32 nodeCount = state->poseGroup->hierarchy->numNodes;
+		a3_SpatialPose *const spatialPose = state->samplePose->spatialPose;
+		a3mat4 *const localSpace = state->localSpace->transform;
+		a3ui32 i, ret = 0;
+		for (i = 0; i < nodeCount; ++i)
+			if (a3spatialPoseConvert(spatialPose + i) > 0)
+			{
+				localSpace[i] = spatialPose[i].transform;
+				state->dirty[i >> 5] |= (1u << (i & 31));
+				++ret;
+			}
+		return ret;
+	}
+	return -1;
+}
+
+// update inverse object-space matrices
+a3i32 a3hierarchyStateUpdateObjectInverse(const a3_HierarchyState *state, const a3boolean usingScale)
+{
+	if (state && state->samplePose->spatialPose)
+	{
+		const a3ui32 nodeCount = state->poseGroup->hierarchy->numNodes;
+		const a3mat4 *const objectSpace = state->objectSpace->transform;
+		a3mat4 *const objectSpaceInverse = state->objectSpaceInverse->transform;
+		a3hierarchyStateInternalInverseArray(objectSpaceInverse, objectSpace, nodeCount, usingScale);
+		return nodeCount;
+	}
+	return -1;
+}
+
+// update bind-to-current given bind-pose object-space transforms
+a3i32 a3hierarchyStateUpdateObjectBindToCurrent(const a3_HierarchyState *state, const a3_HierarchyTransform *objectSpaceBindInverse)
+{
+	if (state && state->samplePose->spatialPose && objectSpaceBindInverse && objectSpaceBindInverse->transform)
+	{
+		const a3ui32 nodeCount = state->poseGroup->hierarchy->numNodes;
+		const a3mat4 *const objectSpace = state->objectSpace->transform;
+		const a3mat4 *const bindInverse = objectSpaceBindInverse->transform;
+		a3mat4 *const bindToCurrent = state->objectSpaceBindToCurrent->transform;
+		a3hierarchyStateInternalProductArray(bindToCurrent, objectSpace, bindInverse, nodeCount);
+		return nodeCount;
+	}
+	return -1;
+}
+
+// update inverse object-space and bind-to-current matrices in one pass
+a3i32 a3hierarchyStateUpdateObjectInverseBindToCurrent(const a3_HierarchyState *state, const a3_HierarchyTransform *objectSpaceBindInverse, const a3boolean usingScale)
+{
+	if (state && state->samplePose->spatialPose && objectSpaceBindInverse && objectSpaceBindInverse->transform)
+	{
+		const a3ui32 nodeCount = state->poseGroup->hierarchy->numNodes;
+		const a3mat4 *const objectSpace = state->objectSpace->transform;
+		const a3mat4 *const bindInverse = objectSpaceBindInverse->transform;
+		a3mat4 *const objectSpaceInverse = state->objectSpaceInverse->transform;
+		a3mat4 *const bindToCurrent = state->objectSpaceBindToCurrent->transform;
+		a3hierarchyStateInternalInverseArray(objectSpaceInverse, objectSpace, nodeCount, usingScale);
+		a3hierarchyStateInternalProductArray(bindToCurrent, objectSpace, bindInverse, nodeCount);
+		return nodeCount;
+	}
 	return -1;
 }
 
@@ -24,9 +24,798 @@
 
 #include "../a3_HierarchyStateBlend.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------
+
+// internal: copy channels of node poses; output transforms are left to be 
+//	rebuilt from dirty flags
+inline void a3hierarchyPoseInternalCopy(a3_SpatialPose* pose_out, const a3_SpatialPose* pose_in, const a3ui32 nodeCount)
+{
+	a3ui32 i;
+	for (i = 0; i < nodeCount; ++i, ++pose_out, ++pose_in)
+	{
+		pose_out->rotation = pose_in->rotation;
+		pose_out->scale = pose_in->scale;
+		pose_out->translation = pose_in->translation;
+		pose_out->dirty |= pose_out->channel | pose_in->channel;
+		pose_out->channel = pose_in->channel;
+	}
+}
+
+// internal: scale single node pose from identity; output may alias input
+inline void a3hierarchyPoseInternalScaleNode(a3_SpatialPose* pose_out, const a3_SpatialPose* pose_in, const a3real w)
+{
+	const a3_SpatialPoseChannel channel = pose_in->channel;
+	if (channel & a3poseChannel_orient_xyz)
+	{
+		// nlerp from identity along the shorter arc
+		const a3vec4 q = pose_in->rotation;
+		const a3real wq = q.w < a3real_zero ? -w : w, w0 = a3real_one - w;
+		const a3real x = q.x * wq, y = q.y * wq, z = q.z * wq, qw = q.w * wq + w0;
+		const a3real lenSq = x * x + y * y + z * z + qw * qw;
+		const a3real lenInv = lenSq > a3real_zero ? a3sqrtInverse(lenSq) : a3real_zero;
+		pose_out->rotation.x = x * lenInv;
+		pose_out->rotation.y = y * lenInv;
+		pose_out->rotation.z = z * lenInv;
+		pose_out->rotation.w = qw * lenInv;
+	}
+	else
+		pose_out->rotation = pose_in->rotation;
+	if (channel & a3poseChannel_scale_xyz)
+	{
+		pose_out->scale.x = a3lerp(a3real_one, pose_in->scale.x, w);
+		pose_out->scale.y = a3lerp(a3real_one, pose_in->scale.y, w);
+		pose_out->scale.z = a3lerp(a3real_one, pose_in->scale.z, w);
+	}
+	else
+		pose_out->scale = pose_in->scale;
+	pose_out->translation.x = pose_in->translation.x * w;
+	pose_out->translation.y = pose_in->translation.y * w;
+	pose_out->translation.z = pose_in->translation.z * w;
+	pose_out->dirty |= pose_out->channel | channel;
+	pose_out->channel = channel;
+}
+
+// internal: scale node poses from identity
+inline void a3hierarchyPoseInternalScale(a3_SpatialPose* pose_out, const a3_SpatialPose* pose_in, const a3real w, const a3ui32 nodeCount)
+{
+	a3ui32 i;
+	for (i = 0; i < nodeCount; ++i)
+		a3hierarchyPoseInternalScaleNode(pose_out + i, pose_in + i, w);
+}
+
+// internal: add scaled layer to base
+inline void a3hierarchyPoseInternalAdd(a3_SpatialPose* pose_out, const a3_SpatialPose* pose_base, const a3_SpatialPose* pose_layer, const a3real w, const a3ui32 nodeCount)
+{
+	a3_SpatialPose layer;
+	a3ui32 i;
+	layer.dirty = a3poseChannel_none;
+	for (i = 0; i < nodeCount; ++i)
+	{
+		a3hierarchyPoseInternalScaleNode(&layer, pose_layer + i, w);
+		a3spatialPoseConcat(pose_out + i, pose_base + i, &layer);
+	}
+}
+
+// internal: weighted average of node poses given input pointers; each 
+//	node reads all inputs before writing so output may alias any input
+//	rotations are aligned to the hemisphere of the heaviest input, so 
+//	dropping zero-weight inputs cannot change the result
+inline void a3hierarchyPoseInternalAverage(a3_SpatialPose* pose_out, const a3_SpatialPose* const* pose_in, const a3real* weight, const a3ui32 poseCount, const a3ui32 nodeCount)
+{
+	a3_SpatialPoseChannel channel;
+	a3vec4 q, q0, r, s, t;
+	a3real wq, lenSq, lenInv;
+	a3ui32 i, j, ref;
+	for (j = 1, ref = 0; j < poseCount; ++j)
+		if (a3absolute(weight[j]) > a3absolute(weight[ref]))
+			ref = j;
+	for (i = 0; i < nodeCount; ++i)
+	{
+		channel = a3poseChannel_none;
+		q0 = pose_in[ref][i].rotation;
+		r = s = t = a3vec4_zero;
+		for (j = 0; j < poseCount; ++j)
+		{
+			const a3_SpatialPose* const p = pose_in[j] + i;
+			q = p->rotation;
+			wq = (q0.x * q.x + q0.y * q.y + q0.z * q.z + q0.w * q.w) < a3real_zero ? -weight[j] : weight[j];
+			r.x += q.x * wq;
+			r.y += q.y * wq;
+			r.z += q.z * wq;
+			r.w += q.w * wq;
+			s.x += p->scale.x * weight[j];
+			s.y += p->scale.y * weight[j];
+			s.z += p->scale.z * weight[j];
+			t.x += p->translation.x * weight[j];
+			t.y += p->translation.y * weight[j];
+			t.z += p->translation.z * weight[j];
+			channel |= p->channel;
+		}
+		lenSq = r.x * r.x + r.y * r.y + r.z * r.z + r.w * r.w;
+		lenInv = lenSq > a3real_zero ? a3sqrtInverse(lenSq) : a3real_zero;
+		pose_out[i].rotation.x = r.x * lenInv;
+		pose_out[i].rotation.y = r.y * lenInv;
+		pose_out[i].rotation.z = r.z * lenInv;
+		pose_out[i].rotation.w = r.w * lenInv;
+		pose_out[i].scale = s;
+		pose_out[i].translation = t;
+		pose_out[i].dirty |= pose_out[i].channel | channel;
+		pose_out[i].channel = channel;
+	}
+}
+
+
+// copy pose
+a3i32 a3hierarchyPoseCopy(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_in, const a3ui32 nodeCount)
+{
+	if (pose_out && pose_out->spatialPose && pose_in && pose_in->spatialPose)
+	{
+		if (pose_out->spatialPose != pose_in->spatialPose)
+			a3hierarchyPoseInternalCopy(pose_out->spatialPose, pose_in->spatialPose, nodeCount);
+		return nodeCount;
+	}
+	return -1;
+}
+
+// interpolate poses
+a3i32 a3hierarchyPoseLerp(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose0, const a3_HierarchyPose *pose1, const a3real u, const a3ui32 nodeCount)
+{
+	if (pose_out && pose_out->spatialPose && pose0 && pose0->spatialPose && pose1 && pose1->spatialPose)
+	{
+		a3ui32 i;
+		for (i = 0; i < nodeCount; ++i)
+			a3spatialPoseLerp(pose_out->spatialPose + i, pose0->spatialPose + i, pose1->spatialPose + i, u);
+		return nodeCount;
+	}
+	return -1;
+}
+
+// concatenate poses
+a3i32 a3hierarchyPoseConcat(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_lhs, const a3_HierarchyPose *pose_rhs, const a3ui32 nodeCount)
+{
+	if (pose_out && pose_lhs && pose_rhs)
+		return a3spatialPoseConcatArray(pose_out->spatialPose, pose_lhs->spatialPose, pose_rhs->spatialPose, nodeCount);
+	return -1;
+}
+
+// scale pose from identity
+a3i32 a3hierarchyPoseScale(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_in, const a3real w, const a3ui32 nodeCount)
+{
+	if (pose_out && pose_out->spatialPose && pose_in && pose_in->spatialPose)
+	{
+		a3hierarchyPoseInternalScale(pose_out->spatialPose, pose_in->spatialPose, w, nodeCount);
+		return nodeCount;
+	}
+	return -1;
+}
+
+// add scaled pose to base pose
+a3i32 a3hierarchyPoseAdd(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_base, const a3_HierarchyPose *pose_layer, const a3real w, const a3ui32 nodeCount)
+{
+	if (pose_out && pose_out->spatialPose && pose_base && pose_base->spatialPose && pose_layer && pose_layer->spatialPose)
+	{
+		a3hierarchyPoseInternalAdd(pose_out->spatialPose, pose_base->spatialPose, pose_layer->spatialPose, w, nodeCount);
+		return nodeCount;
+	}
+	return -1;
+}
+
+// internal: copy nodes outside mask; used when a masked operation cannot 
+//	write over its first input
+inline void a3hierarchyPoseInternalCopyUnmasked(a3_SpatialPose* pose_out, const a3_SpatialPose* pose_in, const a3_HierarchyMask* mask)
+{
+	a3ui32 r, first = 0;
+	for (r = 0; r < mask->rangeCount; ++r)
+	{
+		a3hierarchyPoseInternalCopy(pose_out + first, pose_in + first, mask->range[r * 2] - first);
+		first = mask->range[r * 2 + 1];
+	}
+	a3hierarchyPoseInternalCopy(pose_out + first, pose_in + first, mask->hierarchy->numNodes - first);
+}
+
+// internal: interpolate nodes in mask
+inline void a3hierarchyPoseInternalLerpMasked(a3_SpatialPose* pose_out, const a3_SpatialPose* pose0, const a3_SpatialPose* pose1, const a3real u, const a3_HierarchyMask* mask)
+{
+	a3ui32 r, i, end;
+	for (r = 0; r < mask->rangeCount; ++r)
+		for (i = mask->range[r * 2], end = mask->range[r * 2 + 1]; i < end; ++i)
+			a3spatialPoseLerp(pose_out + i, pose0 + i, pose1 + i, u);
+}
+
+// internal: add scaled layer to nodes in mask
+inline void a3hierarchyPoseInternalAddMasked(a3_SpatialPose* pose_out, const a3_SpatialPose* pose_base, const a3_SpatialPose* pose_layer, const a3real w, const a3_HierarchyMask* mask)
+{
+	a3ui32 r, first;
+	for (r = 0; r < mask->rangeCount; ++r)
+	{
+		first = mask->range[r * 2];
+		a3hierarchyPoseInternalAdd(pose_out + first, pose_base + first, pose_layer + first, w, mask->range[r * 2 + 1] - first);
+	}
+}
+
+// internal: scale nodes in mask
+inline void a3hierarchyPoseInternalScaleMasked(a3_SpatialPose* pose_out, const a3_SpatialPose* pose_in, const a3real w, const a3_HierarchyMask* mask)
+{
+	a3ui32 r, first;
+	for (r = 0; r < mask->rangeCount; ++r)
+	{
+		first = mask->range[r * 2];
+		a3hierarchyPoseInternalScale(pose_out + first, pose_in + first, w, mask->range[r * 2 + 1] - first);
+	}
+}
+
+
+// weighted average of poses
+a3i32 a3hierarchyPoseAverage(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_in, const a3real *weight, const a3ui32 poseCount, const a3ui32 nodeCount)
+{
+	if (pose_out && pose_out->spatialPose && pose_in && weight && poseCount && poseCount <= a3hierarchyBlend_inputMax)
+	{
+		const a3_SpatialPose* in[a3hierarchyBlend_inputMax];
+		a3ui32 j;
+		for (j = 0; j < poseCount; ++j)
+			if (!(in[j] = pose_in[j].spatialPose))
+				return -1;
+		a3hierarchyPoseInternalAverage(pose_out->spatialPose, in, weight, poseCount, nodeCount);
+		return nodeCount;
+	}
+	return -1;
+}
+
+// interpolate poses for nodes in mask
+a3i32 a3hierarchyPoseLerpMasked(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose0, const a3_HierarchyPose *pose1, const a3real u, const a3_HierarchyMask *mask)
+{
+	if (pose_out && pose_out->spatialPose && pose0 && pose0->spatialPose && pose1 && pose1->spatialPose && mask && mask->bits)
+	{
+		a3hierarchyPoseInternalLerpMasked(pose_out->spatialPose, pose0->spatialPose, pose1->spatialPose, u, mask);
+		return mask->count;
+	}
+	return -1;
+}
+
+// add scaled layer for nodes in mask
+a3i32 a3hierarchyPoseAddMasked(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_base, const a3_HierarchyPose *pose_layer, const a3real w, const a3_HierarchyMask *mask)
+{
+	if (pose_out && pose_out->spatialPose && pose_base && pose_base->spatialPose && pose_layer && pose_layer->spatialPose && mask && mask->bits)
+	{
+		a3hierarchyPoseInternalAddMasked(pose_out->spatialPose, pose_base->spatialPose, pose_layer->spatialPose, w, mask);
+		return mask->count;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal: rebuild runs and count from bits
+inline a3i32 a3hierarchyMaskInternalUpdate(a3_HierarchyMask* mask)
+{
+	const a3ui32 numNodes = mask->hierarchy->numNodes;
+	a3ui32 i, set, run = 0;
+	mask->rangeCount = mask->count = 0;
+	for (i = 0; i < numNodes; ++i)
+	{
+		set = mask->bits[i >> 5] >> (i & 31) & 1;
+		if (set != run)
+			mask->range[mask->rangeCount * 2 + !set] = i;
+		mask->rangeCount += run & !set;
+		mask->count += set;
+		run = set;
+	}
+	if (run)
+		mask->range[mask->rangeCount++ * 2 + 1] = numNodes;
+	return mask->count;
+}
+
+// internal: set or clear subtree bits; with topology the subtree is a run 
+//	of pre-order positions, otherwise parents precede children, so one pass 
+//	from the subtree root marks each descendant from its parent
+inline a3i32 a3hierarchyMaskInternalSubtree(a3_HierarchyMask* mask, const a3ui32 nodeIndex, const a3boolean set)
+{
+	const a3ui32 numNodes = mask->hierarchy->numNodes, words = (numNodes + 31) >> 5;
+	const a3_HierarchyNode* node = mask->hierarchy->nodes;
+	const a3_HierarchyTopology* topology = mask->hierarchy->topology;
+	a3ui32* const subtree = mask->bits + words;
+	a3ui32 i, bit, end;
+	a3i32 p;
+
+	memset(subtree, 0, sizeof(a3ui32) * words);
+	if (topology->orderNode)
+		for (i = topology->order[nodeIndex], end = i + topology->subtreeSize[nodeIndex]; i < end; ++i)
+		{
+			bit = topology->orderNode[i];
+			subtree[bit >> 5] |= 1u << (bit & 31);
+		}
+	else
+	{
+		subtree[nodeIndex >> 5] |= 1u << (nodeIndex & 31);
+		for (i = nodeIndex + 1; i < numNodes; ++i)
+		{
+			p = node[i].parentIndex;
+			bit = p >= (a3i32)nodeIndex && (subtree[p >> 5] >> (p & 31) & 1);
+			subtree[i >> 5] |= bit << (i & 31);
+		}
+	}
+	for (i = 0; i < words; ++i)
+		mask->bits[i] = set ? (mask->bits[i] | subtree[i]) : (mask->bits[i] & ~subtree[i]);
+	return a3hierarchyMaskInternalUpdate(mask);
+}
+
+
+// allocate empty mask
+a3i32 a3hierarchyMaskCreate(a3_HierarchyMask *mask_out, const a3_Hierarchy *hierarchy, const a3byte name[a3node_nameSize])
+{
+	if (mask_out && !mask_out->bits && hierarchy && hierarchy->nodes && hierarchy->numNodes)
+	{
+		// bits and scratch, then at most one run per two nodes
+		const a3ui32 words = (hierarchy->numNodes + 31) >> 5;
+		const size_t dataSize = sizeof(a3ui32) * (words * 2 + hierarchy->numNodes + 1);
+		mask_out->bits = (a3ui32*)malloc(dataSize);
+		if (!mask_out->bits)
+			return -1;
+		memset(mask_out->bits, 0, dataSize);
+		mask_out->range = mask_out->bits + words * 2;
+		mask_out->rangeCount = mask_out->count = 0;
+		mask_out->hierarchy = hierarchy;
+		memset(mask_out->name, 0, sizeof(mask_out->name));
+		if (name)
+			strncpy(mask_out->name, name, a3node_nameSize - 1);
+		return hierarchy->numNodes;
+	}
+	return -1;
+}
+
+// release mask
+a3i32 a3hierarchyMaskRelease(a3_HierarchyMask *mask)
+{
+	if (mask && mask->bits)
+	{
+		free(mask->bits);
+		memset(mask, 0, sizeof(a3_HierarchyMask));
+		return 1;
+	}
+	return -1;
+}
+
+// add subtree to mask
+a3i32 a3hierarchyMaskAddSubtree(a3_HierarchyMask *mask, const a3ui32 nodeIndex)
+{
+	if (mask && mask->bits && nodeIndex < mask->hierarchy->numNodes)
+		return a3hierarchyMaskInternalSubtree(mask, nodeIndex, a3true);
+	return -1;
+}
+
+// remove subtree from mask
+a3i32 a3hierarchyMaskRemoveSubtree(a3_HierarchyMask *mask, const a3ui32 nodeIndex)
+{
+	if (mask && mask->bits && nodeIndex < mask->hierarchy->numNodes)
+		return a3hierarchyMaskInternalSubtree(mask, nodeIndex, a3false);
+	return -1;
+}
+
+// add subtree under named node
+a3i32 a3hierarchyMaskAddSubtreeByName(a3_HierarchyMask *mask, const a3byte nodeName[a3node_nameSize])
+{
+	if (mask && mask->bits && nodeName)
+	{
+		const a3i32 nodeIndex = a3hierarchyGetNodeIndex(mask->hierarchy, nodeName);
+		if (nodeIndex >= 0)
+			return a3hierarchyMaskInternalSubtree(mask, nodeIndex, a3true);
+	}
+	return -1;
+}
+
+// invert mask
+a3i32 a3hierarchyMaskInvert(a3_HierarchyMask *mask)
+{
+	if (mask && mask->bits)
+	{
+		const a3ui32 numNodes = mask->hierarchy->numNodes, words = (numNodes + 31) >> 5;
+		a3ui32 i;
+		for (i = 0; i < words; ++i)
+			mask->bits[i] = ~mask->bits[i];
+
+		// keep bits past the last node clear
+		if (numNodes & 31)
+			mask->bits[words - 1] &= (1u << (numNodes & 31)) - 1;
+		return a3hierarchyMaskInternalUpdate(mask);
+	}
+	return -1;
+}
+
 
 //-----------------------------------------------------------------------------
 
+// internal: true if input count suits op
+inline a3boolean a3hierarchyBlendTreeInternalValidInputs(const a3_HierarchyBlendOp op, const a3ui32 inputCount)
+{
+	switch (op)
+	{
+	case a3hierarchyBlend_source:
+	case a3hierarchyBlend_identity:
+		return (inputCount == 0);
+	case a3hierarchyBlend_scale:
+		return (inputCount == 1);
+	case a3hierarchyBlend_lerp:
+	case a3hierarchyBlend_add:
+	case a3hierarchyBlend_concat:
+		return (inputCount == 2);
+	case a3hierarchyBlend_average:
+		return (inputCount >= 1 && inputCount <= a3hierarchyBlend_inputMax);
+	case a3hierarchyBlend_bilinear:
+		return (inputCount == 4);
+	case a3hierarchyBlend_triangular:
+		return (inputCount == 3);
+	}
+	return a3false;
+}
+
+// internal: append node's subtree to instruction list in post-order; the 
+//	slot array marks visited nodes, and only leaves may be shared since they 
+//	never hold a slot
+//	returns arena slots needed by subtree, -1 if not a tree or invalid
+inline a3i32 a3hierarchyBlendTreeInternalCompile(a3_HierarchyBlendTree* tree, const a3ui32 nodeIndex)
+{
+	const a3_HierarchyBlendNode* node = tree->node + nodeIndex;
+	a3i32 need = 0, childNeed, held = 0;
+	a3ui32 i;
+
+	if (tree->slot[nodeIndex] && !node->inputCount)
+		return 0;
+	if (tree->slot[nodeIndex] || !a3hierarchyBlendTreeInternalValidInputs(node->op, node->inputCount) ||
+		(node->op == a3hierarchyBlend_source && !(node->source && node->source->spatialPose)) ||
+		(node->mask && (!node->mask->bits || node->mask->hierarchy->numNodes != tree->hierarchy->numNodes ||
+			(node->op != a3hierarchyBlend_lerp && node->op != a3hierarchyBlend_add && node->op != a3hierarchyBlend_scale))))
+		return -1;
+	tree->slot[nodeIndex] = 1;
+
+	// inputs computed before input i may each hold one slot while it runs
+	for (i = 0; i < node->inputCount; ++i)
+	{
+		if (node->input[i] >= tree->nodeCount)
+			return -1;
+		childNeed = a3hierarchyBlendTreeInternalCompile(tree, node->input[i]);
+		if (childNeed < 0)
+			return -1;
+		need = a3maximum(need, held + childNeed);
+		held += (childNeed > 0);
+	}
+
+	// non-leaf writes into the lowest slot held by its inputs or a new one
+	if (node->inputCount)
+		need = a3maximum(need, a3maximum(held, 1));
+
+	tree->instruction[tree->instructionCount++] = nodeIndex;
+	return need;
+}
+
+
+// allocate blend tree
+a3i32 a3hierarchyBlendTreeCreate(a3_HierarchyBlendTree *tree_out, const a3_Hierarchy *hierarchy, const a3ui32 nodeCount)
+{
+	if (tree_out && !tree_out->data && hierarchy && hierarchy->numNodes && nodeCount)
+	{
+		// pointers and reals first for alignment
+		const size_t dataSize = (sizeof(a3_HierarchyBlendNode) + sizeof(a3_SpatialPose*) + 
+			sizeof(a3real) * a3hierarchyBlend_inputMax + sizeof(a3ui32) + sizeof(a3i32) * 2) * nodeCount;
+		a3ui32 i;
+
+		tree_out->data = malloc(dataSize);
+		if (!tree_out->data)
+			return -1;
+		memset(tree_out->data, 0, dataSize);
+		tree_out->node = (a3_HierarchyBlendNode*)tree_out->data;
+		tree_out->result = (const a3_SpatialPose**)(tree_out->node + nodeCount);
+		tree_out->weight = (a3real*)(tree_out->result + nodeCount);
+		tree_out->instruction = (a3ui32*)(tree_out->weight + nodeCount * a3hierarchyBlend_inputMax);
+		tree_out->slot = (a3i32*)(tree_out->instruction + nodeCount);
+		tree_out->pass = tree_out->slot + nodeCount;
+		for (i = 0; i < nodeCount; ++i)
+			tree_out->node[i].op = a3hierarchyBlend_identity;
+
+		tree_out->hierarchy = hierarchy;
+		tree_out->nodeCount = nodeCount;
+		tree_out->root = 0;
+		tree_out->instructionCount = 0;
+		tree_out->arena = 0;
+		tree_out->slotCount = 0;
+		return nodeCount;
+	}
+	return -1;
+}
+
+// release blend tree
+a3i32 a3hierarchyBlendTreeRelease(a3_HierarchyBlendTree *tree)
+{
+	if (tree && tree->data)
+	{
+		free(tree->arena);
+		free(tree->data);
+		memset(tree, 0, sizeof(a3_HierarchyBlendTree));
+		return 1;
+	}
+	return -1;
+}
+
+// set node as source leaf
+a3i32 a3hierarchyBlendTreeSetSource(a3_HierarchyBlendTree *tree, const a3ui32 nodeIndex, const a3_HierarchyPose *source)
+{
+	if (tree && tree->data && nodeIndex < tree->nodeCount && source && source->spatialPose)
+	{
+		tree->node[nodeIndex].op = a3hierarchyBlend_source;
+		tree->node[nodeIndex].source = source;
+		tree->node[nodeIndex].mask = 0;
+		tree->node[nodeIndex].inputCount = 0;
+		return nodeIndex;
+	}
+	return -1;
+}
+
+// set node operation and inputs
+a3i32 a3hierarchyBlendTreeSetOp(a3_HierarchyBlendTree *tree, const a3ui32 nodeIndex, const a3_HierarchyBlendOp op, const a3ui32 *inputArray, const a3ui32 inputCount)
+{
+	if (tree && tree->data && nodeIndex < tree->nodeCount && op != a3hierarchyBlend_source && 
+		a3hierarchyBlendTreeInternalValidInputs(op, inputCount) && (inputArray || !inputCount))
+	{
+		a3ui32 i;
+		tree->node[nodeIndex].op = op;
+		tree->node[nodeIndex].source = 0;
+		tree->node[nodeIndex].inputCount = inputCount;
+		for (i = 0; i < inputCount; ++i)
+			tree->node[nodeIndex].input[i] = inputArray[i];
+		return nodeIndex;
+	}
+	return -1;
+}
+
+// set or clear mask of node
+a3i32 a3hierarchyBlendTreeSetMask(a3_HierarchyBlendTree *tree, const a3ui32 nodeIndex, const a3_HierarchyMask *mask)
+{
+	if (tree && tree->data && nodeIndex < tree->nodeCount && (!mask || mask->bits))
+	{
+		tree->node[nodeIndex].mask = mask;
+		return nodeIndex;
+	}
+	return -1;
+}
+
+// compile tree
+a3i32 a3hierarchyBlendTreeCompile(a3_HierarchyBlendTree *tree, const a3ui32 rootIndex)
+{
+	if (tree && tree->data && rootIndex < tree->nodeCount)
+	{
+		const a3ui32 numNodes = tree->hierarchy->numNodes;
+		a3i32 need;
+
+		memset(tree->slot, 0, sizeof(a3i32) * tree->nodeCount);
+		tree->instructionCount = 0;
+		need = a3hierarchyBlendTreeInternalCompile(tree, rootIndex);
+		if (need < 0)
+		{
+			tree->instructionCount = 0;
+			return -1;
+		}
+
+		// arena holds the identity pose and the worst-case slots
+		if (!tree->arena || (a3ui32)need > tree->slotCount)
+		{
+			free(tree->arena);
+			tree->arena = (a3_SpatialPose*)malloc(sizeof(a3_SpatialPose) * numNodes * (need + 1));
+			if (!tree->arena)
+			{
+				tree->instructionCount = tree->slotCount = 0;
+				return -1;
+			}
+			tree->slotCount = need;
+		}
+		a3spatialPoseResetArray(tree->arena, numNodes * (tree->slotCount + 1));
+		tree->root = rootIndex;
+		return tree->instructionCount;
+	}
+	return -1;
+}
+
+// internal: decide which inputs of active node contribute given params; 
+//	sets pass mode and weights, and activates contributing inputs
+inline void a3hierarchyBlendTreeInternalPrune(a3_HierarchyBlendTree* tree, const a3ui32 nodeIndex)
+{
+	const a3_HierarchyBlendNode* node = tree->node + nodeIndex;
+	a3real* const weight = tree->weight + nodeIndex * a3hierarchyBlend_inputMax;
+	a3real total = a3real_zero, u = node->param[0], v = node->param[1];
+	a3i32 pass = -1;
+	a3ui32 i, count = 0, last = 0;
+
+	// empty mask leaves input 0 everywhere; a non-empty one still needs 
+	//	input 0 outside the mask, so only u = 0 forwards
+	const a3boolean masked = node->mask != 0, empty = masked && !node->mask->count;
+
+	// binary ops use unit weights for every input they read
+	switch (node->op)
+	{
+	case a3hierarchyBlend_lerp:
+		weight[0] = weight[1] = a3real_one;
+		pass = (u == a3real_zero || empty) ? 0 : (u == a3real_one && !masked) ? 1 : -1;
+		break;
+	case a3hierarchyBlend_add:
+		weight[0] = weight[1] = a3real_one;
+		pass = (u == a3real_zero || empty) ? 0 : -1;
+		break;
+	case a3hierarchyBlend_scale:
+		weight[0] = a3real_one;
+		pass = (u == a3real_one || empty) ? 0 : (u == a3real_zero && !masked) ? -2 : -1;
+		break;
+	case a3hierarchyBlend_concat:
+		weight[0] = weight[1] = a3real_one;
+		break;
+	case a3hierarchyBlend_average:
+	case a3hierarchyBlend_bilinear:
+	case a3hierarchyBlend_triangular:
+		// blend spaces are averages with weights derived from coordinates
+		if (node->op == a3hierarchyBlend_bilinear)
+		{
+			weight[0] = (a3real_one - u) * (a3real_one - v);
+			weight[1] = u * (a3real_one - v);
+			weight[2] = (a3real_one - u) * v;
+			weight[3] = u * v;
+		}
+		else if (node->op == a3hierarchyBlend_triangular)
+		{
+			weight[0] = a3real_one - u - v;
+			weight[1] = u;
+			weight[2] = v;
+		}
+		else
+			for (i = 0; i < node->inputCount; ++i)
+				weight[i] = node->param[i];
+		for (i = 0; i < node->inputCount; ++i)
+			if (weight[i] != a3real_zero)
+			{
+				total += weight[i];
+				last = i;
+				++count;
+			}
+		if (count == 0 || total == a3real_zero)
+			pass = -2;
+		else if (count == 1)
+			pass = last;
+		else
+			for (total = a3recip(total), i = 0; i < node->inputCount; ++i)
+				weight[i] *= total;
+		break;
+	default:
+		break;
+	}
+
+	// activate forwarded input only, or every input with nonzero weight
+	tree->pass[nodeIndex] = pass;
+	if (pass >= 0)
+		tree->pass[node->input[pass]] = -1;
+	else if (pass == -1)
+		for (i = 0; i < node->inputCount; ++i)
+			if (weight[i] != a3real_zero)
+				tree->pass[node->input[i]] = -1;
+}
+
+// evaluate compiled tree
+a3i32 a3hierarchyBlendTreeEvaluate(a3_HierarchyBlendTree *tree, const a3_HierarchyPose *pose_out)
+{
+	if (tree && tree->data && tree->instructionCount && pose_out && pose_out->spatialPose)
+	{
+		const a3ui32 numNodes = tree->hierarchy->numNodes;
+		const a3_SpatialPose* in[a3hierarchyBlend_inputMax];
+		a3real w[a3hierarchyBlend_inputMax];
+		const a3_HierarchyBlendNode* node;
+		const a3real* weight;
+		a3_SpatialPose* target;
+		a3ui32 k, i, n, count, executed = 0;
+		a3i32 top = 0, low;
+
+		// prune: parents precede children in reverse post-order, so one 
+		//	backward pass settles every node without touching joints
+		for (k = 0; k < tree->instructionCount; ++k)
+			tree->pass[tree->instruction[k]] = -3;
+		tree->pass[tree->root] = -1;
+		for (k = tree->instructionCount; k > 0; --k)
+		{
+			n = tree->instruction[k - 1];
+			if (tree->pass[n] != -3)
+				a3hierarchyBlendTreeInternalPrune(tree, n);
+		}
+
+		// execute surviving instructions; results form a stack in the arena
+		for (k = 0; k < tree->instructionCount; ++k)
+		{
+			n = tree->instruction[k];
+			node = tree->node + n;
+			tree->slot[n] = -1;
+			if (tree->pass[n] == -3)
+				continue;
+			if (node->op == a3hierarchyBlend_source)
+			{
+				tree->result[n] = node->source->spatialPose;
+				continue;
+			}
+			if (node->op == a3hierarchyBlend_identity || tree->pass[n] == -2)
+			{
+				tree->result[n] = tree->arena;
+				continue;
+			}
+			if (tree->pass[n] >= 0)
+			{
+				tree->result[n] = tree->result[node->input[tree->pass[n]]];
+				tree->slot[n] = tree->slot[node->input[tree->pass[n]]];
+				continue;
+			}
+
+			// gather contributing inputs and the lowest slot they hold
+			weight = tree->weight + n * a3hierarchyBlend_inputMax;
+			for (i = count = 0, low = -1; i < node->inputCount; ++i)
+			{
+				if (weight[i] != a3real_zero)
+				{
+					in[count] = tree->result[node->input[i]];
+					w[count++] = weight[i];
+					if (tree->slot[node->input[i]] >= 0 && (low < 0 || tree->slot[node->input[i]] < low))
+						low = tree->slot[node->input[i]];
+				}
+			}
+			if (low < 0)
+				low = top;
+			top = low + 1;
+			target = n == tree->root ? pose_out->spatialPose : tree->arena + numNodes * (low + 1);
+
+			// masked ops write in place over input 0 when it holds the slot, 
+			//	otherwise nodes outside the mask are copied first
+			if (node->mask)
+			{
+				if (target != in[0])
+					a3hierarchyPoseInternalCopyUnmasked(target, in[0], node->mask);
+				if (node->op == a3hierarchyBlend_lerp)
+					a3hierarchyPoseInternalLerpMasked(target, in[0], in[1], node->param[0], node->mask);
+				else if (node->op == a3hierarchyBlend_add)
+					a3hierarchyPoseInternalAddMasked(target, in[0], in[1], node->param[0], node->mask);
+				else
+					a3hierarchyPoseInternalScaleMasked(target, in[0], node->param[0], node->mask);
+				tree->result[n] = target;
+				tree->slot[n] = low;
+				++executed;
+				continue;
+			}
+
+			switch (node->op)
+			{
+			case a3hierarchyBlend_lerp:
+				for (i = 0; i < numNodes; ++i)
+					a3spatialPoseLerp(target + i, in[0] + i, in[1] + i, node->param[0]);
+				break;
+			case a3hierarchyBlend_add:
+				a3hierarchyPoseInternalAdd(target, in[0], in[1], node->param[0], numNodes);
+				break;
+			case a3hierarchyBlend_scale:
+				a3hierarchyPoseInternalScale(target, in[0], node->param[0], numNodes);
+				break;
+			case a3hierarchyBlend_concat:
+				a3spatialPoseConcatArray(target, in[0], in[1], numNodes);
+				break;
+			default:
+				a3hierarchyPoseInternalAverage(target, in, w, count, numNodes);
+				break;
+			}
+			tree->result[n] = target;
+			tree->slot[n] = low;
+			++executed;
+		}
+
+		// root forwarded a source, identity or slot
+		if (tree->result[tree->root] != pose_out->spatialPose)
+			a3hierarchyPoseInternalCopy(pose_out->spatialPose, tree->result[tree->root], numNodes);
+		return executed;
+	}
+	return -1;
+}
 
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,363 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_JobSystem.c
+	Implementation of work-stealing job system.
+*/
+
+#include "../a3_JobSystem.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <intrin.h>
+#else	// !_WIN32
+#include <sched.h>
+#endif	// _WIN32
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define a3jobSystemInternalPause()	_mm_pause()
+#else	// !SSE2
+#define a3jobSystemInternalPause()
+#endif	// SSE2
+
+// thread-local storage qualifier
+#ifdef _MSC_VER
+#define A3_JOBSYSTEM_TLS			__declspec(thread)
+#else	// !_MSC_VER
+#define A3_JOBSYSTEM_TLS			__thread
+#endif	// _MSC_VER
+
+// failed attempts to find work before an idle worker yields its time slice
+#define A3_JOBSYSTEM_SPINCOUNT		64
+
+
+// worker run by the calling thread, if any
+static A3_JOBSYSTEM_TLS a3_JobWorker *a3jobSystemInternalCurrent;
+
+
+//-----------------------------------------------------------------------------
+
+// internal: compare and swap; returns previous value
+inline a3i32 a3jobSystemInternalCompareExchange(volatile a3i32 *dst, const a3i32 desired, const a3i32 expected)
+{
+#ifdef _MSC_VER
+	return (a3i32)_InterlockedCompareExchange((volatile long *)dst, desired, expected);
+#else	// !_MSC_VER
+	return __sync_val_compare_and_swap(dst, expected, desired);
+#endif	// _MSC_VER
+}
+
+// internal: atomic add; returns new value
+inline a3i32 a3jobSystemInternalAdd(volatile a3i32 *dst, const a3i32 value)
+{
+#ifdef _MSC_VER
+	return (a3i32)_InterlockedExchangeAdd((volatile long *)dst, value) + value;
+#else	// !_MSC_VER
+	return __sync_add_and_fetch(dst, value);
+#endif	// _MSC_VER
+}
+
+// internal: full memory fence
+inline void a3jobSystemInternalFence()
+{
+#ifdef _MSC_VER
+	MemoryBarrier();
+#else	// !_MSC_VER
+	__sync_synchronize();
+#endif	// _MSC_VER
+}
+
+// internal: keep prior writes before following writes (x86 stores are 
+//	ordered, so only the compiler needs restraining)
+inline void a3jobSystemInternalFenceRelease()
+{
+#ifdef _MSC_VER
+	_ReadWriteBarrier();
+#else	// !_MSC_VER
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+#endif	// _MSC_VER
+}
+
+// internal: keep following reads after prior reads
+inline void a3jobSystemInternalFenceAcquire()
+{
+#ifdef _MSC_VER
+	_ReadWriteBarrier();
+#else	// !_MSC_VER
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif	// _MSC_VER
+}
+
+// internal: give up time slice
+inline void a3jobSystemInternalYield()
+{
+#ifdef _WIN32
+	SwitchToThread();
+#else	// !_WIN32
+	sched_yield();
+#endif	// _WIN32
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal: owner pushes job at bottom; fails if full
+inline a3boolean a3jobSystemInternalPush(a3_JobDeque *deque, const a3_Job *job)
+{
+	const a3i32 b = deque->bottom, t = deque->top;
+	if ((a3ui32)(b - t) > deque->mask)
+		return a3false;
+	deque->job[b & deque->mask] = *job;
+	a3jobSystemInternalFenceRelease();
+	deque->bottom = b + 1;
+	return a3true;
+}
+
+// internal: owner pops job from bottom; races thieves for the last job
+inline a3boolean a3jobSystemInternalPop(a3_JobDeque *deque, a3_Job *job_out)
+{
+	const a3i32 b = deque->bottom - 1;
+	a3i32 t;
+	a3boolean ret = a3true;
+
+	// claim bottom slot before looking at top
+	deque->bottom = b;
+	a3jobSystemInternalFence();
+	t = deque->top;
+	if (t <= b)
+	{
+		*job_out = deque->job[b & deque->mask];
+		if (t == b)
+		{
+			ret = (a3jobSystemInternalCompareExchange(&deque->top, t + 1, t) == t);
+			deque->bottom = b + 1;
+		}
+		return ret;
+	}
+	deque->bottom = b + 1;
+	return a3false;
+}
+
+// internal: thief takes job from top
+inline a3boolean a3jobSystemInternalSteal(a3_JobDeque *deque, a3_Job *job_out)
+{
+	const a3i32 t = deque->top;
+	a3i32 b;
+	a3jobSystemInternalFence();
+	b = deque->bottom;
+	if (t < b)
+	{
+		a3jobSystemInternalFenceAcquire();
+		*job_out = deque->job[t & deque->mask];
+		return (a3jobSystemInternalCompareExchange(&deque->top, t + 1, t) == t);
+	}
+	return a3false;
+}
+
+// internal: run one job from own deque, or stolen from another worker
+inline a3boolean a3jobSystemInternalRunOne(a3_JobWorker *worker)
+{
+	a3_JobSystem *const jobSystem = worker->jobSystem;
+	const a3ui32 workerCount = jobSystem->workerCount;
+	a3_Job job;
+	a3ui32 i, victim;
+
+	if (!a3jobSystemInternalPop(worker->deque, &job))
+	{
+		// start at random victim (xorshift), then try each once
+		worker->seed ^= worker->seed << 13;
+		worker->seed ^= worker->seed >> 17;
+		worker->seed ^= worker->seed << 5;
+		for (i = 0, victim = worker->seed % workerCount; i < workerCount; ++i, victim = (victim + 1 < workerCount ? victim + 1 : 0))
+			if (victim != worker->index && a3jobSystemInternalSteal(jobSystem->worker[victim].deque, &job))
+				break;
+		if (i == workerCount)
+			return a3false;
+		++worker->stolen;
+	}
+
+	job.func(job.args);
+	if (job.counter)
+		a3jobSystemInternalAdd(&job.counter->count, -1);
+	a3jobSystemInternalAdd(&jobSystem->queued->count, -1);
+	++worker->executed;
+	return a3true;
+}
+
+// internal: launched worker thread; runs jobs until the system stops
+a3ret a3jobSystemInternalWorkerMain(void *args)
+{
+	a3_JobWorker *const worker = (a3_JobWorker *)args;
+	a3ui32 idle = 0;
+
+	a3jobSystemInternalCurrent = worker;
+	while (worker->jobSystem->running)
+	{
+		if (a3jobSystemInternalRunOne(worker))
+			idle = 0;
+		else if (++idle < A3_JOBSYSTEM_SPINCOUNT)
+			a3jobSystemInternalPause();
+		else
+			a3jobSystemInternalYield();
+	}
+	a3jobSystemInternalCurrent = 0;
+	return (a3ret)worker->executed;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// create job system
+a3i32 a3jobSystemCreate(a3_JobSystem *jobSystem_out, const a3ui32 workerCount, const a3ui32 jobCapacity)
+{
+	if (jobSystem_out && !jobSystem_out->worker && workerCount && workerCount <= a3jobSystem_workerMax && jobCapacity)
+	{
+		const size_t workerSize = sizeof(a3_JobWorker) * workerCount;
+		a3ui32 capacity = 1, i;
+		a3_Job *job;
+		while (capacity < jobCapacity)
+			capacity <<= 1;
+
+		// workers first, then one job ring per worker
+		jobSystem_out->data = calloc(1, workerSize + sizeof(a3_Job) * capacity * workerCount);
+		if (!jobSystem_out->data)
+			return -1;
+		jobSystem_out->worker = (a3_JobWorker *)jobSystem_out->data;
+		jobSystem_out->workerCount = workerCount;
+		jobSystem_out->running = 1;
+		a3jobCounterReset(jobSystem_out->queued);
+		job = (a3_Job *)((a3byte *)jobSystem_out->data + workerSize);
+		for (i = 0; i < workerCount; ++i)
+		{
+			jobSystem_out->worker[i].jobSystem = jobSystem_out;
+			jobSystem_out->worker[i].index = i;
+			jobSystem_out->worker[i].seed = 2463534242u + i * 2654435769u;
+			jobSystem_out->worker[i].deque->job = job + i * capacity;
+			jobSystem_out->worker[i].deque->mask = capacity - 1;
+		}
+
+		// calling thread is worker 0; launch the rest
+		jobSystem_out->outer = a3jobSystemInternalCurrent;
+		a3jobSystemInternalCurrent = jobSystem_out->worker;
+		for (i = 1; i < workerCount; ++i)
+			if (a3threadLaunch(jobSystem_out->worker[i].thread, a3jobSystemInternalWorkerMain, jobSystem_out->worker + i, 0) <= 0)
+			{
+				a3jobSystemRelease(jobSystem_out);
+				return -1;
+			}
+		return workerCount;
+	}
+	return -1;
+}
+
+// stop workers and release
+a3i32 a3jobSystemRelease(a3_JobSystem *jobSystem)
+{
+	if (jobSystem && jobSystem->worker)
+	{
+		a3ui32 i;
+
+		// finish every queued job, helping if a worker, so none are lost 
+		//	in a deque whose owner stops first; then stop and join
+		a3jobSystemWait(jobSystem, jobSystem->queued);
+		jobSystem->running = 0;
+		for (i = 1; i < jobSystem->workerCount; ++i)
+			if (jobSystem->worker[i].thread->threadFunc)
+				a3threadWait(jobSystem->worker[i].thread);
+
+		if (a3jobSystemInternalCurrent && a3jobSystemInternalCurrent->jobSystem == jobSystem)
+			a3jobSystemInternalCurrent = jobSystem->outer;
+		free(jobSystem->data);
+		memset(jobSystem, 0, sizeof(a3_JobSystem));
+		return 1;
+	}
+	return -1;
+}
+
+// submit job
+a3i32 a3jobSystemSubmit(a3_JobSystem *jobSystem, const a3_JobFunc func, void *args, a3_JobCounter *counter_opt)
+{
+	if (jobSystem && jobSystem->worker && func)
+	{
+		a3_JobWorker *const worker = a3jobSystemInternalCurrent;
+		const a3_Job job = { func, args, counter_opt };
+		if (counter_opt)
+			a3jobSystemInternalAdd(&counter_opt->count, +1);
+		if (worker && worker->jobSystem == jobSystem)
+		{
+			// count before pushing, so a thief cannot complete it first
+			a3jobSystemInternalAdd(&jobSystem->queued->count, +1);
+			if (a3jobSystemInternalPush(worker->deque, &job))
+				return 1;
+			a3jobSystemInternalAdd(&jobSystem->queued->count, -1);
+		}
+
+		// not a worker or deque full: run now
+		func(args);
+		if (counter_opt)
+			a3jobSystemInternalAdd(&counter_opt->count, -1);
+		return 0;
+	}
+	return -1;
+}
+
+// run jobs until counter reaches zero
+a3i32 a3jobSystemWait(a3_JobSystem *jobSystem, a3_JobCounter *counter)
+{
+	if (jobSystem && jobSystem->worker && counter)
+	{
+		a3_JobWorker *const worker = a3jobSystemInternalCurrent;
+		const a3boolean member = (worker && worker->jobSystem == jobSystem);
+		a3ui32 idle = 0;
+		a3i32 ret = 0;
+		while (counter->count > 0)
+		{
+			if (member && a3jobSystemInternalRunOne(worker))
+			{
+				++ret;
+				idle = 0;
+			}
+			else if (++idle < A3_JOBSYSTEM_SPINCOUNT)
+				a3jobSystemInternalPause();
+			else
+				a3jobSystemInternalYield();
+		}
+		a3jobSystemInternalFenceAcquire();
+		return ret;
+	}
+	return -1;
+}
+
+// get index of calling worker
+a3i32 a3jobSystemGetWorkerIndex(const a3_JobSystem *jobSystem)
+{
+	const a3_JobWorker *const worker = a3jobSystemInternalCurrent;
+	if (jobSystem && worker && worker->jobSystem == jobSystem)
+		return worker->index;
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
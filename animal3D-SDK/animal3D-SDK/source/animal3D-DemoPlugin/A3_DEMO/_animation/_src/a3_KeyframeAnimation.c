@@ -32,6 +32,9 @@
 #define A3_CLIP_DEFAULTNAME		("unnamed clip")
 #define A3_CLIP_SEARCHNAME		((clipName && *clipName) ? clipName : A3_CLIP_DEFAULTNAME)
 
+// maximum number of tokens read from one line of clip file
+#define A3_CLIP_TOKENMAX		16
+
 
 //-----------------------------------------------------------------------------
 
@@ -40,16 +43,47 @@ a3i32 a3keyframePoolCreate(a3_KeyframePool* keyframePool_out, const a3ui32 count
 {
 	// initialize array of keyframes
 	keyframePool_out->keyframe = malloc(count * sizeof(a3_Keyframe));
+	for (a3ui32 i = 0; i < count; i++)
+	{
+		keyframePool_out->keyframe[i].pose = 0;
+	}
 
 	keyframePool_out->count = count;
+	keyframePool_out->pose = 0;
+	keyframePool_out->poseCount = 0;
 	return -1;
 }
 
 // release keyframe pool
 a3i32 a3keyframePoolRelease(a3_KeyframePool* keyframePool)
 {
-	// deallocate array of keyframes
+	// deallocate array of keyframes and their poses
 	free(keyframePool->keyframe);
+	free(keyframePool->pose);
+	keyframePool->pose = 0;
+	keyframePool->poseCount = 0;
+	return -1;
+}
+
+// allocate channel poses for every keyframe in pool
+a3i32 a3keyframePoolCreatePoses(a3_KeyframePool* keyframePool, const a3ui32 posesPerKeyframe)
+{
+	if (keyframePool && keyframePool->keyframe && keyframePool->count && !keyframePool->pose && posesPerKeyframe)
+	{
+		const a3ui32 total = keyframePool->count * posesPerKeyframe;
+		a3ui32 i;
+
+		keyframePool->pose = (a3_SpatialPose*)malloc(total * sizeof(a3_SpatialPose));
+		if (!keyframePool->pose)
+			return -1;
+		a3spatialPoseResetArray(keyframePool->pose, total);
+		keyframePool->poseCount = posesPerKeyframe;
+
+		// each keyframe points at its own block
+		for (i = 0; i < keyframePool->count; i++)
+			keyframePool->keyframe[i].pose = keyframePool->pose + i * posesPerKeyframe;
+		return total;
+	}
 	return -1;
 }
 
@@ -58,77 +92,522 @@ a3i32 a3keyframeInit(a3_Keyframe* keyframe_out, const a3real duration, const a3u
 {
 	// setting duration and its inverse
 	keyframe_out->duration = duration;
-	keyframe_out->durationInv = 1.0f / duration;
+	keyframe_out->durationInv = a3recipsafe(duration);
 
 	// setting keyframe data
 	keyframe_out->data = value_x;
+	keyframe_out->sample.time = a3real_zero;
+	keyframe_out->sample.value = (a3real)value_x;
+
+	// clips calculate the interval shape from the mode and handles
+	keyframe_out->interpolation = a3keyframeInterpolation_linear;
+	keyframe_out->handle[0] = keyframe_out->handle[1] = a3real_zero;
 
 	return -1;
 }
 
-//create clip pool from file
-a3i32 a3clipPoolCreateFromFile(a3_ClipPool* clipPool_out, const char* filePath)
+// set interpolation mode and handles of keyframe
+a3i32 a3keyframeSetInterpolation(a3_Keyframe* keyframe_out, const a3_KeyframeInterpolation interpolation, const a3real handleIn, const a3real handleOut)
 {
-	// open specified file
-	a3i32 maxChars = 256;
-	a3ui64 fileSize = 0;
-	char* buffer;
+	if (keyframe_out && interpolation >= a3keyframeInterpolation_step && interpolation <= a3keyframeInterpolation_bezier)
+	{
+		keyframe_out->interpolation = interpolation;
+		keyframe_out->handle[0] = handleIn;
+		keyframe_out->handle[1] = handleOut;
+		return interpolation;
+	}
+	return -1;
+}
 
-	FILE* file = fopen(filePath, "r");
-	if (file == NULL)
+// evaluate channel poses of interval
+a3i32 a3keyframeEvaluatePose(a3_SpatialPose* pose_out, a3_Keyframe const* keyframe, a3_Keyframe const* keyframeNext, const a3ui32 poseCount, const a3real param)
+{
+	if (pose_out && keyframe && keyframe->pose && keyframeNext && keyframeNext->pose)
 	{
-		printf("Error opening file: ");
-		printf(filePath);
-		return -1;
+		// spline modes have no neighbors here; they fall back to linear
+		if (keyframe->interpolation == a3keyframeInterpolation_step)
+			return a3spatialPoseLerpArray(pose_out, keyframe->pose, keyframe->pose, a3real_zero, poseCount);
+		return a3spatialPoseLerpArray(pose_out, keyframe->pose, keyframeNext->pose, param, poseCount);
 	}
+	return -1;
+}
 
-	// get size of file
-	else
+// internal: cubic coefficients of interval from k0 to k1 given neighbors in 
+//	clip order; same expansions as a3CatmullRom and a3HermiteTangent so that 
+//	evaluation reduces to one Horner step
+inline void a3keyframeInternalCoefficients(a3real* c, a3_Keyframe const* k0, a3_Keyframe const* kPrev, a3_Keyframe const* k1, a3_Keyframe const* kNext)
+{
+	const a3real n0 = k0->sample.value, n1 = k1->sample.value;
+	a3real nPrev, nNext, t0, t1;
+
+	// interval with no successor holds its value
+	c[0] = n0;
+	switch (k1 != k0 ? k0->interpolation : a3keyframeInterpolation_step)
 	{
-		fseek(file, 0L, SEEK_END);
-		fileSize = ftell(file);
-		fseek(file, 0L, SEEK_SET);
+	case a3keyframeInterpolation_step:
+		c[1] = c[2] = c[3] = a3real_zero;
+		break;
+	case a3keyframeInterpolation_catmullRom:
+		nPrev = kPrev->sample.value;
+		nNext = kNext->sample.value;
+		c[1] = a3real_half * (n1 - nPrev);
+		c[2] = a3real_half * (nPrev + nPrev - n0 * a3real_five + n1 * a3real_four - nNext);
+		c[3] = a3real_half * ((n0 - n1) * a3real_three - nPrev + nNext);
+		break;
+	case a3keyframeInterpolation_hermite:
+	case a3keyframeInterpolation_bezier:
+		// Bezier handles become tangents: 3 * (control - point)
+		t0 = k0->handle[1];
+		t1 = k1->handle[0];
+		if (k0->interpolation == a3keyframeInterpolation_bezier)
+		{
+			t0 = (t0 - n0) * a3real_three;
+			t1 = (n1 - t1) * a3real_three;
+		}
+		c[1] = t0;
+		c[2] = (n1 - n0) * a3real_three - t0 - t0 - t1;
+		c[3] = t0 + t1 - (n1 - n0) * a3real_two;
+		break;
+	default:
+		c[1] = n1 - n0;
+		c[2] = c[3] = a3real_zero;
+		break;
 	}
+}
 
+// internal: next whitespace-delimited token in line; null at end of line
+inline a3byte* a3clipPoolInternalToken(a3byte** cursor)
+{
+	a3byte* token = *cursor;
+	while (*token == ' ' || *token == '\t' || *token == '\r')
+		++token;
+	if (!*token)
+		return 0;
+	*cursor = token;
+	while (**cursor && **cursor != ' ' && **cursor != '\t' && **cursor != '\r')
+		++(*cursor);
+	if (**cursor)
+		*((*cursor)++) = 0;
+	return token;
+}
 
+// internal: next line in buffer with comment stripped; null at end of buffer
+inline a3byte* a3clipPoolInternalLine(a3byte** cursor)
+{
+	a3byte* line = *cursor, * comment;
+	if (!*line)
+		return 0;
+	while (**cursor && **cursor != '\n')
+		++(*cursor);
+	if (**cursor)
+		*((*cursor)++) = 0;
+	if ((comment = strchr(line, '#')) != 0)
+		*comment = 0;
+	return line;
+}
 
-	// read file into string
-	buffer = malloc(fileSize + 1);
-	if (!buffer) fclose(file), printf("failed to allocate memory"), stderr, exit(1);
-	fread(buffer, 1, fileSize, file);
+// internal: true if token is a transition verb rather than a clip name
+inline a3boolean a3clipPoolInternalIsVerb(const a3byte* token)
+{
+	return (*token == '|' || *token == '>' || *token == '<');
+}
+
+// internal: convert transition verb to flags; -1 if malformed
+inline a3i32 a3clipPoolInternalParseVerb(const a3byte* token)
+{
+	a3i32 flag = 0;
+	if (*token == '>' || *token == '<')
+	{
+		flag |= (*token == '>') ? a3clipTransition_forward : a3clipTransition_reverse;
+		if (token[1] == token[0])
+		{
+			flag |= a3clipTransition_skip;
+			++token;
+		}
+		++token;
+		if (*token == '|')
+		{
+			flag |= a3clipTransition_pause;
+			++token;
+		}
+	}
+	else if (*token == '|')
+	{
+		flag |= a3clipTransition_pause;
+		++token;
+	}
+	return (*token ? -1 : flag);
+}
+
+// internal: read transition verb and optional target name from tokens
+inline a3i32 a3clipPoolInternalParseTransition(a3_ClipTransition* transition_out, const a3_ClipPool* clipPool, const a3index clipIndex, a3byte* const* token, const a3ui32 tokenCount, a3ui32* tokenIndex)
+{
+	a3i32 flag = *tokenIndex < tokenCount ? a3clipPoolInternalParseVerb(token[(*tokenIndex)++]) : -1;
+	a3i32 targetIndex = clipIndex;
+	if (flag >= 0)
+	{
+		// optional target name follows verb
+		if (*tokenIndex < tokenCount && !a3clipPoolInternalIsVerb(token[*tokenIndex]))
+			targetIndex = a3clipGetIndexInPool(clipPool, token[(*tokenIndex)++]);
+		if (targetIndex >= 0)
+		{
+			transition_out->flag = (a3_ClipTransitionFlag)flag;
+			transition_out->clipPool = clipPool;
+			transition_out->clipIndex = targetIndex;
+			return targetIndex;
+		}
+	}
+	return -1;
+}
+
+// internal: compute time and direction of transition from its flags once 
+//	all clip and keyframe durations are known
+inline void a3clipPoolInternalResolveTransition(a3_ClipTransition* transition, const a3boolean atForwardTerminus)
+{
+	a3_Clip const* clip = transition->clipPool->clip + transition->clipIndex;
+	a3_ClipFrame const* frame = clip->frame;
+	const a3boolean pause = (transition->flag & a3clipTransition_pause) != 0;
+	const a3boolean skip = (transition->flag & a3clipTransition_skip) != 0;
+
+	if (transition->flag & a3clipTransition_forward)
+	{
+		transition->playbackDirection = pause ? a3real_zero : +a3real_one;
+		transition->clipTime = skip ? frame[0].duration : a3real_zero;
+	}
+	else if (transition->flag & a3clipTransition_reverse)
+	{
+		transition->playbackDirection = pause ? a3real_zero : -a3real_one;
+		transition->clipTime = skip ? clip->duration - frame[clip->keyframeCount - 1].duration : a3clip_timeEnd;
+	}
+	else
+	{
+		// plain pause: stay at whichever terminus triggered the transition
+		transition->playbackDirection = a3real_zero;
+		transition->clipTime = atForwardTerminus ? a3clip_timeEnd : a3real_zero;
+	}
+}
+
+// create clip pool from file
+a3i32 a3clipPoolCreateFromFile(a3_ClipPool* clipPool_out, const a3_KeyframePool* keyframePool, const a3byte* filePath)
+{
+	if (clipPool_out && !clipPool_out->clip && keyframePool && keyframePool->keyframe && keyframePool->count && filePath && *filePath)
+	{
+		a3byte* buffer, * cursor, * line, * token[A3_CLIP_TOKENMAX], * name;
+		a3i32 fileSize, result;
+		a3ui32 count, lineNumber, i, first, last, tokenCount, tokenIndex;
+		a3real duration;
+		a3_Clip* clip;
+
+		// read entire file into buffer
+		FILE* file = fopen(filePath, "rb");
+		if (!file)
+		{
+			printf("\n A3 Warning: Could not open clip file \'%s\'", filePath);
+			return -1;
+		}
+		fseek(file, 0L, SEEK_END);
+		fileSize = (a3i32)ftell(file);
+		fseek(file, 0L, SEEK_SET);
+		buffer = (a3byte*)malloc(fileSize * 2 + 2);
+		if (!buffer)
+		{
+			fclose(file);
+			return -1;
+		}
+		fileSize = (a3i32)fread(buffer, 1, fileSize, file);
+		buffer[fileSize] = 0;
+		fclose(file);
+
+		// second half of buffer keeps a pristine copy for the second pass
+		memcpy(buffer + fileSize + 1, buffer, fileSize + 1);
+
+		// first pass: count data lines
+		for (count = 0, cursor = buffer; (line = a3clipPoolInternalLine(&cursor)) != 0;)
+			if ((name = a3clipPoolInternalToken(&line)) != 0 && name[0] == '@' && !name[1])
+				++count;
+		if (!count || a3clipPoolCreate(clipPool_out, count) < 0)
+		{
+			printf("\n A3 Warning: No clips in file \'%s\'", filePath);
+			free(buffer);
+			return -1;
+		}
+
+		// second pass: names first so transitions may reference later clips
+		memcpy(buffer, buffer + fileSize + 1, fileSize + 1);
+		for (i = 0, cursor = buffer; (line = a3clipPoolInternalLine(&cursor)) != 0;)
+		{
+			if ((name = a3clipPoolInternalToken(&line)) != 0 && name[0] == '@' && !name[1])
+			{
+				clip = clipPool_out->clip + i;
+				clip->index = i++;
+				if ((name = a3clipPoolInternalToken(&line)) != 0)
+					strncpy(clip->name, name, a3keyframeAnimation_nameLenMax - 1);
+				a3nameIndexUpdate(clipPool_out->nameIndex, clip->index);
+			}
+		}
+
+		// third pass: clip attributes and transitions
+		memcpy(buffer, buffer + fileSize + 1, fileSize + 1);
+		for (i = 0, lineNumber = 1, result = count, cursor = buffer; (line = a3clipPoolInternalLine(&cursor)) != 0; ++lineNumber)
+		{
+			for (tokenCount = 0; tokenCount < A3_CLIP_TOKENMAX && (token[tokenCount] = a3clipPoolInternalToken(&line)) != 0; ++tokenCount);
+			if (tokenCount && token[0][0] == '@' && !token[0][1])
+			{
+				// data: @ name duration first last reverse forward
+				clip = clipPool_out->clip + i;
+				duration = tokenCount > 2 ? (a3real)atof(token[2]) : a3real_zero;
+				first = tokenCount > 3 ? (a3ui32)atoi(token[3]) : 0;
+				last = tokenCount > 4 ? (a3ui32)atoi(token[4]) : 0;
+				if (tokenCount < 5 || first >= keyframePool->count || last >= keyframePool->count)
+				{
+					printf("\n A3 Warning: Invalid clip on line %u of \'%s\'", lineNumber, filePath);
+					first = last = 0;
+					result = -1;
+				}
+				else if (strlen(token[1]) >= a3keyframeAnimation_nameLenMax)
+					printf("\n A3 Warning: Clip name truncated on line %u of \'%s\'", lineNumber, filePath);
+
+				// duration is distributed once clip frames exist
+				a3clipInit(clip, clip->name, keyframePool, first, last,
+					clipPool_out->transition + i * 2 + 1, clipPool_out->transition + i * 2);
+				clip->duration = duration;
+
+				// invalid transitions default to looping the clip
+				tokenIndex = 5;
+				if (a3clipPoolInternalParseTransition(clipPool_out->transition + i * 2, clipPool_out, i, token, tokenCount, &tokenIndex) < 0)
+				{
+					printf("\n A3 Warning: Invalid reverse transition on line %u of \'%s\'", lineNumber, filePath);
+					a3clipTransitionInit(clipPool_out->transition + i * 2, clipPool_out, i, a3real_zero, a3real_zero);
+					clipPool_out->transition[i * 2].flag = a3clipTransition_reverse;
+					result = -1;
+				}
+				if (a3clipPoolInternalParseTransition(clipPool_out->transition + i * 2 + 1, clipPool_out, i, token, tokenCount, &tokenIndex) < 0)
+				{
+					printf("\n A3 Warning: Invalid forward transition on line %u of \'%s\'", lineNumber, filePath);
+					a3clipTransitionInit(clipPool_out->transition + i * 2 + 1, clipPool_out, i, a3real_zero, a3real_zero);
+					clipPool_out->transition[i * 2 + 1].flag = a3clipTransition_forward;
+					result = -1;
+				}
+				++i;
+			}
+		}
+
+		// keyframe ranges are final; time and shape each clip's intervals
+		if (a3clipPoolCreateFrames(clipPool_out) < 0)
+		{
+			a3clipPoolRelease(clipPool_out);
+			free(buffer);
+			return -1;
+		}
+		for (i = 0; i < count; ++i)
+			a3clipDistributeDuration(clipPool_out->clip + i, clipPool_out->clip[i].duration);
+
+		// durations are final; resolve transition times
+		for (i = 0; i < count; ++i)
+		{
+			a3clipPoolInternalResolveTransition(clipPool_out->transition + i * 2, a3false);
+			a3clipPoolInternalResolveTransition(clipPool_out->transition + i * 2 + 1, a3true);
+		}
+
+		free(buffer);
+
+		// a malformed file still produces a usable pool, but report failure
+		return (result >= 0 ? (a3i32)count : -1);
+	}
+	return -1;
+}
 
-	// null terminate buffer for safety
-	buffer[fileSize] = '\0';
+// header for compiled clip pool
+typedef struct a3_ClipPoolBinaryHeader
+{
+	a3ui32 tag, clipSize, transitionSize, count;
+} a3_ClipPoolBinaryHeader;
 
-	// close file
-	fclose(file);
+// tag identifying compiled clip pool
+#define A3_CLIPPOOL_BINARYTAG	(0x50434133)	// 'A3CP'
 
-	// break up text using delimiters
-	char lineDelim[] = "\n";
-	char* ptr = strtok(buffer, lineDelim);
-	while (ptr != NULL)
+// save compiled clip pool to binary file
+a3i32 a3clipPoolSaveBinary(const a3_ClipPool* clipPool, const a3_FileStream* fileStream)
+{
+	FILE* fp;
+	a3ui32 ret = 0;
+	if (clipPool && clipPool->clip && fileStream)
 	{
-		printf("'%s'", ptr);
-		ptr = strtok(NULL, lineDelim);
+		fp = fileStream->stream;
+		if (fp)
+		{
+			const a3_ClipPoolBinaryHeader header = { A3_CLIPPOOL_BINARYTAG, sizeof(a3_Clip), sizeof(a3_ClipTransition), clipPool->count };
+			const size_t dataSize = (sizeof(a3_Clip) + sizeof(a3_ClipTransition) * 2) * clipPool->count;
+			a3_Clip* clip;
+			a3_ClipTransition* transition;
+			a3ui32 i;
+
+			// copy so that pointers can be cleared without touching the pool; 
+			//	they are rebuilt on load since transitions are owned by the pool
+			void* data = malloc(dataSize);
+			if (!data)
+				return -1;
+			memcpy(data, clipPool->clip, dataSize);
+			clip = (a3_Clip*)data;
+			transition = (a3_ClipTransition*)(clip + clipPool->count);
+			for (i = 0; i < clipPool->count; ++i)
+			{
+				clip[i].framePool = 0;
+				clip[i].frame = 0;
+				clip[i].reverseTransition = clip[i].forwardTransition = 0;
+				transition[i * 2].clipPool = transition[i * 2 + 1].clipPool = 0;
+			}
+
+			ret += (a3ui32)fwrite(&header, 1, sizeof(header), fp);
+			ret += (a3ui32)fwrite(data, 1, dataSize, fp);
+			free(data);
+		}
+		return ret;
 	}
+	return -1;
+}
 
+// load compiled clip pool from binary file
+a3i32 a3clipPoolLoadBinary(a3_ClipPool* clipPool_out, const a3_KeyframePool* keyframePool, const a3_FileStream* fileStream)
+{
+	FILE* fp;
+	a3ui32 ret = 0;
+	if (clipPool_out && !clipPool_out->clip && keyframePool && keyframePool->keyframe && fileStream)
+	{
+		fp = fileStream->stream;
+		if (fp)
+		{
+			a3_ClipPoolBinaryHeader header;
+			size_t dataSize;
+			a3_Clip* clip;
+			a3ui32 i;
+
+			// reject files written with a different layout
+			ret += (a3ui32)fread(&header, 1, sizeof(header), fp);
+			if (ret != sizeof(header) || header.tag != A3_CLIPPOOL_BINARYTAG || !header.count ||
+				header.clipSize != sizeof(a3_Clip) || header.transitionSize != sizeof(a3_ClipTransition))
+				return 0;
+			if (a3clipPoolCreate(clipPool_out, header.count) < 0)
+				return 0;
+
+			// single read for clips and transitions, then validate and fix up 
+			//	pointers; truncated files and out-of-range indices are rejected
+			dataSize = (sizeof(a3_Clip) + sizeof(a3_ClipTransition) * 2) * header.count;
+			if (fread(clipPool_out->clip, 1, dataSize, fp) != dataSize)
+			{
+				a3clipPoolRelease(clipPool_out);
+				return 0;
+			}
+			ret += (a3ui32)dataSize;
+			for (i = 0, clip = clipPool_out->clip; i < header.count; ++i, ++clip)
+			{
+				if (clip->first_keyframe >= keyframePool->count || clip->last_keyframe >= keyframePool->count ||
+					clip->keyframeCount != (clip->last_keyframe >= clip->first_keyframe
+						? clip->last_keyframe - clip->first_keyframe
+						: clip->first_keyframe - clip->last_keyframe) + 1 ||
+					clipPool_out->transition[i * 2].clipIndex >= header.count ||
+					clipPool_out->transition[i * 2 + 1].clipIndex >= header.count)
+				{
+					a3clipPoolRelease(clipPool_out);
+					return 0;
+				}
+				clip->framePool = keyframePool;
+				clip->reverseTransition = clipPool_out->transition + i * 2;
+				clip->forwardTransition = clipPool_out->transition + i * 2 + 1;
+				clipPool_out->transition[i * 2].clipPool = clipPool_out->transition[i * 2 + 1].clipPool = clipPool_out;
+				a3nameIndexUpdate(clipPool_out->nameIndex, i);
+			}
+
+			// clip frames are not stored; rebuild and re-distribute durations
+			if (a3clipPoolCreateFrames(clipPool_out) < 0)
+			{
+				a3clipPoolRelease(clipPool_out);
+				return 0;
+			}
+			for (i = 0, clip = clipPool_out->clip; i < header.count; ++i, ++clip)
+				a3clipDistributeDuration(clip, clip->duration);
+		}
+		return ret;
+	}
 	return -1;
 }
 
 // allocate clip pool
 a3i32 a3clipPoolCreate(a3_ClipPool* clipPool_out, const a3ui32 count)
 {
-	// initialize array of clips
-	clipPool_out->clip = malloc(count * sizeof(a3_Clip));
-	clipPool_out->count = count;
-	return 1;
+	if (clipPool_out && !clipPool_out->clip && count)
+	{
+		// clips and their transitions share one block
+		const size_t dataSize = (sizeof(a3_Clip) + sizeof(a3_ClipTransition) * 2) * count;
+		clipPool_out->clip = (a3_Clip*)malloc(dataSize);
+		if (!clipPool_out->clip)
+			return -1;
+		memset(clipPool_out->clip, 0, dataSize);
+		clipPool_out->transition = (a3_ClipTransition*)(clipPool_out->clip + count);
+		clipPool_out->frame = 0;
+		clipPool_out->count = count;
+		a3nameIndexCreate(clipPool_out->nameIndex, clipPool_out->clip->name, sizeof(a3_Clip), count);
+		return count;
+	}
+	return -1;
+}
+
+// allocate clip frames for every clip in pool
+a3i32 a3clipPoolCreateFrames(a3_ClipPool* clipPool)
+{
+	if (clipPool && clipPool->clip)
+	{
+		a3_ClipFrame* frame;
+		a3_Clip* clip;
+		a3_Keyframe const* keyframe;
+		a3ui32 total, i, j;
+		a3i32 step;
+		for (i = total = 0; i < clipPool->count; ++i)
+			total += clipPool->clip[i].keyframeCount;
+		if (!total)
+			return -1;
+
+		free(clipPool->frame);
+		clipPool->frame = frame = (a3_ClipFrame*)malloc(total * sizeof(a3_ClipFrame));
+		if (!frame)
+			return -1;
+		memset(frame, 0, total * sizeof(a3_ClipFrame));
+
+		// each clip points at its own block, timed like its keyframes
+		for (i = 0, clip = clipPool->clip; i < clipPool->count; ++i, frame += (clip++)->keyframeCount)
+		{
+			clip->frame = frame;
+			if (clip->framePool && clip->keyframeCount)
+			{
+				step = clip->last_keyframe >= clip->first_keyframe ? +1 : -1;
+				for (j = 0, keyframe = clip->framePool->keyframe + clip->first_keyframe; j < clip->keyframeCount; ++j, keyframe += step)
+				{
+					frame[j].duration = keyframe->duration;
+					frame[j].durationInv = keyframe->durationInv;
+				}
+				a3clipCalculateCoefficients(clip);
+			}
+		}
+		return total;
+	}
+	return -1;
 }
 
 // release clip pool
 a3i32 a3clipPoolRelease(a3_ClipPool* clipPool)
 {
-	// deallocate array of clips
-	free(clipPool->clip);
+	if (clipPool && clipPool->clip)
+	{
+		// deallocate array of clips and transitions, and clip frames
+		a3nameIndexRelease(clipPool->nameIndex);
+		free(clipPool->clip);
+		free(clipPool->frame);
+		clipPool->clip = 0;
+		clipPool->transition = 0;
+		clipPool->frame = 0;
+		clipPool->count = 0;
+		return 1;
+	}
 	return -1;
 }
 
@@ -144,7 +623,9 @@ const a3_ClipTransition* forwardClipTransition, const a3_ClipTransition* reverse
 
 	// set referenced keyframe pool
 	clip_out->framePool = keyframePool;
-	clip_out->keyframeCount = finalKeyframeIndex - firstKeyframeIndex;
+	clip_out->keyframeCount = (finalKeyframeIndex >= firstKeyframeIndex
+		? finalKeyframeIndex - firstKeyframeIndex
+		: firstKeyframeIndex - finalKeyframeIndex) + 1;
 
 	// set first and last keyframe indices
 	clip_out->first_keyframe = firstKeyframeIndex;
@@ -157,13 +638,46 @@ const a3_ClipTransition* forwardClipTransition, const a3_ClipTransition* reverse
 	return -1;
 }
 
+// calculate clip frames' interval coefficients in clip order
+a3i32 a3clipCalculateCoefficients(a3_Clip* clip)
+{
+	if (clip && clip->framePool && clip->framePool->keyframe && clip->frame && clip->keyframeCount)
+	{
+		// frames run from first to last, either direction; neighbors past 
+		//	either end repeat the terminal frame, and the final interval holds
+		a3_Keyframe const* const keyframe = clip->framePool->keyframe;
+		const a3i32 step = clip->last_keyframe >= clip->first_keyframe ? +1 : -1;
+		const a3ui32 last = clip->keyframeCount - 1;
+		a3index index = clip->first_keyframe;
+		a3ui32 i;
+
+		for (i = 0; i <= last; i++, index += step)
+		{
+			a3keyframeInternalCoefficients(clip->frame[i].coeff, keyframe + index,
+				keyframe + (i > 0 ? index - step : index),
+				keyframe + (i < last ? index + step : index),
+				keyframe + (i + 1 < last ? index + step * 2 : i < last ? index + step : index));
+		}
+		return clip->keyframeCount;
+	}
+	return -1;
+}
+
 // get clip index from pool
 a3i32 a3clipGetIndexInPool(const a3_ClipPool* clipPool, const a3byte clipName[a3keyframeAnimation_nameLenMax])
 {
+	a3i32 index = a3nameIndexFind(clipPool->nameIndex, clipName);
+	if (index >= 0)
+		return index;
+
+	// miss: name may have been changed since it was indexed
 	for (a3ui32 i = 0; i < clipPool->count; i++)
 	{
-		if (clipPool->clip[i].name == clipName)
+		if (!strncmp(clipPool->clip[i].name, clipName, a3keyframeAnimation_nameLenMax))
+		{
+			a3nameIndexUpdate(clipPool->nameIndex, i);
 			return i;
+		}
 	}
 	return -1;
 }
@@ -179,4 +693,103 @@ a3i32 a3clipTransitionInit(a3_ClipTransition* clipTransition_out, a3_ClipPool* p
 }
 
 
+//-----------------------------------------------------------------------------
+
+// bake clip at fixed rate
+a3i32 a3clipBakeCreate(a3_ClipBake* clipBake_out, const a3_Clip* clip, const a3real rate)
+{
+	if (clipBake_out && !clipBake_out->value && clip && clip->framePool && clip->frame && clip->keyframeCount && rate > a3real_zero)
+	{
+		a3_Keyframe const* const keyframe = clip->framePool->keyframe;
+		const a3i32 step = clip->last_keyframe >= clip->first_keyframe ? +1 : -1;
+		const a3ui32 poseCount = clip->framePool->pose ? clip->framePool->poseCount : 0;
+		const a3real duration = clip->duration;
+		a3real frameEstimate = duration * rate, t, start, u;
+		a3ui32 frameCount, i, ordinal;
+		a3index index;
+		size_t poseSize, valueSize;
+
+		// whole number of intervals spans the clip; zero duration keeps one
+		frameCount = (a3ui32)frameEstimate;
+		frameCount += ((a3real)frameCount < frameEstimate);
+		frameCount += !frameCount;
+
+		// poses first to keep them aligned
+		poseSize = sizeof(a3_SpatialPose) * poseCount * (frameCount + 1);
+		valueSize = sizeof(a3real) * (frameCount + 1);
+		clipBake_out->pose = (a3_SpatialPose*)malloc(poseSize + valueSize);
+		if (!clipBake_out->pose)
+			return -1;
+		clipBake_out->value = (a3real*)((a3byte*)clipBake_out->pose + poseSize);
+		if (!poseCount)
+			clipBake_out->pose = 0;
+
+		clipBake_out->duration = duration;
+		clipBake_out->rate = duration > a3real_zero ? (a3real)frameCount / duration : rate;
+		clipBake_out->rateInv = a3recip(clipBake_out->rate);
+		clipBake_out->frameCount = frameCount;
+		clipBake_out->poseCount = poseCount;
+		clipBake_out->clip = clip;
+
+		// frame times only increase, so the keyframe walk is one pass
+		for (i = ordinal = 0, index = clip->first_keyframe, start = a3real_zero; i <= frameCount; ++i)
+		{
+			t = a3minimum((a3real)i * clipBake_out->rateInv, duration);
+			while (t >= start + clip->frame[ordinal].duration && ordinal + 1 < clip->keyframeCount)
+			{
+				start += clip->frame[ordinal].duration;
+				index += step;
+				++ordinal;
+			}
+			u = a3clamp(a3real_zero, a3real_one, (t - start) * clip->frame[ordinal].durationInv);
+			clipBake_out->value[i] = a3clipFrameEvaluate(clip->frame + ordinal, u);
+			if (poseCount)
+				a3keyframeEvaluatePose(clipBake_out->pose + i * poseCount, keyframe + index,
+					keyframe + (ordinal + 1 < clip->keyframeCount ? index + step : index), poseCount, u);
+		}
+		return (frameCount + 1);
+	}
+	return -1;
+}
+
+// release baked clip
+a3i32 a3clipBakeRelease(a3_ClipBake* clipBake)
+{
+	if (clipBake && clipBake->value)
+	{
+		// single block starts at poses, or at values if there are none
+		free(clipBake->pose ? (void*)clipBake->pose : (void*)clipBake->value);
+		memset(clipBake, 0, sizeof(a3_ClipBake));
+		return 1;
+	}
+	return -1;
+}
+
+// sample channel poses at clip time
+a3i32 a3clipBakeSamplePose(a3_SpatialPose* pose_out, a3_ClipBake const* clipBake, const a3real clipTime)
+{
+	if (pose_out && clipBake && clipBake->pose)
+	{
+		a3real u;
+		const a3ui32 index = a3clipBakeInternalFrame(clipBake, clipTime, &u);
+		a3_SpatialPose const* pose = clipBake->pose + index * clipBake->poseCount;
+		return a3spatialPoseLerpArray(pose_out, pose, pose + clipBake->poseCount, u, clipBake->poseCount);
+	}
+	return -1;
+}
+
+// sample scalar values at array of clip times
+a3i32 a3clipBakeSampleArray(a3real* value_out, a3_ClipBake const* clipBake, const a3real* clipTime, const a3ui32 count)
+{
+	if (value_out && clipBake && clipBake->value && clipTime)
+	{
+		a3ui32 i;
+		for (i = 0; i < count; ++i)
+			value_out[i] = a3clipBakeSample(clipBake, clipTime[i]);
+		return count;
+	}
+	return -1;
+}
+
+
 //-----------------------------------------------------------------------------
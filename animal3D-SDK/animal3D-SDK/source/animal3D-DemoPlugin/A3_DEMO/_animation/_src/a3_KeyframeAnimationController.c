@@ -24,46 +24,430 @@
 
 #include "../a3_KeyframeAnimationController.h"
 
+#include "animal3D/a3utility/a3_Timer.h"
+
+#include <stdlib.h>
 #include <string.h>
 
 
+// lane width for controller set arrays (8 reals fills one AVX register)
+#define A3_CLIPCTRLSET_LANES	8
+
+// no-alias hint for batched loops
+#define A3_RESTRICT				__restrict
+
+
 //-----------------------------------------------------------------------------
 
 // initialize clip controller
 a3i32 a3clipControllerInit(a3_ClipController* clipCtrl_out, const a3byte ctrlName[a3keyframeAnimation_nameLenMax], const a3_ClipPool* clipPool, const a3ui32 clipIndex_pool, a3f32 clipTime, a3f32 playbackDirection)
 {
-	for (a3ui32 i = 0; i < a3keyframeAnimation_nameLenMax; i++)
+	if (clipCtrl_out && ctrlName && clipPool && clipPool->frame && clipIndex_pool < clipPool->count)
 	{
-		clipCtrl_out->name[i] = ctrlName[i];
+		a3_Clip const* clip = clipPool->clip + clipIndex_pool;
+		a3ui32 i;
+
+		// name may be shorter than the buffer; stop at its terminator
+		for (i = 0; i < a3keyframeAnimation_nameLenMax - 1 && ctrlName[i]; i++)
+		{
+			clipCtrl_out->name[i] = ctrlName[i];
+		}
+		for (; i < a3keyframeAnimation_nameLenMax; i++)
+		{
+			clipCtrl_out->name[i] = 0;
+		}
+		clipCtrl_out->clipIndex = clipIndex_pool;
+		clipCtrl_out->clipPool = clipPool;
+		clipCtrl_out->playbackDirection = playbackDirection;
+		clipCtrl_out->currentClip = clip;
+
+		// negative clip time requests the end of the clip
+		clipCtrl_out->clipTime = clipTime < 0 ? clip->duration : clipTime;
+
+		// force a full keyframe search from the start of the clip
+		clipCtrl_out->keyframeIndex0 = clip->first_keyframe;
+		clipCtrl_out->keyframeTime = clipCtrl_out->clipTime;
+		a3clipControllerInternalResolve(clipCtrl_out);
+		return 1;
 	}
-	clipCtrl_out->clipIndex = clipIndex_pool;
-	clipCtrl_out->clipPool = clipPool;
-	clipCtrl_out->playbackDirection = playbackDirection;
-	clipCtrl_out->currentClip = &clipPool->clip[clipIndex_pool];
+	return -1;
+}
 
-	// Forward/normal init
-	if (playbackDirection >= 0)
+//-----------------------------------------------------------------------------
+
+// internal: number of keyframes referenced by clip (first and last inclusive)
+inline a3ui32 a3clipControllerSetInternalFrameCount(a3_Clip const* clip)
+{
+	return (clip->last_keyframe >= clip->first_keyframe
+		? clip->last_keyframe - clip->first_keyframe
+		: clip->first_keyframe - clip->last_keyframe) + 1;
+}
+
+// internal: pool index of the keyframe at ordinal position in clip
+inline a3index a3clipControllerSetInternalFrameIndex(a3_Clip const* clip, const a3ui32 ordinal)
+{
+	return (clip->last_keyframe >= clip->first_keyframe
+		? clip->first_keyframe + ordinal
+		: clip->first_keyframe - ordinal);
+}
+
+// internal: refresh cached keyframe data for controller given ordinal in clip
+inline void a3clipControllerSetInternalSetFrame(a3_ClipControllerSet* ctrlSet, const a3ui32 i, a3_Clip const* clip, const a3ui32 ordinal, const a3ui32 frameCount)
+{
+	ctrlSet->keyframeIndex0[i] = a3clipControllerSetInternalFrameIndex(clip, ordinal);
+	ctrlSet->keyframeIndex1[i] = a3clipControllerSetInternalFrameIndex(clip, ordinal + 1 < frameCount ? ordinal + 1 : ordinal);
+	ctrlSet->keyframeDuration[i] = clip->frame[ordinal].duration;
+	ctrlSet->keyframeDurationInv[i] = clip->frame[ordinal].durationInv;
+}
+
+// internal: refresh cached clip data for controller
+inline a3_Clip const* a3clipControllerSetInternalSetClip(a3_ClipControllerSet* ctrlSet, const a3ui32 i, const a3index clipIndex)
+{
+	a3_Clip const* clip = ctrlSet->clipPool->clip + clipIndex;
+	ctrlSet->clipIndex[i] = clipIndex;
+	ctrlSet->clipDuration[i] = clip->duration;
+	ctrlSet->clipDurationInv[i] = clip->durationInv;
+	return clip;
+}
+
+// internal: apply terminus action; overflow is the non-negative amount of 
+//	time that passed beyond the terminus
+inline a3_Clip const* a3clipControllerSetInternalTransition(a3_ClipControllerSet* ctrlSet, const a3ui32 i, a3_Clip const* clip, a3_ClipTransition const* transition, const a3real overflow)
+{
+	a3real base;
+	if (transition)
 	{
-		clipCtrl_out->keyframeIndex0 = clipPool->clip[clipIndex_pool].first_keyframe;
-		clipCtrl_out->keyframePtr0 = &clipPool->clip[clipIndex_pool].framePool->keyframe[clipPool->clip[clipIndex_pool].first_keyframe];
-		clipCtrl_out->keyframeTime = 0;
-		clipCtrl_out->clipTime = clipTime;
+		// jump to target clip; negative time means its end
+		clip = a3clipControllerSetInternalSetClip(ctrlSet, i, transition->clipIndex);
+		ctrlSet->playbackDirection[i] = transition->playbackDirection;
+		base = transition->clipTime < a3real_zero ? clip->duration : transition->clipTime;
+		ctrlSet->clipTime[i] = base + overflow * transition->playbackDirection;
 	}
-	// Reverse init
 	else
 	{
-		clipCtrl_out->keyframeIndex0 = clipPool->clip[clipIndex_pool].last_keyframe;
-		clipCtrl_out->keyframePtr0 = &clipPool->clip[clipIndex_pool].framePool->keyframe[clipPool->clip[clipIndex_pool].last_keyframe];
-		clipCtrl_out->keyframeTime = clipCtrl_out->keyframePtr0->duration;
+		// no transition: loop current clip in current direction
+		ctrlSet->clipTime[i] = ctrlSet->playbackDirection[i] >= a3real_zero
+			? overflow : clip->duration - overflow;
+	}
+	return clip;
+}
+
+// internal: resolve clip and keyframe for a single controller that crossed 
+//	a boundary; this is the only path that touches the clip pool
+inline void a3clipControllerSetInternalResolve(a3_ClipControllerSet* ctrlSet, const a3ui32 i)
+{
+	a3_Clip const* clip = ctrlSet->clipPool->clip + ctrlSet->clipIndex[i];
+	a3_ClipFrame const* frame;
+	const a3index clipIndex = ctrlSet->clipIndex[i];
+	a3ui32 hops, ordinal, frameCount;
+	a3real t = ctrlSet->clipTime[i], kt;
 
-		// interpret clipTime 0 as requesting the "end" of the clip
-		if (clipTime == 0)
+	// clip terminus: follow transitions until time lands inside a clip; 
+	//	only forward playback leaves at exactly the end so that paused and 
+	//	reversing controllers may sit there
+	for (hops = 0; hops < a3clipController_hopsMax && ((ctrlSet->playbackDirection[i] > a3real_zero ? t >= clip->duration : t > clip->duration) || t < a3real_zero); ++hops)
+	{
+		if (t >= clip->duration)
+			clip = a3clipControllerSetInternalTransition(ctrlSet, i, clip, clip->forwardTransition, t - clip->duration);
+		else
+			clip = a3clipControllerSetInternalTransition(ctrlSet, i, clip, clip->reverseTransition, -t);
+		t = ctrlSet->clipTime[i];
+	}
+
+	// degenerate clips (e.g. zero duration) cannot absorb time; clamp
+	t = a3clamp(a3real_zero, clip->duration, t);
+	ctrlSet->clipTime[i] = t;
+	ctrlSet->clipParam[i] = t * clip->durationInv;
+
+	// keyframe: walk from current keyframe if still on the same clip, 
+	//	otherwise walk from the start of the new clip
+	frameCount = a3clipControllerSetInternalFrameCount(clip);
+	if (clipIndex == ctrlSet->clipIndex[i] && hops == 0)
+	{
+		ordinal = ctrlSet->keyframeIndex0[i] >= clip->first_keyframe
+			? ctrlSet->keyframeIndex0[i] - clip->first_keyframe
+			: clip->first_keyframe - ctrlSet->keyframeIndex0[i];
+		kt = ctrlSet->keyframeTime[i];
+	}
+	else
+	{
+		ordinal = 0;
+		kt = t;
+	}
+	frame = clip->frame + ordinal;
+	while (kt >= frame->duration && ordinal + 1 < frameCount)
+	{
+		kt -= frame->duration;
+		frame = clip->frame + (++ordinal);
+	}
+	while (kt < a3real_zero && ordinal > 0)
+	{
+		frame = clip->frame + (--ordinal);
+		kt += frame->duration;
+	}
+	kt = a3clamp(a3real_zero, frame->duration, kt);
+
+	a3clipControllerSetInternalSetFrame(ctrlSet, i, clip, ordinal, frameCount);
+	ctrlSet->keyframeTime[i] = kt;
+	ctrlSet->keyframeParam[i] = kt * frame->durationInv;
+}
+
+
+// allocate controller set
+a3i32 a3clipControllerSetCreate(a3_ClipControllerSet* ctrlSet_out, const a3_ClipPool* clipPool, const a3ui32 count)
+{
+	if (ctrlSet_out && clipPool && clipPool->clip && clipPool->frame && clipPool->count && count)
+	{
+		if (!ctrlSet_out->data)
 		{
-			clipCtrl_out->clipTime = clipPool->clip[clipIndex_pool].duration;
+			const a3ui32 stride = (count + A3_CLIPCTRLSET_LANES - 1) / A3_CLIPCTRLSET_LANES * A3_CLIPCTRLSET_LANES;
+			const a3ui32 realCount = 9, indexCount = 4;
+			const size_t dataSize = (sizeof(a3real) * realCount + sizeof(a3index) * indexCount) * stride;
+			a3real* realPtr;
+			a3index* indexPtr;
+			a3ui32 i;
+
+			ctrlSet_out->data = malloc(dataSize);
+			if (!ctrlSet_out->data)
+				return -1;
+			memset(ctrlSet_out->data, 0, dataSize);
+
+			// carve arrays out of single block; reals first for alignment
+			realPtr = (a3real*)ctrlSet_out->data;
+			ctrlSet_out->clipTime = realPtr;
+			ctrlSet_out->clipParam = (realPtr += stride);
+			ctrlSet_out->keyframeTime = (realPtr += stride);
+			ctrlSet_out->keyframeParam = (realPtr += stride);
+			ctrlSet_out->playbackDirection = (realPtr += stride);
+			ctrlSet_out->clipDuration = (realPtr += stride);
+			ctrlSet_out->clipDurationInv = (realPtr += stride);
+			ctrlSet_out->keyframeDuration = (realPtr += stride);
+			ctrlSet_out->keyframeDurationInv = (realPtr += stride);
+			indexPtr = (a3index*)(realPtr + stride);
+			ctrlSet_out->clipIndex = indexPtr;
+			ctrlSet_out->keyframeIndex0 = (indexPtr += stride);
+			ctrlSet_out->keyframeIndex1 = (indexPtr += stride);
+			ctrlSet_out->resolveList = (indexPtr += stride);
+
+			ctrlSet_out->clipPool = clipPool;
+			ctrlSet_out->count = count;
+			ctrlSet_out->stride = stride;
+
+			// padding lanes stay paused on clip 0 so they never resolve
+			for (i = 0; i < stride; ++i)
+				a3clipControllerSetInit(ctrlSet_out, i, 0, 0, 0);
+			return count;
 		}
 	}
+	return -1;
+}
 
-	return 1;
+// release controller set
+a3i32 a3clipControllerSetRelease(a3_ClipControllerSet* ctrlSet)
+{
+	if (ctrlSet && ctrlSet->data)
+	{
+		free(ctrlSet->data);
+		memset(ctrlSet, 0, sizeof(a3_ClipControllerSet));
+		return 1;
+	}
+	return -1;
 }
 
+// initialize single controller in set
+a3i32 a3clipControllerSetInit(a3_ClipControllerSet* ctrlSet, const a3ui32 ctrlIndex, const a3ui32 clipIndex_pool, const a3f32 clipTime, const a3f32 playbackDirection)
+{
+	if (ctrlSet && ctrlSet->data && ctrlIndex < ctrlSet->stride && clipIndex_pool < ctrlSet->clipPool->count)
+	{
+		a3_Clip const* clip = a3clipControllerSetInternalSetClip(ctrlSet, ctrlIndex, clipIndex_pool);
+
+		// negative clip time requests the end of the clip
+		ctrlSet->playbackDirection[ctrlIndex] = playbackDirection;
+		ctrlSet->clipTime[ctrlIndex] = clipTime < 0 ? clip->duration : clipTime;
+
+		// force a full keyframe search from the start of the clip
+		ctrlSet->keyframeIndex0[ctrlIndex] = clip->first_keyframe;
+		ctrlSet->keyframeTime[ctrlIndex] = ctrlSet->clipTime[ctrlIndex];
+		a3clipControllerSetInternalResolve(ctrlSet, ctrlIndex);
+		return ctrlIndex;
+	}
+	return -1;
+}
+
+// internal: advance time and normalize for every lane; the boundary test 
+//	only writes a flag per lane, so with restrict parameters the loop has no 
+//	branches or stores the compiler cannot prove independent
+inline void a3clipControllerSetInternalAdvance(a3real* A3_RESTRICT clipTime, a3real* A3_RESTRICT clipParam, a3real* A3_RESTRICT keyframeTime, a3real* A3_RESTRICT keyframeParam, a3index* A3_RESTRICT crossed,
+	a3real const* A3_RESTRICT playbackDirection, a3real const* A3_RESTRICT clipDuration, a3real const* A3_RESTRICT clipDurationInv, a3real const* A3_RESTRICT keyframeDuration, a3real const* A3_RESTRICT keyframeDurationInv,
+	const a3real dt, const a3ui32 n)
+{
+	a3real step, t, kt;
+	a3ui32 i;
+	for (i = 0; i < n; ++i)
+	{
+		step = dt * playbackDirection[i];
+		t = clipTime[i] + step;
+		kt = keyframeTime[i] + step;
+		clipTime[i] = t;
+		keyframeTime[i] = kt;
+		clipParam[i] = t * clipDurationInv[i];
+		keyframeParam[i] = kt * keyframeDurationInv[i];
+		crossed[i] = (step != a3real_zero) & ((kt < a3real_zero) | (kt >= keyframeDuration[i]) | (t < a3real_zero) | (t >= clipDuration[i]));
+	}
+}
+
+// update all controllers in set
+a3i32 a3clipControllerSetUpdate(a3_ClipControllerSet* ctrlSet, const a3real dt)
+{
+	if (ctrlSet && ctrlSet->data)
+	{
+		a3index* const resolveList = ctrlSet->resolveList;
+		a3ui32 i, n = ctrlSet->stride, resolveCount = 0;
+
+		// pass 1: flag lanes that crossed a boundary (vectorized)
+		a3clipControllerSetInternalAdvance(ctrlSet->clipTime, ctrlSet->clipParam, ctrlSet->keyframeTime, ctrlSet->keyframeParam, resolveList,
+			ctrlSet->playbackDirection, ctrlSet->clipDuration, ctrlSet->clipDurationInv, ctrlSet->keyframeDuration, ctrlSet->keyframeDurationInv, dt, n);
+
+		// pass 2: compact flagged lanes in place (never overtakes the read)
+		for (i = 0; i < n; ++i)
+			if (resolveList[i])
+				resolveList[resolveCount++] = i;
+
+		// pass 3: only controllers that crossed a boundary touch the pool
+		for (i = 0; i < resolveCount; ++i)
+			a3clipControllerSetInternalResolve(ctrlSet, resolveList[i]);
+
+		return resolveCount;
+	}
+	return -1;
+}
+
+// evaluate current sample value of all controllers
+a3i32 a3clipControllerSetEvaluate(a3_ClipControllerSet const* ctrlSet, a3real* value_out)
+{
+	if (ctrlSet && ctrlSet->data && ctrlSet->clipPool->frame && value_out)
+	{
+		// one gather of the current clip frame's coefficients and a Horner 
+		//	step per controller regardless of interpolation mode
+		a3_Clip const* clip;
+		a3real const* c;
+		a3real u;
+		a3ui32 i;
+		for (i = 0; i < ctrlSet->count; ++i)
+		{
+			clip = ctrlSet->clipPool->clip + ctrlSet->clipIndex[i];
+			c = clip->frame[a3clipGetFrameOrdinal(clip, ctrlSet->keyframeIndex0[i])].coeff;
+			u = ctrlSet->keyframeParam[i];
+			value_out[i] = c[0] + u * (c[1] + u * (c[2] + u * c[3]));
+		}
+		return ctrlSet->count;
+	}
+	return -1;
+}
+
+// evaluate current channel poses of all controllers
+a3i32 a3clipControllerSetEvaluatePose(a3_ClipControllerSet const* ctrlSet, a3_SpatialPose* pose_out)
+{
+	if (ctrlSet && ctrlSet->data && pose_out)
+	{
+		// output blocks are written in controller order, each read from two 
+		//	adjacent keyframe blocks of the controller's own clip's pool; 
+		//	all pools must have the same pose count
+		const a3_KeyframePool* framePool;
+		const a3ui32 poseCount = ctrlSet->clipPool->clip->framePool->poseCount;
+		a3ui32 i;
+		for (i = 0; i < ctrlSet->count; ++i, pose_out += poseCount)
+		{
+			framePool = ctrlSet->clipPool->clip[ctrlSet->clipIndex[i]].framePool;
+			if (!framePool->pose || framePool->poseCount != poseCount)
+				return -1;
+			a3keyframeEvaluatePose(pose_out, framePool->keyframe + ctrlSet->keyframeIndex0[i], framePool->keyframe + ctrlSet->keyframeIndex1[i], poseCount, ctrlSet->keyframeParam[i]);
+		}
+		return ctrlSet->count;
+	}
+	return -1;
+}
+
+// evaluate all controllers from baked clips
+a3i32 a3clipControllerSetEvaluateBaked(a3_ClipControllerSet const* ctrlSet, a3_ClipBake const* clipBake, a3real* value_out)
+{
+	if (ctrlSet && ctrlSet->data && clipBake && value_out)
+	{
+		a3ui32 i;
+		for (i = 0; i < ctrlSet->count; ++i)
+			value_out[i] = a3clipBakeSample(clipBake + ctrlSet->clipIndex[i], ctrlSet->clipTime[i]);
+		return ctrlSet->count;
+	}
+	return -1;
+}
+
+// evaluate channel poses of all controllers from baked clips
+a3i32 a3clipControllerSetEvaluateBakedPose(a3_ClipControllerSet const* ctrlSet, a3_ClipBake const* clipBake, a3_SpatialPose* pose_out)
+{
+	if (ctrlSet && ctrlSet->data && clipBake && clipBake->pose && pose_out)
+	{
+		const a3ui32 poseCount = clipBake->poseCount;
+		a3ui32 i;
+		for (i = 0; i < ctrlSet->count; ++i, pose_out += poseCount)
+			a3clipBakeSamplePose(pose_out, clipBake + ctrlSet->clipIndex[i], ctrlSet->clipTime[i]);
+		return ctrlSet->count;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// measure controllers updated per second using scalar and batched paths
+a3i32 a3clipControllerBenchmark(a3f64* scalarRate_out, a3f64* batchRate_out, const a3_ClipPool* clipPool, const a3ui32 ctrlCount, const a3ui32 updateCount, const a3real dt)
+{
+	if (scalarRate_out && batchRate_out && clipPool && clipPool->count && ctrlCount && updateCount)
+	{
+		const a3f64 total = (a3f64)ctrlCount * (a3f64)updateCount;
+		a3_ClipController* ctrl = (a3_ClipController*)malloc(sizeof(a3_ClipController) * ctrlCount);
+		a3_ClipControllerSet ctrlSet[1] = { 0 };
+		a3_Timer timer[1] = { 0 };
+		a3byte name[a3keyframeAnimation_nameLenMax] = "bench";
+		a3ui32 i, j;
+
+		if (!ctrl)
+			return -1;
+		if (a3clipControllerSetCreate(ctrlSet, clipPool, ctrlCount) < 0)
+		{
+			free(ctrl);
+			return -1;
+		}
+
+		// same starting state for both paths: alternate directions over all clips
+		for (i = 0; i < ctrlCount; ++i)
+		{
+			a3clipControllerInit(ctrl + i, name, clipPool, i % clipPool->count, (i & 1) ? a3clip_timeEnd : 0, (i & 1) ? -1.0f : +1.0f);
+			a3clipControllerSetInit(ctrlSet, i, i % clipPool->count, (i & 1) ? a3clip_timeEnd : 0, (i & 1) ? -1.0f : +1.0f);
+		}
+
+		// scalar path: one controller per call
+		a3timerSet(timer, 0.0);
+		a3timerStart(timer);
+		for (j = 0; j < updateCount; ++j)
+			for (i = 0; i < ctrlCount; ++i)
+				a3clipControllerUpdate(ctrl + i, dt);
+		a3timerUpdate(timer);
+		*scalarRate_out = timer->totalTime > 0.0 ? total / timer->totalTime : 0.0;
+
+		// batched path: all controllers per call
+		a3timerSet(timer, 0.0);
+		a3timerStart(timer);
+		for (j = 0; j < updateCount; ++j)
+			a3clipControllerSetUpdate(ctrlSet, dt);
+		a3timerUpdate(timer);
+		*batchRate_out = timer->totalTime > 0.0 ? total / timer->totalTime : 0.0;
+
+		a3clipControllerSetRelease(ctrlSet);
+		free(ctrl);
+		return ctrlCount;
+	}
+	return -1;
+}
+
+
 //-----------------------------------------------------------------------------
@@ -24,6 +24,101 @@
 
 #include "../a3_Kinematics.h"
 
+#include "animal3D/a3utility/a3_Timer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif	// _MSC_VER
+
+// number of states solved together, level by level, in multi-state solve
+#define A3_KINEMATICS_STATEGROUP	8
+
+// no-alias hint for batched loops
+#define A3_RESTRICT					__restrict
+
+// largest deviation of squared basis lengths from one for a transform to 
+//	be inverted as rigid
+#define A3_KINEMATICS_RIGIDTOLERANCE	((a3real)0.00001)
+
+
+//-----------------------------------------------------------------------------
+
+// internal: inverse of transform, rigid if its basis is unit length
+inline void a3kinematicsInternalInverse(a3mat4 *A3_RESTRICT m_out, const a3mat4 *A3_RESTRICT m)
+{
+	const a3real d0 = m->x0 * m->x0 + m->y0 * m->y0 + m->z0 * m->z0 - a3real_one;
+	const a3real d1 = m->x1 * m->x1 + m->y1 * m->y1 + m->z1 * m->z1 - a3real_one;
+	const a3real d2 = m->x2 * m->x2 + m->y2 * m->y2 + m->z2 * m->z2 - a3real_one;
+	if (a3absolute(d0) + a3absolute(d1) + a3absolute(d2) <= A3_KINEMATICS_RIGIDTOLERANCE)
+		a3real4x4TransformInverseIgnoreScale(m_out->m, m->m);
+	else
+		a3real4x4TransformInverse(m_out->m, m->m);
+}
+
+// internal: solve one level of nodes; no node in the level is the parent of 
+//	another, so the products are independent
+inline void a3kinematicsInternalSolveLevel(a3mat4 *A3_RESTRICT objectSpace, const a3mat4 *A3_RESTRICT localSpace, const a3ui32 *A3_RESTRICT levelNode, const a3i32 *A3_RESTRICT levelParent, const a3ui32 count)
+{
+	a3ui32 i;
+	for (i = 0; i < count; ++i)
+		a3real4x4Product(objectSpace[levelNode[i]].m, objectSpace[levelParent[i]].m, localSpace[levelNode[i]].m);
+}
+
+// internal: solve all levels of a group of states sharing a hierarchy
+inline a3ui32 a3kinematicsInternalSolveGroup(const a3_HierarchyState *hierarchyStateArray, const a3ui32 stateCount)
+{
+	const a3_HierarchyState *const levels = hierarchyStateArray;
+	const a3ui32 *const levelNode = levels->levelNode;
+	const a3i32 *const levelParent = levels->levelParent;
+	const a3ui32 *const levelOffset = levels->levelOffset;
+	a3ui32 level, i, j;
+
+	// first level is all roots
+	if (levels->levelCount)
+		for (j = 0; j < stateCount; ++j)
+			for (i = levelOffset[0]; i < levelOffset[1]; ++i)
+				hierarchyStateArray[j].objectSpace->transform[levelNode[i]] = hierarchyStateArray[j].localSpace->transform[levelNode[i]];
+
+	for (level = 1; level < levels->levelCount; ++level)
+		for (j = 0; j < stateCount; ++j)
+			a3kinematicsInternalSolveLevel(hierarchyStateArray[j].objectSpace->transform, hierarchyStateArray[j].localSpace->transform,
+				levelNode + levelOffset[level], levelParent + levelOffset[level], levelOffset[level + 1] - levelOffset[level]);
+
+	// everything is current
+	for (j = 0; j < stateCount; ++j)
+		memset(hierarchyStateArray[j].dirty, 0, sizeof(a3ui32) * ((levelOffset[levels->levelCount] + 31) >> 5));
+	return levelOffset[levels->levelCount] * stateCount;
+}
+
+
+// internal: index of lowest set bit in non-zero word
+inline a3ui32 a3kinematicsInternalLowestBit(const a3ui32 bits)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, bits);
+	return (a3ui32)index;
+#elif defined(__GNUC__)
+	return (a3ui32)__builtin_ctz(bits);
+#else	// portable
+	a3ui32 index = 0;
+	while (!(bits & (1u << index)))
+		++index;
+	return index;
+#endif	// _MSC_VER
+}
+
+// internal: clear dirty bits of nodes in [firstIndex, lastIndex)
+inline void a3kinematicsInternalClearDirty(a3ui32 *dirty, const a3ui32 firstIndex, const a3ui32 lastIndex)
+{
+	a3ui32 i;
+	for (i = firstIndex; i < lastIndex; ++i)
+		dirty[i >> 5] &= ~(1u << (i & 31));
+}
+
 
 //-----------------------------------------------------------------------------
 
@@ -33,12 +128,157 @@ a3i32 a3kinematicsSolveForwardPartial(const a3_HierarchyState *hierarchyState, c
 	if (hierarchyState && hierarchyState->poseGroup && 
 		firstIndex < hierarchyState->poseGroup->hierarchy->numNodes && nodeCount)
 	{
-		// ****TO-DO: implement forward kinematics algorithm
-		//	- for all nodes starting at first index
-		//		- if node is not root (has parent node)
-		//			- object matrix = parent object matrix * local matrix
-		//		- else
-		//			- copy local matrix to object matrix
+		const a3_Hierarchy *const hierarchy = hierarchyState->poseGroup->hierarchy;
+		const a3ui32 lastIndex = firstIndex + nodeCount < hierarchy->numNodes ? firstIndex + nodeCount : hierarchy->numNodes;
+		a3mat4 *const objectSpace = hierarchyState->objectSpace->transform;
+		const a3mat4 *const localSpace = hierarchyState->localSpace->transform;
+		a3i32 parentIndex;
+		a3ui32 i;
+
+		// whole hierarchy: batch by level
+		if (firstIndex == 0 && lastIndex == hierarchy->numNodes)
+			return a3kinematicsInternalSolveGroup(hierarchyState, 1);
+
+		// sub-range: parents precede children, so index order is valid
+		for (i = firstIndex; i < lastIndex; ++i)
+		{
+			parentIndex = hierarchy->nodes[i].parentIndex;
+			if (parentIndex >= 0)
+				a3real4x4Product(objectSpace[i].m, objectSpace[parentIndex].m, localSpace[i].m);
+			else
+				objectSpace[i] = localSpace[i];
+		}
+		a3kinematicsInternalClearDirty(hierarchyState->dirty, firstIndex, lastIndex);
+		return (lastIndex - firstIndex);
+	}
+	return -1;
+}
+
+// incremental FK solver
+a3i32 a3kinematicsSolveForwardDirty(const a3_HierarchyState *hierarchyState)
+{
+	if (hierarchyState && hierarchyState->poseGroup && hierarchyState->dirty)
+	{
+		const a3_Hierarchy *const hierarchy = hierarchyState->poseGroup->hierarchy;
+		const a3ui32 *const subtreeEnd = hierarchyState->subtreeEnd;
+		const a3ui32 wordCount = (hierarchy->numNodes + 31) >> 5;
+		a3ui32 *const dirty = hierarchyState->dirty;
+		a3mat4 *const objectSpace = hierarchyState->objectSpace->transform;
+		const a3mat4 *const localSpace = hierarchyState->localSpace->transform;
+		a3ui32 word, first, last, i;
+		a3i32 parentIndex, ret = 0;
+
+		for (word = 0; word < wordCount; ++word)
+			while (dirty[word])
+			{
+				// walk the subtree range of the first dirty node; a node is 
+				//	solved if it is dirty or its parent was solved in this walk, 
+				//	in which case it is marked too; other dirty nodes in range 
+				//	may extend it
+				first = (word << 5) + a3kinematicsInternalLowestBit(dirty[word]);
+				last = subtreeEnd[first];
+				for (i = first; i <= last; ++i)
+				{
+					parentIndex = hierarchy->nodes[i].parentIndex;
+					if (!(dirty[i >> 5] & (1u << (i & 31))))
+					{
+						if (parentIndex < (a3i32)first || !(dirty[parentIndex >> 5] & (1u << (parentIndex & 31))))
+							continue;
+						dirty[i >> 5] |= (1u << (i & 31));
+					}
+					if (parentIndex >= 0)
+						a3real4x4Product(objectSpace[i].m, objectSpace[parentIndex].m, localSpace[i].m);
+					else
+						objectSpace[i] = localSpace[i];
+					if (last < subtreeEnd[i])
+						last = subtreeEnd[i];
+					++ret;
+				}
+				a3kinematicsInternalClearDirty(dirty, first, last + 1);
+			}
+		return ret;
+	}
+	return -1;
+}
+
+// multi-state FK solver
+a3i32 a3kinematicsSolveForwardMultiple(const a3_HierarchyState *hierarchyStateArray, const a3ui32 stateCount)
+{
+	if (hierarchyStateArray)
+	{
+		a3ui32 i, j, groupCount;
+		a3i32 ret = 0;
+		for (i = 0; i < stateCount; i += groupCount)
+		{
+			if (!hierarchyStateArray[i].poseGroup)
+				return -1;
+
+			// group consecutive states that share a hierarchy, and so levels
+			for (groupCount = 1, j = i + 1; j < stateCount && groupCount < A3_KINEMATICS_STATEGROUP; ++j, ++groupCount)
+				if (!hierarchyStateArray[j].poseGroup || hierarchyStateArray[j].poseGroup->hierarchy != hierarchyStateArray[i].poseGroup->hierarchy)
+					break;
+			ret += a3kinematicsInternalSolveGroup(hierarchyStateArray + i, groupCount);
+		}
+		return ret;
+	}
+	return -1;
+}
+
+// measure joints solved per second
+a3i32 a3kinematicsBenchmarkForward(a3f64 *sequentialRate_out, a3f64 *batchedRate_out, const a3_HierarchyState *hierarchyState, const a3ui32 stateCount, const a3ui32 passCount)
+{
+	if (sequentialRate_out && batchedRate_out && hierarchyState && hierarchyState->poseGroup && stateCount && passCount)
+	{
+		const a3_Hierarchy *const hierarchy = hierarchyState->poseGroup->hierarchy;
+		const a3ui32 numNodes = hierarchy->numNodes;
+		const a3f64 total = (a3f64)numNodes * (a3f64)stateCount * (a3f64)passCount;
+		a3_HierarchyState *state = (a3_HierarchyState *)calloc(stateCount, sizeof(a3_HierarchyState));
+		a3_Timer timer[1] = { 0 };
+		a3ui32 i, j, k;
+		a3i32 parentIndex;
+
+		if (!state)
+			return -1;
+		for (j = 0; j < stateCount; ++j)
+		{
+			if (a3hierarchyStateCreate(state + j, hierarchyState->poseGroup) < 0)
+			{
+				while (j--)
+					a3hierarchyStateRelease(state + j);
+				free(state);
+				return -1;
+			}
+			memcpy(state[j].localSpace->transform, hierarchyState->localSpace->transform, sizeof(a3mat4) * numNodes);
+		}
+
+		// sequential: one product per node in index order
+		a3timerSet(timer, 0.0);
+		a3timerStart(timer);
+		for (k = 0; k < passCount; ++k)
+			for (j = 0; j < stateCount; ++j)
+				for (i = 0; i < numNodes; ++i)
+				{
+					parentIndex = hierarchy->nodes[i].parentIndex;
+					if (parentIndex >= 0)
+						a3real4x4Product(state[j].objectSpace->transform[i].m, state[j].objectSpace->transform[parentIndex].m, state[j].localSpace->transform[i].m);
+					else
+						state[j].objectSpace->transform[i] = state[j].localSpace->transform[i];
+				}
+		a3timerUpdate(timer);
+		*sequentialRate_out = timer->totalTime > 0.0 ? total / timer->totalTime : 0.0;
+
+		// batched: all states in one call
+		a3timerSet(timer, 0.0);
+		a3timerStart(timer);
+		for (k = 0; k < passCount; ++k)
+			a3kinematicsSolveForwardMultiple(state, stateCount);
+		a3timerUpdate(timer);
+		*batchedRate_out = timer->totalTime > 0.0 ? total / timer->totalTime : 0.0;
+
+		for (j = 0; j < stateCount; ++j)
+			a3hierarchyStateRelease(state + j);
+		free(state);
+		return stateCount;
 	}
 	return -1;
 }
@@ -46,18 +286,415 @@ a3i32 a3kinematicsSolveForwardPartial(const a3_HierarchyState *hierarchyState, c
 
 //-----------------------------------------------------------------------------
 
+// internal: inverse solve of node range; each parent is inverted once, 
+//	into the state's scratch buffer, before the independent products
+inline a3ui32 a3kinematicsInternalSolveInverseRange(const a3_HierarchyState *hierarchyState, const a3ui32 firstIndex, const a3ui32 lastIndex)
+{
+	const a3_HierarchyNode *const nodes = hierarchyState->poseGroup->hierarchy->nodes;
+	const a3ui32 *const subtreeEnd = hierarchyState->subtreeEnd;
+	const a3mat4 *const objectSpace = hierarchyState->objectSpace->transform;
+	a3mat4 *const parentInverse = hierarchyState->parentInverse->transform;
+	a3mat4 *const localSpace = hierarchyState->localSpace->transform;
+	a3i32 parentIndex, external = -1;
+	a3ui32 i;
+
+	// parents: nodes in range with children, and any parent preceding the 
+	//	range (usually one, shared by the range's subtree roots)
+	for (i = firstIndex; i < lastIndex; ++i)
+	{
+		if (subtreeEnd[i] > i)
+			a3kinematicsInternalInverse(parentInverse + i, objectSpace + i);
+		parentIndex = nodes[i].parentIndex;
+		if (parentIndex >= 0 && parentIndex < (a3i32)firstIndex && parentIndex != external)
+			a3kinematicsInternalInverse(parentInverse + parentIndex, objectSpace + (external = parentIndex));
+	}
+
+	// products no longer depend on each other
+	for (i = firstIndex; i < lastIndex; ++i)
+	{
+		parentIndex = nodes[i].parentIndex;
+		if (parentIndex >= 0)
+			a3real4x4Product(localSpace[i].m, parentInverse[parentIndex].m, objectSpace[i].m);
+		else
+			localSpace[i] = objectSpace[i];
+	}
+
+	// local and object-space agree
+	a3kinematicsInternalClearDirty(hierarchyState->dirty, firstIndex, lastIndex);
+	return (lastIndex - firstIndex);
+}
+
 // partial IK solver
 a3i32 a3kinematicsSolveInversePartial(const a3_HierarchyState *hierarchyState, const a3ui32 firstIndex, const a3ui32 nodeCount)
 {
 	if (hierarchyState && hierarchyState->poseGroup &&
 		firstIndex < hierarchyState->poseGroup->hierarchy->numNodes && nodeCount)
 	{
-		// ****TO-DO: implement inverse kinematics algorithm
-		//	- for all nodes starting at first index
-		//		- if node is not root (has parent node)
-		//			- local matrix = inverse parent object matrix * object matrix
-		//		- else
-		//			- copy object matrix to local matrix
+		const a3ui32 numNodes = hierarchyState->poseGroup->hierarchy->numNodes;
+		const a3ui32 lastIndex = firstIndex + nodeCount < numNodes ? firstIndex + nodeCount : numNodes;
+		return a3kinematicsInternalSolveInverseRange(hierarchyState, firstIndex, lastIndex);
+	}
+	return -1;
+}
+
+// multi-state IK solver
+a3i32 a3kinematicsSolveInverseMultiple(const a3_HierarchyState *hierarchyStateArray, const a3ui32 stateCount)
+{
+	if (hierarchyStateArray)
+	{
+		a3ui32 j;
+		a3i32 ret = 0;
+		for (j = 0; j < stateCount; ++j)
+		{
+			if (!hierarchyStateArray[j].poseGroup)
+				return -1;
+			ret += a3kinematicsInternalSolveInverseRange(hierarchyStateArray + j, 0, hierarchyStateArray[j].poseGroup->hierarchy->numNodes);
+		}
+		return ret;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal: rotation taking direction u to direction v by the shortest arc 
+//	(Rodrigues, with axis u x v scaled by the sine); false if either is zero
+inline a3boolean a3kinematicsInternalRotationArc(a3mat3 *r_out, const a3real *u, const a3real *v)
+{
+	const a3real lenSq = a3real3LengthSquared(u) * a3real3LengthSquared(v);
+	a3vec3 k;
+	a3real c, s;
+	if (lenSq > a3real_epsilon)
+	{
+		s = a3sqrtInverse(lenSq);
+		c = a3real3Dot(u, v) * s;
+		a3real3MulS(a3real3Cross(k.v, u, v), s);
+		if (c > -a3real_one + a3real_epsilon)
+		{
+			// R = c I + [k]x + k k^T / (1 + c)
+			s = a3recip(a3real_one + c);
+			r_out->m[0][0] = c + k.x * k.x * s;
+			r_out->m[0][1] = k.z + k.y * k.x * s;
+			r_out->m[0][2] = -k.y + k.z * k.x * s;
+			r_out->m[1][0] = -k.z + k.x * k.y * s;
+			r_out->m[1][1] = c + k.y * k.y * s;
+			r_out->m[1][2] = k.x + k.z * k.y * s;
+			r_out->m[2][0] = k.y + k.x * k.z * s;
+			r_out->m[2][1] = -k.x + k.y * k.z * s;
+			r_out->m[2][2] = c + k.z * k.z * s;
+		}
+		else
+		{
+			// opposite: half turn about any axis perpendicular to u
+			if (u[0] * u[0] < u[2] * u[2])
+				a3real3Set(k.v, a3real_zero, u[2], -u[1]);
+			else
+				a3real3Set(k.v, u[1], -u[0], a3real_zero);
+			a3real3Normalize(k.v);
+			r_out->m[0][0] = k.x * k.x * a3real_two - a3real_one;
+			r_out->m[0][1] = r_out->m[1][0] = k.x * k.y * a3real_two;
+			r_out->m[0][2] = r_out->m[2][0] = k.x * k.z * a3real_two;
+			r_out->m[1][1] = k.y * k.y * a3real_two - a3real_one;
+			r_out->m[1][2] = r_out->m[2][1] = k.y * k.z * a3real_two;
+			r_out->m[2][2] = k.z * k.z * a3real_two - a3real_one;
+		}
+		return a3true;
+	}
+	return a3false;
+}
+
+// internal: rotate chain transforms [first, count) about the position of 
+//	the first so that its offset to 'from' points toward 'to'
+inline void a3kinematicsInternalAim(a3mat4 *work, const a3ui32 first, const a3ui32 count, const a3real *from, const a3real *to)
+{
+	const a3real *const pivot = work[first].m[3];
+	a3vec3 u, v, p;
+	a3mat3 r;
+	a3ui32 i, j;
+	a3real3Diff(u.v, from, pivot);
+	a3real3Diff(v.v, to, pivot);
+	if (a3kinematicsInternalRotationArc(&r, u.v, v.v))
+	{
+		p = *(const a3vec3 *)pivot;
+		for (i = first; i < count; ++i)
+		{
+			// basis columns rotate; position rotates about pivot
+			for (j = 0; j < 3; ++j)
+			{
+				u = *(a3vec3 *)work[i].m[j];
+				work[i].m[j][0] = r.m[0][0] * u.x + r.m[1][0] * u.y + r.m[2][0] * u.z;
+				work[i].m[j][1] = r.m[0][1] * u.x + r.m[1][1] * u.y + r.m[2][1] * u.z;
+				work[i].m[j][2] = r.m[0][2] * u.x + r.m[1][2] * u.y + r.m[2][2] * u.z;
+			}
+			a3real3Diff(u.v, work[i].m[3], p.v);
+			work[i].m[3][0] = p.x + r.m[0][0] * u.x + r.m[1][0] * u.y + r.m[2][0] * u.z;
+			work[i].m[3][1] = p.y + r.m[0][1] * u.x + r.m[1][1] * u.y + r.m[2][1] * u.z;
+			work[i].m[3][2] = p.z + r.m[0][2] * u.x + r.m[1][2] * u.y + r.m[2][2] * u.z;
+		}
+	}
+}
+
+// internal: validate chain against its solver and hierarchy
+inline a3boolean a3kinematicsInternalChainValid(const a3_KinematicsChain *chain)
+{
+	const a3_Hierarchy *hierarchy;
+	a3ui32 k;
+	if (chain->hierarchyState && chain->hierarchyState->poseGroup && chain->hierarchyState->dirty && 
+		chain->nodeCount >= 2 && chain->nodeCount <= a3kinematics_chainMax && 
+		(chain->solver != a3kinematicsSolver_twoBone || chain->nodeCount == 3))
+	{
+		hierarchy = chain->hierarchyState->poseGroup->hierarchy;
+		if (chain->node[0] >= hierarchy->numNodes)
+			return a3false;
+		for (k = 1; k < chain->nodeCount; ++k)
+			if (chain->node[k] <= chain->node[k - 1] || a3hierarchyIsAncestorNode(hierarchy, chain->node[k - 1], chain->node[k]) <= 0)
+				return a3false;
+		return a3true;
+	}
+	return a3false;
+}
+
+// internal: analytic two-bone solve (law of cosines in the bend plane)
+inline a3ui32 a3kinematicsInternalSolveTwoBone(a3mat4 *work, const a3_KinematicsChain *chain)
+{
+	const a3real *const a = work[0].m[3], *const b = work[1].m[3], *const c = work[2].m[3];
+	a3vec3 dir, up, ab, bc, target;
+	a3real l1, l2, d, cosA, sinA;
+
+	a3real3Diff(ab.v, b, a);
+	a3real3Diff(bc.v, c, b);
+	l1 = a3real3Length(ab.v);
+	l2 = a3real3Length(bc.v);
+
+	// direction to goal, distance clamped to reach
+	a3real3Diff(dir.v, chain->goal.v, a);
+	d = a3real3Length(dir.v);
+	if (d > a3real_epsilon)
+		a3real3MulS(dir.v, a3recip(d));
+	else if (a3real3LengthSquared(a3real3Diff(dir.v, c, a)) > a3real_epsilon)
+		a3real3Normalize(dir.v);
+	else
+		return 1;
+	d = a3clamp(a3absolute(l1 - l2), l1 + l2, d);
+
+	// bend direction: pole or current mid joint, perpendicular to goal
+	if (chain->usingPole)
+		a3real3Diff(up.v, chain->pole.v, a);
+	else
+		up = ab;
+	a3real3Sub(up.v, a3real3ProductS(target.v, dir.v, a3real3Dot(up.v, dir.v)));
+	if (a3real3LengthSquared(up.v) <= a3real_epsilon)
+	{
+		a3real3Cross(target.v, ab.v, bc.v);
+		if (a3real3LengthSquared(target.v) <= a3real_epsilon)
+			a3real3Set(target.v, dir.y, -dir.x, a3real_zero);
+		if (a3real3LengthSquared(target.v) <= a3real_epsilon)
+			a3real3Set(target.v, a3real_zero, dir.z, -dir.y);
+		a3real3Cross(up.v, target.v, dir.v);
+	}
+	a3real3Normalize(up.v);
+
+	// place mid joint, then aim end at the clamped goal
+	cosA = (l1 * d > a3real_epsilon) ? a3clamp(-a3real_one, a3real_one, (l1 * l1 + d * d - l2 * l2) * a3recip(a3real_two * l1 * d)) : a3real_one;
+	sinA = a3sqrt(a3real_one - cosA * cosA);
+	a3real3ProductS(target.v, dir.v, l1 * cosA);
+	a3real3Add(target.v, a3real3ProductS(bc.v, up.v, l1 * sinA));
+	a3kinematicsInternalAim(work, 0, 3, b, a3real3Add(target.v, a));
+	a3real3ProductS(target.v, dir.v, d);
+	a3kinematicsInternalAim(work, 1, 3, c, a3real3Add(target.v, a));
+	return 1;
+}
+
+// internal: cyclic coordinate descent; each sweep aims every joint from 
+//	the end back to the base at the goal
+inline a3ui32 a3kinematicsInternalSolveCCD(a3mat4 *work, const a3_KinematicsChain *chain, const a3ui32 iterationMax, const a3real toleranceSq)
+{
+	const a3ui32 n = chain->nodeCount;
+	const a3real *const end = work[n - 1].m[3];
+	a3ui32 iteration, k;
+	for (iteration = 0; iteration < iterationMax && a3real3DistanceSquared(end, chain->goal.v) > toleranceSq; ++iteration)
+		for (k = n - 1; k > 0; --k)
+			a3kinematicsInternalAim(work, k - 1, n, end, chain->goal.v);
+	return iteration;
+}
+
+// internal: forward and backward reaching on joint positions, then aim 
+//	each joint from the base at its solved child position
+inline a3ui32 a3kinematicsInternalSolveFABRIK(a3mat4 *work, const a3_KinematicsChain *chain, const a3ui32 iterationMax, const a3real toleranceSq)
+{
+	const a3ui32 n = chain->nodeCount;
+	a3vec3 p[a3kinematics_chainMax], dir;
+	a3real length[a3kinematics_chainMax], reach = a3real_zero, d;
+	a3ui32 iteration = 0, k;
+
+	for (k = 0; k < n; ++k)
+		p[k] = *(const a3vec3 *)work[k].m[3];
+	for (k = 0; k + 1 < n; ++k)
+		reach += length[k] = a3real3Distance(p[k + 1].v, p[k].v);
+
+	if (a3real3DistanceSquared(chain->goal.v, p[0].v) >= reach * reach)
+	{
+		// out of reach: straighten toward goal
+		a3real3Diff(dir.v, chain->goal.v, p[0].v);
+		a3real3Normalize(dir.v);
+		for (k = 0; k + 1 < n; ++k)
+			a3real3Add(a3real3ProductS(p[k + 1].v, dir.v, length[k]), p[k].v);
+		iteration = 1;
+	}
+	else for (; iteration < iterationMax && a3real3DistanceSquared(p[n - 1].v, chain->goal.v) > toleranceSq; ++iteration)
+	{
+		// backward from goal, then forward from fixed base
+		p[n - 1] = chain->goal;
+		for (k = n - 1; k > 0; --k)
+		{
+			a3real3Diff(dir.v, p[k - 1].v, p[k].v);
+			d = a3real3Length(dir.v);
+			if (d > a3real_epsilon)
+				a3real3Sum(p[k - 1].v, p[k].v, a3real3MulS(dir.v, length[k - 1] * a3recip(d)));
+		}
+		p[0] = *(const a3vec3 *)work[0].m[3];
+		for (k = 1; k < n; ++k)
+		{
+			a3real3Diff(dir.v, p[k].v, p[k - 1].v);
+			d = a3real3Length(dir.v);
+			if (d > a3real_epsilon)
+				a3real3Sum(p[k].v, p[k - 1].v, a3real3MulS(dir.v, length[k - 1] * a3recip(d)));
+		}
+	}
+
+	// positions to rotations; lengths are kept, so each aim lands exactly
+	for (k = 0; k + 1 < n; ++k)
+		a3kinematicsInternalAim(work, k, n, work[k + 1].m[3], p[k + 1].v);
+	return iteration;
+}
+
+// internal: solve chain into its local-space transforms and mark them dirty; 
+//	object-space is left for the caller to refresh
+inline a3i32 a3kinematicsInternalSolveChain(const a3_KinematicsChain *chain, const a3ui32 iterationMax, const a3real tolerance, a3_KinematicsStats *stats_out)
+{
+	if (a3kinematicsInternalChainValid(chain))
+	{
+		const a3_HierarchyState *const state = chain->hierarchyState;
+		const a3_HierarchyNode *const nodes = state->poseGroup->hierarchy->nodes;
+		const a3mat4 *const objectSpace = state->objectSpace->transform;
+		a3mat4 *const localSpace = state->localSpace->transform;
+		const a3ui32 n = chain->nodeCount;
+		a3mat4 work[a3kinematics_chainMax], parent, inverse;
+		a3ui32 iteration, k, node;
+		a3i32 parentIndex;
+		a3real error;
+
+		for (k = 0; k < n; ++k)
+			work[k] = objectSpace[chain->node[k]];
+		switch (chain->solver)
+		{
+		case a3kinematicsSolver_twoBone:
+			iteration = a3kinematicsInternalSolveTwoBone(work, chain);
+			break;
+		case a3kinematicsSolver_ccd:
+			iteration = a3kinematicsInternalSolveCCD(work, chain, iterationMax, tolerance * tolerance);
+			break;
+		case a3kinematicsSolver_fabrik:
+			iteration = a3kinematicsInternalSolveFABRIK(work, chain, iterationMax, tolerance * tolerance);
+			break;
+		default:
+			return -1;
+		}
+
+		// local = inverse parent object * object; a parent between chain 
+		//	nodes k-1 and k keeps its offset from k-1, so its new object-space 
+		//	is new(k-1) * inverse old(k-1) * old parent
+		for (k = 0; k < n; ++k)
+		{
+			node = chain->node[k];
+			parentIndex = nodes[node].parentIndex;
+			if (parentIndex < 0)
+				localSpace[node] = work[k];
+			else
+			{
+				if (k == 0)
+					parent = objectSpace[parentIndex];
+				else if (parentIndex == (a3i32)chain->node[k - 1])
+					parent = work[k - 1];
+				else
+				{
+					a3kinematicsInternalInverse(&inverse, objectSpace + chain->node[k - 1]);
+					a3real4x4Product(parent.m, inverse.m, objectSpace[parentIndex].m);
+					inverse = parent;
+					a3real4x4Product(parent.m, work[k - 1].m, inverse.m);
+				}
+				a3kinematicsInternalInverse(&inverse, &parent);
+				a3real4x4Product(localSpace[node].m, inverse.m, work[k].m);
+			}
+			state->dirty[node >> 5] |= (1u << (node & 31));
+		}
+
+		error = a3real3Distance(work[n - 1].m[3], chain->goal.v);
+		if (stats_out)
+		{
+			stats_out->chainCount += 1;
+			stats_out->convergedCount += (error <= tolerance);
+			stats_out->iterationCount += iteration;
+			stats_out->iterationMax = a3maximum(stats_out->iterationMax, iteration);
+			stats_out->errorSum += error;
+			stats_out->errorMax = a3maximum(stats_out->errorMax, error);
+		}
+		return (error <= tolerance);
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// reset IK stats
+a3i32 a3kinematicsStatsReset(a3_KinematicsStats *stats_out)
+{
+	if (stats_out)
+	{
+		memset(stats_out, 0, sizeof(a3_KinematicsStats));
+		return 1;
+	}
+	return -1;
+}
+
+// solve one IK chain
+a3i32 a3kinematicsSolveChain(const a3_KinematicsChain *chain, const a3ui32 iterationMax, const a3real tolerance, a3_KinematicsStats *stats_out)
+{
+	if (chain)
+	{
+		const a3i32 ret = a3kinematicsInternalSolveChain(chain, iterationMax, tolerance, stats_out);
+		if (ret >= 0)
+			a3kinematicsSolveForwardDirty(chain->hierarchyState);
+		return ret;
+	}
+	return -1;
+}
+
+// solve array of IK chains
+a3i32 a3kinematicsSolveChainArray(const a3_KinematicsChain *chainArray, const a3ui32 chainCount, const a3ui32 iterationMax, const a3real tolerance, a3_KinematicsStats *stats_out)
+{
+	if (chainArray)
+	{
+		const a3_HierarchyState *state = 0;
+		a3ui32 i;
+		a3i32 converged, ret = 0;
+		for (i = 0; i < chainCount; ++i)
+		{
+			// refresh previous state once its run of chains ends
+			if (state && state != chainArray[i].hierarchyState)
+				a3kinematicsSolveForwardDirty(state);
+			converged = a3kinematicsInternalSolveChain(chainArray + i, iterationMax, tolerance, stats_out);
+			if (converged >= 0)
+			{
+				state = chainArray[i].hierarchyState;
+				ret += converged;
+			}
+		}
+		if (state)
+			a3kinematicsSolveForwardDirty(state);
+		return ret;
 	}
 	return -1;
 }
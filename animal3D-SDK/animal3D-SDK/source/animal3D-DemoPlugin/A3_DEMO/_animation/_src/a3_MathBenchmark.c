@@ -0,0 +1,402 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_MathBenchmark.c
+	Implementation of math micro-benchmarks.
+*/
+
+#include "../a3_MathBenchmark.h"
+
+#include "animal3D/a3utility/a3_Timer.h"
+
+#include <stdlib.h>
+
+
+//-----------------------------------------------------------------------------
+
+// reals reserved per element: three 4x4 matrices covers every family
+#define A3_MATHBENCHMARK_STRIDE		48
+
+// samples per degree for the table family
+#define A3_MATHBENCHMARK_TRIGSAMPLES	4
+
+
+// family names
+static a3byte const *const a3mathBenchmarkInternalName[a3mathBenchmark_familyCount] = {
+	"sqrt",
+	"trig",
+	"trigTable",
+	"trigTaylor",
+	"trigArray",
+	"trigArrayFast",
+	"random",
+	"randomStream",
+	"interpolation",
+	"vector",
+	"matrix",
+	"matrixArray",
+	"quaternion",
+	"quaternionArray",
+	"dualquaternion",
+};
+
+
+//-----------------------------------------------------------------------------
+
+// internal: fill inputs with values in [-1, 1); private generator so the 
+//	shared random state is left alone
+inline void a3mathBenchmarkInternalFill(a3real *data, const a3ui32 count)
+{
+	a3ui32 seed = 2463534242u, i;
+	for (i = 0; i < count; ++i)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		data[i] = (a3real)((a3f64)seed / 2147483648.0 - 1.0);
+	}
+}
+
+// internal: turn filled elements into rigid transforms and unit quaternions 
+//	so that inverses and rotations behave as they would in use
+inline void a3mathBenchmarkInternalPrepare(a3real *data, const a3ui32 elementCount)
+{
+	a3real *element;
+	a3mat4 *m;
+	a3dualquat *Q;
+	a3real3 t;
+	a3ui32 i;
+	for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+	{
+		// first matrix: rotation and translation from its own values
+		m = (a3mat4 *)element;
+		a3real3Set(t, m->m30, m->m31, m->m32);
+		a3real4x4SetRotateXYZ(m->m, m->m00 * a3real_oneeighty, m->m01 * a3real_oneeighty, m->m02 * a3real_oneeighty);
+		a3real3SetReal3(m->m[3], t);
+
+		// third matrix: a unit dual quaternion, then a unit quaternion
+		Q = (a3dualquat *)(m + 2);
+		a3dualquatSetEulerTranslate(Q->Q, Q->rx * a3real_oneeighty, Q->ry * a3real_oneeighty, Q->rz * a3real_oneeighty, a3true, t);
+		a3real4Normalize(Q[1].r.q);
+	}
+}
+
+// internal: lay out the buffer for families that read contiguous arrays 
+//	rather than elements; returns false for element families
+inline a3boolean a3mathBenchmarkInternalPrepareArrays(a3real *data, const a3_MathBenchmarkFamily family, const a3ui32 elementCount)
+{
+	a3dualquat *Q;
+	a3quat *q;
+	a3real *param;
+	a3real3 t;
+	a3ui32 i;
+	switch (family)
+	{
+	case a3mathBenchmark_trigArray:
+	case a3mathBenchmark_trigArrayFast:
+		// angles in degrees, then outputs
+		for (i = 0; i < elementCount; ++i)
+			data[i] *= a3real_threesixty;
+		return a3true;
+
+	case a3mathBenchmark_randomStream:
+		// outputs only
+		return a3true;
+
+	case a3mathBenchmark_quaternionArray:
+		// two arrays of unit dual quaternions and an output, then the same 
+		//	for quaternions, then one blend parameter per element
+		Q = (a3dualquat *)data;
+		q = (a3quat *)(Q + elementCount * 3);
+		param = (a3real *)(q + elementCount * 3);
+		for (i = 0; i < elementCount * 2; ++i)
+		{
+			a3real3Set(t, Q[i].dx, Q[i].dy, Q[i].dz);
+			a3dualquatSetEulerTranslate(Q[i].Q, Q[i].rx * a3real_oneeighty, Q[i].ry * a3real_oneeighty, Q[i].rz * a3real_oneeighty, a3true, t);
+			a3real4Normalize(q[i].q);
+		}
+		for (i = 0; i < elementCount; ++i)
+			param[i] = a3absolute(param[i]);
+		return a3true;
+
+	default:
+		break;
+	}
+	return a3false;
+}
+
+// internal: run family over elements; each run fills its own inputs, so 
+//	families may use any part of an element as scratch; returns calls per pass
+inline a3ui32 a3mathBenchmarkInternalPass(a3real *sum_inout, const a3_MathBenchmarkFamily family, a3real *data, const a3ui32 elementCount)
+{
+	a3real *element;
+	a3mat4 *m;
+	a3vec4 *v;
+	a3dualquat *Q;
+	a3quat *q;
+#ifdef A3_OPEN_SOURCE
+	a3trigAccuracy accuracy;
+	a3randomStream stream[1];
+#endif	// A3_OPEN_SOURCE
+	a3integer seed;
+	a3real sum = *sum_inout;
+	a3ui32 i;
+
+	switch (family)
+	{
+	case a3mathBenchmark_sqrt:
+		for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+			sum += a3sqrt(a3absolute(element[0])) + a3sqrtInverse(a3absolute(element[1]) + a3real_one);
+		*sum_inout = sum;
+		return (elementCount * 2);
+
+	case a3mathBenchmark_trig:
+	case a3mathBenchmark_trigTable:
+		// same calls for both; the run sets up a table for the latter
+		for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+			sum += a3sind(element[16] * a3real_threesixty) + a3cosd(element[17] * a3real_threesixty) + a3atan2d(element[18], element[19]);
+		*sum_inout = sum;
+		return (elementCount * 3);
+
+	case a3mathBenchmark_trigTaylor:
+		for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+			sum += a3sindTaylor(element[16] * a3real_threesixty) + a3cosdTaylor(element[17] * a3real_threesixty);
+		*sum_inout = sum;
+		return (elementCount * 2);
+
+	case a3mathBenchmark_trigArray:
+	case a3mathBenchmark_trigArrayFast:
+		// sine and cosine of every angle, then recover the angles from them
+#ifdef A3_OPEN_SOURCE
+		accuracy = family == a3mathBenchmark_trigArray ? a3trigAccuracy_full : a3trigAccuracy_fast;
+		a3trigPolyArray_sind_cosd(data + elementCount * 2, data + elementCount * 3, data, elementCount, accuracy);
+		a3trigPolyArray_atan2d(data + elementCount * 4, data + elementCount * 2, data + elementCount * 3, elementCount, accuracy);
+		*sum_inout = sum + data[elementCount * 3 - 1] + data[elementCount * 5 - 1];
+		return (elementCount * 3);
+#else	// !A3_OPEN_SOURCE
+		return 0;
+#endif	// A3_OPEN_SOURCE
+
+	case a3mathBenchmark_random:
+		// the seed is shared, so put the caller's back
+		seed = a3randomSetSeed(1);
+		for (i = 0; i < elementCount; ++i)
+			sum += a3randomNormalized() + a3randomRange(-a3real_one, a3real_one);
+		a3randomSetSeed(seed);
+		*sum_inout = sum;
+		return (elementCount * 2);
+
+	case a3mathBenchmark_randomStream:
+		// the same draws as above, filled into arrays
+#ifdef A3_OPEN_SOURCE
+		a3randomStreamInit(stream, 1);
+		a3randomStreamFillNormalized(data, stream, elementCount);
+		a3randomStreamFillRange(data + elementCount, stream, elementCount, -a3real_one, a3real_one);
+		*sum_inout = sum + data[elementCount - 1] + data[elementCount * 2 - 1];
+		return (elementCount * 2);
+#else	// !A3_OPEN_SOURCE
+		return 0;
+#endif	// A3_OPEN_SOURCE
+
+	case a3mathBenchmark_interpolation:
+		for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+		{
+			const a3real t = a3absolute(element[20]);
+			sum += a3lerpFunc(element[16], element[17], t);
+			sum += a3CatmullRom(element[16], element[17], element[18], element[19], t);
+			sum += a3HermiteTangent(element[16], element[17], element[18], element[19], t);
+			sum += a3Bezier3(element[16], element[17], element[18], element[19], t);
+		}
+		*sum_inout = sum;
+		return (elementCount * 4);
+
+	case a3mathBenchmark_vector:
+		for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+		{
+			v = (a3vec4 *)(element + 16);
+			a3real4Lerp(v[2].v, v[0].v, v[1].v, a3real_half);
+			a3real4GetUnit(v[3].v, v[2].v);
+			a3real4Add(v[3].v, v[0].v);
+			sum += a3real4Dot(v[3].v, v[1].v);
+		}
+		*sum_inout = sum;
+		return (elementCount * 4);
+
+	case a3mathBenchmark_matrix:
+		for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+		{
+			m = (a3mat4 *)element;
+			a3real4x4Product(m[1].m, m[0].m, m[0].m);
+			a3real4x4GetInverse(m[2].m, m[1].m);
+			a3real4x4TransformInverseIgnoreScale(m[1].m, m[0].m);
+			a3real4Real4x4ProductR(m[2].v3.v, m[0].m, m[1].v0.v);
+			sum += m[2].m00 + m[2].m32;
+		}
+		*sum_inout = sum;
+		return (elementCount * 4);
+
+	case a3mathBenchmark_matrixArray:
+		// the same work as above, one call per step over the whole array; 
+		//	the buffer holds three matrices per element, the first third is 
+		//	input and the rest is output
+#ifdef A3_OPEN_SOURCE
+		m = (a3mat4 *)data;
+		a3real4x4ProductArray(&m[elementCount].m, &m->m, &m->m, elementCount);
+		a3real4x4TransformInverseArray(&m[elementCount * 2].m, &m[elementCount].m, elementCount);
+		a3real4x4TransformInverseArray(&m[elementCount].m, &m->m, elementCount);
+		a3real4x4ProductArrayUniformR(&m[elementCount * 2].m, &m[elementCount].m, m->m, elementCount);
+		*sum_inout = sum + m[elementCount * 3 - 1].m00 + m[elementCount * 3 - 1].m32;
+		return (elementCount * 4);
+#else	// !A3_OPEN_SOURCE
+		return 0;
+#endif	// A3_OPEN_SOURCE
+
+	case a3mathBenchmark_quaternion:
+		for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+		{
+			Q = (a3dualquat *)(element + 32);
+			v = (a3vec4 *)(element + 16);
+			a3quatProduct(v[0].v, Q[0].r.q, Q[1].r.q);
+			a3quatSlerpUnit(v[1].v, Q[0].r.q, Q[1].r.q, a3real_third);
+			a3quatVec3GetRotatedIgnoreScale(v[2].v, Q[0].d.q, v[1].v);
+			sum += v[0].w + v[2].x;
+		}
+		*sum_inout = sum;
+		return (elementCount * 3);
+
+	case a3mathBenchmark_quaternionArray:
+		// blend whole arrays as a pose would be, with per-element parameters; 
+		//	the uniform slerp feeds its output back in as the next goal
+#ifdef A3_OPEN_SOURCE
+		Q = (a3dualquat *)data;
+		q = (a3quat *)(Q + elementCount * 3);
+		a3quatSlerpUnitArrayParams(&q[elementCount * 2].q, &q->q, &q[elementCount].q, (a3real *)(q + elementCount * 3), elementCount);
+		a3quatSlerpUnitFastArrayParams(&q[elementCount * 2].q, &q->q, &q[elementCount].q, (a3real *)(q + elementCount * 3), elementCount);
+		a3quatSlerpUnitFastArray(&q[elementCount].q, &q->q, &q[elementCount * 2].q, a3real_third, elementCount);
+		a3dualquatDLBArrayParams(&Q[elementCount * 2].Q, &Q->Q, &Q[elementCount].Q, (a3real *)(q + elementCount * 3), elementCount);
+		*sum_inout = sum + q[elementCount * 2 - 1].w + Q[elementCount * 3 - 1].dw;
+		return (elementCount * 4);
+#else	// !A3_OPEN_SOURCE
+		return 0;
+#endif	// A3_OPEN_SOURCE
+
+	case a3mathBenchmark_dualquaternion:
+		for (i = 0, element = data; i < elementCount; ++i, element += A3_MATHBENCHMARK_STRIDE)
+		{
+			Q = (a3dualquat *)(element + 32);
+			v = (a3vec4 *)(element + 16);
+			a3dualquatProduct(Q[1].Q, Q[0].Q, Q[0].Q);
+			a3dualquatVec3GetTransformedIgnoreScale(v[0].v, v[1].v, Q[1].Q);
+			a3dualquatDLB2(Q[1].Q, Q[0].Q, Q[1].Q);
+			sum += v[0].x + Q[1].dw;
+		}
+		*sum_inout = sum;
+		return (elementCount * 3);
+
+	default:
+		break;
+	}
+	return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// get family name
+a3byte const *a3mathBenchmarkGetName(const a3_MathBenchmarkFamily family)
+{
+	if (family >= 0 && family < a3mathBenchmark_familyCount)
+		return a3mathBenchmarkInternalName[family];
+	return 0;
+}
+
+// run one family
+a3i32 a3mathBenchmarkRun(a3_MathBenchmarkResult *result_out, const a3_MathBenchmarkFamily family, const a3ui32 elementCount, const a3ui32 passCount)
+{
+	if (result_out && family >= 0 && family < a3mathBenchmark_familyCount && elementCount && passCount)
+	{
+		// the table family times its own table; the polynomial family runs 
+		//	without one built from source, the prebuilt library always needs one
+#ifdef A3_OPEN_SOURCE
+		const a3boolean useTable = (family == a3mathBenchmark_trigTable);
+#else	// !A3_OPEN_SOURCE
+		const a3boolean useTable = (family == a3mathBenchmark_trigTable || family == a3mathBenchmark_trig);
+#endif	// A3_OPEN_SOURCE
+		const a3ui32 count = elementCount * A3_MATHBENCHMARK_STRIDE;
+		a3real *data = (a3real *)malloc(sizeof(a3real) * count), *table = 0;
+		a3_Timer timer[1] = { 0 };
+		a3real sum = a3real_zero;
+		a3ui32 calls = 0, k;
+
+		if (!data)
+			return -1;
+		a3mathBenchmarkInternalFill(data, count);
+		if (!a3mathBenchmarkInternalPrepareArrays(data, family, elementCount))
+			a3mathBenchmarkInternalPrepare(data, elementCount);
+		if (useTable)
+		{
+			table = (a3real *)malloc(sizeof(a3real) * a3trigInitSamplesRequired(A3_MATHBENCHMARK_TRIGSAMPLES));
+			if (!table)
+			{
+				free(data);
+				return -1;
+			}
+			a3trigInit(A3_MATHBENCHMARK_TRIGSAMPLES, table);
+		}
+		else if (family == a3mathBenchmark_trig)
+			a3trigFree();
+
+		a3timerSet(timer, 0.0);
+		a3timerStart(timer);
+		for (k = 0; k < passCount; ++k)
+			calls += a3mathBenchmarkInternalPass(&sum, family, data, elementCount);
+		a3timerUpdate(timer);
+		if (table)
+		{
+			a3trigFree();
+			free(table);
+		}
+		free(data);
+
+		result_out->name = a3mathBenchmarkInternalName[family];
+		result_out->rate = timer->totalTime > 0.0 ? (a3f64)calls / timer->totalTime : 0.0;
+		result_out->checksum = sum;
+		result_out->callCount = calls;
+		return calls;
+	}
+	return -1;
+}
+
+// run all families
+a3i32 a3mathBenchmarkRunAll(a3_MathBenchmarkResult result_out[a3mathBenchmark_familyCount], const a3ui32 elementCount, const a3ui32 passCount)
+{
+	if (result_out && elementCount && passCount)
+	{
+		a3i32 family;
+		for (family = 0; family < a3mathBenchmark_familyCount; ++family)
+			if (a3mathBenchmarkRun(result_out + family, (a3_MathBenchmarkFamily)family, elementCount, passCount) < 0)
+				return -1;
+		return family;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,178 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_NameIndex.c
+	Implementation of hashed name lookup.
+*/
+
+#include "../a3_NameIndex.h"
+
+#include "animal3D/a3utility/a3_Timer.h"
+
+#include <stdlib.h>
+
+
+// marker for records that are not linked into any chain
+#define A3_NAMEINDEX_UNLINKED	(-2)
+
+
+//-----------------------------------------------------------------------------
+
+// internal: name of record
+inline const a3byte* a3nameIndexInternalName(const a3_NameIndex* nameIndex, const a3ui32 recordIndex)
+{
+	return (nameIndex->nameBase + (a3ui64)nameIndex->nameStride * recordIndex);
+}
+
+// internal: remove record from its chain
+inline void a3nameIndexInternalUnlink(const a3_NameIndex* nameIndex, const a3ui32 recordIndex)
+{
+	a3i32* link;
+	if (nameIndex->next[recordIndex] != A3_NAMEINDEX_UNLINKED)
+	{
+		for (link = nameIndex->head + (nameIndex->hash[recordIndex] & nameIndex->bucketMask);
+			*link != (a3i32)recordIndex; link = nameIndex->next + *link);
+		*link = nameIndex->next[recordIndex];
+		nameIndex->next[recordIndex] = A3_NAMEINDEX_UNLINKED;
+	}
+}
+
+// internal: add record to front of its chain if it has a name
+inline void a3nameIndexInternalLink(const a3_NameIndex* nameIndex, const a3ui32 recordIndex)
+{
+	const a3byte* name = a3nameIndexInternalName(nameIndex, recordIndex);
+	a3i32* head;
+	if (*name)
+	{
+		nameIndex->hash[recordIndex] = a3nameIndexHash(name);
+		head = nameIndex->head + (nameIndex->hash[recordIndex] & nameIndex->bucketMask);
+		nameIndex->next[recordIndex] = *head;
+		*head = recordIndex;
+	}
+}
+
+
+// create index
+a3i32 a3nameIndexCreate(a3_NameIndex* nameIndex_out, const a3byte* nameBase, const a3ui32 nameStride, const a3ui32 count)
+{
+	if (nameIndex_out && !nameIndex_out->head && nameBase && nameStride >= a3nameIndex_nameSize && count)
+	{
+		// at least twice as many buckets as records keeps chains short
+		a3ui32 bucketCount = 4, i;
+		while (bucketCount < count * 2)
+			bucketCount <<= 1;
+
+		// one block: heads, links, hashes
+		nameIndex_out->head = (a3i32*)malloc((sizeof(a3i32) * 2 + sizeof(a3ui32)) * count + sizeof(a3i32) * bucketCount);
+		if (!nameIndex_out->head)
+			return -1;
+		nameIndex_out->next = nameIndex_out->head + bucketCount;
+		nameIndex_out->hash = (a3ui32*)(nameIndex_out->next + count);
+		nameIndex_out->nameBase = nameBase;
+		nameIndex_out->nameStride = nameStride;
+		nameIndex_out->count = count;
+		nameIndex_out->bucketMask = bucketCount - 1;
+
+		// link in reverse so that the first of any duplicate names is found
+		for (i = 0; i < bucketCount; ++i)
+			nameIndex_out->head[i] = -1;
+		for (i = 0; i < count; ++i)
+			nameIndex_out->next[i] = A3_NAMEINDEX_UNLINKED;
+		for (i = count; i > 0; --i)
+			a3nameIndexInternalLink(nameIndex_out, i - 1);
+		return count;
+	}
+	return -1;
+}
+
+// release index
+a3i32 a3nameIndexRelease(a3_NameIndex* nameIndex)
+{
+	if (nameIndex && nameIndex->head)
+	{
+		free(nameIndex->head);
+		memset(nameIndex, 0, sizeof(a3_NameIndex));
+		return 1;
+	}
+	return -1;
+}
+
+// re-index record
+a3i32 a3nameIndexUpdate(const a3_NameIndex* nameIndex, const a3ui32 recordIndex)
+{
+	if (nameIndex && nameIndex->head && recordIndex < nameIndex->count)
+	{
+		a3nameIndexInternalUnlink(nameIndex, recordIndex);
+		a3nameIndexInternalLink(nameIndex, recordIndex);
+		return recordIndex;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// measure lookup rates
+a3i32 a3nameIndexBenchmark(a3f64* linearRate_out, a3f64* hashedRate_out, const a3byte* nameBase, const a3ui32 nameStride, const a3ui32 count, const a3ui32 passCount)
+{
+	if (linearRate_out && hashedRate_out && nameBase && nameStride >= a3nameIndex_nameSize && count && passCount)
+	{
+		const a3f64 total = (a3f64)count * (a3f64)passCount;
+		a3_NameIndex nameIndex[1] = { 0 };
+		a3_Timer timer[1] = { 0 };
+		a3ui32 i, j, k, found = 0;
+
+		// linear: every lookup scans from the first record; empty names are 
+		//	not indexed so both paths skip them
+		a3timerSet(timer, 0.0);
+		a3timerStart(timer);
+		for (j = 0; j < passCount; ++j)
+			for (i = 0; i < count; ++i)
+				for (k = 0; k < count && nameBase[(a3ui64)nameStride * i]; ++k)
+					if (!strncmp(nameBase + (a3ui64)nameStride * k, nameBase + (a3ui64)nameStride * i, a3nameIndex_nameSize))
+					{
+						found += k;
+						break;
+					}
+		a3timerUpdate(timer);
+		*linearRate_out = timer->totalTime > 0.0 ? total / timer->totalTime : 0.0;
+
+		// hashed: build index as a load would, then resolve every name
+		a3timerSet(timer, 0.0);
+		a3timerStart(timer);
+		for (j = 0; j < passCount; ++j)
+		{
+			a3nameIndexCreate(nameIndex, nameBase, nameStride, count);
+			for (i = 0; i < count; ++i)
+				if (nameBase[(a3ui64)nameStride * i])
+					found -= a3nameIndexFind(nameIndex, nameBase + (a3ui64)nameStride * i);
+			a3nameIndexRelease(nameIndex);
+		}
+		a3timerUpdate(timer);
+		*hashedRate_out = timer->totalTime > 0.0 ? total / timer->totalTime : 0.0;
+
+		// both paths must agree on every index
+		return (found == 0 ? (a3i32)count : -1);
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
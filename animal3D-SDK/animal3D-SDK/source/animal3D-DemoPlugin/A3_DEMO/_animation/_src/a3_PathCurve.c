@@ -0,0 +1,139 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_PathCurve.c
+	Implementation of path curve.
+*/
+
+#include "../a3_PathCurve.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------
+
+// create path
+a3i32 a3pathCurveCreate(a3_PathCurve *curve_out, const a3vec3 *pointArray, const a3ui32 pointCount, const a3ui32 samplesPerSegment, const a3boolean closed)
+{
+	if (curve_out && !curve_out->point && pointArray && pointCount >= (closed ? 3u : 2u) && samplesPerSegment)
+	{
+		const a3ui32 segmentCount = closed ? pointCount : pointCount - 1;
+		const a3ui32 sampleCount = segmentCount * samplesPerSegment + 1;
+		const a3ui32 lookupCount = sampleCount - 1;
+		const size_t dataSize = sizeof(a3vec3) * (pointCount + sampleCount) + sizeof(a3real) * sampleCount * 2 + sizeof(a3ui32) * (lookupCount + 1);
+		const a3vec3 *pPrev, *p0, *p1, *pNext;
+		a3vec3 derivative;
+		a3real length = a3real_zero, target, speedSq;
+		a3ui32 i, j, s;
+
+		curve_out->point = (a3vec3 *)malloc(dataSize);
+		if (!curve_out->point)
+			return -1;
+		curve_out->sample = curve_out->point + pointCount;
+		curve_out->sampleLength = (a3real *)(curve_out->sample + sampleCount);
+		curve_out->sampleRate = curve_out->sampleLength + sampleCount;
+		curve_out->lookup = (a3ui32 *)(curve_out->sampleRate + sampleCount);
+		for (i = 0; i < pointCount; ++i)
+			curve_out->point[i] = pointArray[i];
+
+		// sample each segment; a segment's first sample overwrites the last 
+		//	of the one before (the same point), then its lengths are offset
+		for (s = 0; s < segmentCount; ++s)
+		{
+			p0 = curve_out->point + s;
+			if (closed)
+			{
+				pPrev = s ? p0 - 1 : curve_out->point + pointCount - 1;
+				p1 = s + 1 < pointCount ? p0 + 1 : curve_out->point;
+				pNext = s + 2 < pointCount ? p0 + 2 : curve_out->point + (s + 2 - pointCount);
+			}
+			else
+			{
+				pPrev = s ? p0 - 1 : p0;
+				p1 = p0 + 1;
+				pNext = s + 2 < pointCount ? p0 + 2 : p1;
+			}
+			j = s * samplesPerSegment;
+			a3real3CalculateArcLengthCatmullRom(&curve_out->sample[j].v, 0, curve_out->sampleLength + j, a3false, samplesPerSegment, pPrev->v, p0->v, p1->v, pNext->v);
+			for (i = 0; i <= samplesPerSegment; ++i)
+			{
+				// sample index advances samplesPerSegment per unit of 
+				//	parameter, so its rate is that over the speed
+				curve_out->sampleLength[j + i] += length;
+				a3pathCurveInternalDerivative(&derivative, pPrev, p0, p1, pNext, (a3real)i / (a3real)samplesPerSegment);
+				speedSq = a3real3LengthSquared(derivative.v);
+				curve_out->sampleRate[j + i] = speedSq > a3real_zero ? (a3real)samplesPerSegment * a3sqrtInverse(speedSq) : a3real_zero;
+			}
+			length = curve_out->sampleLength[j + samplesPerSegment];
+		}
+
+		// lookup entry k holds the last interval starting at or before 
+		//	distance k * length / lookupCount
+		for (i = j = 0; i <= lookupCount; ++i)
+		{
+			target = length * (a3real)i / (a3real)lookupCount;
+			while (j + 1 < lookupCount && curve_out->sampleLength[j + 1] <= target)
+				++j;
+			curve_out->lookup[i] = j;
+		}
+
+		curve_out->length = length;
+		curve_out->lengthInv = length > a3real_zero ? a3recip(length) : a3real_zero;
+		curve_out->lookupScale = length > a3real_zero ? (a3real)lookupCount / length : a3real_zero;
+		curve_out->samplesPerSegmentInv = a3recip((a3real)samplesPerSegment);
+		curve_out->pointCount = pointCount;
+		curve_out->segmentCount = segmentCount;
+		curve_out->sampleCount = sampleCount;
+		curve_out->samplesPerSegment = samplesPerSegment;
+		curve_out->lookupCount = lookupCount;
+		curve_out->closed = closed;
+		return sampleCount;
+	}
+	return -1;
+}
+
+// release path
+a3i32 a3pathCurveRelease(a3_PathCurve *curve)
+{
+	if (curve && curve->point)
+	{
+		free(curve->point);
+		memset(curve, 0, sizeof(a3_PathCurve));
+		return 1;
+	}
+	return -1;
+}
+
+// evaluate many agents
+a3i32 a3pathCurveSampleArray(const a3_PathCurve *curve, a3vec3 *positionArray_out, a3vec3 *tangentArray_out, const a3real *distanceArray, const a3ui32 count)
+{
+	if (curve && curve->point && distanceArray)
+	{
+		a3ui32 i;
+		for (i = 0; i < count; ++i)
+			a3pathCurveInternalEvaluate(curve, positionArray_out ? positionArray_out + i : 0, tangentArray_out ? tangentArray_out + i : 0, a3pathCurveInternalGetParam(curve, distanceArray[i]));
+		return count;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,182 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_PosePipeline.c
+	Implementation of pose pipeline.
+*/
+
+#include "../a3_PosePipeline.h"
+
+#include "animal3D/a3utility/a3_Timer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+// batches per worker in benchmark, so that early finishers can steal
+#define A3_POSEPIPELINE_BATCHPERWORKER	4
+
+
+//-----------------------------------------------------------------------------
+
+// internal: job running one batch of characters
+a3ret a3posePipelineInternalRunBatch(void *args)
+{
+	const a3_PosePipelineBatch *const batch = (const a3_PosePipelineBatch *)args;
+	a3ui32 i;
+	for (i = 0; i < batch->count; ++i)
+		a3posePipelineUpdateCharacter(batch->pipeline, batch->first + i);
+	return (a3ret)batch->count;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// create pipeline
+a3i32 a3posePipelineCreate(a3_PosePipeline *pipeline_out, a3_JobSystem *jobSystem, const a3_ClipControllerSet *ctrlSet, const a3_HierarchyState *hierarchyStateArray, const a3_HierarchyTransform *objectSpaceBindInverse, const a3ui32 characterCount, const a3ui32 batchSize, const a3boolean usingScale)
+{
+	if (pipeline_out && !pipeline_out->batch && jobSystem && ctrlSet && hierarchyStateArray && objectSpaceBindInverse && 
+		characterCount && characterCount <= ctrlSet->count && batchSize)
+	{
+		const a3ui32 batchCount = (characterCount + batchSize - 1) / batchSize;
+		a3ui32 i;
+		pipeline_out->batch = (a3_PosePipelineBatch *)malloc(sizeof(a3_PosePipelineBatch) * batchCount);
+		if (!pipeline_out->batch)
+			return -1;
+		for (i = 0; i < batchCount; ++i)
+		{
+			pipeline_out->batch[i].pipeline = pipeline_out;
+			pipeline_out->batch[i].first = i * batchSize;
+			pipeline_out->batch[i].count = (i + 1 < batchCount) ? batchSize : (characterCount - i * batchSize);
+		}
+		pipeline_out->jobSystem = jobSystem;
+		pipeline_out->ctrlSet = ctrlSet;
+		pipeline_out->hierarchyState = hierarchyStateArray;
+		pipeline_out->objectSpaceBindInverse = objectSpaceBindInverse;
+		pipeline_out->characterCount = characterCount;
+		pipeline_out->batchCount = batchCount;
+		pipeline_out->usingScale = usingScale;
+		a3jobCounterReset(pipeline_out->counter);
+		return batchCount;
+	}
+	return -1;
+}
+
+// release pipeline
+a3i32 a3posePipelineRelease(a3_PosePipeline *pipeline)
+{
+	if (pipeline && pipeline->batch)
+	{
+		free(pipeline->batch);
+		memset(pipeline, 0, sizeof(a3_PosePipeline));
+		return 1;
+	}
+	return -1;
+}
+
+// run all stages for all characters
+a3i32 a3posePipelineUpdate(a3_PosePipeline *pipeline)
+{
+	if (pipeline && pipeline->batch)
+	{
+		a3ui32 i;
+		for (i = 0; i < pipeline->batchCount; ++i)
+			a3jobSystemSubmit(pipeline->jobSystem, a3posePipelineInternalRunBatch, pipeline->batch + i, pipeline->counter);
+		a3jobSystemWait(pipeline->jobSystem, pipeline->counter);
+		return pipeline->characterCount;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// measure characters updated per second at several worker counts
+a3i32 a3posePipelineBenchmark(a3f64 characterRate_out[a3posePipeline_benchmarkCount], const a3_HierarchyPoseGroup *poseGroup, const a3_ClipPool *clipPool, const a3ui32 characterCount, const a3ui32 frameCount, const a3real dt)
+{
+	if (characterRate_out && poseGroup && poseGroup->hpose && clipPool && clipPool->count && characterCount && frameCount)
+	{
+		const a3ui32 workerCount[a3posePipeline_benchmarkCount] = { 1, 2, 4, 8 };
+		const a3f64 total = (a3f64)characterCount * (a3f64)frameCount;
+		a3_HierarchyState *const state = (a3_HierarchyState *)calloc(characterCount + 1, sizeof(a3_HierarchyState));
+		a3_HierarchyState *const bindState = state + characterCount;
+		a3_ClipControllerSet ctrlSet[1] = { 0 };
+		a3_Timer timer[1] = { 0 };
+		a3ui32 i, j, k, created;
+		a3i32 ret = -1;
+
+		if (!state)
+			return -1;
+
+		// bind pose is the base pose; one state per character plus bind
+		for (created = 0; created <= characterCount; ++created)
+			if (a3hierarchyStateCreate(state + created, poseGroup) < 0)
+				break;
+
+		if (created > characterCount && a3clipControllerSetCreate(ctrlSet, clipPool, characterCount) >= 0)
+		{
+			a3kinematicsSolveForward(bindState);
+			a3hierarchyStateUpdateObjectInverse(bindState, a3true);
+
+			for (k = 0, ret = characterCount; k < a3posePipeline_benchmarkCount && ret >= 0; ++k)
+			{
+				a3_JobSystem jobSystem[1] = { 0 };
+				a3_PosePipeline pipeline[1] = { 0 };
+				const a3ui32 batchCount = workerCount[k] * A3_POSEPIPELINE_BATCHPERWORKER;
+				const a3ui32 batchSize = (characterCount + batchCount - 1) / batchCount;
+
+				// same start for every run
+				for (i = 0; i < characterCount; ++i)
+					a3clipControllerSetInit(ctrlSet, i, i % clipPool->count, 0.0f, +1.0f);
+
+				characterRate_out[k] = 0.0;
+				if (a3jobSystemCreate(jobSystem, workerCount[k], batchCount) < 0)
+					ret = -1;
+				else if (a3posePipelineCreate(pipeline, jobSystem, ctrlSet, state, bindState->objectSpaceInverse, characterCount, batchSize, a3true) < 0)
+					ret = -1;
+				else
+				{
+					a3timerSet(timer, 0.0);
+					a3timerStart(timer);
+					for (j = 0; j < frameCount; ++j)
+					{
+						a3clipControllerSetUpdate(ctrlSet, dt);
+						a3posePipelineUpdate(pipeline);
+					}
+					a3timerUpdate(timer);
+					characterRate_out[k] = timer->totalTime > 0.0 ? total / timer->totalTime : 0.0;
+					a3posePipelineRelease(pipeline);
+				}
+				a3jobSystemRelease(jobSystem);
+			}
+			a3clipControllerSetRelease(ctrlSet);
+		}
+
+		for (i = 0; i < created && i <= characterCount; ++i)
+			a3hierarchyStateRelease(state + i);
+		free(state);
+		return ret;
+	}
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------
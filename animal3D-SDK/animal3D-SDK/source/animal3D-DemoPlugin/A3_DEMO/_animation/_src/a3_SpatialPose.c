@@ -27,6 +27,73 @@
 
 //-----------------------------------------------------------------------------
 
+// reset array of poses to identity
+a3i32 a3spatialPoseResetArray(a3_SpatialPose* spatialPose_out, const a3ui32 count)
+{
+	if (spatialPose_out && count)
+	{
+		a3ui32 i;
+		a3spatialPoseReset(spatialPose_out);
+		for (i = 1; i < count; ++i)
+			spatialPose_out[i] = *spatialPose_out;
+		return count;
+	}
+	return -1;
+}
+
+// rebuild transforms of array of poses where dirty
+a3i32 a3spatialPoseConvertArray(a3_SpatialPose* spatialPose, const a3ui32 count)
+{
+	if (spatialPose)
+	{
+		a3i32 ret = 0;
+		a3ui32 i;
+		for (i = 0; i < count; ++i)
+			if (spatialPose[i].dirty)
+				ret += a3spatialPoseConvert(spatialPose + i);
+		return ret;
+	}
+	return -1;
+}
+
+// concatenate arrays of poses element-wise
+a3i32 a3spatialPoseConcatArray(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose_lhs, const a3_SpatialPose* spatialPose_rhs, const a3ui32 count)
+{
+	if (spatialPose_out && spatialPose_lhs && spatialPose_rhs)
+	{
+		a3ui32 i;
+		for (i = 0; i < count; ++i)
+			a3spatialPoseConcat(spatialPose_out + i, spatialPose_lhs + i, spatialPose_rhs + i);
+		return count;
+	}
+	return -1;
+}
+
+// interpolate arrays of poses element-wise
+a3i32 a3spatialPoseLerpArray(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose0, const a3_SpatialPose* spatialPose1, const a3real u, const a3ui32 count)
+{
+	if (spatialPose_out && spatialPose0 && spatialPose1)
+	{
+		a3ui32 i;
+
+		// endpoints need no arithmetic; the output's old channels and the 
+		//	copied ones are marked dirty since the source's flags describe 
+		//	the source, not what changed in the output
+		if (u == a3real_zero || u == a3real_one)
+		{
+			const a3_SpatialPose* const src = u == a3real_zero ? spatialPose0 : spatialPose1;
+			if (src != spatialPose_out)
+				for (i = 0; i < count; ++i)
+					a3spatialPoseCopy(spatialPose_out + i, src + i);
+			return count;
+		}
+
+		for (i = 0; i < count; ++i)
+			a3spatialPoseLerp(spatialPose_out + i, spatialPose0 + i, spatialPose1 + i, u);
+		return count;
+	}
+	return -1;
+}
 
 
 //-----------------------------------------------------------------------------
@@ -20,7 +20,8 @@
 	
 	a3_Hierarchy.h
 	Node tree structure forming a hierarchy. Nodes belonging to the same 
-		hierarchy know the index of their parent node, but not child nodes.
+		hierarchy know the index of their parent node, but not child nodes; 
+		child lists and other derived topology are cached separately.
 
 	**DO NOT MODIFY THIS FILE**
 */
@@ -32,6 +33,8 @@
 #include "animal3D/a3/a3types_integer.h"
 #include "animal3D/a3utility/a3_Stream.h"
 
+#include "a3_NameIndex.h"
+
 
 #ifdef __cplusplus
 extern "C"
@@ -39,6 +42,7 @@ extern "C"
 #else	// !__cplusplus
 typedef struct a3_Hierarchy				a3_Hierarchy;
 typedef struct a3_HierarchyNode			a3_HierarchyNode;
+typedef struct a3_HierarchyTopology		a3_HierarchyTopology;
 #endif	// __cplusplus
 
 
@@ -63,20 +67,54 @@ struct a3_HierarchyNode
 };
 
 
+// A3: Topology derived from parent indices, immutable once built.
+//	member childOffset, child: children of node i are child[childOffset[i]] 
+//		up to child[childOffset[i + 1]], in index order
+//	member depth: number of ancestors per node
+//	member order, orderNode: depth-first (pre-order) position per node and 
+//		node at each position; a subtree occupies consecutive positions
+//	member subtreeSize: number of nodes in each node's subtree, itself 
+//		included; b is in the subtree of a iff order[b] - order[a] is less 
+//		than subtreeSize[a]
+//	member subtreeEnd: last node index in each node's subtree
+//	member levelNode, levelParent: nodes sorted by depth, parent of each
+//	member levelOffset: first entry of each level, plus one past the last
+//	member levelCount: number of depth levels (zero if not built)
+struct a3_HierarchyTopology
+{
+	a3ui32 *childOffset, *child;
+	a3ui32 *depth;
+	a3ui32 *order, *orderNode;
+	a3ui32 *subtreeSize;
+	a3ui32 *subtreeEnd;
+	a3ui32 *levelNode;
+	a3i32 *levelParent;
+	a3ui32 *levelOffset;
+	a3ui32 levelCount;
+};
+
+
 // A3: Hierarchy node container, the hierarchy itself.
 //	member nodes: array of nodes (null if unused)
 //	member numNodes: maximum number of nodes in hierarchy (zero if unused)
+//	member nameIndex: hashed node name lookup, maintained by the functions 
+//		below; if absent, lookup falls back to a linear search
+//	member topology: derived topology, built once all nodes are set; if 
+//		absent, queries fall back to walking parent indices
 struct a3_Hierarchy
 {
 	a3_HierarchyNode *nodes;
 	a3ui32 numNodes;
+	a3_NameIndex nameIndex[1];
+	a3_HierarchyTopology topology[1];
 };
 
 
 //-----------------------------------------------------------------------------
 
 // A3: Allocate hierarchy with maximum node count, names optional.
-//	param hierarchy_out: non-null pointer to uninitialized hierarchy
+//	param hierarchy_out: non-null pointer to zero-initialized or released 
+//		hierarchy; one still holding nodes or topology is rejected
 //	param numNodes: non-zero node count to initialize
 //	param names_opt: optional pointer to a list of names to set immediately
 //	return: numNodes if success
@@ -93,6 +131,22 @@ a3ret a3hierarchyCreate(a3_Hierarchy *hierarchy_out, const a3ui32 numNodes, cons
 //	return: -1 if invalid params
 a3ret a3hierarchySetNode(const a3_Hierarchy *hierarchy, const a3ui32 index, const a3i32 parentIndex, const a3byte name[a3node_nameSize]);
 
+// A3: Build topology cache; call once after the last node is set (file and 
+//		stream loaders do this); setting nodes afterwards requires a rebuild.
+//	param hierarchy: non-null pointer to initialized hierarchy whose nodes 
+//		are all set
+//	return: number of depth levels if success
+//	return: -1 if invalid params or allocation failed
+a3ret a3hierarchyUpdateTopology(a3_Hierarchy *hierarchy);
+
+// A3: Get node's children from topology cache.
+//	param children_out: non-null pointer to receive address of child indices
+//	param hierarchy: non-null pointer to hierarchy with topology built
+//	param index: non-negative index of node in hierarchy
+//	return: number of children if success
+//	return: -1 if invalid params or topology not built
+a3ret a3hierarchyGetChildren(const a3ui32 **children_out, const a3_Hierarchy *hierarchy, const a3ui32 index);
+
 // A3: Get node index by name.
 //	param hierarchy: non-null pointer to initialized hierarchy
 //	param name: name to search for in hierarchy
@@ -129,11 +183,12 @@ a3ret a3hierarchyIsChildNode(const a3_Hierarchy *hierarchy, const a3ui32 childIn
 //	param hierarchy: non-null pointer to initialized hierarchy
 //	param siblingIndex: non-negative possible sibling node index
 //	param otherIndex: non-negative index of node to check for relationship
-//	return: boolean, 1 if the node is a parent of the other; 0 if not
+//	return: boolean, 1 if the node shares a parent with the other; 0 if not
 //	return: -1 if invalid params
 a3ret a3hierarchyIsSiblingNode(const a3_Hierarchy *hierarchy, const a3ui32 siblingIndex, const a3ui32 otherIndex);
 
-// A3: Check if a node is an ancestor of another.
+// A3: Check if a node is an ancestor of another (or the same node); 
+//		constant time with topology built, walks parents otherwise.
 //	param hierarchy: non-null pointer to initialized hierarchy
 //	param ancestorIndex: non-negative possible ancestor node index
 //	param otherIndex: non-negative index of node to check for relationship
@@ -158,7 +213,8 @@ a3ret a3hierarchyIsDescendantNode(const a3_Hierarchy *hierarchy, const a3ui32 de
 a3ret a3hierarchySaveBinary(const a3_Hierarchy *hierarchy, const a3_FileStream *fileStream);
 
 // A3: Load hierarchy from binary file.
-//	param hierarchy: non-null pointer to unused hierarchy
+//	param hierarchy: non-null pointer to zero-initialized or released 
+//		hierarchy; one still holding nodes or topology is rejected
 //	param fileStream: non-null pointer to file stream opened in read mode
 //	return: number of bytes read if success
 //	return: 0 if failed
@@ -174,7 +230,8 @@ a3ret a3hierarchyLoadBinary(a3_Hierarchy *hierarchy, const a3_FileStream *fileSt
 a3ret a3hierarchyCopyToString(const a3_Hierarchy *hierarchy, a3byte *str);
 
 // A3: Read hierarchy from string.
-//	param hierarchy: non-null pointer to unused hierarchy
+//	param hierarchy: non-null pointer to zero-initialized or released 
+//		hierarchy; one still holding nodes or topology is rejected
 //	param str: non-null byte array to stream from
 //	return: number of bytes copied if success
 //	return: 0 if failed
@@ -64,19 +64,70 @@ struct a3_HierarchyTransform
 
 
 // pose group
+//	node poses of all key poses share one 16-byte aligned allocation
 struct a3_HierarchyPoseGroup
 {
 	// pointer to hierarchy
 	const a3_Hierarchy *hierarchy;
+
+	// hierarchy poses, one per key pose, each referencing its node poses
+	a3_HierarchyPose *hpose;
+
+	// contiguous spatial poses for all key poses and nodes, ordered by 
+	//	pose then node (poseIndex * numNodes + nodeIndex)
+	a3_SpatialPose *spatialPosePool;
+
+	// number of key poses
+	a3ui32 poseCount;
 };
 
 
 // hierarchy state structure, with a pointer to the source pose group 
 //	and transformations for kinematics
+//	all buffers share one 16-byte aligned allocation and are indexed by node
 struct a3_HierarchyState
 {
 	// pointer to pose set that the poses come from
 	const a3_HierarchyPoseGroup *poseGroup;
+
+	// current pose sampled or blended from the pose group
+	a3_HierarchyPose samplePose[1];
+
+	// local-space (relative to parent) transforms
+	a3_HierarchyTransform localSpace[1];
+
+	// object-space (relative to root's parent) transforms
+	a3_HierarchyTransform objectSpace[1];
+
+	// inverse object-space transforms
+	a3_HierarchyTransform objectSpaceInverse[1];
+
+	// object-space transforms relative to bind pose (skinning matrices)
+	a3_HierarchyTransform objectSpaceBindToCurrent[1];
+
+	// inverse kinematics scratch: inverted parent transforms, kept apart so 
+	//	the inverse object-space transforms only change on an update
+	a3_HierarchyTransform parentInverse[1];
+
+	// nodes sorted by depth, and the parent of each; nodes in one level do 
+	//	not depend on each other, so kinematics can solve a level as a batch
+	//	(these and the subtree extents are shared from the hierarchy topology)
+	const a3ui32 *levelNode;
+	const a3i32 *levelParent;
+
+	// first entry of each level in the above, plus one past the last level
+	const a3ui32 *levelOffset;
+
+	// number of depth levels
+	a3ui32 levelCount;
+
+	// last node index in each node's subtree; every descendant of node i 
+	//	lies in [i, subtreeEnd[i]], though not every node in that range is one
+	const a3ui32 *subtreeEnd;
+
+	// one bit per node (32 per word) whose local-space transform changed 
+	//	since its object-space transform was last solved
+	a3ui32 *dirty;
 };
 	
 
@@ -94,21 +145,59 @@ a3i32 a3hierarchyPoseGroupGetPoseOffsetIndex(const a3_HierarchyPoseGroup *poseGr
 // get offset to single node pose in contiguous set
 a3i32 a3hierarchyPoseGroupGetNodePoseOffsetIndex(const a3_HierarchyPoseGroup *poseGroup, const a3ui32 poseIndex, const a3ui32 nodeIndex);
 
+// load hierarchy and pose group from Motion Analysis HTR file in a single 
+//	streaming pass; pose 0 is the base pose and pose (f + 1) holds frame f 
+//	relative to the base pose
+//	returns number of poses if success, 0 if failed, -1 if invalid params
+a3i32 a3hierarchyPoseGroupLoadHTR(a3_HierarchyPoseGroup *poseGroup_out, a3_Hierarchy *hierarchy_out, const a3byte *resourceFilePath);
+
+// save pose group to binary file; save its hierarchy first for a snapshot
+//	returns number of bytes written if success, -1 if invalid params
+a3i32 a3hierarchyPoseGroupSaveBinary(const a3_HierarchyPoseGroup *poseGroup, const a3_FileStream *fileStream);
+
+// load pose group for hierarchy from binary file with a single read
+//	returns number of bytes read if success, 0 if failed, -1 if invalid params
+a3i32 a3hierarchyPoseGroupLoadBinary(a3_HierarchyPoseGroup *poseGroup_out, const a3_Hierarchy *hierarchy, const a3_FileStream *fileStream);
+
 
 //-----------------------------------------------------------------------------
 
-// initialize hierarchy state given an initialized hierarchy
+// initialize hierarchy state given an initialized hierarchy whose topology 
+//	is built (see a3hierarchyUpdateTopology)
 a3i32 a3hierarchyStateCreate(a3_HierarchyState *state_out, const a3_HierarchyPoseGroup *poseGroup);
 
 // release hierarchy state
 a3i32 a3hierarchyStateRelease(a3_HierarchyState *state);
 
-// update inverse object-space matrices
+// update local-space matrices of sample poses that changed since the last 
+//	update, marking those nodes dirty
+//	returns number of nodes updated if success, -1 if invalid params
+a3i32 a3hierarchyStateUpdateLocalSpace(const a3_HierarchyState *state);
+
+// mark node dirty after changing its local-space transform directly
+a3i32 a3hierarchyStateSetDirty(const a3_HierarchyState *state, const a3ui32 nodeIndex);
+
+// mark all nodes dirty
+a3i32 a3hierarchyStateSetDirtyAll(const a3_HierarchyState *state);
+
+// check if node is dirty
+a3boolean a3hierarchyStateIsDirty(const a3_HierarchyState *state, const a3ui32 nodeIndex);
+
+// update inverse object-space matrices; without scale, transforms are 
+//	taken to be rigid and inverted by transposing the rotation, otherwise 
+//	the full affine inverse is used
+//	returns number of nodes updated if success, -1 if invalid params
 a3i32 a3hierarchyStateUpdateObjectInverse(const a3_HierarchyState *state, const a3boolean usingScale);
 
 // update bind-to-current given bind-pose object-space transforms
+//	returns number of nodes updated if success, -1 if invalid params
 a3i32 a3hierarchyStateUpdateObjectBindToCurrent(const a3_HierarchyState *state, const a3_HierarchyTransform *objectSpaceBindInverse);
 
+// update inverse object-space and bind-to-current matrices together; both 
+//	are batched over the whole node array
+//	returns number of nodes updated if success, -1 if invalid params
+a3i32 a3hierarchyStateUpdateObjectInverseBindToCurrent(const a3_HierarchyState *state, const a3_HierarchyTransform *objectSpaceBindInverse, const a3boolean usingScale);
+
 
 //-----------------------------------------------------------------------------
 
@@ -35,12 +35,218 @@
 extern "C"
 {
 #else	// !__cplusplus
-
+typedef struct a3_HierarchyMask			a3_HierarchyMask;
+typedef enum a3_HierarchyBlendOp		a3_HierarchyBlendOp;
+typedef struct a3_HierarchyBlendNode	a3_HierarchyBlendNode;
+typedef struct a3_HierarchyBlendTree	a3_HierarchyBlendTree;
 #endif	// __cplusplus
 	
 
 //-----------------------------------------------------------------------------
 
+// constant values
+enum
+{
+	a3hierarchyBlend_inputMax = 8,
+};
+
+
+// named set of nodes for layering (e.g. everything under the spine)
+//	stored both as a bitset for membership and as sorted runs of 
+//	consecutive node indices, so masked operations touch only the nodes 
+//	in the mask; since parents precede children, subtrees form few runs
+struct a3_HierarchyMask
+{
+	// mask name
+	a3byte name[a3node_nameSize];
+
+	// hierarchy the mask indexes
+	const a3_Hierarchy *hierarchy;
+
+	// one bit per node (32 per word), followed by as many scratch words
+	a3ui32 *bits;
+
+	// runs of nodes as (first, one past last) pairs
+	a3ui32 *range;
+
+	// number of runs and of nodes in mask
+	a3ui32 rangeCount, count;
+};
+
+
+// operation performed by blend tree node; inputs and params per op:
+enum a3_HierarchyBlendOp
+{
+	a3hierarchyBlend_source,		// leaf: external pose, no copy
+	a3hierarchyBlend_identity,		// leaf: identity pose
+	a3hierarchyBlend_lerp,			// 2 inputs, param 0 = u
+	a3hierarchyBlend_add,			// 2 inputs, input 1 scaled by param 0 then concatenated
+	a3hierarchyBlend_scale,			// 1 input scaled from identity by param 0
+	a3hierarchyBlend_concat,		// 2 inputs concatenated
+	a3hierarchyBlend_average,		// 1 to max inputs, param i = weight of input i
+	a3hierarchyBlend_bilinear,		// 4 inputs (u0v0, u1v0, u0v1, u1v1), params 0, 1 = u, v
+	a3hierarchyBlend_triangular,	// 3 inputs, params 0, 1 = barycentric weights of inputs 1, 2
+};
+
+
+// blend tree node
+//	params may be changed freely between evaluations; structure may only 
+//	change before compiling
+struct a3_HierarchyBlendNode
+{
+	// operation
+	a3_HierarchyBlendOp op;
+
+	// pose of source node
+	const a3_HierarchyPose *source;
+
+	// optional mask for lerp, add and scale: nodes outside it take input 0
+	const a3_HierarchyMask *mask;
+
+	// indices of input nodes in tree
+	a3ui32 input[a3hierarchyBlend_inputMax];
+	a3ui32 inputCount;
+
+	// operation parameters
+	a3real param[a3hierarchyBlend_inputMax];
+};
+
+
+// blend tree compiled to a flat post-order instruction list
+//	each evaluation first prunes inputs that cannot contribute given the 
+//	current params (e.g. lerp at 0 or 1, zero weights), touching only nodes; 
+//	then runs the surviving instructions, where sources and pass-through 
+//	nodes only forward pointers and the rest write into a stack-allocated 
+//	scratch arena sized for the worst case at compile time
+struct a3_HierarchyBlendTree
+{
+	// hierarchy whose node count sizes all poses
+	const a3_Hierarchy *hierarchy;
+
+	// nodes and root
+	a3_HierarchyBlendNode *node;
+	a3ui32 nodeCount, root;
+
+	// node indices in evaluation order
+	a3ui32 *instruction;
+	a3ui32 instructionCount;
+
+	// per node evaluation state: result poses, arena slot held (or -1), 
+	//	input forwarded (-1 to compute, -2 for identity, -3 if pruned) and 
+	//	weights of inputs (zero if pruned)
+	const a3_SpatialPose **result;
+	a3i32 *slot, *pass;
+	a3real *weight;
+
+	// scratch arena: identity pose followed by slot count poses
+	a3_SpatialPose *arena;
+	a3ui32 slotCount;
+
+	// single allocation backing node and evaluation arrays
+	void *data;
+};
+
+
+//-----------------------------------------------------------------------------
+
+// copy pose keeping output dirty flags valid; transforms are not copied
+//	returns node count if success, -1 if invalid params
+a3i32 a3hierarchyPoseCopy(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_in, const a3ui32 nodeCount);
+
+// interpolate poses node-wise (nlerp rotation, lerp scale/translation)
+//	returns node count if success, -1 if invalid params
+a3i32 a3hierarchyPoseLerp(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose0, const a3_HierarchyPose *pose1, const a3real u, const a3ui32 nodeCount);
+
+// concatenate poses node-wise
+//	returns node count if success, -1 if invalid params
+a3i32 a3hierarchyPoseConcat(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_lhs, const a3_HierarchyPose *pose_rhs, const a3ui32 nodeCount);
+
+// scale pose from identity: rotation nlerp, scale lerp from one, 
+//	translation multiplied; output may alias input
+//	returns node count if success, -1 if invalid params
+a3i32 a3hierarchyPoseScale(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_in, const a3real w, const a3ui32 nodeCount);
+
+// add scaled pose to base pose: base concatenated with scaled layer
+//	returns node count if success, -1 if invalid params
+a3i32 a3hierarchyPoseAdd(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_base, const a3_HierarchyPose *pose_layer, const a3real w, const a3ui32 nodeCount);
+
+// weighted average of poses with weights summing to one (rotations are 
+//	summed on the hemisphere of the heaviest and normalized)
+//	returns node count if success, -1 if invalid params
+a3i32 a3hierarchyPoseAverage(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_in, const a3real *weight, const a3ui32 poseCount, const a3ui32 nodeCount);
+
+// interpolate poses for nodes in mask only; nodes outside the mask are 
+//	left unchanged, so pass the first pose as output to layer in place
+//	returns number of nodes in mask if success, -1 if invalid params
+a3i32 a3hierarchyPoseLerpMasked(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose0, const a3_HierarchyPose *pose1, const a3real u, const a3_HierarchyMask *mask);
+
+// add scaled layer to base pose for nodes in mask only, as above
+//	returns number of nodes in mask if success, -1 if invalid params
+a3i32 a3hierarchyPoseAddMasked(const a3_HierarchyPose *pose_out, const a3_HierarchyPose *pose_base, const a3_HierarchyPose *pose_layer, const a3real w, const a3_HierarchyMask *mask);
+
+
+//-----------------------------------------------------------------------------
+
+// allocate empty mask for hierarchy
+//	returns node count of hierarchy if success, -1 if invalid params or failed
+a3i32 a3hierarchyMaskCreate(a3_HierarchyMask *mask_out, const a3_Hierarchy *hierarchy, const a3byte name[a3node_nameSize]);
+
+// release mask
+a3i32 a3hierarchyMaskRelease(a3_HierarchyMask *mask);
+
+// add node and all of its descendants to mask
+//	returns number of nodes in mask if success, -1 if invalid params
+a3i32 a3hierarchyMaskAddSubtree(a3_HierarchyMask *mask, const a3ui32 nodeIndex);
+
+// remove node and all of its descendants from mask
+//	returns number of nodes in mask if success, -1 if invalid params
+a3i32 a3hierarchyMaskRemoveSubtree(a3_HierarchyMask *mask, const a3ui32 nodeIndex);
+
+// add subtree under named node, e.g. "spine5"
+//	returns number of nodes in mask if success, -1 if invalid params or 
+//	node not found
+a3i32 a3hierarchyMaskAddSubtreeByName(a3_HierarchyMask *mask, const a3byte nodeName[a3node_nameSize]);
+
+// invert mask, e.g. lower body from upper body
+//	returns number of nodes in mask if success, -1 if invalid params
+a3i32 a3hierarchyMaskInvert(a3_HierarchyMask *mask);
+
+// check if node is in mask
+a3boolean a3hierarchyMaskContains(const a3_HierarchyMask *mask, const a3ui32 nodeIndex);
+
+
+//-----------------------------------------------------------------------------
+
+// allocate blend tree with node count; all nodes start as identity leaves
+//	returns node count if success, -1 if invalid params or failed
+a3i32 a3hierarchyBlendTreeCreate(a3_HierarchyBlendTree *tree_out, const a3_Hierarchy *hierarchy, const a3ui32 nodeCount);
+
+// release blend tree
+a3i32 a3hierarchyBlendTreeRelease(a3_HierarchyBlendTree *tree);
+
+// set node as source leaf
+//	returns node index if success, -1 if invalid params
+a3i32 a3hierarchyBlendTreeSetSource(a3_HierarchyBlendTree *tree, const a3ui32 nodeIndex, const a3_HierarchyPose *source);
+
+// set node operation and inputs; params and mask are left unchanged
+//	returns node index if success, -1 if invalid params
+a3i32 a3hierarchyBlendTreeSetOp(a3_HierarchyBlendTree *tree, const a3ui32 nodeIndex, const a3_HierarchyBlendOp op, const a3ui32 *inputArray, const a3ui32 inputCount);
+
+// set or clear (null) mask of lerp, add or scale node; an empty mask 
+//	prunes the node to its first input
+//	returns node index if success, -1 if invalid params
+a3i32 a3hierarchyBlendTreeSetMask(a3_HierarchyBlendTree *tree, const a3ui32 nodeIndex, const a3_HierarchyMask *mask);
+
+// compile tree under root to instruction list and allocate scratch arena; 
+//	fails if a non-leaf node is reached twice (inputs must form a tree, 
+//	though leaves may be shared) or an op has the wrong number of inputs
+//	returns instruction count if success, -1 if invalid params or failed
+a3i32 a3hierarchyBlendTreeCompile(a3_HierarchyBlendTree *tree, const a3ui32 rootIndex);
+
+// evaluate compiled tree into output pose, which must not be a source
+//	returns number of instructions that touched joints if success, -1 if 
+//	invalid params
+a3i32 a3hierarchyBlendTreeEvaluate(a3_HierarchyBlendTree *tree, const a3_HierarchyPose *pose_out);
 
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,180 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_JobSystem.h
+	Fixed pool of worker threads launched with a3_Thread, each owning a 
+		lock-free job deque; idle workers steal from the others. The thread 
+		that creates the system is worker 0 and helps while it waits.
+*/
+
+#ifndef __ANIMAL3D_JOBSYSTEM_H
+#define __ANIMAL3D_JOBSYSTEM_H
+
+
+#include "animal3D/a3/a3macros.h"
+#include "animal3D/a3utility/a3_Thread.h"
+
+
+//-----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#else	// !__cplusplus
+typedef struct a3_Job						a3_Job;
+typedef struct a3_JobCounter				a3_JobCounter;
+typedef struct a3_JobDeque					a3_JobDeque;
+typedef struct a3_JobWorker					a3_JobWorker;
+typedef struct a3_JobSystem					a3_JobSystem;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// job function; same form as a thread function
+typedef a3ret(*a3_JobFunc)(void *);
+
+
+// maximum number of workers, including the creating thread
+enum a3_JobSystemWorkerMax
+{
+	a3jobSystem_workerMax = 64
+};
+
+
+// single job
+struct a3_Job
+{
+	// function to run and its argument
+	a3_JobFunc func;
+	void *args;
+
+	// optional counter decremented when the job completes
+	a3_JobCounter *counter;
+};
+
+
+// number of submitted jobs not yet completed
+struct a3_JobCounter
+{
+	volatile a3i32 count;
+};
+
+
+// work-stealing deque: the owner pushes and pops at the bottom, thieves 
+//	take from the top; ends are kept on separate cache lines
+struct a3_JobDeque
+{
+	volatile a3i32 top;
+	a3byte pad_top[64 - sizeof(a3i32)];
+	volatile a3i32 bottom;
+	a3byte pad_bottom[64 - sizeof(a3i32)];
+
+	// ring of jobs and index mask (capacity is a power of two)
+	a3_Job *job;
+	a3ui32 mask;
+};
+
+
+// worker: deque, thread and steal state
+struct a3_JobWorker
+{
+	a3_JobDeque deque[1];
+	a3_Thread thread[1];
+
+	// owning system and index in it
+	a3_JobSystem *jobSystem;
+	a3ui32 index;
+
+	// random state for picking steal victims
+	a3ui32 seed;
+
+	// jobs run and jobs stolen by this worker
+	a3ui32 executed, stolen;
+};
+
+
+// job system
+struct a3_JobSystem
+{
+	// workers; worker 0 is the creating thread and has no launched thread
+	a3_JobWorker *worker;
+	a3ui32 workerCount;
+
+	// raised while workers should keep running
+	volatile a3i32 running;
+
+	// jobs queued in any deque and not yet completed
+	a3_JobCounter queued[1];
+
+	// worker the creating thread belonged to before this system, if any; 
+	//	restored on release, so systems created on one thread must nest
+	a3_JobWorker *outer;
+
+	// single allocation backing workers and deques
+	void *data;
+};
+
+
+//-----------------------------------------------------------------------------
+
+// create job system with worker count including the calling thread, which 
+//	becomes worker 0; capacity is per worker and rounded up to a power of two
+//	returns worker count if success, -1 if invalid params or failed
+a3i32 a3jobSystemCreate(a3_JobSystem *jobSystem_out, const a3ui32 workerCount, const a3ui32 jobCapacity);
+
+// run or wait on all queued jobs, including those in other workers' deques, 
+//	then stop and join workers and release; call from the creating thread
+a3i32 a3jobSystemRelease(a3_JobSystem *jobSystem);
+
+// submit job from a worker (including the creating thread); the counter, if 
+//	any, is incremented now and decremented when the job completes; a job 
+//	that does not fit, or is submitted from another thread, runs immediately
+//	returns 1 if queued, 0 if run immediately, -1 if invalid params
+a3i32 a3jobSystemSubmit(a3_JobSystem *jobSystem, const a3_JobFunc func, void *args, a3_JobCounter *counter_opt);
+
+// run jobs until counter reaches zero; call from a worker
+//	returns number of jobs run by the caller while waiting, -1 if invalid
+a3i32 a3jobSystemWait(a3_JobSystem *jobSystem, a3_JobCounter *counter);
+
+// get index of calling worker
+//	returns worker index, -1 if caller is not a worker of this system
+a3i32 a3jobSystemGetWorkerIndex(const a3_JobSystem *jobSystem);
+
+// reset counter before submitting a new group of jobs
+a3i32 a3jobCounterReset(a3_JobCounter *counter);
+
+// check if all jobs counted have completed
+a3boolean a3jobCounterIsDone(const a3_JobCounter *counter);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#include "_inl/a3_JobSystem.inl"
+
+
+#endif	// !__ANIMAL3D_JOBSYSTEM_H
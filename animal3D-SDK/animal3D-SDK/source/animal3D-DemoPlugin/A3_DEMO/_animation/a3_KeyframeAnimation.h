@@ -31,6 +31,11 @@
 #include "animal3D-A3DM/a3math/a3vector.h"
 #include "animal3D-A3DM/a3math/a3interpolation.h"
 
+#include "animal3D/a3utility/a3_Stream.h"
+
+#include "a3_NameIndex.h"
+#include "a3_SpatialPose.h"
+
 
 //-----------------------------------------------------------------------------
 
@@ -41,9 +46,13 @@ extern "C"
 typedef struct a3_Sample					a3_Sample;
 typedef struct a3_Keyframe					a3_Keyframe;
 typedef struct a3_KeyframePool				a3_KeyframePool;
+typedef struct a3_ClipFrame					a3_ClipFrame;
 typedef struct a3_Clip						a3_Clip;
 typedef struct a3_ClipPool					a3_ClipPool;
 typedef struct a3_ClipTransition			a3_ClipTransition;
+typedef enum a3_ClipTransitionFlag			a3_ClipTransitionFlag;
+typedef enum a3_KeyframeInterpolation		a3_KeyframeInterpolation;
+typedef struct a3_ClipBake					a3_ClipBake;
 #endif	// __cplusplus
 
 
@@ -55,6 +64,10 @@ enum
 	a3keyframeAnimation_nameLenMax = 32,
 };
 
+// clip time standing for the end of a clip, whatever its duration; any 
+//	negative clip time given to a transition or controller means the same
+#define a3clip_timeEnd	(-1.0f)
+
 
 // single generic value at time
 struct a3_Sample
@@ -64,6 +77,16 @@ struct a3_Sample
 	a3vec3 pos;
 };
 
+// interpolation mode of the interval that starts at a keyframe
+enum a3_KeyframeInterpolation
+{
+	a3keyframeInterpolation_step,		// hold value until next keyframe
+	a3keyframeInterpolation_linear,		// lerp to next keyframe
+	a3keyframeInterpolation_catmullRom,	// spline through neighbors in clip
+	a3keyframeInterpolation_hermite,	// handles are tangents (in, out)
+	a3keyframeInterpolation_bezier,		// handles are control values (in, out)
+};
+
 // description of single keyframe
 // metaphor: moment
 struct a3_Keyframe
@@ -71,10 +94,9 @@ struct a3_Keyframe
 	// index in keyframe pool
 	a3index index;
 
-	// active time interval and its reciprocal
-	
+	// default time interval and its reciprocal; clips referencing the 
+	//	keyframe keep their own timing in their clip frames
 	a3real duration, durationInv;
-	//a3f32 duration, durationInv;
 
 	// sample value described by a keyframe
 	a3i32 data;
@@ -82,6 +104,16 @@ struct a3_Keyframe
 	// the known sample at the start of the interval
 	a3_Sample sample;
 
+	// interpolation mode of the interval
+	a3_KeyframeInterpolation interpolation;
+
+	// handles on either side of the sample (in, out); the interval uses the 
+	//	out handle of this keyframe and the in handle of the next one
+	a3real handle[2];
+
+	// block of channel poses owned by pool (one per animated node); the 
+	//	channel flags of each pose describe which of its parts are keyed
+	a3_SpatialPose *pose;
 };
 
 // pool of keyframe descriptors
@@ -90,8 +122,15 @@ struct a3_KeyframePool
 	// array of keyframes
 	a3_Keyframe *keyframe;
 
+	// channel poses of all keyframes, one contiguous block per keyframe in 
+	//	pool order so clips over consecutive keyframes read sequentially
+	a3_SpatialPose *pose;
+
 	// number of keyframes
 	a3ui32 count;
+
+	// number of poses per keyframe, zero if keyframes are scalar only
+	a3ui32 poseCount;
 };
 
 
@@ -101,12 +140,44 @@ a3i32 a3keyframePoolCreate(a3_KeyframePool* keyframePool_out, const a3ui32 count
 // release keyframe pool
 a3i32 a3keyframePoolRelease(a3_KeyframePool* keyframePool);
 
-// initialize keyframe
+// allocate channel poses for every keyframe in pool, reset to identity; 
+//	set the keyed parts of each keyframe's block with the spatial pose 
+//	setters (e.g. one pose with translation for a prop, one per joint for 
+//	a skeleton)
+//	returns total number of poses if success, -1 if invalid params
+a3i32 a3keyframePoolCreatePoses(a3_KeyframePool* keyframePool, const a3ui32 posesPerKeyframe);
+
+// initialize keyframe; sample value is set from data and the interval 
+//	defaults to linear interpolation
 a3i32 a3keyframeInit(a3_Keyframe* keyframe_out, const a3real duration, const a3ui32 value_x);
 
+// set interpolation mode and handles of keyframe; coefficients are not 
+//	updated until the clips referencing the keyframe recalculate them
+//	handles are tangents per unit keyframe param for Hermite, control 
+//	values for Bezier, and ignored by other modes
+a3i32 a3keyframeSetInterpolation(a3_Keyframe* keyframe_out, const a3_KeyframeInterpolation interpolation, const a3real handleIn, const a3real handleOut);
+
+// evaluate channel poses of interval from keyframe to next keyframe at 
+//	normalized keyframe param; step intervals hold the first block, all 
+//	others interpolate channel-wise (nlerp rotation, lerp scale/translation)
+//	returns number of poses if success, -1 if invalid params
+a3i32 a3keyframeEvaluatePose(a3_SpatialPose* pose_out, a3_Keyframe const* keyframe, a3_Keyframe const* keyframeNext, const a3ui32 poseCount, const a3real param);
+
 
 //-----------------------------------------------------------------------------
 
+// keyframe as referenced by one clip; the interval shape depends on the 
+//	clip's direction and on its neighbors in clip order, so the same keyframe 
+//	may have different data in each clip that references it
+struct a3_ClipFrame
+{
+	// active time interval in clip and its reciprocal
+	a3real duration, durationInv;
+
+	// cubic coefficients of the interval, c0 + u*(c1 + u*(c2 + u*c3))
+	a3real coeff[4];
+};
+
 // description of single clip
 // metaphor: timeline
 struct a3_Clip
@@ -135,6 +206,10 @@ struct a3_Clip
 
 	// array of keyframes
 	const a3_KeyframePool* framePool;
+
+	// data of referenced keyframes in clip order (first to last), owned by 
+	//	the clip pool
+	a3_ClipFrame* frame;
 };
 
 // group of clips
@@ -143,35 +218,75 @@ struct a3_ClipPool
 	// array of clips
 	a3_Clip* clip;
 
+	// array of transitions owned by pool, two per clip (reverse, forward)
+	//	stored in the same allocation immediately after the clips
+	a3_ClipTransition* transition;
+
+	// clip frames of all clips, one contiguous block per clip in pool order
+	a3_ClipFrame* frame;
+
 	// number of clips
 	a3ui32 count;
+
+	// hashed clip name lookup
+	a3_NameIndex nameIndex[1];
+};
+
+// transition action flags, combined to describe the verbs of the clip file
+//	format, e.g. '>>|' is forward | skip | pause
+enum a3_ClipTransitionFlag
+{
+	a3clipTransition_pause = 0x01,		// stop playback after transition
+	a3clipTransition_forward = 0x02,	// start of clip ('>')
+	a3clipTransition_reverse = 0x04,	// end of clip ('<')
+	a3clipTransition_skip = 0x08,		// skip terminal frame ('>>' or '<<')
 };
 
 // clip transition
 struct a3_ClipTransition
 {
+	// action described by transition
+	a3_ClipTransitionFlag flag;
+
 	// array of clips
 	const a3_ClipPool* clipPool;
 
 	// index of target clip
 	a3index clipIndex;
 
-	// clip time;
+	// clip time; negative (a3clip_timeEnd) for the end of the target clip
 	a3f32 clipTime;
 
 	// playbackDirection;
 	a3f32 playbackDirection;
 };
 
-// create clip pool from file
-a3i32 a3clipPoolCreateFromFile(a3_ClipPool* clipPool_out, const char* filePath);
+// create clip pool from animation clip set file; clips reference frames in 
+//	the provided keyframe pool, which is not modified; each clip's duration 
+//	is distributed over its own clip frames and their coefficients calculated
+//	returns number of clips if success, -1 if failed
+a3i32 a3clipPoolCreateFromFile(a3_ClipPool* clipPool_out, const a3_KeyframePool* keyframePool, const a3byte* filePath);
 
-// split input strings using a specific char
-a3i32 a3ColumnCount(char* inputStr);
+// save compiled clip pool to binary file
+//	returns number of bytes written if success, -1 if invalid params
+a3i32 a3clipPoolSaveBinary(const a3_ClipPool* clipPool, const a3_FileStream* fileStream);
+
+// load compiled clip pool from binary file with a single read of the clip 
+//	block followed by pointer fix-up; clip frames are allocated, clip 
+//	durations re-distributed and coefficients recalculated
+//	returns number of bytes read if success, 0 if failed, -1 if invalid params
+a3i32 a3clipPoolLoadBinary(a3_ClipPool* clipPool_out, const a3_KeyframePool* keyframePool, const a3_FileStream* fileStream);
 
 // allocate clip pool
 a3i32 a3clipPoolCreate(a3_ClipPool* clipPool_out, const a3ui32 count);
 
+// allocate clip frames for every clip in pool once their keyframe ranges 
+//	are set (e.g. with a3clipInit); frames start with the keyframes' default 
+//	durations and their coefficients are calculated; releases any previous 
+//	clip frames
+//	returns total number of clip frames if success, -1 if invalid params
+a3i32 a3clipPoolCreateFrames(a3_ClipPool* clipPool);
+
 // release clip pool
 a3i32 a3clipPoolRelease(a3_ClipPool* clipPool);
 
@@ -179,19 +294,82 @@ a3i32 a3clipPoolRelease(a3_ClipPool* clipPool);
 a3i32 a3clipInit(a3_Clip* clip_out, const a3byte clipName[a3keyframeAnimation_nameLenMax], const a3_KeyframePool* keyframePool, const a3ui32 firstKeyframeIndex, const a3ui32 finalKeyframeIndex,
 const a3_ClipTransition* forwardClipTransition, const a3_ClipTransition* reverseClipTransition);
 
-// get clip index from pool
+// get clip index from pool; hashed, clips renamed with a3clipInit after 
+//	pool creation are re-indexed the first time they are looked up
 a3i32 a3clipGetIndexInPool(const a3_ClipPool* clipPool, const a3byte clipName[a3keyframeAnimation_nameLenMax]);
 
-// calculate clip duration as sum of keyframes' durations
+// calculate clip duration as sum of clip frames' durations, or of the 
+//	keyframes' default durations if clip frames are not yet allocated
 a3i32 a3clipCalculateDuration(a3_Clip* clip);
 
-// calculate keyframes' durations by distributing clip's duration
+// calculate clip frames' durations by distributing clip's duration
+//	returns number of keyframes if success, -1 if invalid params (including 
+//	clip frames not yet allocated)
 a3i32 a3clipDistributeDuration(a3_Clip* clip, const a3real newClipDuration);
 
-// initialize clip transition with desired transition attributes
+// calculate clip frames' interval coefficients from the keyframes' values, 
+//	modes and handles in clip order; call again after editing any of those
+//	returns number of keyframes if success, -1 if invalid params (including 
+//	clip frames not yet allocated)
+a3i32 a3clipCalculateCoefficients(a3_Clip* clip);
+
+// get ordinal (position in clip order) of referenced keyframe pool index
+a3ui32 a3clipGetFrameOrdinal(a3_Clip const* clip, const a3index keyframeIndex);
+
+// evaluate cached interval polynomial of clip frame at normalized param
+a3real a3clipFrameEvaluate(a3_ClipFrame const* clipFrame, const a3real param);
+
+// initialize clip transition with desired transition attributes; pass 
+//	a3clip_timeEnd as start time to begin at the end of the target clip
 a3i32 a3clipTransitionInit(a3_ClipTransition* clipTransition_out, a3_ClipPool* pool, a3index index, a3f32 startTime, a3f32 clipPlaybackDirection);
 
 
+//-----------------------------------------------------------------------------
+
+// clip resampled at a fixed rate
+// metaphor: film strip
+//	any clip time maps straight to frame floor(time * rate), so seeking and 
+//	evaluating many playheads costs the same regardless of keyframe count
+struct a3_ClipBake
+{
+	// resampled channel poses, pose count per frame; null if the keyframe 
+	//	pool has no poses
+	a3_SpatialPose *pose;
+
+	// resampled scalar values, one per frame
+	a3real *value;
+
+	// frame rate and its reciprocal, and duration of source clip
+	a3real rate, rateInv, duration;
+
+	// number of frame intervals (frames stored is one more) and poses per frame
+	a3ui32 frameCount, poseCount;
+
+	// source clip
+	a3_Clip const* clip;
+};
+
+// bake clip by evaluating its keyframe intervals (including their modes) at 
+//	a fixed rate; the rate is rounded up so a whole number of frames spans 
+//	the clip exactly, e.g. 24 for data authored at 24 frames per second
+//	returns number of frames stored if success, -1 if invalid params
+a3i32 a3clipBakeCreate(a3_ClipBake* clipBake_out, const a3_Clip* clip, const a3real rate);
+
+// release baked clip
+a3i32 a3clipBakeRelease(a3_ClipBake* clipBake);
+
+// sample scalar value at clip time, clamped to the clip
+a3real a3clipBakeSample(a3_ClipBake const* clipBake, const a3real clipTime);
+
+// sample channel poses at clip time, clamped to the clip
+//	returns number of poses if success, -1 if invalid params
+a3i32 a3clipBakeSamplePose(a3_SpatialPose* pose_out, a3_ClipBake const* clipBake, const a3real clipTime);
+
+// sample scalar values at array of clip times
+//	returns count if success, -1 if invalid params
+a3i32 a3clipBakeSampleArray(a3real* value_out, a3_ClipBake const* clipBake, const a3real* clipTime, const a3ui32 count);
+
+
 //-----------------------------------------------------------------------------
 
 
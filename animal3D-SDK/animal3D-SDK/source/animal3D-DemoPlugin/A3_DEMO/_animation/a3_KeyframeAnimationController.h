@@ -39,9 +39,19 @@ extern "C"
 {
 #else	// !__cplusplus
 typedef struct a3_ClipController			a3_ClipController;
+typedef struct a3_ClipControllerSet			a3_ClipControllerSet;
 #endif	// __cplusplus
 
 
+//-----------------------------------------------------------------------------
+
+// constant values
+enum
+{
+	a3clipController_hopsMax = 8,	// transitions followed by one controller in one update
+};
+
+
 //-----------------------------------------------------------------------------
 
 // clip controller
@@ -85,12 +95,54 @@ struct a3_ClipController
 };
 
 
+// batch of clip controllers stored as structure-of-arrays
+// metaphor: crowd of playheads sharing one clip pool
+//	each array holds 'count' elements, padded to a multiple of the lane width 
+//	so update loops can run without remainder handling
+struct a3_ClipControllerSet
+{
+	// current time relative to start of clip and normalized clip time
+	a3real *clipTime, *clipParam;
+
+	// current time relative to current keyframe and normalized keyframe time
+	a3real *keyframeTime, *keyframeParam;
+
+	// playback behavior: +1 for forward | 0 for pause | -1 for reverse
+	a3real *playbackDirection;
+
+	// cached durations of current clip and keyframe and their reciprocals
+	//	(refreshed only when a controller crosses a boundary)
+	a3real *clipDuration, *clipDurationInv;
+	a3real *keyframeDuration, *keyframeDurationInv;
+
+	// index of clip in pool and indices of current and next keyframe
+	a3index *clipIndex, *keyframeIndex0, *keyframeIndex1;
+
+	// scratch list of controllers that crossed a boundary during update
+	a3index *resolveList;
+
+	// pointer to pool of clips to control
+	const a3_ClipPool* clipPool;
+
+	// number of controllers and padded array length
+	a3ui32 count, stride;
+
+	// single allocation backing all arrays
+	void* data;
+};
+
+
 //-----------------------------------------------------------------------------
 
-// initialize clip controller
+// initialize clip controller; the name is copied up to its terminator and 
+//	a negative clip time (a3clip_timeEnd) starts at the end of the clip
+//	returns 1 if success, -1 if invalid params (including clip frames of pool 
+//	not yet allocated)
 a3i32 a3clipControllerInit(a3_ClipController* clipCtrl_out, const a3byte ctrlName[a3keyframeAnimation_nameLenMax], const a3_ClipPool* clipPool, const a3ui32 clipIndex_pool, a3f32 clipTime, a3f32 playbackDirection);
 
-// update clip controller
+// update clip controller: advance time in playback direction, applying clip 
+//	transitions at either terminus, same rules as controller set update
+//	returns 1 if success, -1 if invalid params
 a3i32 a3clipControllerUpdate(a3_ClipController* clipCtrl, const a3real dt);
 
 // set clip to play
@@ -99,6 +151,49 @@ a3i32 a3clipControllerSetClip(a3_ClipController* clipCtrl, const a3_ClipPool* cl
 // evaluate the current value at time
 a3i32 a3clipControllerEvaluate(a3_ClipController const* clipCtrl, a3_Sample* sample_out);
 
+// evaluate the current channel poses of the keyframe pool into a complete 
+//	pose (pool's pose count elements) in one sequential pass
+//	returns number of poses if success, -1 if invalid params
+a3i32 a3clipControllerEvaluatePose(a3_ClipController const* clipCtrl, a3_SpatialPose* pose_out);
+
+
+//-----------------------------------------------------------------------------
+
+// allocate controller set; all controllers start paused on the first clip
+a3i32 a3clipControllerSetCreate(a3_ClipControllerSet* ctrlSet_out, const a3_ClipPool* clipPool, const a3ui32 count);
+
+// release controller set
+a3i32 a3clipControllerSetRelease(a3_ClipControllerSet* ctrlSet);
+
+// initialize single controller in set, same rules as scalar controller init
+a3i32 a3clipControllerSetInit(a3_ClipControllerSet* ctrlSet, const a3ui32 ctrlIndex, const a3ui32 clipIndex_pool, const a3f32 clipTime, const a3f32 playbackDirection);
+
+// update all controllers in set; returns number of controllers that had to 
+//	resolve a keyframe or clip boundary
+a3i32 a3clipControllerSetUpdate(a3_ClipControllerSet* ctrlSet, const a3real dt);
+
+// evaluate current sample value of all controllers into array
+a3i32 a3clipControllerSetEvaluate(a3_ClipControllerSet const* ctrlSet, a3real* value_out);
+
+// evaluate current channel poses of all controllers into array; each 
+//	controller writes a block of the keyframe pool's pose count elements
+//	returns number of controllers if success, -1 if invalid params
+a3i32 a3clipControllerSetEvaluatePose(a3_ClipControllerSet const* ctrlSet, a3_SpatialPose* pose_out);
+
+// evaluate all controllers from baked clips (one per clip in pool, same 
+//	order) using only clip time; keyframe state is not read
+//	returns number of controllers if success, -1 if invalid params
+a3i32 a3clipControllerSetEvaluateBaked(a3_ClipControllerSet const* ctrlSet, a3_ClipBake const* clipBake, a3real* value_out);
+
+// evaluate channel poses of all controllers from baked clips
+//	returns number of controllers if success, -1 if invalid params
+a3i32 a3clipControllerSetEvaluateBakedPose(a3_ClipControllerSet const* ctrlSet, a3_ClipBake const* clipBake, a3_SpatialPose* pose_out);
+
+// measure controllers updated per second using scalar and batched paths
+//	controllers are distributed over all clips in the pool
+a3i32 a3clipControllerBenchmark(a3f64* scalarRate_out, a3f64* batchRate_out, const a3_ClipPool* clipPool, const a3ui32 ctrlCount, const a3ui32 updateCount, const a3real dt);
+
+
 //-----------------------------------------------------------------------------
 
 
@@ -35,8 +35,68 @@
 extern "C"
 {
 #else	// !__cplusplus
-
+typedef enum a3_KinematicsSolver		a3_KinematicsSolver;
+typedef struct a3_KinematicsChain		a3_KinematicsChain;
+typedef struct a3_KinematicsStats		a3_KinematicsStats;
 #endif	// __cplusplus
+	
+
+//-----------------------------------------------------------------------------
+
+// constant values
+enum
+{
+	a3kinematics_chainMax = 16,
+};
+
+
+// goal-driven IK solver used for a chain
+enum a3_KinematicsSolver
+{
+	a3kinematicsSolver_twoBone,		// analytic; exactly 3 nodes (e.g. hip, knee, ankle)
+	a3kinematicsSolver_ccd,			// cyclic coordinate descent; 2 to max nodes
+	a3kinematicsSolver_fabrik,		// forward and backward reaching; 2 to max nodes
+};
+
+
+// IK chain: nodes from base to end effector, each a descendant (not 
+//	necessarily a child) of the one before; only the chain nodes are 
+//	rotated, nodes between them follow rigidly
+//	the goal and pole are object-space positions in the chain's state
+struct a3_KinematicsChain
+{
+	// state whose object-space transforms are solved
+	const a3_HierarchyState *hierarchyState;
+
+	// solver used
+	a3_KinematicsSolver solver;
+
+	// chain nodes
+	a3ui32 node[a3kinematics_chainMax];
+	a3ui32 nodeCount;
+
+	// goal position for the end effector
+	a3vec3 goal;
+
+	// optional pole position: the bend plane of a two-bone chain contains 
+	//	the base, goal and pole; otherwise the current bend is kept
+	a3vec3 pole;
+	a3boolean usingPole;
+};
+
+
+// IK profiling counters, accumulated over calls until reset
+struct a3_KinematicsStats
+{
+	// chains solved and chains that reached the goal within tolerance
+	a3ui32 chainCount, convergedCount;
+
+	// iterations run (one per analytic solve), total and worst chain
+	a3ui32 iterationCount, iterationMax;
+
+	// remaining end effector distance to goal, total and worst chain
+	a3real errorSum, errorMax;
+};
 
 
 //-----------------------------------------------------------------------------
@@ -52,8 +112,27 @@ extern "C"
 a3i32 a3kinematicsSolveForward(const a3_HierarchyState *hierarchyState);
 
 // forward kinematics solver starting at a specified joint
+//	a full range is solved level by level, each level as one batch; a 
+//	partial range is solved in index order and expects the object-space 
+//	transforms of parents outside the range to be current
+//	returns number of nodes solved if success, -1 if invalid params
 a3i32 a3kinematicsSolveForwardPartial(const a3_HierarchyState *hierarchyState, const a3ui32 firstIndex, const a3ui32 nodeCount);
 
+// incremental forward kinematics solver: solves dirty nodes and their 
+//	descendants only, using the subtree extents to bound the search, then 
+//	clears the dirty bits; other solvers clear the bits of the nodes they solve
+//	returns number of nodes solved if success, -1 if invalid params
+a3i32 a3kinematicsSolveForwardDirty(const a3_HierarchyState *hierarchyState);
+
+// forward kinematics solver for an array of hierarchy states (e.g. one per 
+//	character); states are solved in small groups, level by level
+//	returns total number of nodes solved if success, -1 if invalid params
+a3i32 a3kinematicsSolveForwardMultiple(const a3_HierarchyState *hierarchyStateArray, const a3ui32 stateCount);
+
+// measure joints solved per second by a per-node solver in index order and by 
+//	the batched multi-state solver, using copies of the given state
+a3i32 a3kinematicsBenchmarkForward(a3f64 *sequentialRate_out, a3f64 *batchedRate_out, const a3_HierarchyState *hierarchyState, const a3ui32 stateCount, const a3ui32 passCount);
+
 
 //-----------------------------------------------------------------------------
 
@@ -68,8 +147,40 @@ a3i32 a3kinematicsSolveForwardPartial(const a3_HierarchyState *hierarchyState, c
 a3i32 a3kinematicsSolveInverse(const a3_HierarchyState *hierarchyState);
 
 // inverse kinematics solver starting at a specified joint
+//	each parent's inverse is computed once (rigid if it has no scale) into 
+//	the state's parent inverse scratch, leaving the inverse object-space 
+//	transforms untouched; clears the solved nodes' dirty bits
+//	returns number of nodes solved if success, -1 if invalid params
 a3i32 a3kinematicsSolveInversePartial(const a3_HierarchyState *hierarchyState, const a3ui32 firstIndex, const a3ui32 nodeCount);
 
+// inverse kinematics solver for an array of hierarchy states
+//	returns total number of nodes solved if success, -1 if invalid params
+a3i32 a3kinematicsSolveInverseMultiple(const a3_HierarchyState *hierarchyStateArray, const a3ui32 stateCount);
+
+
+//-----------------------------------------------------------------------------
+
+// goal-driven IK: 
+// given current object-space transforms (forward kinematics already solved), 
+//	rotate the chain nodes about their positions so the end effector reaches 
+//	the goal, then write the chain's local-space transforms and refresh the 
+//	object-space transforms of the chain subtree only
+
+// reset IK stats
+a3i32 a3kinematicsStatsReset(a3_KinematicsStats *stats_out);
+
+// solve one chain; iterative solvers stop early once the end effector is 
+//	within tolerance of the goal
+//	stats are optional; returns 1 if converged, 0 if not, -1 if invalid params
+a3i32 a3kinematicsSolveChain(const a3_KinematicsChain *chain, const a3ui32 iterationMax, const a3real tolerance, a3_KinematicsStats *stats_out);
+
+// solve many chains (e.g. feet of a crowd) in one call; chains sharing a 
+//	state should be consecutive and must not lie in each other's subtrees, 
+//	as each state's object-space is refreshed once after its run of chains
+//	stats are optional; returns number of chains converged, -1 if invalid 
+//	params (invalid chains are skipped and not counted)
+a3i32 a3kinematicsSolveChainArray(const a3_KinematicsChain *chainArray, const a3ui32 chainCount, const a3ui32 iterationMax, const a3real tolerance, a3_KinematicsStats *stats_out);
+
 
 //-----------------------------------------------------------------------------
 
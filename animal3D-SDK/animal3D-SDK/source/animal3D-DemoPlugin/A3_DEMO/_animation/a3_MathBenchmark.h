@@ -0,0 +1,116 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_MathBenchmark.h
+	Micro-benchmarks for the A3DM function families; each family runs a 
+		representative mix of calls over arrays of generated inputs and 
+		reports calls per second, so scalar and intrinsic builds of the math 
+		library can be compared.
+*/
+
+#ifndef __ANIMAL3D_MATHBENCHMARK_H
+#define __ANIMAL3D_MATHBENCHMARK_H
+
+
+#include "animal3D-A3DM/animal3D-A3DM.h"
+
+
+//-----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#else	// !__cplusplus
+typedef enum a3_MathBenchmarkFamily			a3_MathBenchmarkFamily;
+typedef struct a3_MathBenchmarkResult		a3_MathBenchmarkResult;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// benchmarked function families
+enum a3_MathBenchmarkFamily
+{
+	a3mathBenchmark_sqrt,			// square root and inverse square root
+	a3mathBenchmark_trig,			// sine, cosine, arctangent (polynomial)
+	a3mathBenchmark_trigTable,		// sine, cosine from a lookup table
+	a3mathBenchmark_trigTaylor,		// sine, cosine from Taylor series
+	a3mathBenchmark_trigArray,		// sine, cosine, arctangent over arrays
+	a3mathBenchmark_trigArrayFast,	// same, fast accuracy tier
+	a3mathBenchmark_random,			// random numbers
+	a3mathBenchmark_randomStream,	// random numbers from a stream over arrays
+	a3mathBenchmark_interpolation,	// scalar curves
+	a3mathBenchmark_vector,			// 4D vector arithmetic and normalization
+	a3mathBenchmark_matrix,			// 4x4 products, inverses, transforms
+	a3mathBenchmark_matrixArray,	// 4x4 products and inverses over arrays
+	a3mathBenchmark_quaternion,		// products, rotation, slerp
+	a3mathBenchmark_quaternionArray,	// slerp and blending over pose arrays
+	a3mathBenchmark_dualquaternion,	// products, transforms, blending
+
+	a3mathBenchmark_familyCount
+};
+
+
+// result of one family
+struct a3_MathBenchmarkResult
+{
+	// family name
+	a3byte const *name;
+
+	// calls per second
+	a3f64 rate;
+
+	// sum of outputs; keeps the work observable and should match between 
+	//	builds to within rounding
+	a3real checksum;
+
+	// number of calls timed
+	a3ui32 callCount;
+};
+
+
+//-----------------------------------------------------------------------------
+
+// get name of family
+//	returns name if valid family, null otherwise
+a3byte const *a3mathBenchmarkGetName(const a3_MathBenchmarkFamily family);
+
+// run one family over an array of generated inputs, repeated for the given 
+//	number of passes; array families need the math library built from 
+//	source (A3_OPEN_SOURCE), otherwise they time no calls and report zero; 
+//	trig families release the shared trig table, so a caller that keeps one 
+//	re-sets it afterwards (a3trigInitSetTables)
+//	returns number of calls timed if success, -1 if invalid params or failed
+a3i32 a3mathBenchmarkRun(a3_MathBenchmarkResult *result_out, const a3_MathBenchmarkFamily family, const a3ui32 elementCount, const a3ui32 passCount);
+
+// run all families; results array must hold one entry per family
+//	returns number of families run if success, -1 if invalid params or failed
+a3i32 a3mathBenchmarkRunAll(a3_MathBenchmarkResult result_out[a3mathBenchmark_familyCount], const a3ui32 elementCount, const a3ui32 passCount);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#endif	// !__ANIMAL3D_MATHBENCHMARK_H
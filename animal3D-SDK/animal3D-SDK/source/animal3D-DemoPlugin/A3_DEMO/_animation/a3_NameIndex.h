@@ -0,0 +1,113 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+
+	a3_NameIndex.h
+	Hashed lookup of fixed-size names stored in an array of records (e.g.
+		hierarchy nodes or clips). The index does not own the names; it
+		refers to them by base address and stride.
+*/
+
+#ifndef __ANIMAL3D_NAMEINDEX_H
+#define __ANIMAL3D_NAMEINDEX_H
+
+
+#include "animal3D/a3/a3types_integer.h"
+#include "animal3D/a3/a3types_real.h"
+
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#else	// !__cplusplus
+typedef struct a3_NameIndex					a3_NameIndex;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// maximum name length hashed (including null terminator)
+enum a3_NameIndexNameSize
+{
+	a3nameIndex_nameSize = 32
+};
+
+
+// hashed name index
+//	buckets hold the first record index in a chain, chains are linked through
+//	the per-record 'next' array; empty names are not indexed
+struct a3_NameIndex
+{
+	// first record in each bucket's chain (-1 if empty)
+	a3i32* head;
+
+	// next record in chain per record (-1 at end, -2 if not indexed)
+	a3i32* next;
+
+	// cached hash per record
+	a3ui32* hash;
+
+	// address of first record's name and distance between names in bytes
+	const a3byte* nameBase;
+	a3ui32 nameStride;
+
+	// number of records and bucket mask (bucket count is a power of two)
+	a3ui32 count, bucketMask;
+};
+
+
+// hash name (FNV-1a, stops at terminator or maximum name size)
+a3ui32 a3nameIndexHash(const a3byte name[a3nameIndex_nameSize]);
+
+// create index over current names; names may change later with update
+//	returns count if success, -1 if failed
+a3i32 a3nameIndexCreate(a3_NameIndex* nameIndex_out, const a3byte* nameBase, const a3ui32 nameStride, const a3ui32 count);
+
+// release index
+a3i32 a3nameIndexRelease(a3_NameIndex* nameIndex);
+
+// re-index record after its name has changed
+//	returns record index if success, -1 if failed
+a3i32 a3nameIndexUpdate(const a3_NameIndex* nameIndex, const a3ui32 recordIndex);
+
+// find record index by name
+//	returns record index if found, -1 if not found or invalid
+a3i32 a3nameIndexFind(const a3_NameIndex* nameIndex, const a3byte name[a3nameIndex_nameSize]);
+
+// measure names resolved per second with a linear scan and with a freshly
+//	built index (build time included), resolving every name once per pass
+a3i32 a3nameIndexBenchmark(a3f64* linearRate_out, a3f64* hashedRate_out, const a3byte* nameBase, const a3ui32 nameStride, const a3ui32 count, const a3ui32 passCount);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#include "_inl/a3_NameIndex.inl"
+
+
+#endif	// !__ANIMAL3D_NAMEINDEX_H
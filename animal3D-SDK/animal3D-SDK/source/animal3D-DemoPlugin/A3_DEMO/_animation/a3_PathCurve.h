@@ -0,0 +1,124 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_PathCurve.h
+	Catmull-Rom path through control points with a precomputed arc-length 
+		table, for constant-speed motion along rails and crowd paths.
+*/
+
+#ifndef __ANIMAL3D_PATHCURVE_H
+#define __ANIMAL3D_PATHCURVE_H
+
+
+#include "animal3D-A3DM/a3math/a3vector.h"
+#include "animal3D-A3DM/a3math/a3sqrt.h"
+
+
+//-----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#else	// !__cplusplus
+typedef struct a3_PathCurve					a3_PathCurve;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// path curve
+//	the curve is sampled once at creation: each segment at a fixed number of 
+//	uniform parameter steps, with the accumulated length at every sample; 
+//	a lookup of evenly spaced distances then narrows each query to the few 
+//	samples around it, so finding the parameter at a distance costs a short 
+//	binary search regardless of path length; between samples the parameter 
+//	follows a cubic matching the rate at both ends, which keeps speed 
+//	steady across sample boundaries
+//	parameters are global: the integer part is the segment index, the 
+//	fractional part the parameter within the segment
+struct a3_PathCurve
+{
+	// control points; one allocation holds all arrays below
+	a3vec3 *point;
+
+	// curve samples, accumulated length and rate of sample index per unit 
+	//	length at each sample
+	a3vec3 *sample;
+	a3real *sampleLength, *sampleRate;
+
+	// for each evenly spaced distance, index of the sample interval holding it
+	a3ui32 *lookup;
+
+	// total length, its reciprocal and lookup entries per unit length
+	a3real length, lengthInv, lookupScale;
+
+	// reciprocal of samples per segment
+	a3real samplesPerSegmentInv;
+
+	// counts: control points, segments, samples, samples per segment and 
+	//	lookup intervals
+	a3ui32 pointCount, segmentCount, sampleCount, samplesPerSegment, lookupCount;
+
+	// path returns from the last point to the first; distances wrap
+	a3boolean closed;
+};
+
+
+//-----------------------------------------------------------------------------
+
+// create path through control points; open paths need two points and 
+//	clamp distances to their length, closed paths need three and wrap
+//	returns number of samples if success, -1 if invalid params or failed
+a3i32 a3pathCurveCreate(a3_PathCurve *curve_out, const a3vec3 *pointArray, const a3ui32 pointCount, const a3ui32 samplesPerSegment, const a3boolean closed);
+
+// release path
+a3i32 a3pathCurveRelease(a3_PathCurve *curve);
+
+// get global parameter at distance along path
+//	returns segment index if success, -1 if invalid params
+a3i32 a3pathCurveGetParam(const a3_PathCurve *curve, a3real *param_out, const a3real distance);
+
+// evaluate position and unit tangent (either optional) at global parameter
+//	returns segment index if success, -1 if invalid params
+a3i32 a3pathCurveEvaluate(const a3_PathCurve *curve, a3vec3 *position_out, a3vec3 *tangent_out, const a3real param);
+
+// evaluate position and unit tangent (either optional) at distance along 
+//	path, so that evenly spaced distances give constant speed
+//	returns segment index if success, -1 if invalid params
+a3i32 a3pathCurveSample(const a3_PathCurve *curve, a3vec3 *position_out, a3vec3 *tangent_out, const a3real distance);
+
+// evaluate positions and unit tangents (either optional) of many agents on 
+//	the same path, one distance each
+//	returns number of agents if success, -1 if invalid params
+a3i32 a3pathCurveSampleArray(const a3_PathCurve *curve, a3vec3 *positionArray_out, a3vec3 *tangentArray_out, const a3real *distanceArray, const a3ui32 count);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#include "_inl/a3_PathCurve.inl"
+
+
+#endif	// !__ANIMAL3D_PATHCURVE_H
@@ -0,0 +1,128 @@
+/*
+	Copyright 2011-2020 Daniel S. Buckstein
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+/*
+	animal3D SDK: Minimal 3D Animation Framework
+	By Daniel S. Buckstein
+	
+	a3_PosePipeline.h
+	Per-frame pose pipeline for many characters: clip sampling, blending, 
+		forward kinematics and skinning matrices, fanned out over a job 
+		system in batches of characters.
+*/
+
+#ifndef __ANIMAL3D_POSEPIPELINE_H
+#define __ANIMAL3D_POSEPIPELINE_H
+
+
+#include "a3_JobSystem.h"
+#include "a3_KeyframeAnimationController.h"
+#include "a3_Kinematics.h"
+
+
+//-----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#else	// !__cplusplus
+typedef struct a3_PosePipelineBatch			a3_PosePipelineBatch;
+typedef struct a3_PosePipeline				a3_PosePipeline;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// worker counts measured by the benchmark
+enum a3_PosePipelineBenchmarkCount
+{
+	a3posePipeline_benchmarkCount = 4
+};
+
+
+// range of characters processed by one job
+struct a3_PosePipelineBatch
+{
+	const a3_PosePipeline *pipeline;
+	a3ui32 first, count;
+};
+
+
+// pose pipeline
+//	character i is driven by controller i of the set and poses state i; the 
+//	keyframe data of a controller's keyframes is the index of a pose in the 
+//	state's pose group, holding a delta from pose 0 (as loaded from HTR)
+struct a3_PosePipeline
+{
+	// job system to run on
+	a3_JobSystem *jobSystem;
+
+	// controllers and hierarchy states, one per character
+	const a3_ClipControllerSet *ctrlSet;
+	const a3_HierarchyState *hierarchyState;
+
+	// inverse object-space bind pose shared by all characters
+	const a3_HierarchyTransform *objectSpaceBindInverse;
+
+	// batches and counter of batches in flight
+	a3_PosePipelineBatch *batch;
+	a3_JobCounter counter[1];
+
+	// number of characters and batches
+	a3ui32 characterCount, batchCount;
+
+	// skinning matrices account for scale
+	a3boolean usingScale;
+};
+
+
+//-----------------------------------------------------------------------------
+
+// create pipeline over existing controllers and states; the job system, 
+//	controllers, states and bind pose must outlive the pipeline
+//	returns number of batches if success, -1 if invalid params or failed
+a3i32 a3posePipelineCreate(a3_PosePipeline *pipeline_out, a3_JobSystem *jobSystem, const a3_ClipControllerSet *ctrlSet, const a3_HierarchyState *hierarchyStateArray, const a3_HierarchyTransform *objectSpaceBindInverse, const a3ui32 characterCount, const a3ui32 batchSize, const a3boolean usingScale);
+
+// release pipeline
+a3i32 a3posePipelineRelease(a3_PosePipeline *pipeline);
+
+// run all stages for one character on the calling thread
+//	returns number of nodes whose object-space transforms were solved
+a3i32 a3posePipelineUpdateCharacter(const a3_PosePipeline *pipeline, const a3ui32 characterIndex);
+
+// run all stages for all characters, one job per batch; update controllers 
+//	first; call from a worker of the job system
+//	returns number of characters updated if success, -1 if invalid params
+a3i32 a3posePipelineUpdate(a3_PosePipeline *pipeline);
+
+// measure characters updated per second with 1, 2, 4 and 8 workers; each 
+//	frame updates a controller set over the clip pool, then the pipeline
+a3i32 a3posePipelineBenchmark(a3f64 characterRate_out[a3posePipeline_benchmarkCount], const a3_HierarchyPoseGroup *poseGroup, const a3_ClipPool *clipPool, const a3ui32 characterCount, const a3ui32 frameCount, const a3real dt);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#include "_inl/a3_PosePipeline.inl"
+
+
+#endif	// !__ANIMAL3D_POSEPIPELINE_H
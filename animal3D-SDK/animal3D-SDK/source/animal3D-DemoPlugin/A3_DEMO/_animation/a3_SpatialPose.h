@@ -37,6 +37,7 @@ extern "C"
 {
 #else	// !__cplusplus
 typedef enum a3_SpatialPoseChannel		a3_SpatialPoseChannel;
+typedef enum a3_SpatialPoseEulerOrder	a3_SpatialPoseEulerOrder;
 typedef struct a3_SpatialPose			a3_SpatialPose;
 #endif	// __cplusplus
 	
@@ -49,20 +50,125 @@ enum a3_SpatialPoseChannel
 {
 	// identity
 	a3poseChannel_none,					// no channels
+
+	// orientation
+	a3poseChannel_orient_x = 0x0001,	// rotation about x axis
+	a3poseChannel_orient_y = 0x0002,	// rotation about y axis
+	a3poseChannel_orient_z = 0x0004,	// rotation about z axis
+	a3poseChannel_orient_xy = a3poseChannel_orient_x | a3poseChannel_orient_y,
+	a3poseChannel_orient_yz = a3poseChannel_orient_y | a3poseChannel_orient_z,
+	a3poseChannel_orient_zx = a3poseChannel_orient_z | a3poseChannel_orient_x,
+	a3poseChannel_orient_xyz = a3poseChannel_orient_xy | a3poseChannel_orient_z,
+
+	// scale
+	a3poseChannel_scale_x = 0x0010,		// scale along x axis
+	a3poseChannel_scale_y = 0x0020,		// scale along y axis
+	a3poseChannel_scale_z = 0x0040,		// scale along z axis
+	a3poseChannel_scale_xy = a3poseChannel_scale_x | a3poseChannel_scale_y,
+	a3poseChannel_scale_yz = a3poseChannel_scale_y | a3poseChannel_scale_z,
+	a3poseChannel_scale_zx = a3poseChannel_scale_z | a3poseChannel_scale_x,
+	a3poseChannel_scale_xyz = a3poseChannel_scale_xy | a3poseChannel_scale_z,
+
+	// translation
+	a3poseChannel_translate_x = 0x0100,	// translation along x axis
+	a3poseChannel_translate_y = 0x0200,	// translation along y axis
+	a3poseChannel_translate_z = 0x0400,	// translation along z axis
+	a3poseChannel_translate_xy = a3poseChannel_translate_x | a3poseChannel_translate_y,
+	a3poseChannel_translate_yz = a3poseChannel_translate_y | a3poseChannel_translate_z,
+	a3poseChannel_translate_zx = a3poseChannel_translate_z | a3poseChannel_translate_x,
+	a3poseChannel_translate_xyz = a3poseChannel_translate_xy | a3poseChannel_translate_z,
+
+	// everything
+	a3poseChannel_all = a3poseChannel_orient_xyz | a3poseChannel_scale_xyz | a3poseChannel_translate_xyz,
+};
+
+
+// order in which Euler angles are applied when setting orientation
+enum a3_SpatialPoseEulerOrder
+{
+	a3poseEulerOrder_xyz,
+	a3poseEulerOrder_zyx,
 };
 
 	
 //-----------------------------------------------------------------------------
 
 // single pose for a single node
+//	stored decomposed; the matrix is rebuilt from the channels on convert 
+//	and only if a channel has changed since the last convert
 struct a3_SpatialPose
 {
+	// local transform built from channels
 	a3mat4 transform;
+
+	// orientation as unit quaternion (x, y, z, w)
+	a3vec4 rotation;
+
+	// scale (w unused)
+	a3vec4 scale;
+
+	// translation (w unused)
+	a3vec4 translation;
+
+	// channels that differ from identity, and channels changed since the 
+	//	transform was last built
+	a3_SpatialPoseChannel channel, dirty;
+
+	// keep size a multiple of 16 bytes for aligned pools
+	a3ui32 pad[2];
 };
 
 
 //-----------------------------------------------------------------------------
 
+// reset pose to identity; transform is rebuilt immediately
+a3i32 a3spatialPoseReset(a3_SpatialPose* spatialPose);
+
+// copy pose including transform and channels; the output's old and new 
+//	channels are marked dirty so that changed poses are rebuilt
+a3i32 a3spatialPoseCopy(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose_in);
+
+// set orientation from Euler angles in degrees
+a3i32 a3spatialPoseSetRotation(a3_SpatialPose* spatialPose, const a3real degrees_x, const a3real degrees_y, const a3real degrees_z, const a3_SpatialPoseEulerOrder order);
+
+// set scale
+a3i32 a3spatialPoseSetScale(a3_SpatialPose* spatialPose, const a3real scale_x, const a3real scale_y, const a3real scale_z);
+
+// set translation
+a3i32 a3spatialPoseSetTranslation(a3_SpatialPose* spatialPose, const a3real translate_x, const a3real translate_y, const a3real translate_z);
+
+// rebuild transform from channels if any are dirty; translation alone only 
+//	touches the last column
+//	returns 1 if rebuilt, 0 if transform was already current, -1 if invalid
+a3i32 a3spatialPoseConvert(a3_SpatialPose* spatialPose);
+
+// concatenate poses channel-wise: rotations multiply (lhs * rhs), scales 
+//	multiply and translations add; output may alias either input
+a3i32 a3spatialPoseConcat(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose_lhs, const a3_SpatialPose* spatialPose_rhs);
+
+// interpolate poses channel-wise: normalized lerp of rotation along the 
+//	shorter arc, linear scale and translation; 10 lerps at most, channel 
+//	groups unused by both inputs are copied rather than interpolated
+a3i32 a3spatialPoseLerp(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose0, const a3_SpatialPose* spatialPose1, const a3real u);
+
+
+//-----------------------------------------------------------------------------
+
+// reset array of poses to identity
+//	returns count if success, -1 if invalid params
+a3i32 a3spatialPoseResetArray(a3_SpatialPose* spatialPose_out, const a3ui32 count);
+
+// rebuild transforms of array of poses where dirty
+//	returns number rebuilt if success, -1 if invalid params
+a3i32 a3spatialPoseConvertArray(a3_SpatialPose* spatialPose, const a3ui32 count);
+
+// concatenate arrays of poses element-wise
+//	returns count if success, -1 if invalid params
+a3i32 a3spatialPoseConcatArray(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose_lhs, const a3_SpatialPose* spatialPose_rhs, const a3ui32 count);
+
+// interpolate arrays of poses element-wise
+//	returns count if success, -1 if invalid params
+a3i32 a3spatialPoseLerpArray(a3_SpatialPose* spatialPose_out, const a3_SpatialPose* spatialPose0, const a3_SpatialPose* spatialPose1, const a3real u, const a3ui32 count);
 
 
 //-----------------------------------------------------------------------------
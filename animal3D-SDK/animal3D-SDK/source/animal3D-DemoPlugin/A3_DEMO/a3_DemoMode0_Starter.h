@@ -34,6 +34,8 @@
 
 #include "_a3_demo_utilities/a3_DemoSceneObject.h"
 #include "_animation/a3_KeyframeAnimationController.h"
+#include "_animation/a3_HierarchyState.h"
+#include "_animation/a3_PosePipeline.h"
 
 //-----------------------------------------------------------------------------
 
@@ -60,6 +62,9 @@ enum a3_DemoMode0_Starter_ObjectMaxCount
 	starterMaxCount_cameraObject = 1,
 	starterMaxCount_projector = 1,
 	starterMaxCount_clipController = 3,
+	starterMaxCount_character = 32,
+	starterMaxCount_characterBatch = 16,
+	starterMaxCount_jobWorker = 4,
 	};
 
 	// scene object rendering program names
@@ -162,7 +167,16 @@ enum a3_DemoMode0_Starter_ObjectMaxCount
 	a3_ClipController clipController[starterMaxCount_clipController];
 	a3_KeyframePool keyframePool[1];
 	a3_ClipPool clipPool[1];
-	a3_ClipTransition clipTransition[2];
+
+	a3_Hierarchy hierarchy[1];
+	a3_HierarchyPoseGroup hierarchyPoseGroup[1];
+
+	// characters posed each frame by the pipeline on the job system; the 
+	//	job system and pipeline are started by the update that first runs them
+	a3_HierarchyState characterState[starterMaxCount_character], characterBindState[1];
+	a3_ClipControllerSet characterCtrlSet[1];
+	a3_PosePipeline characterPipeline[1];
+	a3_JobSystem jobSystem[1];
 
 	a3index currentClipController;
 	};
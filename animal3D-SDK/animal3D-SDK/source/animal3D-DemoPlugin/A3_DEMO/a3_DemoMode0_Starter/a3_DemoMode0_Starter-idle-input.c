@@ -37,6 +37,57 @@
 
 #include "../_a3_demo_utilities/a3_DemoMacros.h"
 
+#include "../_animation/a3_Kinematics.h"
+#include "../_animation/a3_PosePipeline.h"
+#include "../_animation/a3_MathBenchmark.h"
+
+#include <stdio.h>
+
+
+//-----------------------------------------------------------------------------
+// BENCHMARKS
+
+// run all animation benchmarks on the loaded skeleton and clips, print rates
+static void a3starter_benchmark(a3_DemoState const* demoState, a3_DemoMode0_Starter const* demoMode)
+{
+	a3_HierarchyState hierarchyState[1] = { 0 };
+	a3_MathBenchmarkResult mathResult[a3mathBenchmark_familyCount];
+	a3f64 rate[a3posePipeline_benchmarkCount];
+	a3ui32 i;
+
+	printf("\n\n---------------- BENCHMARKS STARTED     ---------------- \n");
+
+	// forward kinematics over copies of the skeleton's base pose
+	if (a3hierarchyStateCreate(hierarchyState, demoMode->hierarchyPoseGroup) > 0)
+	{
+		if (a3kinematicsBenchmarkForward(rate + 0, rate + 1, hierarchyState, 256, 64) >= 0)
+			printf("\n FK (%u nodes): %.0f joints/s sequential, %.0f joints/s batched", 
+				demoMode->hierarchy->numNodes, rate[0], rate[1]);
+		a3hierarchyStateRelease(hierarchyState);
+	}
+
+	// node name lookups
+	if (a3nameIndexBenchmark(rate + 0, rate + 1, demoMode->hierarchy->nodes->name, sizeof(a3_HierarchyNode), demoMode->hierarchy->numNodes, 1024) >= 0)
+		printf("\n Name lookup: %.0f names/s linear, %.0f names/s indexed", rate[0], rate[1]);
+
+	// clip controllers
+	if (a3clipControllerBenchmark(rate + 0, rate + 1, demoMode->clipPool, 1024, 256, (a3real)(1.0 / 60.0)) >= 0)
+		printf("\n Clip controllers: %.0f updates/s scalar, %.0f updates/s batched", rate[0], rate[1]);
+
+	// full pose pipeline
+	if (a3posePipelineBenchmark(rate, demoMode->hierarchyPoseGroup, demoMode->clipPool, 256, 64, (a3real)(1.0 / 60.0)) >= 0)
+		printf("\n Pose pipeline: %.0f / %.0f / %.0f / %.0f characters/s (1 / 2 / 4 / 8 workers)", 
+			rate[0], rate[1], rate[2], rate[3]);
+
+	// math library; trig families release the table, so restore the demo's
+	if (a3mathBenchmarkRunAll(mathResult, 4096, 64) >= 0)
+		for (i = 0; i < a3mathBenchmark_familyCount; ++i)
+			printf("\n Math %s: %.0f calls/s", mathResult[i].name, mathResult[i].rate);
+	a3trigInitSetTables(4, demoState->trigTable);
+
+	printf("\n\n---------------- BENCHMARKS FINISHED    ---------------- \n");
+}
+
 
 //-----------------------------------------------------------------------------
 // CALLBACKS
@@ -80,6 +131,10 @@ void a3starter_input_keyCharPress(a3_DemoState const* demoState, a3_DemoMode0_St
 		break;
 	case '5': demoMode->clipController[demoMode->currentClipController].playbackDirection = 1;
 		break;
+
+		// run benchmarks (blocks for a while)
+	case 'N': a3starter_benchmark(demoState, demoMode);
+		break;
 	}
 }
 
@@ -38,6 +38,7 @@
 #include "../_a3_demo_utilities/a3_DemoMacros.h"
 
 #include "../_animation/a3_KeyframeAnimationController.h"
+#include "../_animation/a3_PosePipeline.h"
 
 
 //-----------------------------------------------------------------------------
@@ -56,6 +57,7 @@ void a3starter_update(a3_DemoState* demoState, a3_DemoMode0_Starter* demoMode, a
 {
 	a3ui32 i;
 	a3_DemoModelMatrixStack matrixStack[starterMaxCount_sceneObject];
+	a3_SpatialPose evaluatedPose;
 
 	// active camera
 	a3_DemoProjector const* activeCamera = demoMode->projector + demoMode->activeCamera;
@@ -82,31 +84,32 @@ void a3starter_update(a3_DemoState* demoState, a3_DemoMode0_Starter* demoMode, a
 	a3demo_update_bindSkybox(demoMode->obj_camera_main, demoMode->obj_skybox);
 
 	// update matrix stack data
-	for (i = 0; i < starterMaxCount_sceneObject; ++i)
-	{
-		a3demo_updateModelMatrixStack(matrixStack + i,
-			activeCamera->projectionMat.m, activeCameraObject->modelMat.m, activeCameraObject->modelMatInv.m,
-			demoMode->object_scene[i].modelMat.m, a3mat4_identity.m);
-	}
+	a3demo_updateModelMatrixStackArray(matrixStack, demoMode->object_scene, starterMaxCount_sceneObject,
+		activeCamera->projectionMat.m, activeCameraObject->modelMat.m, activeCameraObject->modelMatInv.m,
+		a3mat4_identity.m);
 	for (i = 0; i < 3; i++)
 	{
 		a3clipControllerUpdate(demoMode->clipController + i, (a3real)dt);
 	}
 
 	// change object position using animation data
-	//a3_Sample evaluatedSample;
-	//a3clipControllerEvaluate(demoMode->clipController, &evaluatedSample);
-	//(a * (1.0 - t)) + (b * t)
-	// (1-t) * a + b * t
-	if (demoMode->clipController->playbackDirection > 0)
+	if (a3clipControllerEvaluatePose(demoMode->clipController, &evaluatedPose) > 0)
 	{
-		demoMode->obj_teapot->position.x = ((a3real)1.0 - demoMode->clipController->keyframeParam) * demoMode->clipController->keyframePtr0->data + (a3real)(demoMode->clipController->keyframePtr1->data * demoMode->clipController->keyframeParam);
+		demoMode->obj_teapot->position.x = evaluatedPose.translation.x;
 	}
-	else
+
+	// pose characters in batches on the job system; started here so that 
+	//	this thread, which waits on the batches, is its first worker
+	if (demoMode->characterCtrlSet->data)
 	{
-		demoMode->obj_teapot->position.x = ((a3real)1.0 - demoMode->clipController->keyframeParam) * demoMode->clipController->keyframePtr1->data + (a3real)(demoMode->clipController->keyframePtr0->data * demoMode->clipController->keyframeParam);
+		if (!demoMode->jobSystem->worker)
+			a3jobSystemCreate(demoMode->jobSystem, starterMaxCount_jobWorker, starterMaxCount_characterBatch);
+		if (demoMode->jobSystem->worker && !demoMode->characterPipeline->batch)
+			a3posePipelineCreate(demoMode->characterPipeline, demoMode->jobSystem, demoMode->characterCtrlSet, demoMode->characterState,
+				demoMode->characterBindState->objectSpaceInverse, starterMaxCount_character, starterMaxCount_character / starterMaxCount_characterBatch, a3true);
+		a3clipControllerSetUpdate(demoMode->characterCtrlSet, (a3real)dt);
+		a3posePipelineUpdate(demoMode->characterPipeline);
 	}
-	
 }
 
 
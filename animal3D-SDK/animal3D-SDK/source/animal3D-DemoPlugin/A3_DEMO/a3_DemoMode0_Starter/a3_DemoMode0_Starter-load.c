@@ -47,6 +47,8 @@ void a3starter_input_keyCharHold(a3_DemoState const* demoState, a3_DemoMode0_Sta
 
 void a3starter_loadValidate(a3_DemoState* demoState, a3_DemoMode0_Starter* demoMode)
 {
+	a3ui32 i;
+
 	// initialize callbacks
 	a3_DemoModeCallbacks* const callbacks = demoState->demoModeCallbacks + demoState_modeStarter;
 	callbacks->demoMode = demoMode;
@@ -62,6 +64,28 @@ void a3starter_loadValidate(a3_DemoState* demoState, a3_DemoMode0_Starter* demoM
 	a3demo_setProjectorSceneObject(demoMode->proj_camera_main, demoMode->obj_camera_main);
 
 	// initialize cameras not dependent on viewport
+
+	// demo state may have moved; re-link animation pointers into it
+	for (i = 0; i < demoMode->clipPool->count; i++)
+	{
+		demoMode->clipPool->clip[i].framePool = demoMode->keyframePool;
+		demoMode->clipPool->transition[i * 2].clipPool = demoMode->clipPool;
+		demoMode->clipPool->transition[i * 2 + 1].clipPool = demoMode->clipPool;
+	}
+	for (i = 0; i < starterMaxCount_clipController; i++)
+	{
+		demoMode->clipController[i].clipPool = demoMode->clipPool;
+	}
+	demoMode->hierarchyPoseGroup->hierarchy = demoMode->hierarchy;
+	if (demoMode->characterCtrlSet->data)
+	{
+		for (i = 0; i < starterMaxCount_character; i++)
+		{
+			demoMode->characterState[i].poseGroup = demoMode->hierarchyPoseGroup;
+		}
+		demoMode->characterBindState->poseGroup = demoMode->hierarchyPoseGroup;
+		demoMode->characterCtrlSet->clipPool = demoMode->clipPool;
+	}
 }
 
 
@@ -172,32 +196,84 @@ void a3starter_load(a3_DemoState const* demoState, a3_DemoMode0_Starter* demoMod
 
 	// initialize all the animation things
 
-	// initialize pools of keyframes and clips
-	a3clipPoolCreate(demoMode->clipPool, 5);
-	a3keyframePoolCreate(demoMode->keyframePool, 20);
-
-	const char* PATH = "../../../../resource/animdata/sprite_anim.txt";
-
-	a3clipPoolCreateFromFile(demoMode->clipPool, PATH);
-	// initialize keyframes
-	for (a3ui32 i = 0; i < demoMode->keyframePool->count; i++)
+	// initialize pools of keyframes and clips, and skeletal poses (once; 
+	//	kept across reloads)
+	if (!demoMode->keyframePool->keyframe)
 	{
-		a3keyframeInit(demoMode->keyframePool->keyframe + i, 0.5f, 10 - i);
+		a3_FileStream fileStream[1] = { 0 };
+		const a3byte* const clipFile = "../../../../resource/animdata/sprite_anim.txt";
+		const a3byte* const clipStream = "./data/anim_data_sprite.dat";
+		const a3byte* const skeletonFile = "../../../../resource/animdata/egnaro/egnaro_skel_anim.htr";
+		const a3byte* const skeletonStream = "./data/anim_data_egnaro.dat";
+		a3ui32 i;
+
+		// one keyframe per sprite cell; durations are set by the clips
+		//	each keyframe also keys a translation channel for the teapot
+		a3keyframePoolCreate(demoMode->keyframePool, 64);
+		a3keyframePoolCreatePoses(demoMode->keyframePool, 1);
+		for (i = 0; i < demoMode->keyframePool->count; i++)
+		{
+			a3keyframeInit(demoMode->keyframePool->keyframe + i, 1.0f, i);
+			a3spatialPoseSetTranslation(demoMode->keyframePool->keyframe[i].pose, (a3real)i, a3real_zero, a3real_zero);
+		}
+
+		// attempt to load compiled clips if requested
+		if (demoState->streaming && a3fileStreamOpenRead(fileStream, clipStream))
+		{
+			a3clipPoolLoadBinary(demoMode->clipPool, demoMode->keyframePool, fileStream);
+			a3fileStreamClose(fileStream);
+		}
+		// not streaming or stream doesn't exist
+		if (!demoMode->clipPool->clip)
+		{
+			a3clipPoolCreateFromFile(demoMode->clipPool, demoMode->keyframePool, clipFile);
+			if (demoState->streaming && demoMode->clipPool->clip && a3fileStreamOpenWrite(fileStream, clipStream))
+			{
+				a3clipPoolSaveBinary(demoMode->clipPool, fileStream);
+				a3fileStreamClose(fileStream);
+			}
+		}
+
+		// attempt to load skeleton snapshot if requested
+		if (demoState->streaming && a3fileStreamOpenRead(fileStream, skeletonStream))
+		{
+			a3hierarchyLoadBinary(demoMode->hierarchy, fileStream);
+			a3hierarchyPoseGroupLoadBinary(demoMode->hierarchyPoseGroup, demoMode->hierarchy, fileStream);
+			a3fileStreamClose(fileStream);
+		}
+		// not streaming or snapshot doesn't exist
+		if (!demoMode->hierarchyPoseGroup->hpose)
+		{
+			a3hierarchyRelease(demoMode->hierarchy);
+			a3hierarchyPoseGroupLoadHTR(demoMode->hierarchyPoseGroup, demoMode->hierarchy, skeletonFile);
+			if (demoState->streaming && demoMode->hierarchyPoseGroup->hpose && a3fileStreamOpenWrite(fileStream, skeletonStream))
+			{
+				a3hierarchySaveBinary(demoMode->hierarchy, fileStream);
+				a3hierarchyPoseGroupSaveBinary(demoMode->hierarchyPoseGroup, fileStream);
+				a3fileStreamClose(fileStream);
+			}
+		}
 	}
 
-	a3clipTransitionInit(demoMode->clipTransition + 0, demoMode->clipPool, 1, 0, -1);
-	a3clipTransitionInit(demoMode->clipTransition + 1, demoMode->clipPool, 1, 0, 1);
-
-	a3clipInit(demoMode->clipPool->clip + 0, "0 -> 19", demoMode->keyframePool, 0, 19, demoMode->clipTransition + 0, demoMode->clipTransition + 1);
-	a3clipInit(demoMode->clipPool->clip + 1, "0 -> 10", demoMode->keyframePool, 0, 10, demoMode->clipTransition + 0, demoMode->clipTransition + 1);
-	a3clipInit(demoMode->clipPool->clip + 2, "3 -> 5", demoMode->keyframePool, 3, 5, demoMode->clipTransition + 0, demoMode->clipTransition + 1);
-	a3clipInit(demoMode->clipPool->clip + 3, "5 -> 15", demoMode->keyframePool, 5, 15, demoMode->clipTransition + 0, demoMode->clipTransition + 1);
-	a3clipInit(demoMode->clipPool->clip + 4, "12 -> 16", demoMode->keyframePool, 12, 16, demoMode->clipTransition + 0, demoMode->clipTransition + 1);
-
 	// initialize clip controllers
 	a3clipControllerInit(demoMode->clipController + 0, "Controller 1", demoMode->clipPool, 1, 0, 0);
 	a3clipControllerInit(demoMode->clipController + 1, "Controller 2", demoMode->clipPool, 1, 0, 1);
-	a3clipControllerInit(demoMode->clipController + 2, "Controller 3", demoMode->clipPool, 1, 0, -1);
+	a3clipControllerInit(demoMode->clipController + 2, "Controller 3", demoMode->clipPool, 1, a3clip_timeEnd, -1);
+
+	// characters for the pose pipeline, spread over the clips; the bind 
+	//	pose is the skeleton's base pose
+	if (demoMode->hierarchyPoseGroup->hpose && demoMode->clipPool->count && 
+		a3clipControllerSetCreate(demoMode->characterCtrlSet, demoMode->clipPool, starterMaxCount_character) >= 0)
+	{
+		for (i = 0; i < starterMaxCount_character; i++)
+		{
+			a3hierarchyStateCreate(demoMode->characterState + i, demoMode->hierarchyPoseGroup);
+			a3clipControllerSetInit(demoMode->characterCtrlSet, i, i % demoMode->clipPool->count, 0.0f, +1.0f);
+		}
+		a3hierarchyStateCreate(demoMode->characterBindState, demoMode->hierarchyPoseGroup);
+		a3kinematicsSolveForward(demoMode->characterBindState);
+		a3hierarchyStateUpdateObjectInverse(demoMode->characterBindState, a3true);
+	}
 }
 
 
@@ -41,8 +41,28 @@ void a3starter_unloadValidate(a3_DemoState* demoState, a3_DemoMode0_Starter* dem
 }
 
 
+// stop the job system before the library goes away, even for a hotbuild; 
+//	the next update starts it again
+void a3starter_unloadJobs(a3_DemoState const* demoState, a3_DemoMode0_Starter* demoMode)
+{
+	a3posePipelineRelease(demoMode->characterPipeline);
+	a3jobSystemRelease(demoMode->jobSystem);
+}
+
+
 void a3starter_unload(a3_DemoState const* demoState, a3_DemoMode0_Starter* demoMode)
 {
+	a3ui32 i;
+
+	a3starter_unloadJobs(demoState, demoMode);
+	for (i = 0; i < starterMaxCount_character; i++)
+	{
+		a3hierarchyStateRelease(demoMode->characterState + i);
+	}
+	a3hierarchyStateRelease(demoMode->characterBindState);
+	a3clipControllerSetRelease(demoMode->characterCtrlSet);
+	a3hierarchyPoseGroupRelease(demoMode->hierarchyPoseGroup);
+	a3hierarchyRelease(demoMode->hierarchy);
 	a3clipPoolRelease(demoMode->clipPool);
 	a3keyframePoolRelease(demoMode->keyframePool);
 }